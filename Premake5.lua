@@ -188,10 +188,15 @@ for k, v in pairs(modules) do
 end
 
 
+-- Tools that are run as part of the build (ex: the texture cooker)
+group("Tools")
+include "tools/TextureCooker"
+
 -- This function will create projects for all the paths in a table, and set the group name to the given value
--- @param groupName The name to group the projects under in the workspace
--- @param folders   The table of folders that contain the projects to add
-function AddProjects(groupName, folders)
+-- @param groupName    The name to group the projects under in the workspace
+-- @param folders      The table of folders that contain the projects to add
+-- @param cookTextures True if the projects should cook their textures with the TextureCooker before building
+function AddProjects(groupName, folders, cookTextures)
 
 	premake.info("Building Group: " .. groupName)
 	group(groupName)
@@ -248,6 +253,16 @@ function AddProjects(groupName, folders)
 		  		"(xcopy /Q /E /Y /I /C \"%{resdir}\" \"%{absdir}\")"
 			} 
 
+			if cookTextures then
+				-- Make sure the cooker is built first
+				dependson { "TextureCooker" }
+				-- Cooks the images in the resource folder into compressed DDS files in the output directory
+				-- (the cooker skips anything that is already up to date, so this is cheap after the first build)
+				prebuildcommands {
+					"(\"%{wks.location}bin\\%{outputdir}\\TextureCooker\\TextureCooker.exe\" \"%{resdir}\" \"%{absdir}\")"
+				}
+			end
+
 			-- Our source files are everything in the src folder
 			files {
 				"%{prj.location}\\src\\**.h",
@@ -294,4 +309,4 @@ end
 
 -- Add the User Projects and Sample Projects
 AddProjects("Projects", projects)
-AddProjects("Samples", samples)
\ No newline at end of file
+AddProjects("Samples", samples, true)
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/*
+ * Packs a set of RGBA8 images into square pages. This only works out where everything goes and copies the
+ * pixels into the pages, so that the same packing can be used at runtime (see TTK::TextureAtlas) and offline
+ * (see the texture cooker's --atlas mode)
+ *
+ * Each image is surrounded by a border of padding, which is filled by stretching the image's edge pixels out.
+ * This stops filtering from bleeding neighbouring images into each other
+ */
+class AtlasPacker {
+public:
+	// Where a single image ended up
+	struct Placement {
+		// The page the image is in, or -1 if it could not be packed
+		int Page;
+		// The top left corner of the image in the page, in pixels (not including padding)
+		int X, Y;
+		int Width, Height;
+	};
+
+	/*
+	 * Creates a new empty packer
+	 * @param pageSize The width and height of each page, in pixels
+	 * @param padding  The number of pixels to leave around each image
+	 */
+	AtlasPacker(int pageSize = 2048, int padding = 2);
+
+	/*
+	 * Adds an image to be packed, the pixels are copied so the caller can free them straight away
+	 * @param rgba   The image's pixels, in RGBA8 with no padding between rows
+	 * @param width  The width of the image, in pixels
+	 * @param height The height of the image, in pixels
+	 * @returns The index of the image in GetPlacements, or -1 if the image is empty (it's width or height is 0 or less)
+	 */
+	int Add(const uint8_t* rgba, int width, int height);
+
+	/*
+	 * Packs all of the images that were added since the last call into new pages. Pages that were already
+	 * packed are left alone, so their placements stay valid
+	 * @returns The number of images that could not be packed, because they are bigger than a page
+	 */
+	int Pack();
+
+	int GetPageSize() const { return myPageSize; }
+	int GetPadding() const { return myPadding; }
+	int GetPageCount() const { return (int)myPages.size(); }
+
+	// Gets where each image was placed, in the order they were added
+	const std::vector<Placement>& GetPlacements() const { return myPlacements; }
+	// Gets the RGBA8 pixels of a page, this is empty if ReleasePages has been called
+	const std::vector<uint8_t>& GetPagePixels(int page) const { return myPages[page]; }
+	// Frees the pixels of all of our pages, once they have been uploaded or written out
+	void ReleasePages();
+
+private:
+	int myPageSize;
+	int myPadding;
+
+	std::vector<Placement>            myPlacements;
+	std::vector<std::vector<uint8_t>> myPages;
+	// The pixels of the images that have not been packed yet, indexed the same as myPlacements
+	std::vector<std::vector<uint8_t>> myPending;
+
+	// Copies an image (and it's stretched out edges) into it's spot in a page
+	void __Blit(const Placement& placement, const uint8_t* rgba);
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * A simple bump allocator. Allocations are just an atomic add on an offset, so it's safe to allocate from
+ * multiple threads. Nothing is freed until the whole arena is reset. If we run out of room, we fall back to
+ * the heap for the rest of the frame, and grow the arena at the next reset so we stop overflowing
+ */
+class LinearArena {
+public:
+	/*
+	 * Creates a new arena with the given capacity
+	 * @param capacity The initial size of the arena, in bytes
+	 */
+	LinearArena(size_t capacity);
+	~LinearArena();
+
+	LinearArena(const LinearArena& other) = delete;
+	LinearArena& operator =(const LinearArena& other) = delete;
+
+	/*
+	 * Allocates a block from the arena, this will never return null
+	 * @param size  The size of the block, in bytes
+	 * @param align The alignment of the block, must be a power of 2
+	 */
+	void* Allocate(size_t size, size_t align = alignof(std::max_align_t));
+
+	// Releases everything that was allocated from the arena (and grows it if we overflowed since the last reset)
+	void Reset();
+
+	// Gets the number of bytes that have been allocated since the last reset
+	size_t GetUsed() const { return myOffset.load(std::memory_order_relaxed); }
+	// Gets the size of the arena's backing memory
+	size_t GetCapacity() const { return myCapacity; }
+	// Gets the most bytes that were ever used between resets
+	size_t GetHighWater() const { return myHighWater; }
+	// Gets the number of times we've had to grow the arena
+	size_t GetGrowCount() const { return myGrowCount; }
+
+private:
+	uint8_t*            myMemory;
+	size_t              myCapacity;
+	std::atomic<size_t> myOffset;
+	size_t              myHighWater;
+	size_t              myGrowCount;
+
+	// Blocks that we had to get from the heap because the arena was full
+	std::mutex          myOverflowLock;
+	std::vector<void*>  myOverflow;
+};
+
+/*
+ * A pair of arenas for data that only needs to live for a frame. Each frame allocates from the current
+ * arena, while the previous frame's arena stays valid so async work (ex: a worker or the GPU upload of
+ * last frame's data) can still read from it. NextFrame should be called once per frame
+ */
+class FrameArena {
+public:
+	// The initial size of each of our arenas
+	static const size_t DefaultCapacity = 1024 * 1024;
+
+	// Gets the arena for the current frame
+	static LinearArena& Current();
+	// Gets the arena from the previous frame, which is still valid until the next call to NextFrame
+	static LinearArena& Previous();
+
+	/*
+	 * Swaps our arenas and resets the one we will be using for the new frame. Anything allocated two
+	 * frames ago is no longer valid after this call
+	 */
+	static void NextFrame();
+
+	/*
+	 * Allocates memory from the current frame's arena
+	 * @param size  The size of the block, in bytes
+	 * @param align The alignment of the block, must be a power of 2
+	 */
+	static void* Allocate(size_t size, size_t align = alignof(std::max_align_t)) { return Current().Allocate(size, align); }
+
+private:
+	static LinearArena& __Arena(int index);
+	static int myCurrent;
+};
+
+/*
+ * An STL allocator that allocates from the current frame's arena. Deallocation is a no-op, so containers
+ * using this should reserve up front, and must not be kept around for longer than a frame
+ */
+template <typename T>
+class FrameAllocator {
+public:
+	typedef T value_type;
+
+	FrameAllocator() noexcept = default;
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>&) noexcept { }
+
+	T* allocate(size_t count) {
+		return static_cast<T*>(FrameArena::Allocate(count * sizeof(T), alignof(T)));
+	}
+	void deallocate(T*, size_t) noexcept { }
+
+	template <typename U>
+	bool operator ==(const FrameAllocator<U>&) const noexcept { return true; }
+	template <typename U>
+	bool operator !=(const FrameAllocator<U>&) const noexcept { return false; }
+};
+
+// Containers that live in the frame arena
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
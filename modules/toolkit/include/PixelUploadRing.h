@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <glad/glad.h>
+
+/*
+ * A ring of persistently mapped pixel buffer memory for uploading textures. Pixels are copied into the ring
+ * (which can be done from any thread, since the memory is just a pointer), and the upload is sourced from
+ * the buffer, so the driver can copy it to the texture whenever it likes instead of stalling on our memory.
+ *
+ * Uploads are fenced when Submit is called (or when the ring wraps around), and space is only re-used once
+ * the GPU has passed the fence for it. If we wrap around onto uploads the GPU hasn't finished with yet we
+ * have to wait for them, which shows up in GetStallCount. All of the GL calls must be made on the GL thread.
+ */
+class PixelUploadRing {
+public:
+	// The default size of the ring, in bytes
+	static const size_t DefaultCapacity = 32 * 1024 * 1024;
+
+	// A block of the ring that pixels can be written into
+	struct Allocation {
+		// Where to write the pixels, this is valid from any thread until the allocation has been uploaded
+		uint8_t* Data   = nullptr;
+		// Where the block is within the buffer, in bytes
+		size_t   Offset = 0;
+		size_t   Size   = 0;
+
+		bool IsValid() const { return Data != nullptr; }
+	};
+
+	/*
+	 * Creates and maps the ring's buffer, must be called on the GL thread
+	 * @param capacity The size of the ring, in bytes
+	 */
+	PixelUploadRing(size_t capacity = DefaultCapacity);
+	~PixelUploadRing();
+
+	PixelUploadRing(const PixelUploadRing& other) = delete;
+	PixelUploadRing& operator =(const PixelUploadRing& other) = delete;
+
+	/*
+	 * Reserves a block of the ring, waiting for the GPU if it is still reading from that part of the ring
+	 * @param size  The size of the block, in bytes
+	 * @param align The alignment of the block within the buffer, must be a power of 2
+	 * @returns The block, or an invalid allocation if the size is bigger than the whole ring
+	 */
+	Allocation Allocate(size_t size, size_t align = 16);
+
+	/*
+	 * Uploads the pixels in an allocation to a region of a 2D texture (the allocation must be fully written first)
+	 * @param texture The GL handle of the texture
+	 * @param level   The mip level to upload to
+	 * @param format  The format of the pixel data (ex: GL_RGBA)
+	 * @param type    The type of each component in the pixel data (ex: GL_UNSIGNED_BYTE)
+	 * @param source  The block holding the pixels
+	 */
+	void Upload2D(GLuint texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const Allocation& source);
+	// Uploads the pixels in an allocation to a region of a cubemap, array or 3D texture (z is the face for cubemaps)
+	void Upload3D(GLuint texture, int level, int x, int y, int z, int width, int height, int depth, GLenum format, GLenum type, const Allocation& source);
+
+	/*
+	 * Copies pixels into the ring and uploads them to a 2D texture. If the pixels don't fit in the ring, we
+	 * fall back to uploading them straight from client memory
+	 * @param pixels The pixel data, laid out according to the current GL_UNPACK_ALIGNMENT
+	 */
+	void Upload2D(GLuint texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels);
+	// Copies pixels into the ring and uploads them to a region of a cubemap, array or 3D texture
+	void Upload3D(GLuint texture, int level, int x, int y, int z, int width, int height, int depth, GLenum format, GLenum type, const void* pixels);
+
+	// Fences all of the uploads since the last submit, so we know when their space can be re-used. Call this once per frame
+	void Submit();
+
+	// Gets the size of the ring, in bytes
+	size_t GetCapacity() const { return myCapacity; }
+	// Gets the total number of bytes that have been uploaded through the ring
+	size_t GetBytesUploaded() const { return myBytesUploaded; }
+	// Gets the number of times we had to wait for the GPU before we could re-use part of the ring
+	size_t GetStallCount() const { return myStallCount; }
+
+	/*
+	 * Gets the number of bytes that glTexSubImage will read for a block of pixels, using the current GL_UNPACK_ALIGNMENT
+	 * @param format The format of the pixel data (ex: GL_RGBA)
+	 * @param type   The type of each component in the pixel data (ex: GL_UNSIGNED_BYTE)
+	 */
+	static size_t GetPixelDataSize(int width, int height, int depth, GLenum format, GLenum type);
+
+	// Gets a ring that is shared by the whole program, created on first use (so there must be a GL context by then)
+	static PixelUploadRing& Global();
+
+private:
+	// A range of the ring that the GPU may still be reading from
+	struct Fence {
+		GLsync Sync;
+		size_t Begin;
+		size_t End;
+	};
+
+	GLuint            myBuffer;
+	uint8_t*          myData;
+	size_t            myCapacity;
+	// Where the next allocation goes, and where the uploads that haven't been fenced yet start
+	size_t            myHead;
+	size_t            mySegmentStart;
+	std::deque<Fence> myFences;
+	size_t            myBytesUploaded;
+	size_t            myStallCount;
+
+	void __WaitForRange(size_t begin, size_t end);
+};
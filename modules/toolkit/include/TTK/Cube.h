@@ -1,44 +1,28 @@
 #pragma once
+#include <cstdint>
+
 /*
- * This is a cube, defined in the worst possible format ever.
- * This is literally just every single position and normal in the model, written out in a float
- * array. Do not do this. This is really dumb. Just don't. Please.
+ * This is a unit cube, centered on the origin, as an indexed triangle list
  */
-const float CubeData[] = {
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
-};
\ No newline at end of file
+const float CubePositions[] = {
+	-0.5f, -0.5f, -0.5f,
+	 0.5f, -0.5f, -0.5f,
+	 0.5f,  0.5f, -0.5f,
+	-0.5f,  0.5f, -0.5f,
+	-0.5f, -0.5f,  0.5f,
+	 0.5f, -0.5f,  0.5f,
+	 0.5f,  0.5f,  0.5f,
+	-0.5f,  0.5f,  0.5f
+};
+
+const uint16_t CubeIndices[] = {
+	// -Z, +Z
+	0, 2, 1,  0, 3, 2,
+	4, 5, 6,  4, 6, 7,
+	// -X, +X
+	0, 4, 7,  0, 7, 3,
+	1, 2, 6,  1, 6, 5,
+	// -Y, +Y
+	0, 1, 5,  0, 5, 4,
+	3, 7, 6,  3, 6, 2
+};
@@ -13,9 +13,13 @@
 //////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <string>
+#include <vector>
+#include <unordered_map>
 #include "GLM/glm.hpp"
 #include "glad/glad.h"
 #include "stb_truetype.h"
+#include "StreamBuffer.h"
 
 namespace  TTK
 {
@@ -39,38 +43,93 @@ namespace  TTK
 	};
 	*/
 
+	/*
+	 * How a font's glyphs are stored in it's atlas
+	 */
+	enum class FontMode {
+		// Each glyph is a coverage mask, this is the sharpest at the font's size but gets blurry when scaled up
+		Bitmap        = 0,
+		// Each glyph stores the distance to it's edge, so it stays crisp at any scale
+		DistanceField = 1
+	};
+
 	struct Col8 {
 		char R, G, B, A;
 	};
 
+	/*
+	 * Decodes a single code point from a UTF-8 string, invalid sequences decode to U+FFFD
+	 * @param text The string to decode from, this is moved past the code point
+	 * @returns The code point, or 0 at the end of the string
+	 */
+	uint32_t DecodeUtf8(const char*& text);
+
 	class FontRenderer;
 	
+	/*
+	 * A TrueType font, whose glyphs are rasterized into an atlas the first time they are used. The atlas grows
+	 * as more glyphs are needed, so any code point in the font can be drawn
+	 */
 	class TrueTypeTextureFont {
 	public:
-		TrueTypeTextureFont(const char* fileName, uint32_t size);
+		/*
+		 * Loads a font, and rasterizes it's printable ASCII glyphs up front
+		 * @param fileName The path to the .ttf file to load
+		 * @param size     The pixel height to rasterize the glyphs at
+		 * @param mode     How to store the glyphs, distance fields can be scaled without getting blurry
+		 */
+		TrueTypeTextureFont(const char* fileName, uint32_t size, FontMode mode = FontMode::Bitmap);
 		~TrueTypeTextureFont();
 		
-		GlyphInfo GetGlyph(int codePoint, float offsetX, float offsetY) const;
+		/*
+		 * Gets the quad for a glyph, rasterizing it if this is the first time it has been used
+		 * @param codePoint The unicode code point to get the glyph for
+		 * @param offsetX   The x position of the pen
+		 * @param offsetY   The y position of the pen (the baseline)
+		 * @returns The glyph's quad, with UVs in texels, and the pen position after the glyph
+		 */
+		GlyphInfo GetGlyph(uint32_t codePoint, float offsetX, float offsetY);
 		float  GetKerning(int char1, int char2) const;
 		float  GetLineHeight() const;
 
 		virtual glm::vec2 MeausureString(const char* text, const float scale = 1.0f);
 
 		virtual GLint GetTexture() const { return myTexture; }
+		FontMode GetMode() const { return myMode; }
+		// Checks whether the font file was loaded, an invalid font draws nothing
+		bool IsValid() const { return myFontData != nullptr; }
+
+		// Gets the number of glyphs in our atlas
+		size_t GetGlyphCount() const { return myGlyphs.size(); }
+		glm::ivec2 GetAtlasSize() const { return glm::ivec2(ATLAS_WIDTH, myAtlasHeight); }
 
 	protected:
 		friend class FontRenderer;
 		GLuint   myTexture;
 		GLuint64 m_TexHandle;
 
-		const uint32_t ATLAS_WIDTH = 1024;
-		const uint32_t ATLAS_HEIGHT = 1024;
-		const uint32_t FONT_OVERSAMPLE_X = 2;
-		const uint32_t FONT_OVERSAMPLE_Y = 2;
+		const int      ATLAS_WIDTH = 1024;
+		const int      INITIAL_ATLAS_HEIGHT = 256;
+		const int      MAX_ATLAS_HEIGHT = 4096;
 		const uint32_t FIRST_CHAR = ' ';
-		const uint32_t CHAR_COUNT = '~' - ' ';
+		const uint32_t CHAR_COUNT = '~' - ' ' + 1;
+		// How far outside of a glyph's outline our distance fields reach, in pixels
+		const int      SDF_PADDING = 4;
 
-		stbtt_packedchar* myCharInfo;
+		// Where a glyph is in our atlas, and how to place it relative to the pen, in pixels
+		struct Glyph {
+			glm::ivec2 AtlasPos;
+			glm::ivec2 Size;
+			glm::ivec2 Offset;
+			float      Advance;
+		};
+		// A glyph's pixels before they are packed into the atlas
+		struct GlyphBitmap {
+			unsigned char* Data;
+			int Width, Height, OffsetX, OffsetY;
+		};
+
+		unsigned char*    myFontData;
 		uint32_t          myFontSize;
 		stbtt_fontinfo    myFontInfo;
 		float             myPixelHeightScale;
@@ -78,8 +137,30 @@ namespace  TTK
 		int               myAscent,
 						  myDescent,
 						  myLineGap;
+		FontMode          myMode;
+
+		std::vector<Glyph> myGlyphs;
+		// Maps code points to indices in myGlyphs, split into pages of 256 code points that are only made when used
+		std::vector<std::vector<int32_t>> myGlyphPages;
+		// The top of the packed area across the atlas, as runs of (x, y, width)
+		std::vector<glm::ivec3> mySkyline;
+		int               myAtlasHeight;
+
+		// Gets the index of a glyph, rasterizing it if needed
+		int32_t __GetGlyphIndex(uint32_t codePoint);
+		// Renders a glyph's coverage or distance field, this only reads from the font so it can run on any thread
+		GlyphBitmap __Rasterize(uint32_t codePoint) const;
+		// Packs a rasterized glyph into the atlas and remembers where it went
+		int32_t __AddGlyph(uint32_t codePoint, const GlyphBitmap& bitmap);
+		// Finds a space in the atlas using the skyline packer, growing the atlas if we run out of room
+		bool __Pack(int width, int height, glm::ivec2& result);
+		void __CreateAtlas(int height);
 	};
 	
+	/*
+	 * Batches up all the text drawn in a frame, and draws it all at once when the TTK context is flushed. The quads
+	 * for each string are cached, so text that doesn't change from frame to frame only needs to be copied
+	 */
 	class FontRenderer {
 	public:
 		static FontRenderer& Instance() {
@@ -91,6 +172,8 @@ namespace  TTK
 			delete m_Instance;
 			m_Instance = nullptr;
 		}
+		// Checks whether the renderer has been made yet, so that we can flush without creating it
+		static bool IsCreated() { return m_Instance != nullptr; }
 
 	private:
 		static FontRenderer* m_Instance;
@@ -104,14 +187,64 @@ namespace  TTK
 	public:
 		~FontRenderer();
 
-		void Render(const TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale = 1.0f);
+		/*
+		 * Adds some text to this frame's batch
+		 * @param font  The font to draw the text with
+		 * @param text  The text to draw
+		 * @param pos   The position of the text, in screen coordinates
+		 * @param color The color of the text
+		 * @param scale The scale to apply to the font's size
+		 */
+		void Render(TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale = 1.0f);
+
+		// Draws all of the text that has been added since the last flush
+		void Flush();
+		// Moves on to the next frame, and forgets any cached strings that haven't been drawn in a while
+		void EndFrame();
+
+		// Gets the number of strings that we currently have cached quads for
+		size_t GetCachedRunCount() const { return m_RunCache.size(); }
 		
 	private:
 		FontRenderer();
+
+		// The quads for a string, relative to where it is drawn. The color is filled in when the run is drawn
+		struct GlyphRun {
+			std::vector<Vert> Verts;
+			uint64_t          LastUsedFrame;
+		};
+		struct RunKey {
+			std::string                Text;
+			const TrueTypeTextureFont* Font;
+			float                      Scale;
+			bool operator ==(const RunKey& other) const { return Font == other.Font && Scale == other.Scale && Text == other.Text; }
+		};
+		struct RunKeyHash {
+			size_t operator()(const RunKey& key) const;
+		};
+		// A range of quads that all use the same font, relative to the start of the pending data in our stream
+		struct Batch {
+			// The font's texture can change when it's atlas grows, so we grab it when we flush
+			const TrueTypeTextureFont* Font;
+			size_t   FirstQuad;
+			size_t   QuadCount;
+		};
+
+		// How many frames a string can go without being drawn before we forget it's quads
+		static const uint64_t RunCacheLifetime = 120;
+		static const size_t InitialQuads = 1024;
 				
 		GLuint   m_ShaderHandle;
-		GLuint   m_VAO, m_VBO, m_EBO;
-		Vert     m_MeshData[256 * 4];
-		GLuint   m_IndexData[256 * 6];
+		GLuint   m_VAO, m_EBO;
+		size_t   m_IndexCapacity;
+		StreamBuffer* m_Verts;
+		std::vector<Batch> m_Batches;
+		std::unordered_map<RunKey, GlyphRun, RunKeyHash> m_RunCache;
+		uint64_t m_Frame;
+
+		// Builds the quads for a string, with it's origin at 0,0
+		void __BuildRun(TrueTypeTextureFont& font, const char* text, float scale, std::vector<Vert>& verts) const;
+		// Makes sure that our index buffer can draw the given number of quads
+		void __ReserveIndices(size_t quads);
 	};
 }
\ No newline at end of file
@@ -27,6 +27,19 @@ namespace TTK
 		ZUp = 0,
 		YUp = 1
 	};
+
+	/*
+	 * The layers that TTK's lines, triangles and points can be drawn in. Each layer has it's own depth state,
+	 * see TTK::Context::LayerSettings
+	 */
+	enum class DebugLayer {
+		// Drawn in the world, and hidden behind anything in front of it
+		World   = 0,
+		// Drawn in the world, but on top of everything
+		Overlay = 1,
+		// Drawn on top of everything, in screen coordinates (pixels from the top left)
+		Screen  = 2
+	};
 	
 	class Graphics
 	{
@@ -48,6 +61,12 @@ namespace TTK
 		 * @param fontSize The size of the text to draw, default is 16
 		 */
 		static void DrawText2D(const std::string& text, float posX, float posY, const glm::vec4& color, float fontSize = 16);
+		/*
+		 * Sets the font that TTK uses for drawing text, this must be called before anything else in TTK to have any
+		 * effect. By default this is Consolas on Windows, and DejaVu Sans Mono elsewhere
+		 * @param path The path to the .ttf file to load
+		 */
+		static void SetDefaultFont(const std::string& path);
 
 		/*
 		 * Initializes ImGUI, using the given window
@@ -206,6 +225,19 @@ namespace TTK
 		 */
 		static void SetDepthEnabled(bool isEnabled = true);
 
+		/*
+		 * Sets the layer that any lines, points and vectors drawn after this will go into
+		 * @param layer The layer to draw into (default is the world layer)
+		 */
+		static void SetDebugLayer(DebugLayer layer = DebugLayer::World);
+
+		/*
+		 * Sets how long any lines, points and vectors drawn after this will stay on the screen. Anything with a
+		 * duration only needs to be drawn once, instead of every frame
+		 * @param seconds How long to keep drawing the primitives, 0 to only draw them for this frame
+		 */
+		static void SetDebugDuration(float seconds = 0.0f);
+
 		/*
 		 * Sets the view matrix for TTK to use when rendering, to not use a camera, call this with either no parameters,
 		 * or the identity matrix
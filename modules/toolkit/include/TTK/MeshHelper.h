@@ -4,8 +4,8 @@
 // You may not use this header in your GDW games.
 //
 // This header contains a helper class for drawing the primitive types that
-// were originally supported by GLUT. This file was purposefully built to
-// be non-optimal
+// were originally supported by GLUT. Shapes are batched by type and drawn
+// with instancing when the context is flushed
 //
 // Based off of TTK by Michael Gharbharan 2017
 // Shawn Matthews 2019
@@ -13,29 +13,58 @@
 //////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <vector>
+#include <cstdint>
 #include "TTKContext.h"
 
 namespace TTK {
 	namespace Impl {
+		/*
+		 * Draws the shapes as instances, each call to Render* only queues the shape's transform and color, and
+		 * Flush draws all the instances of a shape with a single draw call
+		 */
 		class MeshHelper {			
 		public:
 			~MeshHelper();
 			MeshHelper();
-			void RenderTeapot(const glm::mat4& transform, const glm::vec4& color) const;
-			void RenderSphere(const glm::mat4& transform, const glm::vec4& color) const;
-			void RenderCube(const glm::mat4& transform, const glm::vec4& color) const;
+			void RenderTeapot(const glm::mat4& transform, const glm::vec4& color);
+			void RenderSphere(const glm::mat4& transform, const glm::vec4& color);
+			void RenderCube(const glm::mat4& transform, const glm::vec4& color);
+
+			// Draws all the shapes that have been queued since the last flush
+			void Flush(const glm::mat4& viewProjection);
+			// Moves our instance buffers on to the next frame
+			void EndFrame();
 			
 		private:
+			struct Instance {
+				glm::mat4 Transform;
+				glm::vec4 Color;
+			};
 			struct mesh {
-				GLuint VAO;
-				GLuint VBO;
+				GLuint        VAO;
+				GLuint        VBO;
+				GLuint        IBO;
+				GLsizei       IndexCount;
+				StreamBuffer* Instances;
 			};
-			mesh __MakeMesh(const float* data, size_t size) const;
+			mesh __MakeMesh(const glm::vec3* positions, size_t vertexCount, const uint16_t* indices, size_t indexCount, const char* name) const;
+			/*
+			 * Generates a unit sphere by repeatedly splitting the faces of an icosahedron, sharing the vertices
+			 * between neighbouring triangles
+			 * @param subdivisions The number of times to split each triangle into 4
+			 */
+			static void __MakeIcosphere(int subdivisions, std::vector<glm::vec3>& positions, std::vector<uint16_t>& indices);
+			void __AddInstance(mesh& mesh, const glm::mat4& transform, const glm::vec4& color);
+			void __Flush(mesh& mesh);
 			
 			mesh m_Teapot;
 			mesh m_Sphere;
 			mesh m_Cube;
 			GLuint m_Shader;
+
+			// How many instances of each shape we start with room for per frame
+			static const size_t InitialInstances = 256;
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a data oriented animation system for large
+// numbers of animated sprites. Where SpriteSheetQuad animates one
+// object at a time, this keeps the state of every sprite in flat arrays
+// and advances all of them in a single pass
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include "TextureAtlas.h"
+
+namespace TTK
+{
+	/*
+	 * Stores animated sprites as components, with each part of their state in it's own array (ex: all of the
+	 * times are together, all of the frames are together). Update advances every sprite with the same branch
+	 * free loop, so the compiler can vectorize it, and Draw feeds them all to the TTK::SpriteBatch
+	 *
+	 * Animations are described by clips, which are shared between sprites. Unlike SpriteSheetQuad, every frame
+	 * in a clip lasts the same amount of time, so that a sprite's frame can be worked out from it's time alone
+	 */
+	class SpriteAnimator {
+	public:
+		// Identifies a sprite, this stays the same even when other sprites are destroyed
+		typedef uint32_t Handle;
+		static const Handle InvalidHandle = 0xFFFFFFFF;
+
+		SpriteAnimator();
+
+		/*
+		 * Adds an animation clip from a list of frames
+		 * @param texture   The texture that the frames are in, this must outlive the animator
+		 * @param frameUVs  The UV rectangle of each frame, as (uMin, vMin, uMax, vMax)
+		 * @param frameRate The number of frames to show per second
+		 * @param loop      True if the animation should loop, false if it should stop on it's last frame
+		 * @returns The index of the new clip
+		 */
+		int AddClip(GLuint texture, const std::vector<glm::vec4>& frameUVs, float frameRate, bool loop = true);
+		/*
+		 * Adds an animation clip by slicing up a sprite sheet in a texture atlas, in the same way that
+		 * SpriteSheetQuad::SliceSpriteSheet does
+		 * @param atlas            The atlas that the sheet is in, this must be built, and must outlive the animator
+		 * @param region           The index of the sheet's region in the atlas
+		 * @param numSpritesPerRow The number of sprites in a single row
+		 * @param numRows          The number of rows that make up the sheet
+		 * @param animTime         The time it should take to complete one full cycle of the animation, if this is 0, then the sprite will default to 60 FPS
+		 * @param loop             True if the animation should loop, false if it should stop on it's last frame
+		 * @returns The index of the new clip
+		 */
+		int AddClip(const TextureAtlas& atlas, int region, int numSpritesPerRow, int numRows, float animTime = 0.0f, bool loop = true);
+
+		/*
+		 * Creates a new sprite, playing the given clip from the start
+		 * @param clip      The index of the clip to play
+		 * @param transform The matrix to transform the sprite directly into clip space with
+		 * @param color     The color to multiply the sprite by
+		 * @returns The handle to the new sprite
+		 */
+		Handle Create(int clip, const glm::mat4& transform = glm::mat4(1.0f), const glm::vec4& color = glm::vec4(1.0f));
+		/*
+		 * Destroys a sprite, it's handle may be given to a new sprite after this
+		 * @param sprite The handle of the sprite to destroy
+		 */
+		void Destroy(Handle sprite);
+		// Destroys all of our sprites, but keeps our clips
+		void Clear();
+
+		/*
+		 * Switches a sprite to a different clip
+		 * @param sprite  The handle of the sprite
+		 * @param clip    The index of the clip to play
+		 * @param restart True to start the clip from the beginning, false to keep the sprite's current time
+		 */
+		void Play(Handle sprite, int clip, bool restart = true);
+		/*
+		 * Sets how fast a sprite plays it's animation, relative to it's clip's frame rate
+		 * @param sprite The handle of the sprite
+		 * @param speed  The speed multiplier, 0 to pause and negative to play backwards
+		 */
+		void SetSpeed(Handle sprite, float speed);
+		/*
+		 * Sets how far into it's clip a sprite is
+		 * @param sprite The handle of the sprite
+		 * @param time   The time into the clip, in seconds
+		 */
+		void SetTime(Handle sprite, float time);
+		void SetTransform(Handle sprite, const glm::mat4& transform);
+		void SetColor(Handle sprite, const glm::vec4& color);
+
+		// Gets the index of the frame that a sprite is on, within it's clip
+		int GetFrame(Handle sprite) const;
+		// Gets whether a sprite that does not loop has reached the end of it's clip (or the start, if it's playing backwards)
+		bool IsFinished(Handle sprite) const;
+
+		/*
+		 * Advances the animations of all of our sprites
+		 * @param deltaTime The time since the last update, in seconds
+		 */
+		void Update(float deltaTime);
+		/*
+		 * Adds all of our sprites to the sprite batch, they will be drawn when TTK is flushed
+		 */
+		void Draw() const;
+
+		// Gets the number of sprites that are alive
+		size_t GetCount() const { return m_Times.size(); }
+		int GetClipCount() const { return (int)m_Clips.size(); }
+
+	private:
+		struct Clip {
+			GLuint   Texture;
+			uint32_t FirstFrame;
+			uint32_t FrameCount;
+			float    FrameRate;
+			bool     Loop;
+		};
+		// The frames of every clip, one after the other
+		std::vector<glm::vec4> m_FrameUVs;
+		std::vector<Clip>      m_Clips;
+
+		// Our sprites, each array is indexed the same way. Sprites are kept packed together, so when one is
+		// destroyed the last sprite is moved into it's place. Anything that Update reads from the sprite's
+		// clip is copied here, so that the update only has to walk through these arrays in order
+		std::vector<float>     m_Times;
+		std::vector<float>     m_Speeds;
+		std::vector<float>     m_FrameRates;
+		std::vector<float>     m_Durations;
+		std::vector<uint32_t>  m_FirstFrames;
+		// The index of the last frame within the clip (the frame count - 1)
+		std::vector<uint32_t>  m_LastFrames;
+		// 1 for sprites that loop and 0 for those that don't, these are floats so Update can blend with them
+		std::vector<float>     m_Loops;
+		// The index of the frame to draw in m_FrameUVs, this is the output of Update
+		std::vector<uint32_t>  m_Frames;
+		std::vector<GLuint>    m_Textures;
+		std::vector<glm::mat4> m_Transforms;
+		std::vector<glm::vec4> m_Colors;
+
+		// Maps handles to the index of their sprite, and back again
+		std::vector<uint32_t>  m_Indices;
+		std::vector<Handle>    m_Handles;
+		std::vector<Handle>    m_FreeHandles;
+
+		// Gets the index of a sprite in our arrays
+		uint32_t __Index(Handle sprite) const;
+		// Copies a clip's settings into a sprite
+		void __SetClip(uint32_t index, int clip);
+		// Works out which frame a sprite is on from it's time
+		void __UpdateFrame(uint32_t index);
+	};
+}
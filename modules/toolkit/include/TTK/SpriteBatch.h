@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library. 
+// You may not use this header in your GDW games.
+//
+// This header contains a batcher for textured quads, which collects all
+// the sprites drawn in a frame and draws them with one call per texture
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include "StreamBuffer.h"
+
+namespace TTK
+{
+	/*
+	 * Collects sprites for a frame, and draws them when the TTK context is flushed. Sprites are grouped by texture,
+	 * and each group is drawn with a single instanced draw. Sprites with the same texture are drawn in the order
+	 * they were added, but different textures may be drawn in any order
+	 */
+	class SpriteBatch {
+	public:
+		static SpriteBatch& Instance() {
+			if (m_Instance == nullptr)
+				m_Instance = new SpriteBatch();
+			return *m_Instance;
+		}
+		static void DestroyContext() {
+			delete m_Instance;
+			m_Instance = nullptr;
+		}
+		// Checks whether the batch has been made yet, so that we can flush without creating it
+		static bool IsCreated() { return m_Instance != nullptr; }
+
+	private:
+		static SpriteBatch* m_Instance;
+
+	public:
+		~SpriteBatch();
+
+		/*
+		 * Adds a sprite to this frame's batch. The sprite is a quad from -1 to 1 on the x and y axes
+		 * @param texture   The texture to draw the sprite with, this must stay alive until the batch is flushed
+		 * @param uvRect    The part of the texture to draw, as (uMin, vMin, uMax, vMax)
+		 * @param transform The matrix to transform the quad directly into clip space with
+		 * @param color     The color to multiply the texture by
+		 */
+		void Draw(GLuint texture, const glm::vec4& uvRect, const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f));
+
+		// Draws all of the sprites that have been added since the last flush
+		void Flush();
+		// Moves our instance buffer on to the next frame
+		void EndFrame();
+
+		// Gets the number of draw calls that the last flush made
+		size_t GetLastDrawCount() const { return m_LastDrawCount; }
+
+	private:
+		SpriteBatch();
+
+		struct SpriteInstance {
+			glm::mat4 Transform;
+			glm::vec4 UVRect;
+			glm::vec4 Color;
+		};
+		// We sort these instead of the instances, so that we only move the instances once
+		struct SortKey {
+			GLuint   Texture;
+			uint32_t Index;
+		};
+
+		static const size_t InitialSprites = 1024;
+
+		GLuint                      m_Shader;
+		GLuint                      m_VAO;
+		StreamBuffer*               m_Instances;
+		std::vector<SpriteInstance> m_Pending;
+		std::vector<SortKey>        m_Keys;
+		size_t                      m_LastDrawCount;
+	};
+}
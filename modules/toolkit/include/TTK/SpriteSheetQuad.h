@@ -3,7 +3,8 @@
 // This header is a part of the Tutorial Tool Kit (TTK) library. 
 // You may not use this header in your GDW games.
 // 
-// This class is a helper for drawing an animated sprite from a sprite sheet
+// This class is a helper for drawing an animated sprite from a sprite sheet,
+// it only tracks the animation and leaves the drawing to TTK::SpriteBatch
 //
 // Michael Gharbharan 2015 - 2017
 // Shawn Matthews - 2019
@@ -14,6 +15,7 @@
 
 #include <GLM/glm.hpp>
 #include "Texture2D.h"
+#include "TextureAtlas.h"
 #include <vector>
 
 namespace TTK {
@@ -57,6 +59,16 @@ namespace TTK {
 		 * @animTim The time it should take to complete one full cycle of the animation, if this is 0, then the sprite will default to 60 FPS
 		 */
 		void SliceSpriteSheet(const char* fileName, int numSpritesPerRow, int numRows, float animTime = 0.0f);
+		/*
+		 * Calculates coordinates for each sprite in a sheet that has been packed into a texture atlas. Sprites
+		 * that share an atlas page are drawn together by the sprite batch, without switching textures
+		 * @param atlas The atlas that the sheet is in, this must be built, and must outlive this sprite
+		 * @param region The index of the sheet's region in the atlas (see TextureAtlas::Add and TextureAtlas::Find)
+		 * @param numSpritesPerRow The number of sprites in a single row
+		 * @param numRows The number of rows that make up the sheet
+		 * @animTim The time it should take to complete one full cycle of the animation, if this is 0, then the sprite will default to 60 FPS
+		 */
+		void SliceSpriteSheet(const TextureAtlas& atlas, int region, int numSpritesPerRow, int numRows, float animTime = 0.0f);
 
 		/*
 		 * Updates this sprite, and advances to the next frame if required
@@ -75,8 +87,8 @@ namespace TTK {
 		void SetLooping(bool loop);
 
 		/*
-		 * Renders this sprite with the given transformation matrix. Note that this matrix
-		 * should transform the sprite directly into clip space
+		 * Adds this sprite to the sprite batch with the given transformation matrix, it will be drawn when TTK
+		 * is flushed. Note that this matrix should transform the sprite directly into clip space
 		 * @param matrix The MVP matrix to render this sprite with
 		 */
 		void Draw(const glm::mat4& matrix);
@@ -112,23 +124,21 @@ namespace TTK {
 		int GetNumberOfFrames() const;
 
 	private:
-		struct QuadVert {
-			glm::vec3 Position;
-			glm::vec2 Texture;
-		};
-
 		int   m_CurrentFrame;
 		float m_FrameTime;
 		bool  m_DoesLoop;
 		Texture2D m_Texture;
+		// The atlas page that our sheet is in, or 0 if we are using our own texture
+		GLuint    m_AtlasTexture;
 		glm::vec4 m_Color;
-		QuadVert  m_Vertices[4];
-		uint32_t m_VAO, m_VBO, m_EBO, m_Shader;
 
 		std::vector<SpriteCoordinates> m_SpriteCoordinates;
 
 		// Displays the amount of time each frame is visible for
 		std::vector<float> m_FrameLength;
+
+		// Slices a sheet of the given size into frames, with the sheet covering uvRect in it's texture
+		void __Slice(int sheetWidth, int sheetHeight, int numSpritesPerRow, int numRows, float animTime, const glm::vec4& uvRect);
 	};
 
 }
@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library. 
+// You may not use this header in your GDW games.
+//
+// This header contains a persistently mapped vertex buffer for
+// streaming data that is re-written every frame
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <glad/glad.h>
+
+namespace TTK
+{
+	/*
+	 * A vertex buffer that is split into a region for each frame that can be in flight. Vertices are written
+	 * straight into mapped GPU memory, and each region is fenced when it's frame ends, so we only ever wait on
+	 * the GPU if it falls more than FrameCount frames behind. If a frame writes more than a region can hold,
+	 * the buffer grows instead of flushing early
+	 */
+	class StreamBuffer {
+	public:
+		// How many frames we can write before we have to wait for the GPU to finish with the oldest one
+		static const int FrameCount = 3;
+
+		/*
+		 * Creates and maps the buffer, must be called with a GL context
+		 * @param stride   The size of a single element, in bytes
+		 * @param capacity The number of elements each frame can hold before we grow
+		 * @param name     The debug name of the buffer
+		 */
+		StreamBuffer(size_t stride, size_t capacity, const char* name = nullptr);
+		~StreamBuffer();
+
+		StreamBuffer(const StreamBuffer& other) = delete;
+		StreamBuffer& operator =(const StreamBuffer& other) = delete;
+
+		/*
+		 * Reserves room for some elements in this frame's region, growing the buffer if it is full
+		 * @param count The number of elements to reserve
+		 * @returns A pointer to write the elements to, this is only valid until the next call to Allocate
+		 */
+		void* Allocate(size_t count);
+
+		// Gets the number of elements that have been written since the last call to MarkDrawn
+		size_t GetPendingCount() const { return m_Head - m_DrawStart; }
+		// Gets the index of the first pending element in the buffer, for use as the first vertex in a draw
+		size_t GetPendingFirst() const { return m_DrawStart; }
+		// Lets the buffer know that the pending elements have been drawn
+		void MarkDrawn() { m_DrawStart = m_Head; }
+
+		// Fences this frame's region and moves on to the next one, waiting for the GPU if it's still using it
+		void EndFrame();
+
+		// Gets the underlying buffer, this changes when the buffer grows
+		GLuint GetHandle() const { return m_Buffer; }
+		size_t GetStride() const { return m_Stride; }
+		// Gets the number of elements that each frame can hold
+		size_t GetCapacity() const { return m_Capacity; }
+		// Gets the number of times we had to wait for the GPU before we could write to a region
+		size_t GetStallCount() const { return m_StallCount; }
+		// Gets the number of times the buffer has grown
+		size_t GetGrowCount() const { return m_GrowCount; }
+
+	private:
+		GLuint      m_Buffer;
+		char*       m_Data;
+		const char* m_Name;
+		size_t      m_Stride;
+		size_t      m_Capacity;
+		// Which region we're writing to, and our positions in the buffer (in elements)
+		int         m_Frame;
+		size_t      m_Head;
+		size_t      m_DrawStart;
+		GLsync      m_Fences[FrameCount];
+		size_t      m_StallCount;
+		size_t      m_GrowCount;
+
+		// Creates and maps a buffer with room for the given number of elements per frame
+		void __CreateBuffer(size_t capacity);
+		// Makes sure that each frame can hold at least the given number of elements
+		void __Grow(size_t capacity);
+	};
+}
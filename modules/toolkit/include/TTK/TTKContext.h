@@ -14,7 +14,12 @@
 #pragma once
 
 #include <GLM/glm.hpp>
+#include <string>
+#include <vector>
+#include <chrono>
 #include "FontRenderer.h"
+#include "GraphicsUtils.h"
+#include "StreamBuffer.h"
 
 namespace TTK
 {
@@ -35,6 +40,17 @@ namespace TTK
 			glm::vec4 Color;
 			float     Size;
 		};
+
+		/*
+		 * The render state for one of our debug layers. Layers are drawn from the lowest order to the highest
+		 */
+		struct LayerSettings {
+			bool DepthTest;
+			bool DepthWrite;
+			// When true, the layer is drawn with GetOrthoProjection instead of the view projection
+			bool ScreenSpace;
+			int  Order;
+		};
 		
 		inline static Context& Instance() {
 			if (m_Instance == nullptr)
@@ -45,16 +61,25 @@ namespace TTK
 			delete m_Instance;
 			m_Instance = nullptr;
 		}
+		/*
+		 * Sets the font file that the context loads for drawing text, this must be called before the context is
+		 * first used to have any effect
+		 * @param path The path to a .ttf file
+		 */
+		inline static void SetDefaultFontPath(const std::string& path) { m_DefaultFontPath = path; }
+		inline static const std::string& GetDefaultFontPath() { return m_DefaultFontPath; }
 	private:
 		static Context* m_Instance;
+		static std::string m_DefaultFontPath;
 
 	public:
 		~Context();
 
-		void SetProjection(const glm::mat4& value) { m_Projection = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
+		// Batches are drawn with the view projection at the time they are flushed, so changing either matrix flushes
+		void SetProjection(const glm::mat4& value) { Flush(); m_Projection = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
 		const glm::mat4& GetProjection() const { return m_Projection; }
 
-		void SetView(const glm::mat4& value) { m_ViewMatrix = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
+		void SetView(const glm::mat4& value) { Flush(); m_ViewMatrix = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
 		const glm::mat4& GetView() const { return m_ViewMatrix; }
 
 		const glm::mat4& GetViewProjection() const { return m_ViewProjection; }
@@ -65,16 +90,29 @@ namespace TTK
 
 		void RenderText(const char* text, const glm::vec2& position, const glm::vec4& color, float scale = 1.0f);
 		
-		void DrawTeapot(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
-		void DrawSphere(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
-		void DrawCube(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
+		// Shapes ignore the current layer and duration, they are drawn with whatever depth state is current
+		void DrawTeapot(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawSphere(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawCube(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
 
 		void AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color = {0, 0, 0, 1});
 		void AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color = { 0, 0, 0, 1 });
 		void AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color = { 0, 0, 0, 1 });
 		void AddPoint(const glm::vec3& pos, float size, const glm::vec4& color = { 0, 0, 0, 1 });
+
+		// Sets the layer that lines, tris and points are added to
+		void SetLayer(DebugLayer layer) { m_CurrentLayer = layer; }
+		DebugLayer GetLayer() const { return m_CurrentLayer; }
+		// Sets how long lines, tris and points are drawn for once added, in seconds (0 for just this frame)
+		void SetDuration(float seconds) { m_CurrentDuration = seconds; }
+		float GetDuration() const { return m_CurrentDuration; }
+
+		LayerSettings& GetLayerSettings(DebugLayer layer) { return m_Layers[(int)layer].Settings; }
 		
+		// Draws everything that has been added so far, without ending the frame
 		void Flush();
+		// Draws everything that has been added, and moves our vertex buffers on to the next frame
+		void EndFrame();
 
 	private:
 		Context();
@@ -87,27 +125,49 @@ namespace TTK
 		GLuint m_ShaderHandle;
 		GLuint m_PointShaderHandle;
 		struct GLBuff {
-			GLuint VBO, VAO;
-			size_t Count;
-			size_t ElemSize;
-			GLenum Mode;
-			void*  Data;
-			GLuint Shader;
+			GLuint        VAO;
+			StreamBuffer* Stream;
+			GLenum        Mode;
+			GLuint        Shader;
+			// How many vertices make up a single primitive
+			size_t        PrimVerts;
+			// Primitives with a duration, these are kept on the CPU and only re-uploaded when they change
+			std::vector<char>  Timed;
+			std::vector<float> TimedExpiry;
+			GLuint             TimedVBO;
+			size_t             TimedCapacity;
+			bool               TimedDirty;
 		};
-		GLBuff m_Tris, m_Lines, m_Points;
+		struct Layer {
+			GLBuff        Tris, Lines, Points;
+			LayerSettings Settings;
+		};
+		static const int LayerCount = 3;
+		Layer m_Layers[LayerCount];
+
+		DebugLayer m_CurrentLayer;
+		float      m_CurrentDuration;
+		// The time since the context was made, as of the last EndFrame
+		float      m_Time;
+		std::chrono::steady_clock::time_point m_StartTime;
 
 		int m_WindowWidth, m_WindowHeight;
 
-		GLBuff __InitBuff(GLenum mode, GLuint shader, void* dataSource, size_t elemSize, size_t maxElems);
-		void __Flush(GLBuff& buff);
+		void __InitBuff(GLBuff& buff, GLenum mode, GLuint shader, size_t elemSize, size_t primVerts, size_t initialElems, const char* name);
+		void __DestroyBuff(GLBuff& buff);
+		// Gets somewhere to write a primitive in the current layer, either for this frame or for the current duration
+		void* __Allocate(GLBuff Layer::* type);
+		// Draws all of our layers, including the primitives with durations if drawTimed is true
+		void __FlushLayers(bool drawTimed);
+		// Draws a single buffer, boundShader is the shader that's already bound with viewProjection (0 for none)
+		void __Flush(GLBuff& buff, const glm::mat4& viewProjection, bool drawTimed, GLuint& boundShader);
+		// Removes any primitives that have outlived their duration
+		void __Expire(GLBuff& buff);
 		GLuint __CompileShader(const char* vsSource, const char* fsSource);
 
-		static const size_t MaxPointVerts = 512;
-		static const size_t MaxLineVerts = 512 * 2;
-		static const size_t MaxTriVerts = 512 * 3;
-
-		PointVert  m_PointVerts[MaxPointVerts];
-		SimpleVert m_LineVerts[MaxLineVerts];
-		SimpleVert m_TriVerts[MaxTriVerts];
+		// How many vertices each buffer starts with room for per frame, they will grow if a frame needs more
+		static const size_t InitialPointVerts = 512;
+		static const size_t InitialLineVerts = 512 * 2;
+		static const size_t InitialTriVerts = 512 * 3;
 	};
 }
@@ -0,0 +1,128 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a texture atlas, which packs many small images
+// (like sprite sheets) into a few large textures, so that the sprite
+// batch can draw them all without switching textures
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include "AtlasPacker.h"
+
+namespace TTK
+{
+	/*
+	 * A set of images packed into shared pages. Images can either be packed at runtime (Add followed by Build),
+	 * or loaded from an atlas that was packed offline by the texture cooker (LoadFromFile)
+	 *
+	 * Each page is a regular 2D texture, so anything that takes a texture and a UV rectangle (like
+	 * TTK::SpriteBatch) can draw from an atlas by remapping it's UVs into the image's region
+	 */
+	class TextureAtlas {
+	public:
+		typedef std::shared_ptr<TextureAtlas> Ptr;
+
+		// The part of a page that a single image occupies
+		struct Region {
+			// The page texture that the image lives in, 0 if the atlas has not been built yet
+			GLuint    Texture;
+			int       Page;
+			// The image's position and size in the page, in pixels
+			int       X, Y, Width, Height;
+			// The image's normalized coordinates in the page, as (uMin, vMin, uMax, vMax)
+			glm::vec4 UVRect;
+		};
+
+		/*
+		 * Creates a new empty atlas
+		 * @param pageSize The width and height of each page, in pixels
+		 * @param padding  The number of pixels to leave around each image, to stop filtering from bleeding
+		 *                 neighbouring images into each other
+		 */
+		TextureAtlas(int pageSize = 2048, int padding = 2);
+		~TextureAtlas();
+
+		TextureAtlas(const TextureAtlas& other) = delete;
+		TextureAtlas& operator =(const TextureAtlas& other) = delete;
+
+		/*
+		 * Loads an image and adds it to the atlas, it will be packed on the next call to Build. The image can
+		 * be found again later by passing the same path to Find
+		 * @param fileName The path to the image, relative to the current working directory
+		 * @returns The index of the image's region, or -1 if the image could not be loaded
+		 */
+		int Add(const std::string& fileName);
+		/*
+		 * Adds an image to the atlas from memory, it will be packed on the next call to Build
+		 * @param name   The name to find the image by
+		 * @param rgba   The image's pixels in RGBA8, these are copied so they can be freed straight away
+		 * @param width  The width of the image, in pixels
+		 * @param height The height of the image, in pixels
+		 * @returns The index of the image's region, or -1 if the image is empty
+		 */
+		int Add(const std::string& name, const uint8_t* rgba, int width, int height);
+
+		/*
+		 * Packs all of the images added since the last build into new pages and uploads them. Regions that
+		 * were already built are not moved, so it's safe to keep adding images after building
+		 */
+		void Build();
+
+		/*
+		 * Loads an atlas that was packed by the texture cooker (TextureCooker <input> <output> --atlas <name>),
+		 * any images that were already in this atlas are kept. Regions are named by their path relative to the
+		 * cooker's input folder, with forward slashes
+		 * @param layoutPath The path to the .atlas file, the pages are expected to be next to it
+		 * @returns True if the atlas was loaded, false if otherwise
+		 */
+		bool LoadFromFile(const std::string& layoutPath);
+
+		/*
+		 * Finds a region by the name or path it was added with
+		 * @returns The index of the region, or -1 if there is no region with that name
+		 */
+		int Find(const std::string& name) const;
+
+		// Gets one of our regions, the texture and UVs are only valid once the atlas has been built
+		const Region& GetRegion(int region) const { return m_Regions[region]; }
+		int GetRegionCount() const { return (int)m_Regions.size(); }
+
+		/*
+		 * Converts a UV rectangle within a single image into a rectangle within it's page
+		 * @param region The index of the image's region
+		 * @param uvRect The rectangle in the image, as (uMin, vMin, uMax, vMax)
+		 * @returns The same rectangle in the image's page
+		 */
+		glm::vec4 Remap(int region, const glm::vec4& uvRect) const;
+
+		GLuint GetPageTexture(int page) const { return m_Pages[page]; }
+		int GetPageCount() const { return (int)m_Pages.size(); }
+
+	private:
+		AtlasPacker m_Packer;
+		// The packer's index for each of our regions, or -1 for regions that were loaded from a file
+		std::vector<int>                     m_PackerIndices;
+		std::vector<Region>                  m_Regions;
+		std::vector<GLuint>                  m_Pages;
+		std::vector<glm::ivec2>              m_PageSizes;
+		// Maps our packer's page indices to our own, since pages from files are mixed in with the packer's
+		std::vector<int>                     m_PackerPages;
+		std::unordered_map<std::string, int> m_Names;
+
+		// Creates a page texture from RGBA8 pixels, and returns it's index
+		int __UploadPage(const uint8_t* pixels, int width, int height);
+		// Fills in the texture and UVs of a region from it's pixel position
+		void __UpdateRegion(Region& region);
+	};
+}
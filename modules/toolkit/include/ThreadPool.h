@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * A fixed set of worker threads that pull tasks from a shared queue. Use Enqueue for fire and forget work
+ * (or work you want a future for), and ParallelFor to split a loop across all of the workers
+ */
+class ThreadPool {
+public:
+	/*
+	 * Creates a new thread pool
+	 * @param numThreads The number of worker threads, or 0 to use one per hardware thread (minus the caller)
+	 */
+	ThreadPool(size_t numThreads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool& other) = delete;
+	ThreadPool& operator =(const ThreadPool& other) = delete;
+
+	/*
+	 * Adds a task to the queue
+	 * @param func The function to invoke on a worker thread
+	 * @returns A future that will hold the function's result
+	 */
+	template <typename Func>
+	auto Enqueue(Func&& func) -> std::future<decltype(func())> {
+		typedef decltype(func()) Result;
+		// std::function needs to be copyable, so we keep the packaged task on the heap
+		auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+		std::future<Result> result = task->get_future();
+		__Push([task]() { (*task)(); });
+		return result;
+	}
+
+	/*
+	 * Invokes a function for every index in [0, count), split across the workers and the calling thread.
+	 * Blocks until every index has been processed
+	 * @param count     The number of indices to process
+	 * @param func      The function to invoke with each index
+	 * @param grainSize The number of indices that each thread grabs at a time
+	 */
+	void ParallelFor(size_t count, const std::function<void(size_t)>& func, size_t grainSize = 1);
+
+	// Blocks until the queue is empty and all of the workers are idle
+	void Wait();
+
+	// Gets the number of worker threads in the pool
+	size_t GetThreadCount() const { return myThreads.size(); }
+
+	// Gets a pool that is shared by the whole program, created on first use
+	static ThreadPool& Global();
+
+private:
+	std::vector<std::thread>          myThreads;
+	std::deque<std::function<void()>> myQueue;
+	std::mutex                        myLock;
+	std::condition_variable           myWakeCondition;
+	std::condition_variable           myIdleCondition;
+	size_t                            myActiveCount;
+	bool                              isStopping;
+
+	void __Push(std::function<void()>&& task);
+	void __WorkerLoop();
+};
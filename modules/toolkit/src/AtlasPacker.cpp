@@ -0,0 +1,100 @@
+#include "AtlasPacker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stb_rect_pack.h>
+
+AtlasPacker::AtlasPacker(int pageSize, int padding) :
+	myPageSize(pageSize),
+	myPadding(padding)
+{ }
+
+int AtlasPacker::Add(const uint8_t* rgba, int width, int height) {
+	// There's nothing to pack, and __Blit can't stretch the edges of an image that has none
+	if (width <= 0 || height <= 0)
+		return -1;
+	Placement placement;
+	placement.Page   = -1;
+	placement.X      = 0;
+	placement.Y      = 0;
+	placement.Width  = width;
+	placement.Height = height;
+	myPlacements.push_back(placement);
+	myPending.emplace_back(rgba, rgba + (size_t)width * height * 4);
+	return (int)myPlacements.size() - 1;
+}
+
+int AtlasPacker::Pack() {
+	int numFailed = 0;
+	std::vector<stbrp_rect> remaining;
+	for (size_t ix = 0; ix < myPending.size(); ix++) {
+		if (myPending[ix].empty())
+			continue;
+		const Placement& placement = myPlacements[ix];
+		int paddedWidth  = placement.Width  + myPadding * 2;
+		int paddedHeight = placement.Height + myPadding * 2;
+		// These would never fit, so don't bother trying
+		if (paddedWidth > myPageSize || paddedHeight > myPageSize) {
+			myPending[ix].clear();
+			myPending[ix].shrink_to_fit();
+			numFailed++;
+			continue;
+		}
+		stbrp_rect rect = {};
+		rect.id = (int)ix;
+		rect.w  = (stbrp_coord)paddedWidth;
+		rect.h  = (stbrp_coord)paddedHeight;
+		remaining.push_back(rect);
+	}
+
+	// Fill up one page at a time, anything that doesn't fit spills over into the next page
+	std::vector<stbrp_node> nodes(myPageSize);
+	while (!remaining.empty()) {
+		stbrp_context context;
+		stbrp_init_target(&context, myPageSize, myPageSize, nodes.data(), (int)nodes.size());
+		stbrp_pack_rects(&context, remaining.data(), (int)remaining.size());
+
+		int page = (int)myPages.size();
+		myPages.emplace_back((size_t)myPageSize * myPageSize * 4, (uint8_t)0);
+
+		std::vector<stbrp_rect> spilled;
+		for (const stbrp_rect& rect : remaining) {
+			if (!rect.was_packed) {
+				spilled.push_back(rect);
+				continue;
+			}
+			Placement& placement = myPlacements[rect.id];
+			placement.Page = page;
+			placement.X    = rect.x + myPadding;
+			placement.Y    = rect.y + myPadding;
+			__Blit(placement, myPending[rect.id].data());
+			myPending[rect.id].clear();
+			myPending[rect.id].shrink_to_fit();
+		}
+		remaining = std::move(spilled);
+	}
+	return numFailed;
+}
+
+void AtlasPacker::ReleasePages() {
+	for (std::vector<uint8_t>& page : myPages) {
+		page.clear();
+		page.shrink_to_fit();
+	}
+}
+
+void AtlasPacker::__Blit(const Placement& placement, const uint8_t* rgba) {
+	uint8_t* page = myPages[placement.Page].data();
+	size_t rowSize = (size_t)placement.Width * 4;
+	for (int y = -myPadding; y < placement.Height + myPadding; y++) {
+		int sourceY = std::clamp(y, 0, placement.Height - 1);
+		const uint8_t* source = rgba + sourceY * rowSize;
+		uint8_t* dest = page + ((size_t)(placement.Y + y) * myPageSize + placement.X) * 4;
+		memcpy(dest, source, rowSize);
+		// Stretch the first and last pixels of the row out into the padding
+		for (int x = 1; x <= myPadding; x++) {
+			memcpy(dest - x * 4, source, 4);
+			memcpy(dest + rowSize + (x - 1) * 4, source + rowSize - 4, 4);
+		}
+	}
+}
@@ -0,0 +1,85 @@
+#include "FrameArena.h"
+
+#include <cstdlib>
+#include <algorithm>
+
+// Rounds a value up to the next multiple of align (which must be a power of 2)
+inline size_t AlignUp(size_t value, size_t align) {
+	return (value + align - 1) & ~(align - 1);
+}
+
+LinearArena::LinearArena(size_t capacity) :
+	myMemory(nullptr),
+	myCapacity(capacity),
+	myOffset(0),
+	myHighWater(0),
+	myGrowCount(0)
+{
+	myMemory = static_cast<uint8_t*>(malloc(myCapacity));
+}
+
+LinearArena::~LinearArena() {
+	Reset();
+	free(myMemory);
+}
+
+void* LinearArena::Allocate(size_t size, size_t align) {
+	// Grab enough room that we can align within the block no matter where the offset lands
+	size_t padded = size + align - 1;
+	size_t offset = myOffset.fetch_add(padded, std::memory_order_relaxed);
+	if (offset + padded <= myCapacity) {
+		uintptr_t address = reinterpret_cast<uintptr_t>(myMemory + offset);
+		return reinterpret_cast<void*>(AlignUp(address, align));
+	}
+
+	// We're out of room, fall back to the heap and remember to free it at the next reset
+	// (our offset keeps counting, so we know how big to grow to)
+	void* block = malloc(padded);
+	{
+		std::lock_guard<std::mutex> lock(myOverflowLock);
+		myOverflow.push_back(block);
+	}
+	return reinterpret_cast<void*>(AlignUp(reinterpret_cast<uintptr_t>(block), align));
+}
+
+void LinearArena::Reset() {
+	size_t used = myOffset.load(std::memory_order_relaxed);
+	myHighWater = std::max(myHighWater, used);
+
+	std::lock_guard<std::mutex> lock(myOverflowLock);
+	if (!myOverflow.empty()) {
+		for (void* block : myOverflow)
+			free(block);
+		myOverflow.clear();
+	}
+
+	// If we overflowed, grow so that the next frame like this one fits (with some headroom)
+	if (used > myCapacity) {
+		myCapacity = AlignUp(used + used / 2, 4096);
+		free(myMemory);
+		myMemory = static_cast<uint8_t*>(malloc(myCapacity));
+		myGrowCount++;
+	}
+	myOffset.store(0, std::memory_order_relaxed);
+}
+
+int FrameArena::myCurrent = 0;
+
+LinearArena& FrameArena::__Arena(int index) {
+	// Function level statics so the arenas are ready no matter when the first allocation happens
+	static LinearArena arenas[2] = { LinearArena(DefaultCapacity), LinearArena(DefaultCapacity) };
+	return arenas[index];
+}
+
+LinearArena& FrameArena::Current() {
+	return __Arena(myCurrent);
+}
+
+LinearArena& FrameArena::Previous() {
+	return __Arena(myCurrent ^ 1);
+}
+
+void FrameArena::NextFrame() {
+	myCurrent ^= 1;
+	__Arena(myCurrent).Reset();
+}
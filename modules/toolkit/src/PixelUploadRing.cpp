@@ -0,0 +1,184 @@
+#include "PixelUploadRing.h"
+
+#include <cstring>
+
+PixelUploadRing::PixelUploadRing(size_t capacity) :
+	myBuffer(0),
+	myData(nullptr),
+	myCapacity(capacity),
+	myHead(0),
+	mySegmentStart(0),
+	myBytesUploaded(0),
+	myStallCount(0)
+{
+	// Coherent means our writes are visible to the GPU without flushing them, as long as they happen before the upload is issued
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glCreateBuffers(1, &myBuffer);
+	glNamedBufferStorage(myBuffer, capacity, nullptr, flags);
+	myData = static_cast<uint8_t*>(glMapNamedBufferRange(myBuffer, 0, capacity, flags));
+	glObjectLabel(GL_BUFFER, myBuffer, -1, "PixelUploadRing");
+}
+
+PixelUploadRing::~PixelUploadRing() {
+	for (Fence& fence : myFences)
+		glDeleteSync(fence.Sync);
+	glUnmapNamedBuffer(myBuffer);
+	glDeleteBuffers(1, &myBuffer);
+}
+
+PixelUploadRing::Allocation PixelUploadRing::Allocate(size_t size, size_t align) {
+	Allocation result;
+	if (size > myCapacity || myData == nullptr)
+		return result;
+
+	size_t start = (myHead + align - 1) & ~(align - 1);
+	if (start + size > myCapacity) {
+		// Fence off everything we've written so far before we start writing over the front of the ring
+		Submit();
+		start = 0;
+		mySegmentStart = 0;
+	}
+	__WaitForRange(start, start + size);
+	myHead = start + size;
+
+	result.Data   = myData + start;
+	result.Offset = start;
+	result.Size   = size;
+	return result;
+}
+
+void PixelUploadRing::Upload2D(GLuint texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const Allocation& source) {
+	// With a pixel unpack buffer bound, the data pointer is an offset into the buffer
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myBuffer);
+	glTextureSubImage2D(texture, level, x, y, width, height, format, type, reinterpret_cast<const void*>(source.Offset));
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	myBytesUploaded += source.Size;
+}
+
+void PixelUploadRing::Upload3D(GLuint texture, int level, int x, int y, int z, int width, int height, int depth, GLenum format, GLenum type, const Allocation& source) {
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, myBuffer);
+	glTextureSubImage3D(texture, level, x, y, z, width, height, depth, format, type, reinterpret_cast<const void*>(source.Offset));
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	myBytesUploaded += source.Size;
+}
+
+void PixelUploadRing::Upload2D(GLuint texture, int level, int x, int y, int width, int height, GLenum format, GLenum type, const void* pixels) {
+	size_t size = GetPixelDataSize(width, height, 1, format, type);
+	Allocation block = Allocate(size);
+	if (!block.IsValid()) {
+		glTextureSubImage2D(texture, level, x, y, width, height, format, type, pixels);
+		return;
+	}
+	memcpy(block.Data, pixels, size);
+	Upload2D(texture, level, x, y, width, height, format, type, block);
+}
+
+void PixelUploadRing::Upload3D(GLuint texture, int level, int x, int y, int z, int width, int height, int depth, GLenum format, GLenum type, const void* pixels) {
+	size_t size = GetPixelDataSize(width, height, depth, format, type);
+	Allocation block = Allocate(size);
+	if (!block.IsValid()) {
+		glTextureSubImage3D(texture, level, x, y, z, width, height, depth, format, type, pixels);
+		return;
+	}
+	memcpy(block.Data, pixels, size);
+	Upload3D(texture, level, x, y, z, width, height, depth, format, type, block);
+}
+
+void PixelUploadRing::Submit() {
+	if (myHead == mySegmentStart)
+		return;
+	Fence fence;
+	fence.Sync  = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	fence.Begin = mySegmentStart;
+	fence.End   = myHead;
+	myFences.push_back(fence);
+	mySegmentStart = myHead;
+}
+
+size_t PixelUploadRing::GetPixelDataSize(int width, int height, int depth, GLenum format, GLenum type) {
+	size_t components = 4;
+	switch (format) {
+		case GL_RED:
+		case GL_GREEN:
+		case GL_BLUE:
+		case GL_RED_INTEGER:
+		case GL_DEPTH_COMPONENT:
+		case GL_STENCIL_INDEX:
+			components = 1; break;
+		case GL_RG:
+		case GL_RG_INTEGER:
+		case GL_DEPTH_STENCIL:
+			components = 2; break;
+		case GL_RGB:
+		case GL_BGR:
+		case GL_RGB_INTEGER:
+			components = 3; break;
+		default: break;
+	}
+
+	size_t pixelSize;
+	switch (type) {
+		case GL_UNSIGNED_BYTE:
+		case GL_BYTE:
+			pixelSize = components; break;
+		case GL_UNSIGNED_SHORT:
+		case GL_SHORT:
+		case GL_HALF_FLOAT:
+			pixelSize = components * 2; break;
+		// Packed types hold a whole pixel in one value
+		case GL_UNSIGNED_SHORT_5_6_5:
+		case GL_UNSIGNED_SHORT_4_4_4_4:
+		case GL_UNSIGNED_SHORT_5_5_5_1:
+			pixelSize = 2; break;
+		case GL_UNSIGNED_INT_8_8_8_8:
+		case GL_UNSIGNED_INT_8_8_8_8_REV:
+		case GL_UNSIGNED_INT_2_10_10_10_REV:
+		case GL_UNSIGNED_INT_24_8:
+			pixelSize = 4; break;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			pixelSize = 8; break;
+		default:
+			pixelSize = components * 4; break;
+	}
+
+	// Every row but the last is padded out to the unpack alignment
+	GLint alignment = 4;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	size_t rowSize  = (size_t)width * pixelSize;
+	size_t rowPitch = (rowSize + alignment - 1) / alignment * alignment;
+	size_t rows     = (size_t)height * depth;
+	return rows == 0 ? 0 : rowPitch * (rows - 1) + rowSize;
+}
+
+PixelUploadRing& PixelUploadRing::Global() {
+	// We never destroy the global ring, since the GL context is usually gone by the time statics are destroyed
+	static PixelUploadRing* ring = new PixelUploadRing();
+	return *ring;
+}
+
+void PixelUploadRing::__WaitForRange(size_t begin, size_t end) {
+	// Drop any fences that the GPU has already passed
+	while (!myFences.empty() && glClientWaitSync(myFences.front().Sync, 0, 0) != GL_TIMEOUT_EXPIRED) {
+		glDeleteSync(myFences.front().Sync);
+		myFences.pop_front();
+	}
+
+	// Fences complete in order, so we only need to wait on the newest one that overlaps us
+	int last = -1;
+	for (size_t ix = 0; ix < myFences.size(); ix++) {
+		if (myFences[ix].Begin < end && begin < myFences[ix].End)
+			last = (int)ix;
+	}
+	if (last < 0)
+		return;
+
+	myStallCount++;
+	GLenum status;
+	do {
+		status = glClientWaitSync(myFences[last].Sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	} while (status == GL_TIMEOUT_EXPIRED);
+	for (int ix = 0; ix <= last; ix++) {
+		glDeleteSync(myFences.front().Sync);
+		myFences.pop_front();
+	}
+}
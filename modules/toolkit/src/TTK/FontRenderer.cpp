@@ -12,7 +12,10 @@
 
 #include "TTK/FontRenderer.h"
 #include <fstream>
+#include <climits>
+#include <cstdint>
 #include "Logging.h"
+#include "ThreadPool.h"
 #include <GLM/gtc/matrix_transform.hpp>
 #include "TTK/TTKContext.h"
 
@@ -53,19 +56,51 @@ char* readFile(const char* filename) {
 
 TTK::FontRenderer* TTK::FontRenderer::m_Instance = nullptr;
 
-TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t size)
+uint32_t TTK::DecodeUtf8(const char*& text) {
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text);
+	if (bytes[0] == 0)
+		return 0;
+
+	// The first byte tells us how many continuation bytes follow it
+	uint32_t result;
+	int extra;
+	if (bytes[0] < 0x80)      { result = bytes[0];        extra = 0; }
+	else if (bytes[0] < 0xC0) { text += 1; return 0xFFFD; }
+	else if (bytes[0] < 0xE0) { result = bytes[0] & 0x1F; extra = 1; }
+	else if (bytes[0] < 0xF0) { result = bytes[0] & 0x0F; extra = 2; }
+	else if (bytes[0] < 0xF8) { result = bytes[0] & 0x07; extra = 3; }
+	else                      { text += 1; return 0xFFFD; }
+
+	for (int ix = 1; ix <= extra; ix++) {
+		if ((bytes[ix] & 0xC0) != 0x80) {
+			// Truncated sequence, skip what we've read so far and let the next byte start again
+			text += ix;
+			return 0xFFFD;
+		}
+		result = (result << 6) | (bytes[ix] & 0x3F);
+	}
+	text += extra + 1;
+	return result <= 0x10FFFF ? result : 0xFFFD;
+}
+
+TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t size, FontMode mode)
 {
 	myFontSize = size;
-
-	unsigned char* fontData = (unsigned char*)readFile(fileName);
-	uint8_t* atlasData = new uint8_t[static_cast<size_t>(ATLAS_WIDTH) * ATLAS_HEIGHT];
-
-	myCharInfo = new stbtt_packedchar[CHAR_COUNT];
-
-	if (!stbtt_InitFont(&myFontInfo, fontData, 0)) {
+	myMode = mode;
+	myTexture = 0;
+	m_TexHandle = 0;
+	myAtlasHeight = 0;
+
+	// stb_truetype reads from the file data whenever we need a new glyph or kerning, so we keep it around
+	myFontData = (unsigned char*)readFile(fileName);
+	if (myFontData == nullptr) {
+		LOG_ERROR("Failed to open font file \"{}\"", fileName);
+		return;
+	}
+	if (!stbtt_InitFont(&myFontInfo, myFontData, 0)) {
 		LOG_ERROR("Failed to initialize font");
-		delete[] atlasData;
-		delete[] fontData;
+		delete[] myFontData;
+		myFontData = nullptr;
 		return;
 	}
 
@@ -75,77 +110,61 @@ TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t siz
 	myPixelHeightScale = stbtt_ScaleForPixelHeight(&myFontInfo, static_cast<float>(size));
 	myEmToPixel = stbtt_ScaleForMappingEmToPixels(&myFontInfo, 1.0f);
 
-	stbtt_pack_context context;
-	if (!stbtt_PackBegin(&context, atlasData, ATLAS_WIDTH, ATLAS_HEIGHT, 0, 1, nullptr)) {
-		LOG_ERROR("Failed to pack font texture");
-		delete[] atlasData;
-		delete[] fontData;
-		return;
-	}
-
-	stbtt_PackSetOversampling(&context, FONT_OVERSAMPLE_X, FONT_OVERSAMPLE_Y);
-	if (!stbtt_PackFontRange(&context, fontData, 0, static_cast<float>(size), FIRST_CHAR, CHAR_COUNT, myCharInfo)) {
-		LOG_ERROR("Failed to pack font range");
-		delete[] atlasData;
-		delete[] fontData;
-		return;
-	}
-	stbtt_PackEnd(&context);
-
-	for (uint32_t ix = FIRST_CHAR; ix < FIRST_CHAR + CHAR_COUNT; ix++) {
-		// TODO: Grab glyph data
-	}
-
-	// Create and upload the texture to store our font in
-	LOG_ASSERT(glGetError() == GL_NONE, "Some error has occured!");
-	glCreateTextures(GL_TEXTURE_2D, 1, &myTexture);
-	glTextureParameteri(myTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTextureParameteri(myTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTextureParameteri(myTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
-	glTextureParameteri(myTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	LOG_ASSERT(glGetError() == GL_NONE, "Some error has occured!");
-	glTextureStorage2D(myTexture, 1, GL_R8, ATLAS_WIDTH, ATLAS_HEIGHT);
-	LOG_ASSERT(glGetError() == GL_NONE, "Internal texture format not supported");
-	glTextureSubImage2D(myTexture, 0, 0, 0, ATLAS_WIDTH, ATLAS_HEIGHT, GL_RED, GL_UNSIGNED_BYTE, atlasData);
-	LOG_ASSERT(glGetError() == GL_NONE, "Texture transfer format not supported");
-	m_TexHandle = glGetTextureHandleARB(myTexture);
-	glMakeTextureHandleResidentARB(m_TexHandle);
-
-	delete[] atlasData;
-	delete[] fontData;
+	__CreateAtlas(INITIAL_ATLAS_HEIGHT);
+	mySkyline.push_back(glm::ivec3(0, 0, ATLAS_WIDTH));
+	myGlyphPages.resize((0x10FFFF >> 8) + 1);
+
+	// Rasterizing is the slow part, and each glyph is independent, so we spread the ASCII range across the workers
+	// and only pack them on this thread. Everything else is rasterized the first time it's drawn
+	std::vector<GlyphBitmap> bitmaps(CHAR_COUNT);
+	ThreadPool::Global().ParallelFor(CHAR_COUNT, [&](size_t ix) {
+		bitmaps[ix] = __Rasterize(FIRST_CHAR + static_cast<uint32_t>(ix));
+	});
+	for (uint32_t ix = 0; ix < CHAR_COUNT; ix++)
+		__AddGlyph(FIRST_CHAR + ix, bitmaps[ix]);
 }
 
 TTK::TrueTypeTextureFont::~TrueTypeTextureFont()
 {
-	delete[] myCharInfo;
+	if (m_TexHandle != 0)
+		glMakeTextureHandleNonResidentARB(m_TexHandle);
 	glDeleteTextures(1, &myTexture);
+	delete[] myFontData;
 }
 
-TTK::GlyphInfo TTK::TrueTypeTextureFont::GetGlyph(int codePoint, float offsetX, float offsetY) const {
-	stbtt_aligned_quad quad;
-
-	stbtt_GetPackedQuad(myCharInfo, ATLAS_WIDTH, ATLAS_HEIGHT, codePoint - FIRST_CHAR, &offsetX, &offsetY, &quad, 1);
-	auto xmin = quad.x0;
-	auto xmax = quad.x1;
-	auto ymin = -quad.y1;
-	auto ymax = -quad.y0;
-
+TTK::GlyphInfo TTK::TrueTypeTextureFont::GetGlyph(uint32_t codePoint, float offsetX, float offsetY) {
 	GlyphInfo info = GlyphInfo();
 	info.OffsetX = offsetX;
 	info.OffsetY = offsetY;
-	info.Positions[0] = { xmax, -ymin };
-	info.Positions[1] = { xmax, -ymax };
-	info.Positions[2] = { xmin, -ymax };
-	info.Positions[3] = { xmin, -ymin };
-	info.UVs[0] = { quad.s1, quad.t1 };
-	info.UVs[1] = { quad.s1, quad.t0 };
-	info.UVs[2] = { quad.s0, quad.t0 };
-	info.UVs[3] = { quad.s0, quad.t1 };
+	int32_t index = __GetGlyphIndex(codePoint);
+	if (index < 0)
+		return info;
+
+	const Glyph& glyph = myGlyphs[index];
+	// Snap to whole pixels, so that bitmap glyphs line up with the screen's pixels
+	float xmin = floorf(offsetX + glyph.Offset.x + 0.5f);
+	float ymin = floorf(offsetY + glyph.Offset.y + 0.5f);
+	float xmax = xmin + glyph.Size.x;
+	float ymax = ymin + glyph.Size.y;
+	glm::vec2 uvMin = glyph.AtlasPos;
+	glm::vec2 uvMax = glyph.AtlasPos + glyph.Size;
+
+	info.OffsetX = offsetX + glyph.Advance;
+	info.Positions[0] = { xmax, ymax };
+	info.Positions[1] = { xmax, ymin };
+	info.Positions[2] = { xmin, ymin };
+	info.Positions[3] = { xmin, ymax };
+	info.UVs[0] = { uvMax.x, uvMax.y };
+	info.UVs[1] = { uvMax.x, uvMin.y };
+	info.UVs[2] = { uvMin.x, uvMin.y };
+	info.UVs[3] = { uvMin.x, uvMax.y };
 
 	return info;
 }
 
 float TTK::TrueTypeTextureFont::GetKerning(int char1, int char2) const {
+	if (myFontData == nullptr)
+		return 0.0f;
 	return stbtt_GetCodepointKernAdvance(&myFontInfo, char1, char2) * myPixelHeightScale;
 }
 
@@ -154,65 +173,217 @@ float TTK::TrueTypeTextureFont::GetLineHeight() const {
 }
 
 glm::vec2 TTK::TrueTypeTextureFont::MeausureString(const char* text, const float scale) {
-	float multiplier = scale;
+	float xOff{ 0 };
+	float maxWidth = 0.0f;
+	int lines = 1;
+	uint32_t prev = 0;
 
-	glm::vec2 originPos = glm::vec2();
+	for (uint32_t codePoint = DecodeUtf8(text); codePoint != 0; codePoint = DecodeUtf8(text)) {
+		if (codePoint == '\n') {
+			lines++;
+			xOff = 0;
+			prev = 0;
+		}
+		else if (codePoint == '\r') {
+			xOff = 0;
+			prev = 0;
+		}
+		else if (codePoint == '\t') {
+			xOff += GetGlyph(' ', 0.0f, 0.0f).OffsetX * 4;
+			prev = 0;
+		}
+		else {
+			if (prev != 0)
+				xOff += GetKerning(prev, codePoint);
+			xOff = GetGlyph(codePoint, xOff, 0.0f).OffsetX;
+			prev = codePoint;
+		}
+		maxWidth = glm::max(maxWidth, xOff);
+	}
+	// The last line only takes up the height of the glyphs, not the gap to the next line
+	float height = (lines - 1) * GetLineHeight() + (myAscent - myDescent) * myPixelHeightScale;
+	return glm::vec2(maxWidth, height) * scale;
+}
 
-	GlyphInfo glyph;
+int32_t TTK::TrueTypeTextureFont::__GetGlyphIndex(uint32_t codePoint) {
+	if (myFontData == nullptr || codePoint > 0x10FFFF)
+		return -1;
+	std::vector<int32_t>& page = myGlyphPages[codePoint >> 8];
+	if (page.empty())
+		page.resize(256, -1);
+	int32_t& index = page[codePoint & 0xFF];
+	if (index < 0) {
+		index = __AddGlyph(codePoint, __Rasterize(codePoint));
+	}
+	return index;
+}
 
-	size_t length = strlen(text);
-	float xOff{ 0 }, yOff{ 0 };
-	float lineHeight = 0.0f;
-	float maxWidth = 0.0f;
-	float totalHeight = 0.0f;
+TTK::TrueTypeTextureFont::GlyphBitmap TTK::TrueTypeTextureFont::__Rasterize(uint32_t codePoint) const {
+	GlyphBitmap result = GlyphBitmap();
+	if (myMode == FontMode::DistanceField) {
+		const unsigned char onEdge = 128;
+		const float distanceScale = static_cast<float>(onEdge) / SDF_PADDING;
+		result.Data = stbtt_GetCodepointSDF(&myFontInfo, myPixelHeightScale, static_cast<int>(codePoint), SDF_PADDING, onEdge, distanceScale,
+			&result.Width, &result.Height, &result.OffsetX, &result.OffsetY);
+	} else {
+		result.Data = stbtt_GetCodepointBitmap(&myFontInfo, myPixelHeightScale, myPixelHeightScale, static_cast<int>(codePoint),
+			&result.Width, &result.Height, &result.OffsetX, &result.OffsetY);
+	}
+	// Glyphs without an outline (like spaces) don't give us a bitmap
+	if (result.Data == nullptr)
+		result.Width = result.Height = result.OffsetX = result.OffsetY = 0;
+	return result;
+}
 
-	for (size_t i = 0; i < length; i++) {
-		glyph = GetGlyph(text[i], xOff, yOff);
-		xOff = glyph.OffsetX;
-		yOff = glyph.OffsetY;
+int32_t TTK::TrueTypeTextureFont::__AddGlyph(uint32_t codePoint, const GlyphBitmap& bitmap) {
+	int advance, leftBearing;
+	stbtt_GetCodepointHMetrics(&myFontInfo, static_cast<int>(codePoint), &advance, &leftBearing);
+
+	Glyph glyph;
+	glyph.AtlasPos = glm::ivec2(0);
+	glyph.Size = glm::ivec2(bitmap.Width, bitmap.Height);
+	glyph.Offset = glm::ivec2(bitmap.OffsetX, bitmap.OffsetY);
+	glyph.Advance = advance * myPixelHeightScale;
+
+	if (bitmap.Data != nullptr) {
+		// Leave a pixel between glyphs, so that filtering doesn't bleed into the neighbours
+		if (__Pack(bitmap.Width + 1, bitmap.Height + 1, glyph.AtlasPos)) {
+			GLint alignment;
+			glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTextureSubImage2D(myTexture, 0, glyph.AtlasPos.x, glyph.AtlasPos.y, bitmap.Width, bitmap.Height, GL_RED, GL_UNSIGNED_BYTE, bitmap.Data);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+		} else {
+			LOG_WARN("Font atlas is full, glyph U+{:04X} will not be drawn", codePoint);
+			glyph.Size = glm::ivec2(0);
+		}
+		// The same free works for both bitmaps and distance fields
+		stbtt_FreeBitmap(bitmap.Data, nullptr);
+	}
 
-		lineHeight = glm::max(lineHeight, -glyph.Positions[1].y);
-		maxWidth = glm::max(maxWidth, xOff);
+	myGlyphs.push_back(glyph);
+	return static_cast<int32_t>(myGlyphs.size() - 1);
+}
 
-		if (text[i] == '\n')
-		{
-			yOff += GetLineHeight() * multiplier;
-			totalHeight += lineHeight;
-			lineHeight = 0.0f;
-			xOff = 0;
-		}
-		else if (text[i] == '\r') {
-			xOff = 0;
+bool TTK::TrueTypeTextureFont::__Pack(int width, int height, glm::ivec2& result) {
+	if (width > ATLAS_WIDTH)
+		return false;
+
+	// Bottom-left skyline packing, we place the rect wherever it's top would be the lowest, ignoring the height
+	// of the atlas for now so that we know how much we need to grow it by
+	size_t bestIx = SIZE_MAX;
+	int bestY = INT_MAX, bestWidth = INT_MAX;
+	for (size_t ix = 0; ix < mySkyline.size(); ix++) {
+		int x = mySkyline[ix].x;
+		if (x + width > ATLAS_WIDTH)
+			break;
+		int y = 0;
+		int remaining = width;
+		for (size_t next = ix; remaining > 0; next++) {
+			y = glm::max(y, mySkyline[next].y);
+			remaining -= mySkyline[next].z;
 		}
-		else if (text[i] == '\t') {
-			float xOffTemp{ 0 }, yOffTemp{ 0 };
-			glyph = GetGlyph(' ', xOffTemp, yOffTemp);
-			xOff += glyph.OffsetX * 4;
+		if (y < bestY || (y == bestY && mySkyline[ix].z < bestWidth)) {
+			bestIx = ix;
+			bestY = y;
+			bestWidth = mySkyline[ix].z;
 		}
 	}
-	GlyphInfo space = GetGlyph('|', xOff, yOff);
-	yOff += -(space.Positions[1].y - space.Positions[0].y);
-	return glm::vec2(xOff, yOff);
+	if (bestIx == SIZE_MAX || bestY + height > MAX_ATLAS_HEIGHT)
+		return false;
+
+	if (bestY + height > myAtlasHeight) {
+		int newHeight = myAtlasHeight;
+		while (newHeight < bestY + height)
+			newHeight *= 2;
+		__CreateAtlas(glm::min(newHeight, MAX_ATLAS_HEIGHT));
+	}
+
+	result = glm::ivec2(mySkyline[bestIx].x, bestY);
+
+	// Add our rect to the skyline, and trim the runs that it now covers
+	mySkyline.insert(mySkyline.begin() + bestIx, glm::ivec3(result.x, bestY + height, width));
+	for (size_t ix = bestIx + 1; ix < mySkyline.size(); ) {
+		int overlap = mySkyline[ix - 1].x + mySkyline[ix - 1].z - mySkyline[ix].x;
+		if (overlap <= 0)
+			break;
+		mySkyline[ix].x += overlap;
+		mySkyline[ix].z -= overlap;
+		if (mySkyline[ix].z <= 0)
+			mySkyline.erase(mySkyline.begin() + ix);
+		else
+			break;
+	}
+	// Merge neighbouring runs at the same height
+	for (size_t ix = 0; ix + 1 < mySkyline.size(); ) {
+		if (mySkyline[ix].y == mySkyline[ix + 1].y) {
+			mySkyline[ix].z += mySkyline[ix + 1].z;
+			mySkyline.erase(mySkyline.begin() + ix + 1);
+		} else
+			ix++;
+	}
+	return true;
+}
+
+void TTK::TrueTypeTextureFont::__CreateAtlas(int height) {
+	GLuint texture;
+	glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	// Distance fields need to be filtered, so that we can find the edge between texels
+	glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, myMode == FontMode::DistanceField ? GL_LINEAR : GL_NEAREST);
+	glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTextureStorage2D(texture, 1, GL_R8, ATLAS_WIDTH, height);
+	LOG_ASSERT(glGetError() == GL_NONE, "Internal texture format not supported");
+
+	// Growing keeps everything where it was, our UVs are in texels so nothing that's been built needs to change
+	if (myTexture != 0) {
+		const uint8_t zero = 0;
+		glClearTexSubImage(texture, 0, 0, myAtlasHeight, 0, ATLAS_WIDTH, height - myAtlasHeight, 1, GL_RED, GL_UNSIGNED_BYTE, &zero);
+		glCopyImageSubData(myTexture, GL_TEXTURE_2D, 0, 0, 0, 0, texture, GL_TEXTURE_2D, 0, 0, 0, 0, ATLAS_WIDTH, myAtlasHeight, 1);
+		glMakeTextureHandleNonResidentARB(m_TexHandle);
+		glDeleteTextures(1, &myTexture);
+	} else {
+		const uint8_t zero = 0;
+		glClearTexImage(texture, 0, GL_RED, GL_UNSIGNED_BYTE, &zero);
+	}
+	myTexture = texture;
+	myAtlasHeight = height;
+	m_TexHandle = glGetTextureHandleARB(myTexture);
+	glMakeTextureHandleResidentARB(m_TexHandle);
 }
 
 TTK::FontRenderer::~FontRenderer()
 {
-	glDeleteShader(m_ShaderHandle);
+	glDeleteProgram(m_ShaderHandle);
 	glDeleteVertexArrays(1, &m_VAO);
+	glDeleteBuffers(1, &m_EBO);
+	delete m_Verts;
 }
 
-void TTK::FontRenderer::Render(const TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale)
-{
-	size_t length = strlen(text);
-	
-	float multiplier = scale;
-
-	// The number of quads ACTUALLY drawn Shit-For-Brains
-	int quads = 0;
+size_t TTK::FontRenderer::RunKeyHash::operator()(const RunKey& key) const {
+	size_t result = std::hash<std::string>()(key.Text);
+	result ^= std::hash<const void*>()(key.Font) + 0x9e3779b9 + (result << 6) + (result >> 2);
+	result ^= std::hash<float>()(key.Scale) + 0x9e3779b9 + (result << 6) + (result >> 2);
+	return result;
+}
 
-	glm::vec2 originPos = glm::vec2(pos.x, pos.y);
+void TTK::FontRenderer::Render(TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale)
+{
+	if (!font.IsValid())
+		return;
 
-	static GlyphInfo glyph;
+	// Strings that were drawn recently can re-use their quads, otherwise we build them once and keep them around
+	RunKey key{ text, &font, scale };
+	auto it = m_RunCache.find(key);
+	if (it == m_RunCache.end()) {
+		it = m_RunCache.emplace(std::move(key), GlyphRun()).first;
+		__BuildRun(font, text, scale, it->second.Verts);
+	}
+	GlyphRun& run = it->second;
+	run.LastUsedFrame = m_Frame;
+	if (run.Verts.empty())
+		return;
 
 	Col8 gpuCol;
 	gpuCol.R = static_cast<char>(color.r * 255);
@@ -220,109 +391,148 @@ void TTK::FontRenderer::Render(const TrueTypeTextureFont& font, const char* text
 	gpuCol.B = static_cast<char>(color.b * 255);
 	gpuCol.A = static_cast<char>(color.a * 255);
 
-	float xOff{ 0 }, yOff{ 0 };
-
-	for (int i = 0; i < length; i++) {
-		glyph = font.GetGlyph(text[i], xOff, yOff);
-		xOff = glyph.OffsetX;
-		yOff = glyph.OffsetY;
-
-		if (text[i] == '\n')
-		{
-			yOff += font.GetLineHeight() * multiplier;
-			xOff = 0;
-		}
-		else if (text[i] == '\r') {
-			xOff = 0;
-		}
-		else if (text[i] == '\t') {
-			float xOffTemp{ 0 }, yOffTemp{ 0 };
-			glyph = font.GetGlyph(' ', xOffTemp, yOffTemp);
-			xOff += glyph.OffsetX * 4;
-		}
-		else {
-			m_MeshData[quads * 4 + 0].Position = originPos + glyph.Positions[0] * multiplier;
-			m_MeshData[quads * 4 + 0].UV = glyph.UVs[0];
-			m_MeshData[quads * 4 + 0].Color = gpuCol;
-
-			m_MeshData[quads * 4 + 1].Position = originPos + glyph.Positions[1] * multiplier;
-			m_MeshData[quads * 4 + 1].UV = glyph.UVs[1];
-			m_MeshData[quads * 4 + 1].Color = gpuCol;
-
-			m_MeshData[quads * 4 + 2].Position = originPos + glyph.Positions[2] * multiplier;
-			m_MeshData[quads * 4 + 2].UV = glyph.UVs[2];
-			m_MeshData[quads * 4 + 2].Color = gpuCol;
-
-			m_MeshData[quads * 4 + 3].Position = originPos + glyph.Positions[3] * multiplier;
-			m_MeshData[quads * 4 + 3].UV = glyph.UVs[3];
-			m_MeshData[quads * 4 + 3].Color = gpuCol;
-
-
-			m_IndexData[quads * 6 + 0] = quads * 4 + 0;
-			m_IndexData[quads * 6 + 1] = quads * 4 + 1;
-			m_IndexData[quads * 6 + 2] = quads * 4 + 2;
-
-			m_IndexData[quads * 6 + 3] = quads * 4 + 0;
-			m_IndexData[quads * 6 + 4] = quads * 4 + 2;
-			m_IndexData[quads * 6 + 5] = quads * 4 + 3;
-
-			quads++;
-		}
+	// Consecutive strings with the same font share a batch
+	size_t quads = run.Verts.size() / 4;
+	size_t firstQuad = m_Verts->GetPendingCount() / 4;
+	if (!m_Batches.empty() && m_Batches.back().Font == &font)
+		m_Batches.back().QuadCount += quads;
+	else
+		m_Batches.push_back({ &font, firstQuad, quads });
+
+	Vert* verts = static_cast<Vert*>(m_Verts->Allocate(run.Verts.size()));
+	for (size_t ix = 0; ix < run.Verts.size(); ix++) {
+		verts[ix].Position = pos + run.Verts[ix].Position;
+		verts[ix].Color = gpuCol;
+		verts[ix].UV = run.Verts[ix].UV;
 	}
+}
 
-	length = quads;
+void TTK::FontRenderer::Flush() {
+	if (m_Batches.empty())
+		return;
 
-	// Update and render our meshes
-	bool blendState = glIsEnabled(GL_BLEND);
+	size_t totalQuads = m_Verts->GetPendingCount() / 4;
+	__ReserveIndices(totalQuads);
+
+	// We only save and restore the state once for the whole batch, rather than once per string
+	GLboolean blendState = glIsEnabled(GL_BLEND);
 	GLboolean depthMaskEnabled = false;
 	glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMaskEnabled);
 	glDepthMask(GL_FALSE);
 	glEnable(GL_BLEND);
 	glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
-	glGetError();
+
 	glm::mat4 proj = TTK::Context::Instance().GetOrthoProjection();
 	glUseProgram(m_ShaderHandle);
 	glProgramUniformMatrix4fv(m_ShaderHandle, 0, 1, false, &proj[0][0]);
-	glProgramUniformHandleui64ARB(m_ShaderHandle, 1, font.m_TexHandle);	
+	// The stream's handle changes when it grows, so we bind it every flush
+	glVertexArrayVertexBuffer(m_VAO, 0, m_Verts->GetHandle(), 0, sizeof(Vert));
 	glBindVertexArray(m_VAO);
-	glNamedBufferSubData(m_VBO, 0, length * 4 * sizeof(Vert), m_MeshData);
-	glNamedBufferSubData(m_EBO, 0, length * 6 * sizeof(GLuint), m_IndexData);
-	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(length * 6), GL_UNSIGNED_INT, nullptr);
+	size_t first = m_Verts->GetPendingFirst();
+	for (const Batch& batch : m_Batches) {
+		glProgramUniformHandleui64ARB(m_ShaderHandle, 1, batch.Font->m_TexHandle);
+		glProgramUniform1i(m_ShaderHandle, 2, batch.Font->myMode == FontMode::DistanceField ? 1 : 0);
+		// Our indices always start from quad 0, so the base vertex moves them to the batch's quads
+		glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(batch.QuadCount * 6), GL_UNSIGNED_INT, nullptr,
+			static_cast<GLint>(first + batch.FirstQuad * 4));
+	}
 	glBindVertexArray(0);
 	LOG_ASSERT(glGetError() == GL_NONE, "Failed to draw our text mesh!");
+
 	if (!blendState) glDisable(GL_BLEND);
 	glDepthMask(depthMaskEnabled);
+
+	m_Verts->MarkDrawn();
+	m_Batches.clear();
+}
+
+void TTK::FontRenderer::EndFrame() {
+	m_Verts->EndFrame();
+	m_Frame++;
+	for (auto it = m_RunCache.begin(); it != m_RunCache.end(); ) {
+		if (m_Frame - it->second.LastUsedFrame > RunCacheLifetime)
+			it = m_RunCache.erase(it);
+		else
+			++it;
+	}
+}
+
+void TTK::FontRenderer::__BuildRun(TrueTypeTextureFont& font, const char* text, float scale, std::vector<Vert>& verts) const {
+	float multiplier = scale;
+	GlyphInfo glyph;
+	float xOff{ 0 }, yOff{ 0 };
+	uint32_t prev = 0;
+
+	verts.reserve(strlen(text) * 4);
+	for (uint32_t codePoint = DecodeUtf8(text); codePoint != 0; codePoint = DecodeUtf8(text)) {
+		if (codePoint == '\n')
+		{
+			// The whole run is scaled at the end, so we move down by the unscaled line height
+			yOff += font.GetLineHeight();
+			xOff = 0;
+			prev = 0;
+		}
+		else if (codePoint == '\r') {
+			xOff = 0;
+			prev = 0;
+		}
+		else if (codePoint == '\t') {
+			xOff += font.GetGlyph(' ', 0.0f, 0.0f).OffsetX * 4;
+			prev = 0;
+		}
+		else {
+			if (prev != 0)
+				xOff += font.GetKerning(prev, codePoint);
+			glyph = font.GetGlyph(codePoint, xOff, yOff);
+			xOff = glyph.OffsetX;
+			prev = codePoint;
+			for (int corner = 0; corner < 4; corner++) {
+				Vert vert;
+				vert.Position = glyph.Positions[corner] * multiplier;
+				vert.UV = glyph.UVs[corner];
+				vert.Color = Col8();
+				verts.push_back(vert);
+			}
+		}
+	}
+}
+
+void TTK::FontRenderer::__ReserveIndices(size_t quads) {
+	if (quads <= m_IndexCapacity)
+		return;
+	// Every quad uses the same pattern, so we only need to rebuild the indices when we need more of them
+	m_IndexCapacity = glm::max(quads, m_IndexCapacity * 2);
+	std::vector<GLuint> indices(m_IndexCapacity * 6);
+	for (GLuint ix = 0; ix < m_IndexCapacity; ix++) {
+		indices[ix * 6 + 0] = ix * 4 + 0;
+		indices[ix * 6 + 1] = ix * 4 + 1;
+		indices[ix * 6 + 2] = ix * 4 + 2;
+		indices[ix * 6 + 3] = ix * 4 + 0;
+		indices[ix * 6 + 4] = ix * 4 + 2;
+		indices[ix * 6 + 5] = ix * 4 + 3;
+	}
+	glNamedBufferData(m_EBO, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
 }
 
 TTK::FontRenderer::FontRenderer() {
 	LOG_INFO("Initializing font renderer");
 
-	memset(m_MeshData, 0, sizeof(m_MeshData));
-	memset(m_IndexData, 0, sizeof(m_IndexData));
+	m_Frame = 0;
+	m_IndexCapacity = 0;
+	m_Verts = new StreamBuffer(sizeof(Vert), InitialQuads * 4, "TTK Text");
 
-	glCreateVertexArrays(1, &m_VAO);
-	glBindVertexArray(m_VAO);
-	GLuint buffers[2];
-	glCreateBuffers(2, buffers);
-	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
-	glNamedBufferData(buffers[0], 256 * 4 * sizeof(Vert), m_MeshData, GL_DYNAMIC_DRAW);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
-	glNamedBufferData(buffers[1], 256 * 6 * sizeof(GLuint), m_IndexData, GL_DYNAMIC_DRAW);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	#pragma warning(push)
-	#pragma warning(disable: 6011)
-	Vert* v = nullptr;
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(Vert), &v->Position);
-	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, false, sizeof(Vert), &v->Color);
-	glVertexAttribPointer(2, 2, GL_FLOAT, false, sizeof(Vert), &v->UV);
-	#pragma warning(pop)
-	
-	glBindVertexArray(0);
+	glCreateBuffers(1, &m_EBO);
+	__ReserveIndices(InitialQuads);
 
-	m_VBO = buffers[0];
-	m_EBO = buffers[1];
+	glCreateVertexArrays(1, &m_VAO);
+	glVertexArrayElementBuffer(m_VAO, m_EBO);
+	for (GLuint ix = 0; ix < 3; ix++) {
+		glEnableVertexArrayAttrib(m_VAO, ix);
+		glVertexArrayAttribBinding(m_VAO, ix, 0);
+	}
+	glVertexArrayAttribFormat(m_VAO, 0, 2, GL_FLOAT, false, offsetof(Vert, Position));
+	glVertexArrayAttribFormat(m_VAO, 1, 4, GL_UNSIGNED_BYTE, true, offsetof(Vert, Color));
+	glVertexArrayAttribFormat(m_VAO, 2, 2, GL_FLOAT, false, offsetof(Vert, UV));
 
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) in vec2 vertexPosition;
@@ -340,12 +550,20 @@ TTK::FontRenderer::FontRenderer() {
 	const char* fsSource = R"LIT(#version 430
 			#extension GL_ARB_bindless_texture : enable
             layout(bindless_sampler, location = 1) uniform sampler2D xSampler;
+            layout (location = 2) uniform int xDistanceField;
             layout (location = 0) in vec4 fragColor;
             layout (location = 1) in vec2 fragUv;            	
             out vec4 frag_color;            	
             void main() {
+                // Our UVs are in texels, so that they stay valid when the atlas grows
+                float value = texture2D(xSampler, fragUv / vec2(textureSize(xSampler, 0))).r;
+                if (xDistanceField != 0) {
+                    // The edge of the glyph is at 0.5, and we smooth over about a pixel on screen at any scale
+                    float width = max(fwidth(value) * 0.5, 1e-4);
+                    value = smoothstep(0.5 - width, 0.5 + width, value);
+                }
                 frag_color = fragColor;
-				frag_color.a = texture2D(xSampler, fragUv).r;
+                frag_color.a *= value;
             })LIT";
 
 	m_ShaderHandle = glCreateProgram();
@@ -13,6 +13,8 @@
 
 #include "TTK/GraphicsUtils.h"
 #include "TTK/TTKContext.h"
+#include "TTK/SpriteBatch.h"
+#include "FrameArena.h"
 #include <GLM/gtc/matrix_transform.inl>
 
 #include "imgui.h"
@@ -45,6 +47,14 @@ void TTK::Graphics::SetDepthEnabled(bool isEnabled) {
 		glDisable(GL_DEPTH_TEST);
 }
 
+void TTK::Graphics::SetDebugLayer(DebugLayer layer) {
+	TTK::Context::Instance().SetLayer(layer);
+}
+
+void TTK::Graphics::SetDebugDuration(float seconds) {
+	TTK::Context::Instance().SetDuration(seconds);
+}
+
 void TTK::Graphics::SetCameraMatrix(const glm::mat4& view) {
 	TTK::Context::Instance().SetView(view);
 }
@@ -62,7 +72,9 @@ void TTK::Graphics::ClearScreen() {
 }
 
 void TTK::Graphics::EndFrame() {
-	TTK::Context::Instance().Flush();
+	TTK::Context::Instance().EndFrame();
+	// Anything allocated for this frame is now done with
+	FrameArena::NextFrame();
 }
 
 void TTK::Graphics::DrawGrid(float gridWidth, AlignMode mode) {
@@ -87,6 +99,7 @@ void TTK::Graphics::DrawGrid(float gridWidth, AlignMode mode) {
 void TTK::Graphics::Cleanup() {
 	TTK::Context::DestroyContext();
 	TTK::FontRenderer::DestroyContext();
+	TTK::SpriteBatch::DestroyContext();
 }
 
 void TTK::Graphics::DrawText2D(const std::string& text, float posX, float posY, float fontSize) {
@@ -97,6 +110,10 @@ void TTK::Graphics::DrawText2D(const std::string& text, float posX, float posY,
 	TTK::Context::Instance().RenderText(text.c_str(), { posX, posY }, color, fontSize / 32.0f);
 }
 
+void TTK::Graphics::SetDefaultFont(const std::string& path) {
+	TTK::Context::SetDefaultFontPath(path);
+}
+
 void TTK::Graphics::InitImGUI(GLFWwindow* window) {
 	// Creates a new ImGUI context5
 	ImGui::CreateContext();
@@ -11,8 +11,8 @@
 //////////////////////////////////////////////////////////////////////////
 #include "TTK/MeshHelper.h"
 
+#include <unordered_map>
 #include "TTK/Teapot.h"
-#include "TTK/Sphere.h"
 #include "TTK/Cube.h"
 #include "Logging.h"
 
@@ -21,72 +21,170 @@ TTK::Impl::MeshHelper::~MeshHelper() {
 	glDeleteBuffers(1, &m_Teapot.VBO);
 	glDeleteBuffers(1, &m_Sphere.VBO);
 	glDeleteBuffers(1, &m_Cube.VBO);
+	glDeleteBuffers(1, &m_Teapot.IBO);
+	glDeleteBuffers(1, &m_Sphere.IBO);
+	glDeleteBuffers(1, &m_Cube.IBO);
 	glDeleteVertexArrays(1, &m_Teapot.VAO);
 	glDeleteVertexArrays(1, &m_Sphere.VAO);
 	glDeleteVertexArrays(1, &m_Cube.VAO);
+	delete m_Teapot.Instances;
+	delete m_Sphere.Instances;
+	delete m_Cube.Instances;
 	glDeleteProgram(m_Shader);
 }
 
-void TTK::Impl::MeshHelper::RenderTeapot(const glm::mat4& transform, const glm::vec4& color) const {
-	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Teapot.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(TeapotData) / (sizeof(float) * 6));
+void TTK::Impl::MeshHelper::RenderTeapot(const glm::mat4& transform, const glm::vec4& color) {
+	__AddInstance(m_Teapot, transform, color);
 }
 
-void TTK::Impl::MeshHelper::RenderSphere(const glm::mat4& transform, const glm::vec4& color) const {
-	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Sphere.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(SphereData) / (sizeof(float) * 6));
+void TTK::Impl::MeshHelper::RenderSphere(const glm::mat4& transform, const glm::vec4& color) {
+	__AddInstance(m_Sphere, transform, color);
 }
 
-void TTK::Impl::MeshHelper::RenderCube(const glm::mat4& transform, const glm::vec4& color) const
+void TTK::Impl::MeshHelper::RenderCube(const glm::mat4& transform, const glm::vec4& color)
 {
+	__AddInstance(m_Cube, transform, color);
+}
+
+void TTK::Impl::MeshHelper::Flush(const glm::mat4& viewProjection) {
+	if (m_Teapot.Instances->GetPendingCount() == 0 && m_Sphere.Instances->GetPendingCount() == 0 && m_Cube.Instances->GetPendingCount() == 0)
+		return;
 	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Cube.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(CubeData) / (sizeof(float) * 6));
+	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &viewProjection[0][0]);
+	__Flush(m_Teapot);
+	__Flush(m_Sphere);
+	__Flush(m_Cube);
+}
+
+void TTK::Impl::MeshHelper::EndFrame() {
+	m_Teapot.Instances->EndFrame();
+	m_Sphere.Instances->EndFrame();
+	m_Cube.Instances->EndFrame();
+}
+
+void TTK::Impl::MeshHelper::__AddInstance(mesh& mesh, const glm::mat4& transform, const glm::vec4& color) {
+	Instance* instance = static_cast<Instance*>(mesh.Instances->Allocate(1));
+	instance->Transform = transform;
+	instance->Color = color;
+}
+
+void TTK::Impl::MeshHelper::__Flush(mesh& mesh) {
+	size_t count = mesh.Instances->GetPendingCount();
+	if (count > 0) {
+		// The instance buffer changes when it grows, so we re-bind it for every draw
+		glVertexArrayVertexBuffer(mesh.VAO, 1, mesh.Instances->GetHandle(), 0, sizeof(Instance));
+		glBindVertexArray(mesh.VAO);
+		glDrawElementsInstancedBaseInstance(GL_TRIANGLES, mesh.IndexCount, GL_UNSIGNED_SHORT, nullptr, static_cast<GLsizei>(count), static_cast<GLuint>(mesh.Instances->GetPendingFirst()));
+		mesh.Instances->MarkDrawn();
+	}
 }
 
-TTK::Impl::MeshHelper::mesh TTK::Impl::MeshHelper::__MakeMesh(const float* data, size_t size) const {
+TTK::Impl::MeshHelper::mesh TTK::Impl::MeshHelper::__MakeMesh(const glm::vec3* positions, size_t vertexCount, const uint16_t* indices, size_t indexCount, const char* name) const {
+	LOG_ASSERT(vertexCount <= UINT16_MAX, "Too many vertices for 16 bit indices!");
 	mesh result;
-	glCreateVertexArrays(1, &result.VAO);
-	glBindVertexArray(result.VAO);
+	result.IndexCount = static_cast<GLsizei>(indexCount);
+	result.Instances = new StreamBuffer(sizeof(Instance), InitialInstances, name);
+
 	glCreateBuffers(1, &result.VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, result.VBO);
-	glNamedBufferData(result.VBO, size, data, GL_DYNAMIC_DRAW);
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(float) * 6, 0);
+	glNamedBufferStorage(result.VBO, sizeof(glm::vec3) * vertexCount, positions, 0);
+	glCreateBuffers(1, &result.IBO);
+	glNamedBufferStorage(result.IBO, sizeof(uint16_t) * indexCount, indices, 0);
+
+	// Binding 0 is the shape's positions, binding 1 steps once per instance
+	glCreateVertexArrays(1, &result.VAO);
+	glVertexArrayElementBuffer(result.VAO, result.IBO);
+	glVertexArrayVertexBuffer(result.VAO, 0, result.VBO, 0, sizeof(glm::vec3));
+	glEnableVertexArrayAttrib(result.VAO, 0);
+	glVertexArrayAttribFormat(result.VAO, 0, 3, GL_FLOAT, false, 0);
+	glVertexArrayAttribBinding(result.VAO, 0, 0);
+
+	// A mat4 attribute takes up 4 locations, one for each column
+	for (GLuint ix = 0; ix < 4; ix++) {
+		glEnableVertexArrayAttrib(result.VAO, 1 + ix);
+		glVertexArrayAttribFormat(result.VAO, 1 + ix, 4, GL_FLOAT, false, static_cast<GLuint>(offsetof(Instance, Transform) + sizeof(glm::vec4) * ix));
+		glVertexArrayAttribBinding(result.VAO, 1 + ix, 1);
+	}
+	glEnableVertexArrayAttrib(result.VAO, 5);
+	glVertexArrayAttribFormat(result.VAO, 5, 4, GL_FLOAT, false, offsetof(Instance, Color));
+	glVertexArrayAttribBinding(result.VAO, 5, 1);
+	glVertexArrayBindingDivisor(result.VAO, 1, 1);
 	return result;
 }
 
+void TTK::Impl::MeshHelper::__MakeIcosphere(int subdivisions, std::vector<glm::vec3>& positions, std::vector<uint16_t>& indices) {
+	// The 12 corners of an icosahedron are the corners of 3 golden rectangles at right angles to each other
+	const float t = (1.0f + sqrtf(5.0f)) / 2.0f;
+	positions = {
+		{ -1,  t,  0 }, {  1,  t,  0 }, { -1, -t,  0 }, {  1, -t,  0 },
+		{  0, -1,  t }, {  0,  1,  t }, {  0, -1, -t }, {  0,  1, -t },
+		{  t,  0, -1 }, {  t,  0,  1 }, { -t,  0, -1 }, { -t,  0,  1 }
+	};
+	indices = {
+		0, 11, 5,   0, 5, 1,    0, 1, 7,    0, 7, 10,   0, 10, 11,
+		1, 5, 9,    5, 11, 4,   11, 10, 2,  10, 7, 6,   7, 1, 8,
+		3, 9, 4,    3, 4, 2,    3, 2, 6,    3, 6, 8,    3, 8, 9,
+		4, 9, 5,    2, 4, 11,   6, 2, 10,   8, 6, 7,    9, 8, 1
+	};
+	for (glm::vec3& pos : positions)
+		pos = glm::normalize(pos);
+
+	for (int level = 0; level < subdivisions; level++) {
+		// Each edge is shared by 2 triangles, so we remember the midpoints we've already made
+		std::unordered_map<uint32_t, uint16_t> midpoints;
+		auto getMidpoint = [&](uint16_t a, uint16_t b) {
+			uint32_t key = a < b ? (a << 16) | b : (b << 16) | a;
+			auto it = midpoints.find(key);
+			if (it != midpoints.end())
+				return it->second;
+			uint16_t result = static_cast<uint16_t>(positions.size());
+			positions.push_back(glm::normalize(positions[a] + positions[b]));
+			midpoints[key] = result;
+			return result;
+		};
+
+		std::vector<uint16_t> split;
+		split.reserve(indices.size() * 4);
+		for (size_t ix = 0; ix < indices.size(); ix += 3) {
+			uint16_t a = indices[ix], b = indices[ix + 1], c = indices[ix + 2];
+			uint16_t ab = getMidpoint(a, b), bc = getMidpoint(b, c), ca = getMidpoint(c, a);
+			split.insert(split.end(), { a, ab, ca,  b, bc, ab,  c, ca, bc,  ab, bc, ca });
+		}
+		indices.swap(split);
+	}
+}
+
 TTK::Impl::MeshHelper::MeshHelper()
 {
-	m_Teapot = __MakeMesh(TeapotData, sizeof(TeapotData));
-	m_Sphere = __MakeMesh(SphereData, sizeof(SphereData));
-	m_Cube   = __MakeMesh(CubeData, sizeof(CubeData));
-	
-	glBindVertexArray(0);
+	// The teapot is stored quantized, so we expand it back out before uploading it
+	std::vector<glm::vec3> positions(TeapotVertexCount);
+	for (size_t ix = 0; ix < TeapotVertexCount; ix++)
+		positions[ix] = GetTeapotPosition(ix);
+	m_Teapot = __MakeMesh(positions.data(), positions.size(), TeapotIndices, TeapotIndexCount, "TTK Teapot Instances");
+
+	std::vector<uint16_t> indices;
+	__MakeIcosphere(2, positions, indices);
+	m_Sphere = __MakeMesh(positions.data(), positions.size(), indices.data(), indices.size(), "TTK Sphere Instances");
+
+	const size_t cubeVerts = sizeof(CubePositions) / (sizeof(float) * 3);
+	m_Cube   = __MakeMesh(reinterpret_cast<const glm::vec3*>(CubePositions), cubeVerts, CubeIndices, sizeof(CubeIndices) / sizeof(uint16_t), "TTK Cube Instances");
 	
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) in vec3 vertexPosition;
-            layout (location = 0) uniform mat4 xTransform;	
+            layout (location = 1) in mat4 instanceTransform;
+            layout (location = 5) in vec4 instanceColor;
+            layout (location = 0) uniform mat4 xViewProjection;
+
+            layout (location = 0) out vec4 fragmentColor;
             void main() {
-                gl_Position = xTransform * vec4(vertexPosition, 1);
+                gl_Position = xViewProjection * instanceTransform * vec4(vertexPosition, 1);
+                fragmentColor = instanceColor;
             })LIT";
 
 	const char* fsSource = R"LIT(#version 430   
-            layout (location = 1) uniform vec4 xColor;		
+            layout (location = 0) in vec4 fragColor;
             out vec4 frag_color;            	
             void main() {
-                frag_color = xColor;
+                frag_color = fragColor;
             })LIT";
 
 	m_Shader = glCreateProgram();
@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK sprite animation system
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TTK/SpriteAnimator.h"
+#include <algorithm>
+#include "TTK/SpriteBatch.h"
+#include "Logging.h"
+
+TTK::SpriteAnimator::SpriteAnimator() { }
+
+int TTK::SpriteAnimator::AddClip(GLuint texture, const std::vector<glm::vec4>& frameUVs, float frameRate, bool loop) {
+	LOG_ASSERT(!frameUVs.empty(), "SpriteAnimator.cpp Error! Clips must have at least one frame!");
+	LOG_ASSERT(frameRate > 0.0f, "SpriteAnimator.cpp Error! Clips must have a positive frame rate!");
+
+	Clip clip;
+	clip.Texture    = texture;
+	clip.FirstFrame = static_cast<uint32_t>(m_FrameUVs.size());
+	clip.FrameCount = static_cast<uint32_t>(frameUVs.size());
+	clip.FrameRate  = frameRate;
+	clip.Loop       = loop;
+	m_FrameUVs.insert(m_FrameUVs.end(), frameUVs.begin(), frameUVs.end());
+	m_Clips.push_back(clip);
+	return static_cast<int>(m_Clips.size()) - 1;
+}
+
+int TTK::SpriteAnimator::AddClip(const TextureAtlas& atlas, int region, int numSpritesPerRow, int numRows, float animTime, bool loop) {
+	LOG_ASSERT(region >= 0 && region < atlas.GetRegionCount(), "SpriteAnimator.cpp Error! Region {} is not in the atlas!", region);
+	LOG_ASSERT(atlas.GetRegion(region).Texture != 0, "SpriteAnimator.cpp Error! The atlas must be built before adding clips from it!");
+
+	std::vector<glm::vec4> frames;
+	for (int j = 0; j < numRows; j++) {
+		for (int i = 0; i < numSpritesPerRow; i++) {
+			glm::vec4 uvRect = glm::vec4(
+				static_cast<float>(i) / numSpritesPerRow, static_cast<float>(j) / numRows,
+				static_cast<float>(i + 1) / numSpritesPerRow, static_cast<float>(j + 1) / numRows);
+			frames.push_back(atlas.Remap(region, uvRect));
+		}
+	}
+	float frameRate = animTime == 0.0f ? 60.0f : frames.size() / animTime;
+	return AddClip(atlas.GetRegion(region).Texture, frames, frameRate, loop);
+}
+
+TTK::SpriteAnimator::Handle TTK::SpriteAnimator::Create(int clip, const glm::mat4& transform, const glm::vec4& color) {
+	Handle handle;
+	if (!m_FreeHandles.empty()) {
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+	} else {
+		handle = static_cast<Handle>(m_Indices.size());
+		m_Indices.push_back(0);
+	}
+
+	uint32_t index = static_cast<uint32_t>(m_Times.size());
+	m_Indices[handle] = index;
+	m_Handles.push_back(handle);
+	m_Times.push_back(0.0f);
+	m_Speeds.push_back(1.0f);
+	m_FrameRates.push_back(0.0f);
+	m_Durations.push_back(0.0f);
+	m_FirstFrames.push_back(0);
+	m_LastFrames.push_back(0);
+	m_Loops.push_back(0.0f);
+	m_Frames.push_back(0);
+	m_Textures.push_back(0);
+	m_Transforms.push_back(transform);
+	m_Colors.push_back(color);
+
+	__SetClip(index, clip);
+	__UpdateFrame(index);
+	return handle;
+}
+
+void TTK::SpriteAnimator::Destroy(Handle sprite) {
+	uint32_t index = __Index(sprite);
+
+	// Move our last sprite into the hole, so that the arrays stay packed
+	auto remove = [index](auto& values) {
+		values[index] = values.back();
+		values.pop_back();
+	};
+	remove(m_Handles);
+	remove(m_Times);
+	remove(m_Speeds);
+	remove(m_FrameRates);
+	remove(m_Durations);
+	remove(m_FirstFrames);
+	remove(m_LastFrames);
+	remove(m_Loops);
+	remove(m_Frames);
+	remove(m_Textures);
+	remove(m_Transforms);
+	remove(m_Colors);
+
+	if (index < m_Handles.size())
+		m_Indices[m_Handles[index]] = index;
+	m_Indices[sprite] = InvalidHandle;
+	m_FreeHandles.push_back(sprite);
+}
+
+void TTK::SpriteAnimator::Clear() {
+	m_Handles.clear();
+	m_Times.clear();
+	m_Speeds.clear();
+	m_FrameRates.clear();
+	m_Durations.clear();
+	m_FirstFrames.clear();
+	m_LastFrames.clear();
+	m_Loops.clear();
+	m_Frames.clear();
+	m_Textures.clear();
+	m_Transforms.clear();
+	m_Colors.clear();
+	m_Indices.clear();
+	m_FreeHandles.clear();
+}
+
+void TTK::SpriteAnimator::Play(Handle sprite, int clip, bool restart) {
+	uint32_t index = __Index(sprite);
+	__SetClip(index, clip);
+	if (restart)
+		m_Times[index] = 0.0f;
+	__UpdateFrame(index);
+}
+
+void TTK::SpriteAnimator::SetSpeed(Handle sprite, float speed) {
+	m_Speeds[__Index(sprite)] = speed;
+}
+
+void TTK::SpriteAnimator::SetTime(Handle sprite, float time) {
+	uint32_t index = __Index(sprite);
+	m_Times[index] = time;
+	__UpdateFrame(index);
+}
+
+void TTK::SpriteAnimator::SetTransform(Handle sprite, const glm::mat4& transform) {
+	m_Transforms[__Index(sprite)] = transform;
+}
+
+void TTK::SpriteAnimator::SetColor(Handle sprite, const glm::vec4& color) {
+	m_Colors[__Index(sprite)] = color;
+}
+
+int TTK::SpriteAnimator::GetFrame(Handle sprite) const {
+	uint32_t index = __Index(sprite);
+	return static_cast<int>(m_Frames[index] - m_FirstFrames[index]);
+}
+
+bool TTK::SpriteAnimator::IsFinished(Handle sprite) const {
+	uint32_t index = __Index(sprite);
+	if (m_Loops[index] != 0.0f)
+		return false;
+	// Update clamps the time of sprites that don't loop, so sprites playing backwards stop at exactly 0
+	return m_Speeds[index] < 0.0f ? m_Times[index] <= 0.0f : m_Times[index] >= m_Durations[index];
+}
+
+void TTK::SpriteAnimator::Update(float deltaTime) {
+	// We go through raw pointers, so the compiler knows that the loop only touches these arrays
+	const size_t    count       = m_Times.size();
+	float*          times       = m_Times.data();
+	const float*    speeds      = m_Speeds.data();
+	const float*    frameRates  = m_FrameRates.data();
+	const float*    durations   = m_Durations.data();
+	const uint32_t* firstFrames = m_FirstFrames.data();
+	const uint32_t* lastFrames  = m_LastFrames.data();
+	const float*    loops       = m_Loops.data();
+	uint32_t*       frames      = m_Frames.data();
+
+	// Every sprite does the same work, looping is picked by blending with the loop flag rather than a branch
+	for (size_t ix = 0; ix < count; ix++) {
+		float duration = durations[ix];
+		float time = times[ix] + deltaTime * speeds[ix];
+
+		// Wraps the time into [0, duration) for looping sprites. This is a floor done with truncation (std::floor
+		// and compares stop the loop from vectorizing), done twice so that playing backwards wraps properly
+		float cycles = time / duration;
+		cycles -= static_cast<float>(static_cast<int32_t>(cycles));
+		cycles += 1.0f;
+		cycles -= static_cast<float>(static_cast<int32_t>(cycles));
+		float wrapped = cycles * duration;
+		float clamped = std::min(std::max(time, 0.0f), duration);
+		time = clamped + loops[ix] * (wrapped - clamped);
+		times[ix] = time;
+
+		// The time is never negative here, so truncating is the same as flooring
+		uint32_t frame = static_cast<uint32_t>(static_cast<int32_t>(time * frameRates[ix]));
+		frames[ix] = firstFrames[ix] + std::min(frame, lastFrames[ix]);
+	}
+}
+
+void TTK::SpriteAnimator::Draw() const {
+	SpriteBatch& batch = SpriteBatch::Instance();
+	for (size_t ix = 0; ix < m_Times.size(); ix++)
+		batch.Draw(m_Textures[ix], m_FrameUVs[m_Frames[ix]], m_Transforms[ix], m_Colors[ix]);
+}
+
+uint32_t TTK::SpriteAnimator::__Index(Handle sprite) const {
+	LOG_ASSERT(sprite < m_Indices.size() && m_Indices[sprite] != InvalidHandle, "SpriteAnimator.cpp Error! Sprite {} does not exist!", sprite);
+	return m_Indices[sprite];
+}
+
+void TTK::SpriteAnimator::__SetClip(uint32_t index, int clip) {
+	LOG_ASSERT(clip >= 0 && clip < static_cast<int>(m_Clips.size()), "SpriteAnimator.cpp Error! Clip {} does not exist!", clip);
+	const Clip& source = m_Clips[clip];
+	m_FrameRates[index]  = source.FrameRate;
+	m_Durations[index]   = source.FrameCount / source.FrameRate;
+	m_FirstFrames[index] = source.FirstFrame;
+	m_LastFrames[index]  = source.FrameCount - 1;
+	m_Loops[index]       = source.Loop ? 1.0f : 0.0f;
+	m_Textures[index]    = source.Texture;
+}
+
+void TTK::SpriteAnimator::__UpdateFrame(uint32_t index) {
+	uint32_t frame = static_cast<uint32_t>(std::max(m_Times[index], 0.0f) * m_FrameRates[index]);
+	m_Frames[index] = m_FirstFrames[index] + std::min(frame, m_LastFrames[index]);
+}
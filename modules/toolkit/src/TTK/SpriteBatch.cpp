@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library. 
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK sprite batcher
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TTK/SpriteBatch.h"
+#include <algorithm>
+#include <stdexcept>
+#include "Logging.h"
+
+TTK::SpriteBatch* TTK::SpriteBatch::m_Instance = nullptr;
+
+TTK::SpriteBatch::~SpriteBatch() {
+	glDeleteProgram(m_Shader);
+	glDeleteVertexArrays(1, &m_VAO);
+	delete m_Instances;
+}
+
+void TTK::SpriteBatch::Draw(GLuint texture, const glm::vec4& uvRect, const glm::mat4& transform, const glm::vec4& color) {
+	m_Keys.push_back({ texture, static_cast<uint32_t>(m_Pending.size()) });
+	m_Pending.push_back({ transform, uvRect, color });
+}
+
+void TTK::SpriteBatch::Flush() {
+	m_LastDrawCount = 0;
+	if (m_Pending.empty())
+		return;
+
+	// Group the sprites by texture, keeping the order that they were added in within each group
+	std::stable_sort(m_Keys.begin(), m_Keys.end(), [](const SortKey& a, const SortKey& b) { return a.Texture < b.Texture; });
+
+	SpriteInstance* instances = static_cast<SpriteInstance*>(m_Instances->Allocate(m_Pending.size()));
+	for (size_t ix = 0; ix < m_Keys.size(); ix++)
+		instances[ix] = m_Pending[m_Keys[ix].Index];
+	size_t first = m_Instances->GetPendingFirst();
+
+	glUseProgram(m_Shader);
+	// The stream's handle changes when it grows, so we bind it every flush
+	glVertexArrayVertexBuffer(m_VAO, 0, m_Instances->GetHandle(), 0, sizeof(SpriteInstance));
+	glBindVertexArray(m_VAO);
+	for (size_t start = 0; start < m_Keys.size(); ) {
+		size_t end = start + 1;
+		while (end < m_Keys.size() && m_Keys[end].Texture == m_Keys[start].Texture)
+			end++;
+		glBindTextureUnit(0, m_Keys[start].Texture);
+		glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(end - start), static_cast<GLuint>(first + start));
+		m_LastDrawCount++;
+		start = end;
+	}
+	glBindVertexArray(0);
+	glBindTextureUnit(0, 0);
+
+	m_Instances->MarkDrawn();
+	m_Pending.clear();
+	m_Keys.clear();
+}
+
+void TTK::SpriteBatch::EndFrame() {
+	m_Instances->EndFrame();
+}
+
+TTK::SpriteBatch::SpriteBatch() {
+	m_LastDrawCount = 0;
+	m_Instances = new StreamBuffer(sizeof(SpriteInstance), InitialSprites, "TTK Sprites");
+
+	// The quad's corners come from gl_VertexID, so the only buffer we read from steps once per sprite
+	glCreateVertexArrays(1, &m_VAO);
+	for (GLuint ix = 0; ix < 6; ix++) {
+		glEnableVertexArrayAttrib(m_VAO, ix);
+		glVertexArrayAttribBinding(m_VAO, ix, 0);
+	}
+	for (GLuint ix = 0; ix < 4; ix++)
+		glVertexArrayAttribFormat(m_VAO, ix, 4, GL_FLOAT, false, static_cast<GLuint>(offsetof(SpriteInstance, Transform) + sizeof(glm::vec4) * ix));
+	glVertexArrayAttribFormat(m_VAO, 4, 4, GL_FLOAT, false, offsetof(SpriteInstance, UVRect));
+	glVertexArrayAttribFormat(m_VAO, 5, 4, GL_FLOAT, false, offsetof(SpriteInstance, Color));
+	glVertexArrayBindingDivisor(m_VAO, 0, 1);
+
+	const char* vsSource = R"LIT(#version 440
+            layout (location = 0) in mat4 instanceTransform;
+            layout (location = 4) in vec4 instanceUVRect;
+            layout (location = 5) in vec4 instanceColor;
+            layout (location = 0) out vec2 fragmentTexture;
+            layout (location = 1) out vec4 fragmentColor;
+            void main() {
+                // Drawn as a strip, the corners go top left, top right, bottom left, bottom right
+                vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+                gl_Position = instanceTransform * vec4(mix(vec2(-1.0, 1.0), vec2(1.0, -1.0), corner), 0, 1);
+                fragmentTexture = mix(instanceUVRect.xy, instanceUVRect.zw, corner);
+                fragmentColor = instanceColor;
+            })LIT";
+
+	const char* fsSource = R"LIT(#version 440
+            layout(binding = 0) uniform sampler2D xSampler;
+            layout (location = 0) in vec2 fragUv;
+            layout (location = 1) in vec4 fragColor;
+            out vec4 frag_color;            	
+            void main() {
+				frag_color = texture(xSampler, fragUv) * fragColor;
+            })LIT";
+
+	m_Shader = glCreateProgram();
+
+	GLuint programs[2];
+	programs[0] = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(programs[0], 1, &vsSource, NULL);
+	glCompileShader(programs[0]);
+	programs[1] = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(programs[1], 1, &fsSource, NULL);
+	glCompileShader(programs[1]);
+
+	// Attach our two shaders
+	glAttachShader(m_Shader, programs[0]);
+	glAttachShader(m_Shader, programs[1]);
+
+	// Perform linking
+	glLinkProgram(m_Shader);
+
+	GLint success = 0;
+	glGetProgramiv(m_Shader, GL_LINK_STATUS, &success);
+	if (success == GL_FALSE) {
+		GLint length = 0;
+		glGetProgramiv(m_Shader, GL_INFO_LOG_LENGTH, &length);
+		std::string log(length > 0 ? length : 1, '\0');
+		glGetProgramInfoLog(m_Shader, length, &length, &log[0]);
+		LOG_ERROR("Sprite shader failed to link:\n{}", log);
+		throw std::runtime_error("Failed to link shader program!");
+	}
+
+	// Remove shader parts to save space
+	glDetachShader(m_Shader, programs[0]);
+	glDeleteShader(programs[0]);
+	glDetachShader(m_Shader, programs[1]);
+	glDeleteShader(programs[1]);
+}
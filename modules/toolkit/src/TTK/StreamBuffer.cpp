@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library. 
+// You may not use this file in your GDW games.
+//
+// This file implements the persistently mapped stream buffer
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TTK/StreamBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include "Logging.h"
+
+TTK::StreamBuffer::StreamBuffer(size_t stride, size_t capacity, const char* name) :
+	m_Buffer(0),
+	m_Data(nullptr),
+	m_Name(name),
+	m_Stride(stride),
+	m_Capacity(0),
+	m_Frame(0),
+	m_Head(0),
+	m_DrawStart(0),
+	m_StallCount(0),
+	m_GrowCount(0)
+{
+	for (int ix = 0; ix < FrameCount; ix++)
+		m_Fences[ix] = nullptr;
+	__CreateBuffer(std::max(capacity, (size_t)1));
+}
+
+TTK::StreamBuffer::~StreamBuffer() {
+	for (int ix = 0; ix < FrameCount; ix++)
+		if (m_Fences[ix] != nullptr)
+			glDeleteSync(m_Fences[ix]);
+	glUnmapNamedBuffer(m_Buffer);
+	glDeleteBuffers(1, &m_Buffer);
+}
+
+void* TTK::StreamBuffer::Allocate(size_t count) {
+	size_t regionEnd = (m_Frame + 1) * m_Capacity;
+	if (m_Head + count > regionEnd)
+		__Grow(std::max(m_Capacity * 2, (m_Head - m_Frame * m_Capacity) + count));
+	void* result = m_Data + m_Head * m_Stride;
+	m_Head += count;
+	return result;
+}
+
+void TTK::StreamBuffer::EndFrame() {
+	// Anything that wasn't drawn is dropped, so that it doesn't end up in the next frame's region
+	m_Fences[m_Frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	m_Frame = (m_Frame + 1) % FrameCount;
+
+	// Make sure the GPU is done with the last frame that used this region
+	if (m_Fences[m_Frame] != nullptr) {
+		if (glClientWaitSync(m_Fences[m_Frame], 0, 0) == GL_TIMEOUT_EXPIRED) {
+			m_StallCount++;
+			GLenum status;
+			do {
+				status = glClientWaitSync(m_Fences[m_Frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			} while (status == GL_TIMEOUT_EXPIRED);
+		}
+		glDeleteSync(m_Fences[m_Frame]);
+		m_Fences[m_Frame] = nullptr;
+	}
+	m_Head = m_DrawStart = m_Frame * m_Capacity;
+}
+
+void TTK::StreamBuffer::__CreateBuffer(size_t capacity) {
+	// Coherent means our writes are visible to the GPU without flushing them, as long as they happen before the draw is issued
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	m_Capacity = capacity;
+	glCreateBuffers(1, &m_Buffer);
+	glNamedBufferStorage(m_Buffer, m_Stride * m_Capacity * FrameCount, nullptr, flags);
+	m_Data = static_cast<char*>(glMapNamedBufferRange(m_Buffer, 0, m_Stride * m_Capacity * FrameCount, flags));
+	if (m_Name != nullptr)
+		glObjectLabel(GL_BUFFER, m_Buffer, -1, m_Name);
+}
+
+void TTK::StreamBuffer::__Grow(size_t capacity) {
+	// Anything written this frame that hasn't been drawn yet needs to come with us to the new buffer. Draws that
+	// were already issued keep using the old buffer, GL won't free it until they're done
+	size_t pending = m_Head - m_DrawStart;
+	char* oldData = m_Data;
+	size_t oldStart = m_DrawStart;
+	GLuint oldBuffer = m_Buffer;
+
+	__CreateBuffer(capacity);
+	m_GrowCount++;
+	LOG_INFO("Growing stream buffer \"{}\" to {} elements per frame", m_Name != nullptr ? m_Name : "", m_Capacity);
+
+	// The new buffer isn't being used by any frames yet, so we can start over in the first region
+	for (int ix = 0; ix < FrameCount; ix++) {
+		if (m_Fences[ix] != nullptr)
+			glDeleteSync(m_Fences[ix]);
+		m_Fences[ix] = nullptr;
+	}
+	m_Frame = 0;
+	memcpy(m_Data, oldData + oldStart * m_Stride, pending * m_Stride);
+	m_DrawStart = 0;
+	m_Head = pending;
+
+	glUnmapNamedBuffer(oldBuffer);
+	glDeleteBuffers(1, &oldBuffer);
+}
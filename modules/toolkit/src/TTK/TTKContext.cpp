@@ -13,21 +13,29 @@
 #include "TTK/TTKContext.h"
 #include <GLM/gtc/matrix_transform.hpp>
 #include <string>
+#include <algorithm>
+#include <cstring>
 #include "Logging.h"
 #include "TTK/MeshHelper.h"
+#include "TTK/SpriteBatch.h"
 
 TTK::Context* TTK::Context::m_Instance = nullptr;
+#ifdef _WIN32
+std::string TTK::Context::m_DefaultFontPath = "C:\\Windows\\Fonts\\consola.ttf";
+#else
+std::string TTK::Context::m_DefaultFontPath = "/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf";
+#endif
 
 TTK::Context::~Context() {
 	delete m_MeshHelper;
 	delete m_DefaultFont;
-	glDeleteBuffers(1, &m_Tris.VBO);
-	glDeleteBuffers(1, &m_Lines.VBO);
-	glDeleteBuffers(1, &m_Points.VBO);
-	glDeleteVertexArrays(1, &m_Tris.VAO);
-	glDeleteVertexArrays(1, &m_Lines.VAO);
-	glDeleteVertexArrays(1, &m_Points.VAO);
+	for (Layer& layer : m_Layers) {
+		__DestroyBuff(layer.Tris);
+		__DestroyBuff(layer.Lines);
+		__DestroyBuff(layer.Points);
+	}
 	glDeleteProgram(m_ShaderHandle);
+	glDeleteProgram(m_PointShaderHandle);
 }
 
 glm::mat4 TTK::Context::GetOrthoProjection() const {
@@ -45,40 +53,35 @@ void TTK::Context::RenderText(const char* text, const glm::vec2& position, const
 	TTK::FontRenderer::Instance().Render(*m_DefaultFont, text, position, color, scale);
 }
 
-void TTK::Context::DrawTeapot(const glm::mat4& mat, const glm::vec4& color) const {
+void TTK::Context::DrawTeapot(const glm::mat4& mat, const glm::vec4& color) {
 	m_MeshHelper->RenderTeapot(mat, color);
 }
 
-void TTK::Context::DrawSphere(const glm::mat4& mat, const glm::vec4& color) const {
+void TTK::Context::DrawSphere(const glm::mat4& mat, const glm::vec4& color) {
 	m_MeshHelper->RenderSphere(mat, color);
 }
 
-void TTK::Context::DrawCube(const glm::mat4& mat, const glm::vec4& color) const {
+void TTK::Context::DrawCube(const glm::mat4& mat, const glm::vec4& color) {
 	m_MeshHelper->RenderCube(mat, color);
 }
 
 void TTK::Context::AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color) {
-	m_LineVerts[m_Lines.Count + 0].Position = a;
-	m_LineVerts[m_Lines.Count + 0].Color = color;
-	m_LineVerts[m_Lines.Count + 1].Position = b;
-	m_LineVerts[m_Lines.Count + 1].Color = color;
-	m_Lines.Count += 2;
-	if (m_Lines.Count == MaxLineVerts) {
-		__Flush(m_Lines);
-	}
+	// We write straight into the mapped buffer, it will grow if this frame has more lines than it can hold
+	SimpleVert* verts = static_cast<SimpleVert*>(__Allocate(&Layer::Lines));
+	verts[0].Position = a;
+	verts[0].Color = color;
+	verts[1].Position = b;
+	verts[1].Color = color;
 }
 
 void TTK::Context::AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color) {
-	m_TriVerts[m_Tris.Count + 0].Position = a;
-	m_TriVerts[m_Tris.Count + 0].Color = color;
-	m_TriVerts[m_Tris.Count + 1].Position = b;
-	m_TriVerts[m_Tris.Count + 1].Color = color;
-	m_TriVerts[m_Tris.Count + 2].Position = c;
-	m_TriVerts[m_Tris.Count + 2].Color = color;
-	m_Tris.Count += 3;
-	if (m_Tris.Count == MaxTriVerts) {
-		__Flush(m_Tris);
-	}
+	SimpleVert* verts = static_cast<SimpleVert*>(__Allocate(&Layer::Tris));
+	verts[0].Position = a;
+	verts[0].Color = color;
+	verts[1].Position = b;
+	verts[1].Color = color;
+	verts[2].Position = c;
+	verts[2].Color = color;
 }
 
 void TTK::Context::AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color) {
@@ -90,25 +93,50 @@ void TTK::Context::AddQuad(const glm::vec3& min, const glm::vec3& max, const glm
 
 void TTK::Context::AddPoint(const glm::vec3& pos, float size, const glm::vec4& color)
 {
-	m_PointVerts[m_Points.Count].Position = pos;
-	m_PointVerts[m_Points.Count].Color = color;
-	m_PointVerts[m_Points.Count].Size = size;
-	m_Points.Count += 1;
-	if (m_Points.Count == MaxPointVerts) {
-		__Flush(m_Points);
-	}
+	PointVert* vert = static_cast<PointVert*>(__Allocate(&Layer::Points));
+	vert->Position = pos;
+	vert->Color = color;
+	vert->Size = size;
 }
 
 void TTK::Context::Flush() {
-	__Flush(m_Tris);
-	__Flush(m_Lines);
-	__Flush(m_Points);
+	m_MeshHelper->Flush(m_ViewProjection);
+	__FlushLayers(false);
+	if (SpriteBatch::IsCreated())
+		SpriteBatch::Instance().Flush();
+	// Text goes on top of everything else
+	if (FontRenderer::IsCreated())
+		FontRenderer::Instance().Flush();
+}
+
+void TTK::Context::EndFrame() {
+	m_MeshHelper->Flush(m_ViewProjection);
+	// Primitives with a duration are only drawn here, so that extra flushes during the frame don't draw them twice
+	__FlushLayers(true);
+	if (SpriteBatch::IsCreated()) {
+		SpriteBatch::Instance().Flush();
+		SpriteBatch::Instance().EndFrame();
+	}
+	if (FontRenderer::IsCreated()) {
+		FontRenderer::Instance().Flush();
+		FontRenderer::Instance().EndFrame();
+	}
+	m_MeshHelper->EndFrame();
+
+	m_Time = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_StartTime).count();
+	for (Layer& layer : m_Layers) {
+		for (GLBuff* buff : { &layer.Tris, &layer.Lines, &layer.Points }) {
+			buff->Stream->EndFrame();
+			__Expire(*buff);
+		}
+	}
 }
 
 TTK::Context::Context() {
 	m_Projection = glm::ortho(0.0f, 800.0f, 0.0f, 600.0f);
 	m_ViewMatrix = glm::mat4(1.0f);
-	m_DefaultFont = new TrueTypeTextureFont("C:\\\\Windows\\Fonts\\consola.ttf", 32);
+	// The default font is a distance field, so that DrawText2D stays crisp at any font size
+	m_DefaultFont = new TrueTypeTextureFont(m_DefaultFontPath.c_str(), 32, FontMode::DistanceField);
 	
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) uniform mat4 xTransform;
@@ -148,27 +176,33 @@ TTK::Context::Context() {
 	m_PointShaderHandle = __CompileShader(vsSourcePoint, fsSource);
 
 
-	m_Tris = __InitBuff(GL_TRIANGLES, m_ShaderHandle, m_TriVerts, sizeof(SimpleVert), MaxTriVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Color));
-
-	m_Lines = __InitBuff(GL_LINES, m_ShaderHandle, m_LineVerts, sizeof(SimpleVert), MaxLineVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Color));
-
-	m_Points = __InitBuff(GL_POINTS, m_PointShaderHandle, m_PointVerts, sizeof(PointVert), MaxLineVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Color));
-	glVertexAttribPointer(2, 1, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Size));
-
-	glBindVertexArray(0);
+	const char* layerNames[LayerCount] = { "World", "Overlay", "Screen" };
+	for (int ix = 0; ix < LayerCount; ix++) {
+		Layer& layer = m_Layers[ix];
+		std::string prefix = std::string("TTK ") + layerNames[ix];
+		__InitBuff(layer.Tris, GL_TRIANGLES, m_ShaderHandle, sizeof(SimpleVert), 3, InitialTriVerts, (prefix + " Triangles").c_str());
+		glVertexArrayAttribFormat(layer.Tris.VAO, 0, 3, GL_FLOAT, false, offsetof(SimpleVert, Position));
+		glVertexArrayAttribFormat(layer.Tris.VAO, 1, 4, GL_FLOAT, false, offsetof(SimpleVert, Color));
+
+		__InitBuff(layer.Lines, GL_LINES, m_ShaderHandle, sizeof(SimpleVert), 2, InitialLineVerts, (prefix + " Lines").c_str());
+		glVertexArrayAttribFormat(layer.Lines.VAO, 0, 3, GL_FLOAT, false, offsetof(SimpleVert, Position));
+		glVertexArrayAttribFormat(layer.Lines.VAO, 1, 4, GL_FLOAT, false, offsetof(SimpleVert, Color));
+
+		__InitBuff(layer.Points, GL_POINTS, m_PointShaderHandle, sizeof(PointVert), 1, InitialPointVerts, (prefix + " Points").c_str());
+		glVertexArrayAttribFormat(layer.Points.VAO, 0, 3, GL_FLOAT, false, offsetof(PointVert, Position));
+		glVertexArrayAttribFormat(layer.Points.VAO, 1, 4, GL_FLOAT, false, offsetof(PointVert, Color));
+		glVertexArrayAttribFormat(layer.Points.VAO, 2, 1, GL_FLOAT, false, offsetof(PointVert, Size));
+		glEnableVertexArrayAttrib(layer.Points.VAO, 2);
+		glVertexArrayAttribBinding(layer.Points.VAO, 2, 0);
+	}
+	// The world layer is depth tested like any other geometry, the rest are drawn on top of it
+	m_Layers[(int)DebugLayer::World].Settings   = { true,  true,  false, 0 };
+	m_Layers[(int)DebugLayer::Overlay].Settings = { false, false, false, 1 };
+	m_Layers[(int)DebugLayer::Screen].Settings  = { false, false, true,  2 };
+	m_CurrentLayer = DebugLayer::World;
+	m_CurrentDuration = 0.0f;
+	m_Time = 0.0f;
+	m_StartTime = std::chrono::steady_clock::now();
 
 	// Make sure that the mesh helper has a context
 	m_MeshHelper = new Impl::MeshHelper();
@@ -177,32 +211,145 @@ TTK::Context::Context() {
 	glEnable(GL_PROGRAM_POINT_SIZE);
 }
 
-TTK::Context::GLBuff TTK::Context::__InitBuff(GLenum mode, GLuint shader, void* dataSource, size_t elemSize, size_t maxElems)
+void TTK::Context::__InitBuff(GLBuff& buff, GLenum mode, GLuint shader, size_t elemSize, size_t primVerts, size_t initialElems, const char* name)
 {
-	GLBuff result;
-	result.Mode = mode;
-	result.Count = 0;
-	result.Data = dataSource;
-	result.ElemSize = elemSize;
-	result.Shader = shader;
-
-	glCreateVertexArrays(1, &result.VAO);
-	glBindVertexArray(result.VAO);
-	glCreateBuffers(1, &result.VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, result.VBO);
-	glNamedBufferData(result.VBO, elemSize * maxElems, nullptr, GL_STREAM_DRAW);
+	buff.Mode = mode;
+	buff.Shader = shader;
+	buff.PrimVerts = primVerts;
+	buff.Stream = new StreamBuffer(elemSize, initialElems, name);
+	buff.TimedVBO = 0;
+	buff.TimedCapacity = 0;
+	buff.TimedDirty = false;
+
+	// All of our layouts start with a position and color, which are read from binding 0
+	glCreateVertexArrays(1, &buff.VAO);
+	glEnableVertexArrayAttrib(buff.VAO, 0);
+	glEnableVertexArrayAttrib(buff.VAO, 1);
+	glVertexArrayAttribBinding(buff.VAO, 0, 0);
+	glVertexArrayAttribBinding(buff.VAO, 1, 0);
+}
 
-	return result;
+void TTK::Context::__DestroyBuff(GLBuff& buff) {
+	delete buff.Stream;
+	glDeleteBuffers(1, &buff.TimedVBO);
+	glDeleteVertexArrays(1, &buff.VAO);
+}
+
+void* TTK::Context::__Allocate(GLBuff Layer::* type) {
+	GLBuff& buff = m_Layers[(int)m_CurrentLayer].*type;
+	if (m_CurrentDuration <= 0.0f)
+		return buff.Stream->Allocate(buff.PrimVerts);
+
+	size_t primSize = buff.Stream->GetStride() * buff.PrimVerts;
+	buff.Timed.resize(buff.Timed.size() + primSize);
+	buff.TimedExpiry.push_back(m_Time + m_CurrentDuration);
+	buff.TimedDirty = true;
+	return buff.Timed.data() + buff.Timed.size() - primSize;
 }
 
-void TTK::Context::__Flush(GLBuff& buff) {
-	if (buff.Count > 0) {
+void TTK::Context::__FlushLayers(bool drawTimed) {
+	// Draw our layers in order, we only need to touch the depth state if something is actually drawn
+	Layer* sorted[LayerCount];
+	for (int ix = 0; ix < LayerCount; ix++)
+		sorted[ix] = &m_Layers[ix];
+	std::stable_sort(sorted, sorted + LayerCount, [](const Layer* a, const Layer* b) { return a->Settings.Order < b->Settings.Order; });
+
+	// We only query the user's depth state once we know we're going to change it, since queries can stall
+	GLboolean depthTest = GL_FALSE;
+	GLboolean depthWrite = GL_TRUE;
+	bool stateChanged = false;
+
+	for (Layer* layer : sorted) {
+		bool hasWork = false;
+		for (GLBuff* buff : { &layer->Tris, &layer->Lines, &layer->Points })
+			hasWork |= buff->Stream->GetPendingCount() > 0 || (drawTimed && !buff->TimedExpiry.empty());
+		if (!hasWork)
+			continue;
+
+		if (!stateChanged) {
+			depthTest = glIsEnabled(GL_DEPTH_TEST);
+			glGetBooleanv(GL_DEPTH_WRITEMASK, &depthWrite);
+		}
+		if (layer->Settings.DepthTest)
+			glEnable(GL_DEPTH_TEST);
+		else
+			glDisable(GL_DEPTH_TEST);
+		glDepthMask(layer->Settings.DepthWrite ? GL_TRUE : GL_FALSE);
+		stateChanged = true;
+
+		// Each primitive type has it's own buffer, so a layer is already grouped into one draw per pipeline. Tris
+		// and lines share a shader, so they are drawn back to back and only bind it once
+		glm::mat4 viewProjection = layer->Settings.ScreenSpace ? GetOrthoProjection() : m_ViewProjection;
+		GLuint boundShader = 0;
+		__Flush(layer->Tris, viewProjection, drawTimed, boundShader);
+		__Flush(layer->Lines, viewProjection, drawTimed, boundShader);
+		__Flush(layer->Points, viewProjection, drawTimed, boundShader);
+	}
+
+	// Put the depth state back to however the user had it
+	if (stateChanged) {
+		if (depthTest)
+			glEnable(GL_DEPTH_TEST);
+		else
+			glDisable(GL_DEPTH_TEST);
+		glDepthMask(depthWrite);
+	}
+}
+
+void TTK::Context::__Flush(GLBuff& buff, const glm::mat4& viewProjection, bool drawTimed, GLuint& boundShader) {
+	size_t count = buff.Stream->GetPendingCount();
+	size_t timedCount = drawTimed ? buff.TimedExpiry.size() * buff.PrimVerts : 0;
+	if (count == 0 && timedCount == 0)
+		return;
+
+	if (buff.Shader != boundShader) {
 		glUseProgram(buff.Shader);
-		glUniformMatrix4fv(0, 1, false, &m_ViewProjection[0][0]);
-		glNamedBufferSubData(buff.VBO, 0, buff.Count * buff.ElemSize, buff.Data);
-		glBindVertexArray(buff.VAO);
-		glDrawArrays(buff.Mode, 0, static_cast<GLsizei>(buff.Count));
-		buff.Count = 0;
+		glUniformMatrix4fv(0, 1, false, &viewProjection[0][0]);
+		boundShader = buff.Shader;
+	}
+	glBindVertexArray(buff.VAO);
+	GLsizei stride = static_cast<GLsizei>(buff.Stream->GetStride());
+
+	if (count > 0) {
+		// The stream's handle changes when it grows, so we bind it every time instead of once up front
+		glVertexArrayVertexBuffer(buff.VAO, 0, buff.Stream->GetHandle(), 0, stride);
+		glDrawArrays(buff.Mode, static_cast<GLint>(buff.Stream->GetPendingFirst()), static_cast<GLsizei>(count));
+		buff.Stream->MarkDrawn();
+	}
+
+	if (timedCount > 0) {
+		if (buff.TimedDirty) {
+			if (buff.Timed.size() > buff.TimedCapacity) {
+				glDeleteBuffers(1, &buff.TimedVBO);
+				glCreateBuffers(1, &buff.TimedVBO);
+				buff.TimedCapacity = buff.Timed.size() * 2;
+				glNamedBufferData(buff.TimedVBO, buff.TimedCapacity, nullptr, GL_DYNAMIC_DRAW);
+			}
+			glNamedBufferSubData(buff.TimedVBO, 0, buff.Timed.size(), buff.Timed.data());
+			buff.TimedDirty = false;
+		}
+		glVertexArrayVertexBuffer(buff.VAO, 0, buff.TimedVBO, 0, stride);
+		glDrawArrays(buff.Mode, 0, static_cast<GLsizei>(timedCount));
+	}
+}
+
+void TTK::Context::__Expire(GLBuff& buff) {
+	// Slide the primitives that are still alive down over the ones that have expired, keeping them in order
+	size_t primSize = buff.Stream->GetStride() * buff.PrimVerts;
+	size_t kept = 0;
+	for (size_t ix = 0; ix < buff.TimedExpiry.size(); ix++) {
+		if (buff.TimedExpiry[ix] > m_Time) {
+			if (kept != ix) {
+				buff.TimedExpiry[kept] = buff.TimedExpiry[ix];
+				memcpy(buff.Timed.data() + kept * primSize, buff.Timed.data() + ix * primSize, primSize);
+			}
+			kept++;
+		}
+	}
+	if (kept != buff.TimedExpiry.size()) {
+		buff.TimedExpiry.resize(kept);
+		buff.Timed.resize(kept * primSize);
+		buff.TimedDirty = true;
 	}
 }
 
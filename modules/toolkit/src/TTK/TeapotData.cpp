@@ -0,0 +1,1215 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library. 
+// You may not use this file in your GDW games.
+//
+// This file contains the Utah Teapot as an indexed mesh. Each position is
+// stored once, quantized to 16 bits per axis within the teapot's bounds,
+// see TeapotBoundsMin and TeapotBoundsMax in Teapot.h
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/Teapot.h"
+
+const uint16_t TeapotPositions[TeapotVertexCount * 3] = {
+	44492, 50669, 29042, 44634, 49931, 29004, 44817, 49931, 32768, 44674, 50669, 32768, 43965, 50669, 25523, 44101, 49931, 25450, 43119, 50669, 22255, 43246, 49931, 22149,
+	41982, 50669, 19282, 42098, 49931, 19145, 40580, 50669, 16646, 40682, 49931, 16482, 38941, 50669, 14391, 39027, 49931, 14205, 37093, 50669, 12562, 37159, 49931, 12357,
+	35061, 50669, 11202, 35107, 49931, 10983, 32873, 50669, 10353, 32897, 49931, 10126, 30557, 50669, 10061, 30557, 49931, 9830, 44436, 51242, 29057, 44618, 51242, 32768,
+	43911, 51242, 25552, 43069, 51242, 22297, 41936, 51242, 19335, 40540, 51242, 16710, 38908, 51242, 14465, 37067, 51242, 12643, 35043, 51242, 11288, 32864, 51242, 10443,
+	30557, 51242, 10151, 44455, 51652, 29052, 44636, 51652, 32768, 43929, 51652, 25543, 43085, 51652, 22283, 41951, 51652, 19318, 40553, 51652, 16689, 38919, 51652, 14440,
+	37075, 51652, 12616, 35049, 51652, 11259, 32867, 51652, 10413, 30557, 51652, 10121, 44535, 51897, 29030, 44717, 51897, 32768, 44006, 51897, 25501, 43158, 51897, 22223,
+	42017, 51897, 19240, 40611, 51897, 16596, 38967, 51897, 14335, 37113, 51897, 12500, 35075, 51897, 11135, 32881, 51897, 10284, 30557, 51897, 9991, 44665, 51979, 28996,
+	44849, 51979, 32768, 44131, 51979, 25433, 43275, 51979, 22125, 42123, 51979, 19114, 40704, 51979, 16446, 39045, 51979, 14163, 37174, 51979, 12311, 35117, 51979, 10934,
+	32902, 51979, 10075, 30557, 51979, 9779, 44833, 51897, 28951, 45019, 51897, 32768, 44292, 51897, 25346, 43426, 51897, 21998, 42261, 51897, 18952, 40825, 51897, 16252,
+	39146, 51897, 13942, 37252, 51897, 12068, 35171, 51897, 10675, 32930, 51897, 9806, 30557, 51897, 9506, 45026, 51652, 28899, 45215, 51652, 32768, 44478, 51652, 25246,
+	43600, 51652, 21852, 42419, 51652, 18765, 40964, 51652, 16028, 39263, 51652, 13687, 37343, 51652, 11788, 35234, 51652, 10375, 32962, 51652, 9495, 30557, 51652, 9191,
+	45233, 51242, 28844, 45424, 51242, 32768, 44677, 51242, 25138, 43787, 51242, 21696, 42589, 51242, 18565, 41113, 51242, 15789, 39387, 51242, 13415, 37440, 51242, 11488,
+	35300, 51242, 10055, 32997, 51242, 9162, 30557, 51242, 8854, 45441, 50669, 28788, 45635, 50669, 32768, 44878, 50669, 25030, 43974, 50669, 21539, 42760, 50669, 18363,
+	41263, 50669, 15548, 39512, 50669, 13140, 37538, 50669, 11186, 35368, 50669, 9733, 33031, 50669, 8827, 30557, 50669, 8514, 45639, 49931, 28735, 45836, 49931, 32768,
+	45068, 49931, 24927, 44153, 49931, 21390, 42922, 49931, 18172, 41405, 49931, 15319, 39631, 49931, 12879, 37631, 49931, 10899, 35432, 49931, 9427, 33064, 49931, 8508,
+	30557, 49931, 8192, 28241, 50669, 10353, 28217, 49931, 10126, 26053, 50669, 11202, 26008, 49931, 10983, 24022, 50669, 12562, 23955, 49931, 12357, 22173, 50669, 14391,
+	22088, 49931, 14205, 20534, 50669, 16646, 20433, 49931, 16482, 19133, 50669, 19282, 19017, 49931, 19145, 17996, 50669, 22255, 17868, 49931, 22149, 17150, 50669, 25523,
+	17014, 49931, 25450, 16622, 50669, 29042, 16481, 49931, 29004, 16440, 50669, 32768, 16297, 49931, 32768, 28250, 51242, 10443, 26071, 51242, 11288, 24048, 51242, 12643,
+	22206, 51242, 14465, 20574, 51242, 16710, 19178, 51242, 19335, 18046, 51242, 22297, 17203, 51242, 25552, 16678, 51242, 29057, 16497, 51242, 32768, 28247, 51652, 10413,
+	26065, 51652, 11259, 24039, 51652, 12616, 22195, 51652, 14440, 20561, 51652, 16689, 19163, 51652, 19318, 18029, 51652, 22283, 17186, 51652, 25543, 16660, 51652, 29052,
+	16478, 51652, 32768, 28234, 51897, 10284, 26040, 51897, 11135, 24002, 51897, 12500, 22147, 51897, 14335, 20503, 51897, 16596, 19098, 51897, 19240, 17957, 51897, 22223,
+	17108, 51897, 25501, 16579, 51897, 29030, 16397, 51897, 32768, 28212, 51979, 10075, 25998, 51979, 10934, 23941, 51979, 12311, 22069, 51979, 14163, 20410, 51979, 16446,
+	18991, 51979, 19114, 17840, 51979, 22125, 16983, 51979, 25433, 16449, 51979, 28996, 16265, 51979, 32768, 28184, 51897, 9806, 25943, 51897, 10675, 23862, 51897, 12068,
+	21968, 51897, 13942, 20289, 51897, 16252, 18854, 51897, 18952, 17689, 51897, 21998, 16822, 51897, 25346, 16282, 51897, 28951, 16095, 51897, 32768, 28152, 51652, 9495,
+	25881, 51652, 10375, 23771, 51652, 11788, 21852, 51652, 13687, 20150, 51652, 16028, 18695, 51652, 18765, 17514, 51652, 21852, 16636, 51652, 25246, 16088, 51652, 28899,
+	15900, 51652, 32768, 28118, 51242, 9162, 25814, 51242, 10055, 23674, 51242, 11488, 21727, 51242, 13415, 20002, 51242, 15789, 18526, 51242, 18565, 17328, 51242, 21696,
+	16437, 51242, 25138, 15882, 51242, 28844, 15690, 51242, 32768, 28083, 50669, 8827, 25747, 50669, 9733, 23577, 50669, 11186, 21602, 50669, 13140, 19852, 50669, 15548,
+	18355, 50669, 18363, 17140, 50669, 21539, 16237, 50669, 25030, 15673, 50669, 28788, 15479, 50669, 32768, 28050, 49931, 8508, 25683, 49931, 9427, 23484, 49931, 10899,
+	21483, 49931, 12879, 19709, 49931, 15319, 18193, 49931, 18172, 16962, 49931, 21390, 16046, 49931, 24927, 15475, 49931, 28735, 15279, 49931, 32768, 16622, 50669, 36493,
+	16481, 49931, 36531, 17150, 50669, 40012, 17014, 49931, 40085, 17996, 50669, 43280, 17868, 49931, 43386, 19133, 50669, 46253, 19017, 49931, 46390, 20534, 50669, 48889,
+	20433, 49931, 49053, 22173, 50669, 51144, 22088, 49931, 51330, 24022, 50669, 52973, 23955, 49931, 53178, 26053, 50669, 54333, 26008, 49931, 54552, 28241, 50669, 55182,
+	28217, 49931, 55409, 30557, 50669, 55474, 30557, 49931, 55705, 16678, 51242, 36478, 17203, 51242, 39983, 18046, 51242, 43238, 19178, 51242, 46200, 20574, 51242, 48825,
+	22206, 51242, 51070, 24048, 51242, 52892, 26071, 51242, 54247, 28250, 51242, 55092, 30557, 51242, 55384, 16660, 51652, 36483, 17186, 51652, 39992, 18029, 51652, 43252,
+	19163, 51652, 46217, 20561, 51652, 48846, 22195, 51652, 51095, 24039, 51652, 52919, 26065, 51652, 54276, 28247, 51652, 55122, 30557, 51652, 55414, 16579, 51897, 36505,
+	17108, 51897, 40034, 17957, 51897, 43312, 19098, 51897, 46295, 20503, 51897, 48939, 22147, 51897, 51200, 24002, 51897, 53035, 26040, 51897, 54400, 28234, 51897, 55251,
+	30557, 51897, 55544, 16449, 51979, 36539, 16983, 51979, 40102, 17840, 51979, 43410, 18991, 51979, 46421, 20410, 51979, 49089, 22069, 51979, 51372, 23941, 51979, 53224,
+	25998, 51979, 54601, 28212, 51979, 55460, 30557, 51979, 55756, 16282, 51897, 36584, 16822, 51897, 40189, 17689, 51897, 43537, 18854, 51897, 46583, 20289, 51897, 49283,
+	21968, 51897, 51593, 23862, 51897, 53467, 25943, 51897, 54860, 28184, 51897, 55729, 30557, 51897, 56029, 16088, 51652, 36636, 16636, 51652, 40289, 17514, 51652, 43683,
+	18695, 51652, 46770, 20150, 51652, 49507, 21852, 51652, 51848, 23771, 51652, 53747, 25881, 51652, 55160, 28152, 51652, 56040, 30557, 51652, 56344, 15882, 51242, 36691,
+	16437, 51242, 40397, 17328, 51242, 43839, 18526, 51242, 46970, 20002, 51242, 49746, 21727, 51242, 52120, 23674, 51242, 54047, 25814, 51242, 55480, 28118, 51242, 56373,
+	30557, 51242, 56681, 15673, 50669, 36747, 16237, 50669, 40505, 17140, 50669, 43996, 18355, 50669, 47172, 19852, 50669, 49987, 21602, 50669, 52395, 23577, 50669, 54349,
+	25747, 50669, 55802, 28083, 50669, 56708, 30557, 50669, 57021, 15475, 49931, 36800, 16046, 49931, 40608, 16962, 49931, 44145, 18193, 49931, 47363, 19709, 49931, 50216,
+	21483, 49931, 52656, 23484, 49931, 54636, 25683, 49931, 56108, 28050, 49931, 57027, 30557, 49931, 57343, 32873, 50669, 55182, 32897, 49931, 55409, 35061, 50669, 54333,
+	35107, 49931, 54552, 37093, 50669, 52973, 37159, 49931, 53178, 38941, 50669, 51144, 39027, 49931, 51330, 40580, 50669, 48889, 40682, 49931, 49053, 41982, 50669, 46253,
+	42098, 49931, 46390, 43119, 50669, 43280, 43246, 49931, 43386, 43965, 50669, 40012, 44101, 49931, 40085, 44492, 50669, 36493, 44634, 49931, 36531, 32864, 51242, 55092,
+	35043, 51242, 54247, 37067, 51242, 52892, 38908, 51242, 51070, 40540, 51242, 48825, 41936, 51242, 46200, 43069, 51242, 43238, 43911, 51242, 39983, 44436, 51242, 36478,
+	32867, 51652, 55122, 35049, 51652, 54276, 37075, 51652, 52919, 38919, 51652, 51095, 40553, 51652, 48846, 41951, 51652, 46217, 43085, 51652, 43252, 43929, 51652, 39992,
+	44455, 51652, 36483, 32881, 51897, 55251, 35075, 51897, 54400, 37113, 51897, 53035, 38967, 51897, 51200, 40611, 51897, 48939, 42017, 51897, 46295, 43158, 51897, 43312,
+	44006, 51897, 40034, 44535, 51897, 36505, 32902, 51979, 55460, 35117, 51979, 54601, 37174, 51979, 53224, 39045, 51979, 51372, 40704, 51979, 49089, 42123, 51979, 46421,
+	43275, 51979, 43410, 44131, 51979, 40102, 44665, 51979, 36539, 32930, 51897, 55729, 35171, 51897, 54860, 37252, 51897, 53467, 39146, 51897, 51593, 40825, 51897, 49283,
+	42261, 51897, 46583, 43426, 51897, 43537, 44292, 51897, 40189, 44833, 51897, 36584, 32962, 51652, 56040, 35234, 51652, 55160, 37343, 51652, 53747, 39263, 51652, 51848,
+	40964, 51652, 49507, 42419, 51652, 46770, 43600, 51652, 43683, 44478, 51652, 40289, 45026, 51652, 36636, 32997, 51242, 56373, 35300, 51242, 55480, 37440, 51242, 54047,
+	39387, 51242, 52120, 41113, 51242, 49746, 42589, 51242, 46970, 43787, 51242, 43839, 44677, 51242, 40397, 45233, 51242, 36691, 33031, 50669, 56708, 35368, 50669, 55802,
+	37538, 50669, 54349, 39512, 50669, 52395, 41263, 50669, 49987, 42760, 50669, 47172, 43974, 50669, 43996, 44878, 50669, 40505, 45441, 50669, 36747, 33064, 49931, 57027,
+	35432, 49931, 56108, 37631, 49931, 54636, 39631, 49931, 52656, 41405, 49931, 50216, 42922, 49931, 47363, 44153, 49931, 44145, 45068, 49931, 40608, 45639, 49931, 36800,
+	46391, 46656, 28534, 46597, 46656, 32768, 45791, 46656, 24536, 44830, 46656, 20823, 43538, 46656, 17444, 41946, 46656, 14449, 40084, 46656, 11888, 37983, 46656, 9809,
+	35675, 46656, 8263, 33189, 46656, 7299, 30557, 46656, 6967, 47127, 43390, 28337, 47343, 43390, 32768, 46500, 43390, 24153, 45494, 43390, 20267, 44142, 43390, 16731,
+	42475, 43390, 13597, 40527, 43390, 10917, 38329, 43390, 8741, 35913, 43390, 7124, 33311, 43390, 6115, 30557, 43390, 5767, 47833, 40143, 28148, 48059, 40143, 32768,
+	47179, 40143, 23786, 46131, 40143, 19735, 44721, 40143, 16048, 42983, 40143, 12780, 40952, 40143, 9985, 38660, 40143, 7717, 36141, 40143, 6031, 33429, 40143, 4979,
+	30557, 40143, 4616, 48494, 36924, 27972, 48729, 36924, 32768, 47816, 36924, 23442, 46727, 36924, 19236, 45263, 36924, 15408, 43459, 36924, 12015, 41349, 36924, 9113,
+	38970, 36924, 6759, 36355, 36924, 5007, 33539, 36924, 3915, 30557, 36924, 3539, 49095, 33743, 27811, 49337, 33743, 32768, 48394, 33743, 23130, 47268, 33743, 18783,
+	45755, 33743, 14827, 43891, 33743, 11320, 41711, 33743, 8321, 39252, 33743, 5888, 36549, 33743, 4078, 33639, 33743, 2949, 30557, 33743, 2560, 49621, 30608, 27671,
+	49869, 30608, 32768, 48899, 30608, 22857, 47742, 30608, 18386, 46186, 30608, 14318, 44269, 30608, 10712, 42027, 30608, 7628, 39498, 30608, 5126, 36719, 30608, 3264,
+	33726, 30608, 2104, 30557, 30608, 1704, 50055, 27529, 27554, 50310, 27529, 32768, 49317, 27529, 22631, 48134, 27529, 18058, 46543, 27529, 13897, 44582, 27529, 10209,
+	42289, 27529, 7055, 39702, 27529, 4495, 36859, 27529, 2592, 33798, 27529, 1405, 30557, 27529, 995, 50385, 24516, 27466, 50643, 24516, 32768, 49634, 24516, 22460,
+	48431, 24516, 17810, 46813, 24516, 13579, 44818, 24516, 9828, 42487, 24516, 6621, 39856, 24516, 4018, 36966, 24516, 2082, 33853, 24516, 875, 30557, 24516, 459,
+	50593, 21578, 27411, 50855, 21578, 32768, 49835, 21578, 22351, 48619, 21578, 17653, 46984, 21578, 13377, 44968, 21578, 9587, 42612, 21578, 6346, 39954, 21578, 3715,
+	37033, 21578, 1759, 33888, 21578, 539, 30557, 21578, 119, 50666, 18724, 27391, 50929, 18724, 32768, 49905, 18724, 22313, 48685, 18724, 17597, 47043, 18724, 13306,
+	45021, 18724, 9503, 42656, 18724, 6249, 39988, 18724, 3610, 37057, 18724, 1646, 33900, 18724, 422, 30557, 18724, 0, 27925, 46656, 7299, 25440, 46656, 8263,
+	23131, 46656, 9809, 21031, 46656, 11888, 19169, 46656, 14449, 17576, 46656, 17444, 16284, 46656, 20823, 15323, 46656, 24536, 14724, 46656, 28534, 14517, 46656, 32768,
+	27803, 43390, 6115, 25202, 43390, 7124, 22786, 43390, 8741, 20588, 43390, 10917, 18639, 43390, 13597, 16973, 43390, 16731, 15620, 43390, 20267, 14614, 43390, 24153,
+	13987, 43390, 28337, 13771, 43390, 32768, 27686, 40143, 4979, 24973, 40143, 6031, 22455, 40143, 7717, 20163, 40143, 9985, 18131, 40143, 12780, 16393, 40143, 16048,
+	14984, 40143, 19735, 13935, 40143, 23786, 13281, 40143, 28148, 13056, 40143, 32768, 27576, 36924, 3915, 24760, 36924, 5007, 22145, 36924, 6759, 19765, 36924, 9113,
+	17656, 36924, 12015, 15851, 36924, 15408, 14388, 36924, 19236, 13299, 36924, 23442, 12620, 36924, 27972, 12386, 36924, 32768, 27476, 33743, 2949, 24566, 33743, 4078,
+	21863, 33743, 5888, 19403, 33743, 8321, 17223, 33743, 11320, 15359, 33743, 14827, 13846, 33743, 18783, 12721, 33743, 23130, 12019, 33743, 27811, 11777, 33743, 32768,
+	27388, 30608, 2104, 24396, 30608, 3264, 21616, 30608, 5126, 19087, 30608, 7628, 16846, 30608, 10712, 14928, 30608, 14318, 13372, 30608, 18386, 12215, 30608, 22857,
+	11494, 30608, 27671, 11245, 30608, 32768, 27316, 27529, 1405, 24255, 27529, 2592, 21412, 27529, 4495, 18826, 27529, 7055, 16533, 27529, 10209, 14572, 27529, 13897,
+	12980, 27529, 18058, 11797, 27529, 22631, 11059, 27529, 27554, 10805, 27529, 32768, 27261, 24516, 875, 24149, 24516, 2082, 21258, 24516, 4018, 18628, 24516, 6621,
+	16296, 24516, 9828, 14302, 24516, 13579, 12684, 24516, 17810, 11480, 24516, 22460, 10730, 24516, 27466, 10471, 24516, 32768, 27227, 21578, 539, 24081, 21578, 1759,
+	21160, 21578, 3715, 18502, 21578, 6346, 16146, 21578, 9587, 14131, 21578, 13377, 12496, 21578, 17653, 11279, 21578, 22351, 10521, 21578, 27411, 10260, 21578, 32768,
+	27215, 18724, 422, 24058, 18724, 1646, 21126, 18724, 3610, 18458, 18724, 6249, 16093, 18724, 9503, 14071, 18724, 13306, 12430, 18724, 17597, 11209, 18724, 22313,
+	10448, 18724, 27391, 10186, 18724, 32768, 14724, 46656, 37001, 15323, 46656, 40999, 16284, 46656, 44712, 17576, 46656, 48091, 19169, 46656, 51086, 21031, 46656, 53647,
+	23131, 46656, 55726, 25440, 46656, 57272, 27925, 46656, 58236, 30557, 46656, 58568, 13987, 43390, 37198, 14614, 43390, 41382, 15620, 43390, 45268, 16973, 43390, 48804,
+	18639, 43390, 51938, 20588, 43390, 54618, 22786, 43390, 56794, 25202, 43390, 58411, 27803, 43390, 59420, 30557, 43390, 59768, 13281, 40143, 37387, 13935, 40143, 41749,
+	14984, 40143, 45800, 16393, 40143, 49487, 18131, 40143, 52755, 20163, 40143, 55550, 22455, 40143, 57818, 24973, 40143, 59504, 27686, 40143, 60556, 30557, 40143, 60919,
+	12620, 36924, 37563, 13299, 36924, 42093, 14388, 36924, 46299, 15851, 36924, 50127, 17656, 36924, 53520, 19765, 36924, 56422, 22145, 36924, 58776, 24760, 36924, 60528,
+	27576, 36924, 61620, 30557, 36924, 61996, 12019, 33743, 37724, 12721, 33743, 42405, 13846, 33743, 46752, 15359, 33743, 50708, 17223, 33743, 54215, 19403, 33743, 57214,
+	21863, 33743, 59647, 24566, 33743, 61457, 27476, 33743, 62586, 30557, 33743, 62975, 11494, 30608, 37864, 12215, 30608, 42678, 13372, 30608, 47149, 14928, 30608, 51217,
+	16846, 30608, 54823, 19087, 30608, 57907, 21616, 30608, 60409, 24396, 30608, 62271, 27388, 30608, 63431, 30557, 30608, 63831, 11059, 27529, 37981, 11797, 27529, 42904,
+	12980, 27529, 47477, 14572, 27529, 51638, 16533, 27529, 55326, 18826, 27529, 58480, 21412, 27529, 61040, 24255, 27529, 62943, 27316, 27529, 64130, 30557, 27529, 64540,
+	10730, 24516, 38069, 11480, 24516, 43075, 12684, 24516, 47725, 14302, 24516, 51956, 16296, 24516, 55707, 18628, 24516, 58914, 21258, 24516, 61517, 24149, 24516, 63453,
+	27261, 24516, 64660, 30557, 24516, 65076, 10521, 21578, 38124, 11279, 21578, 43184, 12496, 21578, 47882, 14131, 21578, 52158, 16146, 21578, 55948, 18502, 21578, 59189,
+	21160, 21578, 61820, 24081, 21578, 63776, 27227, 21578, 64996, 30557, 21578, 65416, 10448, 18724, 38144, 11209, 18724, 43222, 12430, 18724, 47938, 14071, 18724, 52229,
+	16093, 18724, 56032, 18458, 18724, 59286, 21126, 18724, 61925, 24058, 18724, 63889, 27215, 18724, 65113, 30557, 18724, 65535, 33189, 46656, 58236, 35675, 46656, 57272,
+	37983, 46656, 55726, 40084, 46656, 53647, 41946, 46656, 51086, 43538, 46656, 48091, 44830, 46656, 44712, 45791, 46656, 40999, 46391, 46656, 37001, 33311, 43390, 59420,
+	35913, 43390, 58411, 38329, 43390, 56794, 40527, 43390, 54618, 42475, 43390, 51938, 44142, 43390, 48804, 45494, 43390, 45268, 46500, 43390, 41382, 47127, 43390, 37198,
+	33429, 40143, 60556, 36141, 40143, 59504, 38660, 40143, 57818, 40952, 40143, 55550, 42983, 40143, 52755, 44721, 40143, 49487, 46131, 40143, 45800, 47179, 40143, 41749,
+	47833, 40143, 37387, 33539, 36924, 61620, 36355, 36924, 60528, 38970, 36924, 58776, 41349, 36924, 56422, 43459, 36924, 53520, 45263, 36924, 50127, 46727, 36924, 46299,
+	47816, 36924, 42093, 48494, 36924, 37563, 33639, 33743, 62586, 36549, 33743, 61457, 39252, 33743, 59647, 41711, 33743, 57214, 43891, 33743, 54215, 45755, 33743, 50708,
+	47268, 33743, 46752, 48394, 33743, 42405, 49095, 33743, 37724, 33726, 30608, 63431, 36719, 30608, 62271, 39498, 30608, 60409, 42027, 30608, 57907, 44269, 30608, 54823,
+	46186, 30608, 51217, 47742, 30608, 47149, 48899, 30608, 42678, 49621, 30608, 37864, 33798, 27529, 64130, 36859, 27529, 62943, 39702, 27529, 61040, 42289, 27529, 58480,
+	44582, 27529, 55326, 46543, 27529, 51638, 48134, 27529, 47477, 49317, 27529, 42904, 50055, 27529, 37981, 33853, 24516, 64660, 36966, 24516, 63453, 39856, 24516, 61517,
+	42487, 24516, 58914, 44818, 24516, 55707, 46813, 24516, 51956, 48431, 24516, 47725, 49634, 24516, 43075, 50385, 24516, 38069, 33888, 21578, 64996, 37033, 21578, 63776,
+	39954, 21578, 61820, 42612, 21578, 59189, 44968, 21578, 55948, 46984, 21578, 52158, 48619, 21578, 47882, 49835, 21578, 43184, 50593, 21578, 38124, 33900, 18724, 65113,
+	37057, 18724, 63889, 39988, 18724, 61925, 42656, 18724, 59286, 45021, 18724, 56032, 47043, 18724, 52229, 48685, 18724, 47938, 49905, 18724, 43222, 50666, 18724, 38144,
+	50526, 16054, 27429, 50786, 16054, 32768, 49770, 16054, 22387, 48558, 16054, 17704, 46928, 16054, 13442, 44920, 16054, 9665, 42572, 16054, 6435, 39922, 16054, 3814,
+	37011, 16054, 1864, 33876, 16054, 648, 30557, 16054, 229, 50143, 13656, 27531, 50399, 13656, 32768, 49402, 13656, 22585, 48213, 13656, 17992, 46615, 13656, 13812,
+	44645, 13656, 10107, 42342, 13656, 6939, 39743, 13656, 4368, 36888, 13656, 2455, 33813, 13656, 1263, 30557, 13656, 852, 49580, 11520, 27681, 49829, 11520, 32768,
+	48860, 11520, 22878, 47706, 11520, 18417, 46153, 11520, 14357, 44240, 11520, 10759, 42003, 11520, 7681, 39479, 11520, 5184, 36706, 11520, 3327, 33719, 11520, 2169,
+	30557, 11520, 1769, 48897, 9637, 27864, 49136, 9637, 32768, 48203, 9637, 23233, 47089, 9637, 18932, 45593, 9637, 15019, 43748, 9637, 11550, 41592, 9637, 8583,
+	39158, 9637, 6176, 36485, 9637, 4385, 33606, 9637, 3268, 30557, 9637, 2884, 48153, 7997, 28063, 48382, 7997, 32768, 47487, 7997, 23620, 46419, 7997, 19494,
+	44983, 7997, 15739, 43213, 7997, 12411, 41144, 7997, 9564, 38809, 7997, 7254, 36244, 7997, 5536, 33482, 7997, 4465, 30557, 7997, 4096, 47409, 6591, 28262,
+	47628, 6591, 32768, 46771, 6591, 24007, 45748, 6591, 20055, 44373, 6591, 16459, 42678, 6591, 13271, 40696, 6591, 10545, 38461, 6591, 8333, 36004, 6591, 6688,
+	33358, 6591, 5662, 30557, 6591, 5308, 46725, 5410, 28445, 46936, 5410, 32768, 46113, 5410, 24362, 45132, 5410, 20571, 43812, 5410, 17121, 42186, 5410, 14063,
+	40285, 5410, 11447, 38140, 5410, 9325, 35783, 5410, 7746, 33245, 5410, 6762, 30557, 5410, 6422, 46162, 4444, 28595, 46365, 4444, 32768, 45571, 4444, 24655,
+	44624, 4444, 20996, 43350, 4444, 17666, 41781, 4444, 14714, 39946, 4444, 12190, 37876, 4444, 10141, 35601, 4444, 8617, 33151, 4444, 7667, 30557, 4444, 7340,
+	45780, 3684, 28697, 45978, 3684, 32768, 45204, 3684, 24854, 44280, 3684, 21284, 43037, 3684, 18035, 41506, 3684, 15156, 39716, 3684, 12693, 37697, 3684, 10695,
+	35477, 3684, 9209, 33088, 3684, 8282, 30557, 3684, 7963, 45639, 3121, 28735, 45836, 3121, 32768, 45068, 3121, 24927, 44153, 3121, 21390, 42922, 3121, 18172,
+	41405, 3121, 15319, 39631, 3121, 12879, 37631, 3121, 10899, 35432, 3121, 9427, 33064, 3121, 8508, 30557, 3121, 8192, 27238, 16054, 648, 24103, 16054, 1864,
+	21192, 16054, 3814, 18543, 16054, 6435, 16195, 16054, 9665, 14186, 16054, 13442, 12557, 16054, 17704, 11345, 16054, 22387, 10589, 16054, 27429, 10328, 16054, 32768,
+	27302, 13656, 1263, 24227, 13656, 2455, 21371, 13656, 4368, 18773, 13656, 6939, 16470, 13656, 10107, 14500, 13656, 13812, 12901, 13656, 17992, 11712, 13656, 22585,
+	10971, 13656, 27531, 10715, 13656, 32768, 27395, 11520, 2169, 24409, 11520, 3327, 21635, 11520, 5184, 19111, 11520, 7681, 16874, 11520, 10759, 14961, 11520, 14357,
+	13409, 11520, 18417, 12254, 11520, 22878, 11534, 11520, 27681, 11286, 11520, 32768, 27509, 9637, 3268, 24630, 9637, 4385, 21956, 9637, 6176, 19523, 9637, 8583,
+	17366, 9637, 11550, 15522, 9637, 15019, 14025, 9637, 18932, 12912, 9637, 23233, 12218, 9637, 27864, 11978, 9637, 32768, 27632, 7997, 4465, 24870, 7997, 5536,
+	22305, 7997, 7254, 19971, 7997, 9564, 17901, 7997, 12411, 16132, 7997, 15739, 14696, 7997, 19494, 13628, 7997, 23620, 12962, 7997, 28063, 12732, 7997, 32768,
+	27756, 6591, 5662, 25111, 6591, 6688, 22654, 6591, 8333, 20418, 6591, 10545, 18437, 6591, 13271, 16742, 6591, 16459, 15367, 6591, 20055, 14344, 6591, 24007,
+	13706, 6591, 28262, 13486, 6591, 32768, 27870, 5410, 6762, 25332, 5410, 7746, 22975, 5410, 9325, 20830, 5410, 11447, 18928, 5410, 14063, 17302, 5410, 17121,
+	15983, 5410, 20571, 15001, 5410, 24362, 14389, 5410, 28445, 14179, 5410, 32768, 27963, 4444, 7667, 25514, 4444, 8617, 23239, 4444, 10141, 21168, 4444, 12190,
+	19333, 4444, 14714, 17764, 4444, 17666, 16490, 4444, 20996, 15543, 4444, 24655, 14953, 4444, 28595, 14749, 4444, 32768, 28027, 3684, 8282, 25637, 3684, 9209,
+	23418, 3684, 10695, 21398, 3684, 12693, 19608, 3684, 15156, 18077, 3684, 18035, 16835, 3684, 21284, 15911, 3684, 24854, 15335, 3684, 28697, 15136, 3684, 32768,
+	28050, 3121, 8508, 25683, 3121, 9427, 23484, 3121, 10899, 21483, 3121, 12879, 19709, 3121, 15319, 18193, 3121, 18172, 16962, 3121, 21390, 16046, 3121, 24927,
+	15475, 3121, 28735, 15279, 3121, 32768, 10589, 16054, 38106, 11345, 16054, 43148, 12557, 16054, 47831, 14186, 16054, 52093, 16195, 16054, 55870, 18543, 16054, 59100,
+	21192, 16054, 61721, 24103, 16054, 63671, 27238, 16054, 64887, 30557, 16054, 65306, 10971, 13656, 38004, 11712, 13656, 42950, 12901, 13656, 47543, 14500, 13656, 51723,
+	16470, 13656, 55428, 18773, 13656, 58596, 21371, 13656, 61167, 24227, 13656, 63080, 27302, 13656, 64272, 30557, 13656, 64683, 11534, 11520, 37854, 12254, 11520, 42657,
+	13409, 11520, 47118, 14961, 11520, 51178, 16874, 11520, 54776, 19111, 11520, 57854, 21635, 11520, 60351, 24409, 11520, 62208, 27395, 11520, 63366, 30557, 11520, 63766,
+	12218, 9637, 37671, 12912, 9637, 42302, 14025, 9637, 46603, 15522, 9637, 50516, 17366, 9637, 53985, 19523, 9637, 56952, 21956, 9637, 59359, 24630, 9637, 61150,
+	27509, 9637, 62267, 30557, 9637, 62651, 12962, 7997, 37472, 13628, 7997, 41915, 14696, 7997, 46041, 16132, 7997, 49796, 17901, 7997, 53124, 19971, 7997, 55971,
+	22305, 7997, 58281, 24870, 7997, 59999, 27632, 7997, 61070, 30557, 7997, 61439, 13706, 6591, 37273, 14344, 6591, 41528, 15367, 6591, 45480, 16742, 6591, 49076,
+	18437, 6591, 52264, 20418, 6591, 54990, 22654, 6591, 57202, 25111, 6591, 58847, 27756, 6591, 59873, 30557, 6591, 60227, 14389, 5410, 37090, 15001, 5410, 41173,
+	15983, 5410, 44964, 17302, 5410, 48414, 18928, 5410, 51472, 20830, 5410, 54088, 22975, 5410, 56210, 25332, 5410, 57789, 27870, 5410, 58773, 30557, 5410, 59113,
+	14953, 4444, 36940, 15543, 4444, 40880, 16490, 4444, 44539, 17764, 4444, 47869, 19333, 4444, 50821, 21168, 4444, 53345, 23239, 4444, 55394, 25514, 4444, 56918,
+	27963, 4444, 57868, 30557, 4444, 58195, 15335, 3684, 36838, 15911, 3684, 40681, 16835, 3684, 44251, 18077, 3684, 47500, 19608, 3684, 50379, 21398, 3684, 52842,
+	23418, 3684, 54840, 25637, 3684, 56326, 28027, 3684, 57253, 30557, 3684, 57572, 15475, 3121, 36800, 16046, 3121, 40608, 16962, 3121, 44145, 18193, 3121, 47363,
+	19709, 3121, 50216, 21483, 3121, 52656, 23484, 3121, 54636, 25683, 3121, 56108, 28050, 3121, 57027, 30557, 3121, 57343, 33876, 16054, 64887, 37011, 16054, 63671,
+	39922, 16054, 61721, 42572, 16054, 59100, 44920, 16054, 55870, 46928, 16054, 52093, 48558, 16054, 47831, 49770, 16054, 43148, 50526, 16054, 38106, 33813, 13656, 64272,
+	36888, 13656, 63080, 39743, 13656, 61167, 42342, 13656, 58596, 44645, 13656, 55428, 46615, 13656, 51723, 48213, 13656, 47543, 49402, 13656, 42950, 50143, 13656, 38004,
+	33719, 11520, 63366, 36706, 11520, 62208, 39479, 11520, 60351, 42003, 11520, 57854, 44240, 11520, 54776, 46153, 11520, 51178, 47706, 11520, 47118, 48860, 11520, 42657,
+	49580, 11520, 37854, 33606, 9637, 62267, 36485, 9637, 61150, 39158, 9637, 59359, 41592, 9637, 56952, 43748, 9637, 53985, 45593, 9637, 50516, 47089, 9637, 46603,
+	48203, 9637, 42302, 48897, 9637, 37671, 33482, 7997, 61070, 36244, 7997, 59999, 38809, 7997, 58281, 41144, 7997, 55971, 43213, 7997, 53124, 44983, 7997, 49796,
+	46419, 7997, 46041, 47487, 7997, 41915, 48153, 7997, 37472, 33358, 6591, 59873, 36004, 6591, 58847, 38461, 6591, 57202, 40696, 6591, 54990, 42678, 6591, 52264,
+	44373, 6591, 49076, 45748, 6591, 45480, 46771, 6591, 41528, 47409, 6591, 37273, 33245, 5410, 58773, 35783, 5410, 57789, 38140, 5410, 56210, 40285, 5410, 54088,
+	42186, 5410, 51472, 43812, 5410, 48414, 45132, 5410, 44964, 46113, 5410, 41173, 46725, 5410, 37090, 33151, 4444, 57868, 35601, 4444, 56918, 37876, 4444, 55394,
+	39946, 4444, 53345, 41781, 4444, 50821, 43350, 4444, 47869, 44624, 4444, 44539, 45571, 4444, 40880, 46162, 4444, 36940, 33088, 3684, 57253, 35477, 3684, 56326,
+	37697, 3684, 54840, 39716, 3684, 52842, 41506, 3684, 50379, 43037, 3684, 47500, 44280, 3684, 44251, 45204, 3684, 40681, 45780, 3684, 36838, 33064, 3121, 57027,
+	35432, 3121, 56108, 37631, 3121, 54636, 39631, 3121, 52656, 41405, 3121, 50216, 42922, 3121, 47363, 44153, 3121, 44145, 45068, 3121, 40608, 45639, 3121, 36800,
+	12218, 42256, 31440, 14289, 42261, 31440, 14260, 42130, 32768, 12214, 42125, 32768, 12231, 42611, 30408, 14366, 42616, 30408, 12249, 43135, 29671, 14480, 43141, 29671,
+	12271, 43771, 29229, 14619, 43777, 29229, 12295, 44463, 29081, 14769, 44470, 29081, 12319, 45155, 29229, 14920, 45163, 29229, 12341, 45791, 29671, 15059, 45800, 29671,
+	12359, 46315, 30408, 15173, 46324, 30408, 12371, 46670, 31440, 15250, 46680, 31440, 12376, 46801, 32768, 15279, 46811, 32768, 10341, 42222, 31440, 10357, 42092, 32768,
+	10297, 42575, 30408, 10232, 43095, 29671, 10153, 43727, 29229, 10068, 44414, 29081, 9982, 45101, 29229, 9903, 45733, 29671, 9839, 46253, 30408, 9794, 46606, 31440,
+	9778, 46736, 32768, 8662, 42131, 31440, 8696, 42003, 32768, 8570, 42477, 30408, 8434, 42987, 29671, 8270, 43607, 29229, 8091, 44281, 29081, 7912, 44955, 29229,
+	7748, 45574, 29671, 7612, 46084, 30408, 7520, 46430, 31440, 7487, 46558, 32768, 7187, 41953, 31440, 7236, 41830, 32768, 7055, 42286, 30408, 6861, 42776, 29671,
+	6625, 43372, 29229, 6368, 44021, 29081, 6111, 44669, 29229, 5875, 45265, 29671, 5681, 45756, 30408, 5549, 46089, 31440, 5500, 46212, 32768, 5924, 41659, 31440,
+	5984, 41545, 32768, 5759, 41970, 30408, 5517, 42429, 29671, 5222, 42986, 29229, 4902, 43592, 29081, 4582, 44199, 29229, 4287, 44756, 29671, 4045, 45214, 30408,
+	3880, 45526, 31440, 3820, 45640, 32768, 4876, 41221, 31440, 4946, 41119, 32768, 4686, 41500, 30408, 4406, 41911, 29671, 4066, 42410, 29229, 3695, 42954, 29081,
+	3325, 43497, 29229, 2985, 43996, 29671, 2705, 44407, 30408, 2515, 44686, 31440, 2445, 44788, 32768, 4051, 40610, 31440, 4128, 40524, 32768, 3842, 40844, 30408,
+	3534, 41188, 29671, 3159, 41607, 29229, 2752, 42062, 29081, 2344, 42517, 29229, 1970, 42935, 29671, 1661, 43280, 30408, 1452, 43513, 31440, 1375, 43599, 32768,
+	3455, 39797, 31440, 3536, 39733, 32768, 3232, 39971, 30408, 2905, 40226, 29671, 2507, 40537, 29229, 2074, 40875, 29081, 1641, 41213, 29229, 1243, 41524, 29671,
+	915, 41780, 30408, 693, 41953, 31440, 611, 42017, 32768, 3092, 38753, 31440, 3177, 38717, 32768, 2862, 38849, 30408, 2524, 38991, 29671, 2112, 39164, 29229,
+	1665, 39351, 29081, 1217, 39539, 29229, 806, 39712, 29671, 467, 39854, 30408, 237, 39950, 31440, 153, 39986, 32768, 2970, 37449, 31440, 3056, 37449, 32768,
+	2738, 37449, 30408, 2396, 37449, 29671, 1980, 37449, 29229, 1528, 37449, 29081, 1076, 37449, 29229, 660, 37449, 29671, 318, 37449, 30408, 86, 37449, 31440,
+	0, 37449, 32768, 12371, 46670, 34095, 15250, 46680, 34095, 12359, 46315, 35127, 15173, 46324, 35127, 12341, 45791, 35864, 15059, 45800, 35864, 12319, 45155, 36306,
+	14920, 45163, 36306, 12295, 44463, 36454, 14769, 44470, 36454, 12271, 43771, 36306, 14619, 43777, 36306, 12249, 43135, 35864, 14480, 43141, 35864, 12231, 42611, 35127,
+	14366, 42616, 35127, 12218, 42256, 34095, 14289, 42261, 34095, 9794, 46606, 34095, 9839, 46253, 35127, 9903, 45733, 35864, 9982, 45101, 36306, 10068, 44414, 36454,
+	10153, 43727, 36306, 10232, 43095, 35864, 10297, 42575, 35127, 10341, 42222, 34095, 7520, 46430, 34095, 7612, 46084, 35127, 7748, 45574, 35864, 7912, 44955, 36306,
+	8091, 44281, 36454, 8270, 43607, 36306, 8434, 42987, 35864, 8570, 42477, 35127, 8662, 42131, 34095, 5549, 46089, 34095, 5681, 45756, 35127, 5875, 45265, 35864,
+	6111, 44669, 36306, 6368, 44021, 36454, 6625, 43372, 36306, 6861, 42776, 35864, 7055, 42286, 35127, 7187, 41953, 34095, 3880, 45526, 34095, 4045, 45214, 35127,
+	4287, 44756, 35864, 4582, 44199, 36306, 4902, 43592, 36454, 5222, 42986, 36306, 5517, 42429, 35864, 5759, 41970, 35127, 5924, 41659, 34095, 2515, 44686, 34095,
+	2705, 44407, 35127, 2985, 43996, 35864, 3325, 43497, 36306, 3695, 42954, 36454, 4066, 42410, 36306, 4406, 41911, 35864, 4686, 41500, 35127, 4876, 41221, 34095,
+	1452, 43513, 34095, 1661, 43280, 35127, 1970, 42935, 35864, 2344, 42517, 36306, 2752, 42062, 36454, 3159, 41607, 36306, 3534, 41188, 35864, 3842, 40844, 35127,
+	4051, 40610, 34095, 693, 41953, 34095, 915, 41780, 35127, 1243, 41524, 35864, 1641, 41213, 36306, 2074, 40875, 36454, 2507, 40537, 36306, 2905, 40226, 35864,
+	3232, 39971, 35127, 3455, 39797, 34095, 237, 39950, 34095, 467, 39854, 35127, 806, 39712, 35864, 1217, 39539, 36306, 1665, 39351, 36454, 2112, 39164, 36306,
+	2524, 38991, 35864, 2862, 38849, 35127, 3092, 38753, 34095, 86, 37449, 34095, 318, 37449, 35127, 660, 37449, 35864, 1076, 37449, 36306, 1528, 37449, 36454,
+	1980, 37449, 36306, 2396, 37449, 35864, 2738, 37449, 35127, 2970, 37449, 34095, 3034, 35878, 31440, 3118, 35913, 32768, 2805, 35783, 30408, 2468, 35643, 29671,
+	2058, 35474, 29229, 1613, 35289, 29081, 1167, 35104, 29229, 758, 34934, 29671, 421, 34794, 30408, 192, 34699, 31440, 107, 34664, 32768, 3228, 34091, 31440,
+	3308, 34153, 32768, 3009, 33922, 30408, 2687, 33673, 29671, 2296, 33371, 29229, 1870, 33042, 29081, 1444, 32713, 29229, 1053, 32411, 29671, 731, 32162, 30408,
+	512, 31993, 31440, 432, 31931, 32768, 3559, 32141, 31440, 3633, 32224, 32768, 3357, 31916, 30408, 3059, 31583, 29671, 2698, 31179, 29229, 2305, 30739, 29081,
+	1912, 30300, 29229, 1550, 29896, 29671, 1253, 29563, 30408, 1051, 29338, 31440, 976, 29254, 32768, 4033, 30084, 31440, 4099, 30184, 32768, 3854, 29815, 30408,
+	3590, 29418, 29671, 3270, 28936, 29229, 2921, 28411, 29081, 2573, 27886, 29229, 2252, 27404, 29671, 1989, 27007, 30408, 1810, 26738, 31440, 1744, 26638, 32768,
+	4656, 27974, 31440, 4711, 28086, 32768, 4506, 27671, 30408, 4285, 27223, 29671, 4016, 26679, 29229, 3724, 26087, 29081, 3432, 25495, 29229, 3164, 24952, 29671,
+	2943, 24504, 30408, 2793, 24200, 31440, 2737, 24088, 32768, 5433, 25867, 31440, 5476, 25989, 32768, 5318, 25534, 30408, 5148, 25043, 29671, 4942, 24447, 29229,
+	4718, 23799, 29081, 4494, 23150, 29229, 4288, 22554, 29671, 4118, 22063, 30408, 4003, 21731, 31440, 3960, 21608, 32768, 6372, 23815, 31440, 6400, 23948, 32768,
+	6297, 23455, 30408, 6187, 22923, 29671, 6053, 22278, 29229, 5907, 21575, 29081, 5762, 20873, 29229, 5628, 20228, 29671, 5518, 19696, 30408, 5443, 19335, 31440,
+	5415, 19203, 32768, 7478, 21876, 31440, 7489, 22020, 32768, 7449, 21485, 30408, 7406, 20909, 29671, 7354, 20210, 29229, 7297, 19448, 29081, 7240, 18687, 29229,
+	7188, 17988, 29671, 7145, 17412, 30408, 7116, 17021, 31440, 7106, 16877, 32768, 8756, 20102, 31440, 8749, 20260, 32768, 8778, 19675, 30408, 8810, 19045, 29671,
+	8849, 18280, 29229, 8891, 17447, 29081, 8934, 16615, 29229, 8973, 15850, 29671, 9004, 15220, 30408, 9026, 14793, 31440, 9034, 14635, 32768, 10214, 18550, 31440,
+	10292, 18075, 30408, 10406, 17376, 29671, 10544, 16527, 29229, 10695, 15604, 29081, 10846, 14680, 29229, 10984, 13831, 29671, 11098, 13132, 30408, 11176, 12658, 31440,
+	11204, 12483, 32768, 192, 34699, 34095, 421, 34794, 35127, 758, 34934, 35864, 1167, 35104, 36306, 1613, 35289, 36454, 2058, 35474, 36306, 2468, 35643, 35864,
+	2805, 35783, 35127, 3034, 35878, 34095, 512, 31993, 34095, 731, 32162, 35127, 1053, 32411, 35864, 1444, 32713, 36306, 1870, 33042, 36454, 2296, 33371, 36306,
+	2687, 33673, 35864, 3009, 33922, 35127, 3228, 34091, 34095, 1051, 29338, 34095, 1253, 29563, 35127, 1550, 29896, 35864, 1912, 30300, 36306, 2305, 30739, 36454,
+	2698, 31179, 36306, 3059, 31583, 35864, 3357, 31916, 35127, 3559, 32141, 34095, 1810, 26738, 34095, 1989, 27007, 35127, 2252, 27404, 35864, 2573, 27886, 36306,
+	2921, 28411, 36454, 3270, 28936, 36306, 3590, 29418, 35864, 3854, 29815, 35127, 4033, 30084, 34095, 2793, 24200, 34095, 2943, 24504, 35127, 3164, 24952, 35864,
+	3432, 25495, 36306, 3724, 26087, 36454, 4016, 26679, 36306, 4285, 27223, 35864, 4506, 27671, 35127, 4656, 27974, 34095, 4003, 21731, 34095, 4118, 22063, 35127,
+	4288, 22554, 35864, 4494, 23150, 36306, 4718, 23799, 36454, 4942, 24447, 36306, 5148, 25043, 35864, 5318, 25534, 35127, 5433, 25867, 34095, 5443, 19335, 34095,
+	5518, 19696, 35127, 5628, 20228, 35864, 5762, 20873, 36306, 5907, 21575, 36454, 6053, 22278, 36306, 6187, 22923, 35864, 6297, 23455, 35127, 6372, 23815, 34095,
+	7116, 17021, 34095, 7145, 17412, 35127, 7188, 17988, 35864, 7240, 18687, 36306, 7297, 19448, 36454, 7354, 20210, 36306, 7406, 20909, 35864, 7449, 21485, 35127,
+	7478, 21876, 34095, 9026, 14793, 34095, 9004, 15220, 35127, 8973, 15850, 35864, 8934, 16615, 36306, 8891, 17447, 36454, 8849, 18280, 36306, 8810, 19045, 35864,
+	8778, 19675, 35127, 8756, 20102, 34095, 11176, 12658, 34095, 11098, 13132, 35127, 10984, 13831, 35864, 10846, 14680, 36306, 10695, 15604, 36454, 10544, 16527, 36306,
+	10406, 17376, 35864, 10292, 18075, 35127, 10214, 18550, 34095, 50311, 29610, 29899, 47873, 29166, 29848, 47873, 29647, 32768, 50276, 30046, 32768, 50408, 28425, 27667,
+	47873, 27862, 27577, 50550, 26679, 26074, 47873, 25939, 25955, 50723, 24559, 25117, 47873, 23605, 24982, 50911, 22252, 24799, 47873, 21065, 24658, 51099, 19945, 25117,
+	47873, 18525, 24982, 51272, 17825, 26074, 47873, 16190, 25955, 51415, 16079, 27667, 47873, 14268, 27577, 51511, 14895, 29899, 47873, 12963, 29848, 51547, 14458, 32768,
+	47873, 12483, 32768, 52120, 30773, 30036, 52061, 31157, 32768, 52280, 29729, 27913, 52515, 28191, 26395, 52801, 26324, 25485, 53112, 24292, 25181, 53424, 22259, 25485,
+	53710, 20392, 26395, 53945, 18854, 27913, 54105, 17811, 30036, 54164, 17426, 32768, 53419, 32521, 30240, 53346, 32849, 32768, 53616, 31633, 28274, 53908, 30324, 26869,
+	54262, 28735, 26027, 54647, 27005, 25746, 55033, 25275, 26027, 55387, 23686, 26869, 55678, 22377, 28274, 55876, 21489, 30240, 55949, 21162, 32768, 54326, 34722, 30486,
+	54245, 34989, 32768, 54545, 33996, 28712, 54868, 32927, 27445, 55261, 31628, 26684, 55687, 30215, 26431, 56114, 28801, 26684, 56507, 27503, 27445, 56830, 26433, 28712,
+	57049, 25707, 30486, 57130, 25440, 32768, 54961, 37241, 30755, 54876, 37449, 32768, 55193, 36678, 29189, 55536, 35848, 28071, 55951, 34840, 27400, 56403, 33743, 27177,
+	56856, 32646, 27400, 57271, 31638, 28071, 57614, 30808, 29189, 57846, 30244, 30755, 57931, 30037, 32768, 55444, 39945, 31023, 55353, 40095, 32768, 55689, 39537, 29667,
+	56050, 38935, 28697, 56489, 38205, 28116, 56967, 37411, 27922, 57444, 36617, 28116, 57883, 35887, 28697, 58245, 35286, 29667, 58490, 34878, 31023, 58580, 34727, 32768,
+	55893, 42699, 31270, 55794, 42797, 32768, 56159, 42432, 30105, 56552, 42039, 29273, 57029, 41562, 28774, 57548, 41042, 28607, 58068, 40522, 28774, 58545, 40045, 29273,
+	58937, 39652, 30105, 59204, 39385, 31270, 59302, 39287, 32768, 56427, 45371, 31473, 56315, 45425, 32768, 56732, 45224, 30466, 57181, 45007, 29747, 57726, 44744, 29315,
+	58319, 44458, 29172, 58913, 44171, 29315, 59458, 43908, 29747, 59907, 43691, 30466, 60212, 43544, 31473, 60324, 43490, 32768, 57167, 47826, 31611, 57031, 47847, 32768,
+	57534, 47770, 30711, 58076, 47688, 30069, 58735, 47589, 29683, 59451, 47480, 29554, 60167, 47372, 29683, 60826, 47272, 30069, 61368, 47190, 30711, 61736, 47134, 31611,
+	61871, 47113, 32768, 58230, 49931, 31662, 58059, 49931, 32768, 58694, 49931, 30801, 59379, 49931, 30187, 60210, 49931, 29818, 61114, 49931, 29696, 62019, 49931, 29818,
+	62850, 49931, 30187, 63535, 49931, 30801, 63999, 49931, 31662, 64170, 49931, 32768, 51511, 14895, 35636, 47873, 12963, 35687, 51415, 16079, 37868, 47873, 14268, 37958,
+	51272, 17825, 39461, 47873, 16190, 39580, 51099, 19945, 40418, 47873, 18525, 40553, 50911, 22252, 40736, 47873, 21065, 40877, 50723, 24559, 40418, 47873, 23605, 40553,
+	50550, 26679, 39461, 47873, 25939, 39580, 50408, 28425, 37868, 47873, 27862, 37958, 50311, 29610, 35636, 47873, 29166, 35687, 54105, 17811, 35499, 53945, 18854, 37622,
+	53710, 20392, 39140, 53424, 22259, 40050, 53112, 24292, 40354, 52801, 26324, 40050, 52515, 28191, 39140, 52280, 29729, 37622, 52120, 30773, 35499, 55876, 21489, 35295,
+	55678, 22377, 37261, 55387, 23686, 38666, 55033, 25275, 39508, 54647, 27005, 39789, 54262, 28735, 39508, 53908, 30324, 38666, 53616, 31633, 37261, 53419, 32521, 35295,
+	57049, 25707, 35049, 56830, 26433, 36823, 56507, 27503, 38090, 56114, 28801, 38851, 55687, 30215, 39104, 55261, 31628, 38851, 54868, 32927, 38090, 54545, 33996, 36823,
+	54326, 34722, 35049, 57846, 30244, 34780, 57614, 30808, 36346, 57271, 31638, 37464, 56856, 32646, 38135, 56403, 33743, 38358, 55951, 34840, 38135, 55536, 35848, 37464,
+	55193, 36678, 36346, 54961, 37241, 34780, 58490, 34878, 34512, 58245, 35286, 35868, 57883, 35887, 36838, 57444, 36617, 37419, 56967, 37411, 37613, 56489, 38205, 37419,
+	56050, 38935, 36838, 55689, 39537, 35868, 55444, 39945, 34512, 59204, 39385, 34265, 58937, 39652, 35430, 58545, 40045, 36262, 58068, 40522, 36761, 57548, 41042, 36928,
+	57029, 41562, 36761, 56552, 42039, 36262, 56159, 42432, 35430, 55893, 42699, 34265, 60212, 43544, 34062, 59907, 43691, 35069, 59458, 43908, 35788, 58913, 44171, 36220,
+	58319, 44458, 36363, 57726, 44744, 36220, 57181, 45007, 35788, 56732, 45224, 35069, 56427, 45371, 34062, 61736, 47134, 33924, 61368, 47190, 34824, 60826, 47272, 35466,
+	60167, 47372, 35852, 59451, 47480, 35981, 58735, 47589, 35852, 58076, 47688, 35466, 57534, 47770, 34824, 57167, 47826, 33924, 63999, 49931, 33873, 63535, 49931, 34734,
+	62850, 49931, 35348, 62019, 49931, 35717, 61114, 49931, 35839, 60210, 49931, 35717, 59379, 49931, 35348, 58694, 49931, 34734, 58230, 49931, 33873, 58542, 50356, 31674,
+	58362, 50353, 32768, 59028, 50365, 30823, 59746, 50378, 30216, 60617, 50394, 29852, 61565, 50411, 29730, 62513, 50428, 29852, 63384, 50444, 30216, 64101, 50457, 30823,
+	64588, 50465, 31674, 64767, 50469, 32768, 58837, 50687, 31708, 58654, 50680, 32768, 59333, 50704, 30883, 60065, 50729, 30294, 60954, 50759, 29941, 61921, 50793, 29823,
+	62888, 50826, 29941, 63777, 50857, 30294, 64509, 50882, 30883, 65006, 50899, 31708, 65189, 50905, 32768, 59103, 50923, 31757, 58920, 50914, 32768, 59599, 50948, 30971,
+	60329, 50984, 30410, 61216, 51027, 30073, 62181, 51074, 29961, 63146, 51121, 30073, 64033, 51165, 30410, 64764, 51201, 30971, 65259, 51225, 31757, 65442, 51234, 32768,
+	59329, 51066, 31817, 59151, 51055, 32768, 59815, 51096, 31078, 60530, 51140, 30550, 61398, 51193, 30234, 62343, 51251, 30128, 63288, 51310, 30234, 64156, 51363, 30550,
+	64871, 51407, 31078, 65356, 51437, 31817, 65535, 51448, 32768, 59504, 51114, 31883, 59332, 51102, 32768, 59971, 51147, 31195, 60659, 51197, 30703, 61494, 51256, 30408,
+	62403, 51321, 30310, 63313, 51386, 30408, 64148, 51446, 30703, 64836, 51495, 31195, 65303, 51528, 31883, 65475, 51540, 32768, 59615, 51068, 31948, 59452, 51055, 32768,
+	60057, 51102, 31311, 60709, 51152, 30856, 61500, 51213, 30583, 62361, 51280, 30492, 63222, 51346, 30583, 64013, 51407, 30856, 64665, 51457, 31311, 65107, 51492, 31948,
+	65270, 51504, 32768, 59651, 50926, 32008, 59499, 50914, 32768, 60064, 50958, 31418, 60672, 51005, 30996, 61410, 51062, 30743, 62213, 51123, 30659, 63017, 51185, 30743,
+	63755, 51242, 30996, 64363, 51289, 31418, 64776, 51321, 32008, 64928, 51332, 32768, 59600, 50690, 32058, 59460, 50680, 32768, 59980, 50716, 31506, 60539, 50753, 31112,
+	61218, 50799, 30875, 61958, 50849, 30797, 62697, 50899, 30875, 63376, 50945, 31112, 63936, 50982, 31506, 64315, 51008, 32058, 64455, 51017, 32768, 59451, 50358, 32092,
+	59324, 50353, 32768, 59796, 50374, 31566, 60304, 50396, 31190, 60921, 50423, 30965, 61592, 50453, 30890, 62264, 50482, 30965, 62881, 50510, 31190, 63389, 50532, 31566,
+	63734, 50547, 32092, 63861, 50553, 32768, 59191, 49931, 32104, 59077, 49931, 32768, 59501, 49931, 31588, 59957, 49931, 31219, 60511, 49931, 30998, 61114, 49931, 30924,
+	61717, 49931, 30998, 62271, 49931, 31219, 62728, 49931, 31588, 63037, 49931, 32104, 63152, 49931, 32768, 64588, 50465, 33861, 64101, 50457, 34712, 63384, 50444, 35319,
+	62513, 50428, 35683, 61565, 50411, 35805, 60617, 50394, 35683, 59746, 50378, 35319, 59028, 50365, 34712, 58542, 50356, 33861, 65006, 50899, 33827, 64509, 50882, 34652,
+	63777, 50857, 35241, 62888, 50826, 35594, 61921, 50793, 35712, 60954, 50759, 35594, 60065, 50729, 35241, 59333, 50704, 34652, 58837, 50687, 33827, 65259, 51225, 33778,
+	64764, 51201, 34564, 64033, 51165, 35125, 63146, 51121, 35462, 62181, 51074, 35574, 61216, 51027, 35462, 60329, 50984, 35125, 59599, 50948, 34564, 59103, 50923, 33778,
+	65356, 51437, 33718, 64871, 51407, 34457, 64156, 51363, 34985, 63288, 51310, 35301, 62343, 51251, 35407, 61398, 51193, 35301, 60530, 51140, 34985, 59815, 51096, 34457,
+	59329, 51066, 33718, 65303, 51528, 33652, 64836, 51495, 34340, 64148, 51446, 34832, 63313, 51386, 35127, 62403, 51321, 35225, 61494, 51256, 35127, 60659, 51197, 34832,
+	59971, 51147, 34340, 59504, 51114, 33652, 65107, 51492, 33587, 64665, 51457, 34224, 64013, 51407, 34679, 63222, 51346, 34952, 62361, 51280, 35043, 61500, 51213, 34952,
+	60709, 51152, 34679, 60057, 51102, 34224, 59615, 51068, 33587, 64776, 51321, 33527, 64363, 51289, 34117, 63755, 51242, 34539, 63017, 51185, 34792, 62213, 51123, 34876,
+	61410, 51062, 34792, 60672, 51005, 34539, 60064, 50958, 34117, 59651, 50926, 33527, 64315, 51008, 33477, 63936, 50982, 34029, 63376, 50945, 34423, 62697, 50899, 34660,
+	61958, 50849, 34738, 61218, 50799, 34660, 60539, 50753, 34423, 59980, 50716, 34029, 59600, 50690, 33477, 63734, 50547, 33443, 63389, 50532, 33969, 62881, 50510, 34345,
+	62264, 50482, 34570, 61592, 50453, 34645, 60921, 50423, 34570, 60304, 50396, 34345, 59796, 50374, 33969, 59451, 50358, 33443, 63037, 49931, 33431, 62728, 49931, 33947,
+	62271, 49931, 34316, 61717, 49931, 34537, 61114, 49931, 34611, 60511, 49931, 34537, 59957, 49931, 34316, 59501, 49931, 33947, 59191, 49931, 33431, 30557, 65535, 32768,
+	32539, 65357, 32768, 32514, 65357, 32242, 32440, 65357, 31747, 32322, 65357, 31288, 32163, 65357, 30870, 31966, 65357, 30501, 31737, 65357, 30185, 31477, 65357, 29929,
+	31191, 65357, 29739, 30884, 65357, 29620, 30557, 65357, 29579, 33662, 64861, 31934, 33703, 64861, 32768, 33545, 64861, 31149, 33358, 64861, 30420, 33105, 64861, 29757,
+	32793, 64861, 29171, 32429, 64861, 28669, 32017, 64861, 28263, 31564, 64861, 27961, 31075, 64861, 27773, 30557, 64861, 27708, 34159, 64103, 31801, 34206, 64103, 32768,
+	34023, 64103, 30890, 33806, 64103, 30044, 33512, 64103, 29276, 33151, 64103, 28595, 32728, 64103, 28014, 32250, 64103, 27543, 31725, 64103, 27192, 31158, 64103, 26974,
+	30557, 64103, 26899, 34161, 63138, 31801, 34208, 63138, 32768, 34025, 63138, 30889, 33807, 63138, 30043, 33514, 63138, 29274, 33152, 63138, 28593, 32729, 63138, 28011,
+	32251, 63138, 27540, 31725, 63138, 27189, 31158, 63138, 26971, 30557, 63138, 26896, 33825, 62024, 31891, 33868, 62024, 32768, 33702, 62024, 31064, 33504, 62024, 30297,
+	33238, 62024, 29600, 32910, 62024, 28982, 32527, 62024, 28455, 32093, 62024, 28027, 31616, 62024, 27709, 31102, 62024, 27511, 30557, 62024, 27443, 33308, 60816, 32030,
+	33344, 60816, 32768, 33205, 60816, 31334, 33038, 60816, 30688, 32814, 60816, 30101, 32538, 60816, 29581, 32215, 60816, 29137, 31850, 60816, 28777, 31449, 60816, 28509,
+	31016, 60816, 28342, 30557, 60816, 28285, 32767, 59571, 32175, 32796, 59571, 32768, 32684, 59571, 31616, 32550, 59571, 31098, 32370, 59571, 30626, 32148, 59571, 30208,
+	31889, 59571, 29851, 31595, 59571, 29562, 31273, 59571, 29347, 30926, 59571, 29213, 30557, 59571, 29166, 32359, 58345, 32285, 32382, 58345, 32768, 32291, 58345, 31830,
+	32182, 58345, 31407, 32035, 58345, 31022, 31854, 58345, 30682, 31642, 58345, 30391, 31403, 58345, 30154, 31140, 58345, 29979, 30857, 58345, 29869, 30557, 58345, 29832,
+	32240, 57193, 32317, 32262, 57193, 32768, 32177, 57193, 31892, 32075, 57193, 31497, 31937, 57193, 31138, 31768, 57193, 30820, 31570, 57193, 30548, 31347, 57193, 30327,
+	31101, 57193, 30162, 30837, 57193, 30060, 30557, 57193, 30025, 32568, 56173, 32230, 32594, 56173, 32768, 32492, 56173, 31722, 32370, 56173, 31251, 32206, 56173, 30821,
+	32004, 56173, 30441, 31767, 56173, 30116, 31500, 56173, 29852, 31207, 56173, 29655, 30891, 56173, 29533, 30557, 56173, 29491, 30231, 65357, 29620, 29923, 65357, 29739,
+	29637, 65357, 29929, 29378, 65357, 30185, 29148, 65357, 30501, 28952, 65357, 30870, 28793, 65357, 31288, 28674, 65357, 31747, 28600, 65357, 32242, 28575, 65357, 32768,
+	30039, 64861, 27773, 29551, 64861, 27961, 29098, 64861, 28263, 28686, 64861, 28669, 28321, 64861, 29171, 28009, 64861, 29757, 27757, 64861, 30420, 27569, 64861, 31149,
+	27452, 64861, 31934, 27412, 64861, 32768, 29956, 64103, 26974, 29390, 64103, 27192, 28864, 64103, 27543, 28386, 64103, 28014, 27963, 64103, 28595, 27602, 64103, 29276,
+	27309, 64103, 30044, 27091, 64103, 30890, 26955, 64103, 31801, 26909, 64103, 32768, 29956, 63138, 26971, 29389, 63138, 27189, 28863, 63138, 27540, 28385, 63138, 28011,
+	27962, 63138, 28593, 27600, 63138, 29274, 27307, 63138, 30043, 27089, 63138, 30889, 26953, 63138, 31801, 26907, 63138, 32768, 30012, 62024, 27511, 29498, 62024, 27709,
+	29021, 62024, 28027, 28588, 62024, 28455, 28204, 62024, 28982, 27876, 62024, 29600, 27610, 62024, 30297, 27412, 62024, 31064, 27289, 62024, 31891, 27247, 62024, 32768,
+	30099, 60816, 28342, 29666, 60816, 28509, 29264, 60816, 28777, 28900, 60816, 29137, 28576, 60816, 29581, 28300, 60816, 30101, 28076, 60816, 30688, 27910, 60816, 31334,
+	27806, 60816, 32030, 27770, 60816, 32768, 30189, 59571, 29213, 29841, 59571, 29347, 29519, 59571, 29562, 29226, 59571, 29851, 28966, 59571, 30208, 28744, 59571, 30626,
+	28564, 59571, 31098, 28431, 59571, 31616, 28347, 59571, 32175, 28318, 59571, 32768, 30257, 58345, 29869, 29974, 58345, 29979, 29711, 58345, 30154, 29472, 58345, 30391,
+	29261, 58345, 30682, 29079, 58345, 31022, 28933, 58345, 31407, 28823, 58345, 31830, 28755, 58345, 32285, 28732, 58345, 32768, 30277, 57193, 30060, 30013, 57193, 30162,
+	29768, 57193, 30327, 29544, 57193, 30548, 29346, 57193, 30820, 29177, 57193, 31138, 29040, 57193, 31497, 28938, 57193, 31892, 28874, 57193, 32317, 28852, 57193, 32768,
+	30223, 56173, 29533, 29907, 56173, 29655, 29614, 56173, 29852, 29347, 56173, 30116, 29111, 56173, 30441, 28909, 56173, 30821, 28744, 56173, 31251, 28622, 56173, 31722,
+	28546, 56173, 32230, 28520, 56173, 32768, 28600, 65357, 33293, 28674, 65357, 33788, 28793, 65357, 34247, 28952, 65357, 34665, 29148, 65357, 35034, 29378, 65357, 35350,
+	29637, 65357, 35606, 29923, 65357, 35796, 30231, 65357, 35915, 30557, 65357, 35956, 27452, 64861, 33601, 27569, 64861, 34386, 27757, 64861, 35115, 28009, 64861, 35778,
+	28321, 64861, 36364, 28686, 64861, 36866, 29098, 64861, 37272, 29551, 64861, 37574, 30039, 64861, 37762, 30557, 64861, 37827, 26955, 64103, 33734, 27091, 64103, 34645,
+	27309, 64103, 35491, 27602, 64103, 36259, 27963, 64103, 36940, 28386, 64103, 37521, 28864, 64103, 37992, 29390, 64103, 38343, 29956, 64103, 38561, 30557, 64103, 38636,
+	26953, 63138, 33734, 27089, 63138, 34646, 27307, 63138, 35492, 27600, 63138, 36261, 27962, 63138, 36942, 28385, 63138, 37524, 28863, 63138, 37995, 29389, 63138, 38346,
+	29956, 63138, 38564, 30557, 63138, 38639, 27289, 62024, 33644, 27412, 62024, 34471, 27610, 62024, 35238, 27876, 62024, 35935, 28204, 62024, 36553, 28588, 62024, 37080,
+	29021, 62024, 37508, 29498, 62024, 37826, 30012, 62024, 38024, 30557, 62024, 38092, 27806, 60816, 33505, 27910, 60816, 34201, 28076, 60816, 34847, 28300, 60816, 35434,
+	28576, 60816, 35954, 28900, 60816, 36398, 29264, 60816, 36758, 29666, 60816, 37026, 30099, 60816, 37193, 30557, 60816, 37250, 28347, 59571, 33360, 28431, 59571, 33919,
+	28564, 59571, 34437, 28744, 59571, 34909, 28966, 59571, 35327, 29226, 59571, 35684, 29519, 59571, 35973, 29841, 59571, 36188, 30189, 59571, 36322, 30557, 59571, 36369,
+	28755, 58345, 33250, 28823, 58345, 33705, 28933, 58345, 34128, 29079, 58345, 34513, 29261, 58345, 34853, 29472, 58345, 35144, 29711, 58345, 35381, 29974, 58345, 35556,
+	30257, 58345, 35666, 30557, 58345, 35703, 28874, 57193, 33218, 28938, 57193, 33643, 29040, 57193, 34038, 29177, 57193, 34397, 29346, 57193, 34715, 29544, 57193, 34987,
+	29768, 57193, 35208, 30013, 57193, 35373, 30277, 57193, 35475, 30557, 57193, 35510, 28546, 56173, 33305, 28622, 56173, 33813, 28744, 56173, 34284, 28909, 56173, 34714,
+	29111, 56173, 35094, 29347, 56173, 35419, 29614, 56173, 35683, 29907, 56173, 35880, 30223, 56173, 36002, 30557, 56173, 36044, 30884, 65357, 35915, 31191, 65357, 35796,
+	31477, 65357, 35606, 31737, 65357, 35350, 31966, 65357, 35034, 32163, 65357, 34665, 32322, 65357, 34247, 32440, 65357, 33788, 32514, 65357, 33293, 31075, 64861, 37762,
+	31564, 64861, 37574, 32017, 64861, 37272, 32429, 64861, 36866, 32793, 64861, 36364, 33105, 64861, 35778, 33358, 64861, 35115, 33545, 64861, 34386, 33662, 64861, 33601,
+	31158, 64103, 38561, 31725, 64103, 38343, 32250, 64103, 37992, 32728, 64103, 37521, 33151, 64103, 36940, 33512, 64103, 36259, 33806, 64103, 35491, 34023, 64103, 34645,
+	34159, 64103, 33734, 31158, 63138, 38564, 31725, 63138, 38346, 32251, 63138, 37995, 32729, 63138, 37524, 33152, 63138, 36942, 33514, 63138, 36261, 33807, 63138, 35492,
+	34025, 63138, 34646, 34161, 63138, 33734, 31102, 62024, 38024, 31616, 62024, 37826, 32093, 62024, 37508, 32527, 62024, 37080, 32910, 62024, 36553, 33238, 62024, 35935,
+	33504, 62024, 35238, 33702, 62024, 34471, 33825, 62024, 33644, 31016, 60816, 37193, 31449, 60816, 37026, 31850, 60816, 36758, 32215, 60816, 36398, 32538, 60816, 35954,
+	32814, 60816, 35434, 33038, 60816, 34847, 33205, 60816, 34201, 33308, 60816, 33505, 30926, 59571, 36322, 31273, 59571, 36188, 31595, 59571, 35973, 31889, 59571, 35684,
+	32148, 59571, 35327, 32370, 59571, 34909, 32550, 59571, 34437, 32684, 59571, 33919, 32767, 59571, 33360, 30857, 58345, 35666, 31140, 58345, 35556, 31403, 58345, 35381,
+	31642, 58345, 35144, 31854, 58345, 34853, 32035, 58345, 34513, 32182, 58345, 34128, 32291, 58345, 33705, 32359, 58345, 33250, 30837, 57193, 35475, 31101, 57193, 35373,
+	31347, 57193, 35208, 31570, 57193, 34987, 31768, 57193, 34715, 31937, 57193, 34397, 32075, 57193, 34038, 32177, 57193, 33643, 32240, 57193, 33218, 30891, 56173, 36002,
+	31207, 56173, 35880, 31500, 56173, 35683, 31767, 56173, 35419, 32004, 56173, 35094, 32206, 56173, 34714, 32370, 56173, 34284, 32492, 56173, 33813, 32568, 56173, 33305,
+	33366, 55324, 32016, 33403, 55324, 32768, 33260, 55324, 31307, 33090, 55324, 30648, 32860, 55324, 30049, 32578, 55324, 29517, 32247, 55324, 29063, 31875, 55324, 28694,
+	31465, 55324, 28420, 31024, 55324, 28249, 30557, 55324, 28190, 34491, 54625, 31716, 34542, 54625, 32768, 34342, 54625, 30723, 34103, 54625, 29800, 33782, 54625, 28961,
+	33386, 54625, 28217, 32924, 54625, 27581, 32402, 54625, 27064, 31828, 54625, 26680, 31211, 54625, 26441, 30557, 54625, 26358, 35844, 54038, 31354, 35913, 54038, 32768,
+	35644, 54038, 30019, 35323, 54038, 28779, 34891, 54038, 27651, 34360, 54038, 26651, 33738, 54038, 25796, 33037, 54038, 25102, 32266, 54038, 24586, 31436, 54038, 24264,
+	30557, 54038, 24153, 37330, 53526, 30957, 37418, 53526, 32768, 37074, 53526, 29247, 36663, 53526, 27658, 36110, 53526, 26213, 35429, 53526, 24932, 34632, 53526, 23836,
+	33734, 53526, 22947, 32746, 53526, 22286, 31683, 53526, 21874, 30557, 53526, 21731, 38852, 53052, 30550, 38960, 53052, 32768, 38538, 53052, 28455, 38035, 53052, 26510,
+	37358, 53052, 24740, 36523, 53052, 23171, 35548, 53052, 21829, 34448, 53052, 20740, 33238, 53052, 19930, 31936, 53052, 19425, 30557, 53052, 19251, 40314, 52578, 30159,
+	40441, 52578, 32768, 39945, 52578, 27695, 39353, 52578, 25407, 38556, 52578, 23325, 37575, 52578, 21479, 36428, 52578, 19901, 35133, 52578, 18620, 33711, 52578, 17667,
+	32179, 52578, 17074, 30557, 52578, 16869, 41619, 52066, 29810, 41764, 52066, 32768, 41201, 52066, 27017, 40529, 52066, 24422, 39626, 52066, 22062, 38514, 52066, 19969,
+	37213, 52066, 18180, 35745, 52066, 16728, 34132, 52066, 15648, 32396, 52066, 14974, 30557, 52066, 14742, 42671, 51479, 29529, 42829, 51479, 32768, 42212, 51479, 26470,
+	41477, 51479, 23629, 40488, 51479, 21044, 39270, 51479, 18753, 37846, 51479, 16793, 36238, 51479, 15203, 34472, 51479, 14020, 32571, 51479, 13283, 30557, 51479, 13028,
+	43373, 50780, 29341, 43540, 50780, 32768, 42888, 50780, 26105, 42110, 50780, 23100, 41064, 50780, 20365, 39775, 50780, 17941, 38268, 50780, 15867, 36568, 50780, 14185,
+	34699, 50780, 12934, 32687, 50780, 12154, 30557, 50780, 11885, 43628, 49931, 29273, 43799, 49931, 32768, 43133, 49931, 25972, 42340, 49931, 22907, 41273, 49931, 20118,
+	39959, 49931, 17645, 38422, 49931, 15531, 36687, 49931, 13815, 34782, 49931, 12539, 32730, 49931, 11743, 30557, 49931, 11469, 30090, 55324, 28249, 29649, 55324, 28420,
+	29240, 55324, 28694, 28867, 55324, 29063, 28537, 55324, 29517, 28254, 55324, 30049, 28025, 55324, 30648, 27854, 55324, 31307, 27748, 55324, 32016, 27711, 55324, 32768,
+	29903, 54625, 26441, 29286, 54625, 26680, 28712, 54625, 27064, 28191, 54625, 27581, 27728, 54625, 28217, 27332, 54625, 28961, 27011, 54625, 29800, 26773, 54625, 30723,
+	26624, 54625, 31716, 26573, 54625, 32768, 29678, 54038, 24264, 28849, 54038, 24586, 28078, 54038, 25102, 27376, 54038, 25796, 26755, 54038, 26651, 26223, 54038, 27651,
+	25791, 54038, 28779, 25471, 54038, 30019, 25270, 54038, 31354, 25202, 54038, 32768, 29431, 53526, 21874, 28368, 53526, 22286, 27381, 53526, 22947, 26482, 53526, 23836,
+	25686, 53526, 24932, 25005, 53526, 26213, 24452, 53526, 27658, 24041, 53526, 29247, 23784, 53526, 30957, 23696, 53526, 32768, 29178, 53052, 19425, 27876, 53052, 19930,
+	26667, 53052, 20740, 25566, 53052, 21829, 24591, 53052, 23171, 23757, 53052, 24740, 23080, 53052, 26510, 22576, 53052, 28455, 22262, 53052, 30550, 22154, 53052, 32768,
+	28935, 52578, 17074, 27404, 52578, 17667, 25981, 52578, 18620, 24687, 52578, 19901, 23539, 52578, 21479, 22558, 52578, 23325, 21762, 52578, 25407, 21170, 52578, 27695,
+	20800, 52578, 30159, 20673, 52578, 32768, 28718, 52066, 14974, 26982, 52066, 15648, 25369, 52066, 16728, 23902, 52066, 18180, 22601, 52066, 19969, 21488, 52066, 22062,
+	20585, 52066, 24422, 19914, 52066, 27017, 19495, 52066, 29810, 19351, 52066, 32768, 28544, 51479, 13283, 26642, 51479, 14020, 24876, 51479, 15203, 23269, 51479, 16793,
+	21844, 51479, 18753, 20626, 51479, 21044, 19637, 51479, 23629, 18902, 51479, 26470, 18444, 51479, 29529, 18285, 51479, 32768, 28427, 50780, 12154, 26415, 50780, 12934,
+	24547, 50780, 14185, 22846, 50780, 15867, 21339, 50780, 17941, 20051, 50780, 20365, 19005, 50780, 23100, 18227, 50780, 26105, 17742, 50780, 29341, 17574, 50780, 32768,
+	28385, 49931, 11743, 26333, 49931, 12539, 24427, 49931, 13815, 22693, 49931, 15531, 21156, 49931, 17645, 19841, 49931, 20118, 18774, 49931, 22907, 17981, 49931, 25972,
+	17486, 49931, 29273, 17316, 49931, 32768, 27748, 55324, 33519, 27854, 55324, 34228, 28025, 55324, 34887, 28254, 55324, 35486, 28537, 55324, 36018, 28867, 55324, 36472,
+	29240, 55324, 36841, 29649, 55324, 37115, 30090, 55324, 37286, 30557, 55324, 37345, 26624, 54625, 33819, 26773, 54625, 34812, 27011, 54625, 35735, 27332, 54625, 36574,
+	27728, 54625, 37318, 28191, 54625, 37954, 28712, 54625, 38471, 29286, 54625, 38855, 29903, 54625, 39094, 30557, 54625, 39177, 25270, 54038, 34181, 25471, 54038, 35516,
+	25791, 54038, 36756, 26223, 54038, 37884, 26755, 54038, 38884, 27376, 54038, 39739, 28078, 54038, 40433, 28849, 54038, 40949, 29678, 54038, 41271, 30557, 54038, 41382,
+	23784, 53526, 34578, 24041, 53526, 36288, 24452, 53526, 37877, 25005, 53526, 39322, 25686, 53526, 40603, 26482, 53526, 41699, 27381, 53526, 42588, 28368, 53526, 43249,
+	29431, 53526, 43661, 30557, 53526, 43804, 22262, 53052, 34985, 22576, 53052, 37080, 23080, 53052, 39025, 23757, 53052, 40795, 24591, 53052, 42364, 25566, 53052, 43706,
+	26667, 53052, 44795, 27876, 53052, 45605, 29178, 53052, 46110, 30557, 53052, 46284, 20800, 52578, 35376, 21170, 52578, 37840, 21762, 52578, 40128, 22558, 52578, 42210,
+	23539, 52578, 44056, 24687, 52578, 45634, 25981, 52578, 46915, 27404, 52578, 47868, 28935, 52578, 48461, 30557, 52578, 48666, 19495, 52066, 35725, 19914, 52066, 38518,
+	20585, 52066, 41113, 21488, 52066, 43473, 22601, 52066, 45566, 23902, 52066, 47355, 25369, 52066, 48807, 26982, 52066, 49887, 28718, 52066, 50561, 30557, 52066, 50793,
+	18444, 51479, 36006, 18902, 51479, 39065, 19637, 51479, 41906, 20626, 51479, 44491, 21844, 51479, 46782, 23269, 51479, 48742, 24876, 51479, 50332, 26642, 51479, 51515,
+	28544, 51479, 52252, 30557, 51479, 52507, 17742, 50780, 36194, 18227, 50780, 39430, 19005, 50780, 42435, 20051, 50780, 45170, 21339, 50780, 47594, 22846, 50780, 49668,
+	24547, 50780, 51350, 26415, 50780, 52601, 28427, 50780, 53381, 30557, 50780, 53650, 17486, 49931, 36262, 17981, 49931, 39563, 18774, 49931, 42628, 19841, 49931, 45417,
+	21156, 49931, 47890, 22693, 49931, 50004, 24427, 49931, 51720, 26333, 49931, 52996, 28385, 49931, 53792, 30557, 49931, 54066, 31024, 55324, 37286, 31465, 55324, 37115,
+	31875, 55324, 36841, 32247, 55324, 36472, 32578, 55324, 36018, 32860, 55324, 35486, 33090, 55324, 34887, 33260, 55324, 34228, 33366, 55324, 33519, 31211, 54625, 39094,
+	31828, 54625, 38855, 32402, 54625, 38471, 32924, 54625, 37954, 33386, 54625, 37318, 33782, 54625, 36574, 34103, 54625, 35735, 34342, 54625, 34812, 34491, 54625, 33819,
+	31436, 54038, 41271, 32266, 54038, 40949, 33037, 54038, 40433, 33738, 54038, 39739, 34360, 54038, 38884, 34891, 54038, 37884, 35323, 54038, 36756, 35644, 54038, 35516,
+	35844, 54038, 34181, 31683, 53526, 43661, 32746, 53526, 43249, 33734, 53526, 42588, 34632, 53526, 41699, 35429, 53526, 40603, 36110, 53526, 39322, 36663, 53526, 37877,
+	37074, 53526, 36288, 37330, 53526, 34578, 31936, 53052, 46110, 33238, 53052, 45605, 34448, 53052, 44795, 35548, 53052, 43706, 36523, 53052, 42364, 37358, 53052, 40795,
+	38035, 53052, 39025, 38538, 53052, 37080, 38852, 53052, 34985, 32179, 52578, 48461, 33711, 52578, 47868, 35133, 52578, 46915, 36428, 52578, 45634, 37575, 52578, 44056,
+	38556, 52578, 42210, 39353, 52578, 40128, 39945, 52578, 37840, 40314, 52578, 35376, 32396, 52066, 50561, 34132, 52066, 49887, 35745, 52066, 48807, 37213, 52066, 47355,
+	38514, 52066, 45566, 39626, 52066, 43473, 40529, 52066, 41113, 41201, 52066, 38518, 41619, 52066, 35725, 32571, 51479, 52252, 34472, 51479, 51515, 36238, 51479, 50332,
+	37846, 51479, 48742, 39270, 51479, 46782, 40488, 51479, 44491, 41477, 51479, 41906, 42212, 51479, 39065, 42671, 51479, 36006, 32687, 50780, 53381, 34699, 50780, 52601,
+	36568, 50780, 51350, 38268, 50780, 49668, 39775, 50780, 47594, 41064, 50780, 45170, 42110, 50780, 42435, 42888, 50780, 39430, 43373, 50780, 36194, 32730, 49931, 53792,
+	34782, 49931, 52996, 36687, 49931, 51720, 38422, 49931, 50004, 39959, 49931, 47890, 41273, 49931, 45417, 42340, 49931, 42628, 43133, 49931, 39563, 43628, 49931, 36262,
+	30557, 0, 32768, 34512, 45, 32768, 34461, 45, 33811, 34313, 45, 34797, 34076, 45, 35713, 33758, 45, 36546, 33365, 45, 37284, 32906, 45, 37916,
+	32388, 45, 38428, 31819, 45, 38809, 31206, 45, 39047, 30557, 45, 39129, 37628, 175, 34658, 37720, 175, 32768, 37360, 175, 36443, 36931, 175, 38101,
+	36354, 175, 39610, 35643, 175, 40947, 34811, 175, 42091, 33873, 175, 43019, 32842, 175, 43710, 31732, 175, 44140, 30557, 175, 44289, 40133, 379, 35328,
+	40258, 379, 32768, 39771, 379, 37746, 39190, 379, 39992, 38408, 379, 42035, 37445, 379, 43847, 36319, 379, 45396, 35048, 379, 46653, 33652, 379, 47588,
+	32149, 379, 48171, 30557, 379, 48372, 42056, 649, 35842, 42206, 649, 32768, 41620, 649, 38745, 40922, 649, 41442, 39984, 649, 43896, 38828, 649, 46070,
+	37475, 649, 47930, 35950, 649, 49440, 34273, 649, 50563, 32468, 649, 51263, 30557, 649, 51504, 43471, 975, 36220, 43639, 975, 32768, 42982, 975, 39481,
+	42198, 975, 42509, 41144, 975, 45265, 39846, 975, 47708, 38327, 975, 49797, 36614, 975, 51492, 34731, 975, 52753, 32704, 975, 53539, 30557, 975, 53810,
+	44457, 1348, 36484, 44638, 1348, 32768, 43931, 1348, 39993, 43087, 1348, 43253, 41952, 1348, 46219, 40554, 1348, 48848, 38920, 1348, 51097, 37076, 1348, 52921,
+	35050, 1348, 54279, 32868, 1348, 55125, 30557, 1348, 55416, 45089, 1758, 36653, 45279, 1758, 32768, 44539, 1758, 40322, 43657, 1758, 43730, 42471, 1758, 46831,
+	41010, 1758, 49580, 39301, 1758, 51931, 37373, 1758, 53839, 35254, 1758, 55258, 32973, 1758, 56142, 30557, 1758, 56447, 45446, 2197, 36748, 45640, 2197, 32768,
+	44882, 2197, 40508, 43979, 2197, 43999, 42764, 2197, 47177, 41266, 2197, 49993, 39515, 2197, 52401, 37540, 2197, 54356, 35369, 2197, 55810, 33032, 2197, 56716,
+	30557, 2197, 57029, 45604, 2654, 36790, 45800, 2654, 32768, 45034, 2654, 40590, 44121, 2654, 44118, 42893, 2654, 47329, 41380, 2654, 50175, 39610, 2654, 52609,
+	37614, 2654, 54584, 35420, 2654, 56054, 33058, 2654, 56970, 30557, 2654, 57285, 29908, 45, 39047, 29295, 45, 38809, 28726, 45, 38428, 28208, 45, 37916,
+	27749, 45, 37284, 27357, 45, 36546, 27038, 45, 35713, 26801, 45, 34797, 26653, 45, 33811, 26602, 45, 32768, 29382, 175, 44140, 28272, 175, 43710,
+	27241, 175, 43019, 26303, 175, 42091, 25472, 175, 40947, 24761, 175, 39610, 24184, 175, 38101, 23754, 175, 36443, 23487, 175, 34658, 23395, 175, 32768,
+	28965, 379, 48171, 27462, 379, 47588, 26066, 379, 46653, 24796, 379, 45396, 23669, 379, 43847, 22706, 379, 42035, 21925, 379, 39992, 21343, 379, 37746,
+	20981, 379, 35328, 20856, 379, 32768, 28646, 649, 51263, 26841, 649, 50563, 25164, 649, 49440, 23639, 649, 47930, 22287, 649, 46070, 21130, 649, 43896,
+	20192, 649, 41442, 19494, 649, 38745, 19059, 649, 35842, 18909, 649, 32768, 28411, 975, 53539, 26383, 975, 52753, 24501, 975, 51492, 22787, 975, 49797,
+	21269, 975, 47708, 19970, 975, 45265, 18916, 975, 42509, 18132, 975, 39481, 17643, 975, 36220, 17475, 975, 32768, 28247, 1348, 55125, 26065, 1348, 54279,
+	24038, 1348, 52921, 22194, 1348, 51097, 20560, 1348, 48848, 19162, 1348, 46219, 18028, 1348, 43253, 17184, 1348, 39993, 16658, 1348, 36484, 16476, 1348, 32768,
+	28142, 1758, 56142, 25860, 1758, 55258, 23742, 1758, 53839, 21814, 1758, 51931, 20105, 1758, 49580, 18643, 1758, 46831, 17457, 1758, 43730, 16575, 1758, 40322,
+	16025, 1758, 36653, 15835, 1758, 32768, 28082, 2197, 56716, 25745, 2197, 55810, 23574, 2197, 54356, 21599, 2197, 52401, 19848, 2197, 49993, 18351, 2197, 47177,
+	17136, 2197, 43999, 16232, 2197, 40508, 15668, 2197, 36748, 15474, 2197, 32768, 28056, 2654, 56970, 25694, 2654, 56054, 23500, 2654, 54584, 21504, 2654, 52609,
+	19735, 2654, 50175, 18222, 2654, 47329, 16994, 2654, 44118, 16080, 2654, 40590, 15511, 2654, 36790, 15315, 2654, 32768, 26653, 45, 31724, 26801, 45, 30738,
+	27038, 45, 29822, 27357, 45, 28989, 27749, 45, 28251, 28208, 45, 27619, 28726, 45, 27107, 29295, 45, 26726, 29908, 45, 26488, 30557, 45, 26406,
+	23487, 175, 30877, 23754, 175, 29092, 24184, 175, 27434, 24761, 175, 25925, 25472, 175, 24588, 26303, 175, 23444, 27241, 175, 22516, 28272, 175, 21825,
+	29382, 175, 21395, 30557, 175, 21246, 20981, 379, 30207, 21343, 379, 27789, 21925, 379, 25543, 22706, 379, 23500, 23669, 379, 21688, 24796, 379, 20139,
+	26066, 379, 18882, 27462, 379, 17947, 28965, 379, 17364, 30557, 379, 17163, 19059, 649, 29693, 19494, 649, 26790, 20192, 649, 24093, 21130, 649, 21639,
+	22287, 649, 19465, 23639, 649, 17605, 25164, 649, 16095, 26841, 649, 14972, 28646, 649, 14272, 30557, 649, 14031, 17643, 975, 29315, 18132, 975, 26054,
+	18916, 975, 23026, 19970, 975, 20270, 21269, 975, 17827, 22787, 975, 15738, 24501, 975, 14043, 26383, 975, 12782, 28411, 975, 11996, 30557, 975, 11725,
+	16658, 1348, 29051, 17184, 1348, 25542, 18028, 1348, 22282, 19162, 1348, 19316, 20560, 1348, 16687, 22194, 1348, 14438, 24038, 1348, 12614, 26065, 1348, 11256,
+	28247, 1348, 10410, 30557, 1348, 10119, 16025, 1758, 28882, 16575, 1758, 25213, 17457, 1758, 21805, 18643, 1758, 18704, 20105, 1758, 15955, 21814, 1758, 13604,
+	23742, 1758, 11696, 25860, 1758, 10277, 28142, 1758, 9393, 30557, 1758, 9088, 15668, 2197, 28787, 16232, 2197, 25027, 17136, 2197, 21536, 18351, 2197, 18358,
+	19848, 2197, 15542, 21599, 2197, 13134, 23574, 2197, 11179, 25745, 2197, 9725, 28082, 2197, 8819, 30557, 2197, 8506, 15511, 2654, 28745, 16080, 2654, 24945,
+	16994, 2654, 21417, 18222, 2654, 18206, 19735, 2654, 15360, 21504, 2654, 12926, 23500, 2654, 10951, 25694, 2654, 9481, 28056, 2654, 8565, 30557, 2654, 8250,
+	31206, 45, 26488, 31819, 45, 26726, 32388, 45, 27107, 32906, 45, 27619, 33365, 45, 28251, 33758, 45, 28989, 34076, 45, 29822, 34313, 45, 30738,
+	34461, 45, 31724, 31732, 175, 21395, 32842, 175, 21825, 33873, 175, 22516, 34811, 175, 23444, 35643, 175, 24588, 36354, 175, 25925, 36931, 175, 27434,
+	37360, 175, 29092, 37628, 175, 30877, 32149, 379, 17364, 33652, 379, 17947, 35048, 379, 18882, 36319, 379, 20139, 37445, 379, 21688, 38408, 379, 23500,
+	39190, 379, 25543, 39771, 379, 27789, 40133, 379, 30207, 32468, 649, 14272, 34273, 649, 14972, 35950, 649, 16095, 37475, 649, 17605, 38828, 649, 19465,
+	39984, 649, 21639, 40922, 649, 24093, 41620, 649, 26790, 42056, 649, 29693, 32704, 975, 11996, 34731, 975, 12782, 36614, 975, 14043, 38327, 975, 15738,
+	39846, 975, 17827, 41144, 975, 20270, 42198, 975, 23026, 42982, 975, 26054, 43471, 975, 29315, 32868, 1348, 10410, 35050, 1348, 11256, 37076, 1348, 12614,
+	38920, 1348, 14438, 40554, 1348, 16687, 41952, 1348, 19316, 43087, 1348, 22282, 43931, 1348, 25542, 44457, 1348, 29051, 32973, 1758, 9393, 35254, 1758, 10277,
+	37373, 1758, 11696, 39301, 1758, 13604, 41010, 1758, 15955, 42471, 1758, 18704, 43657, 1758, 21805, 44539, 1758, 25213, 45089, 1758, 28882, 33032, 2197, 8819,
+	35369, 2197, 9725, 37540, 2197, 11179, 39515, 2197, 13134, 41266, 2197, 15542, 42764, 2197, 18358, 43979, 2197, 21536, 44882, 2197, 25027, 45446, 2197, 28787,
+	33058, 2654, 8565, 35420, 2654, 9481, 37614, 2654, 10951, 39610, 2654, 12926, 41380, 2654, 15360, 42893, 2654, 18206, 44121, 2654, 21417, 45034, 2654, 24945,
+	45604, 2654, 28745
+};
+
+const uint16_t TeapotIndices[TeapotIndexCount] = {
+	0, 1, 2, 2, 3, 0, 4, 5, 1, 1, 0, 4, 6, 7, 5, 5, 4, 6, 8, 9, 7, 7, 6, 8,
+	10, 11, 9, 9, 8, 10, 12, 13, 11, 11, 10, 12, 14, 15, 13, 13, 12, 14, 16, 17, 15, 15, 14, 16,
+	18, 19, 17, 17, 16, 18, 20, 21, 19, 19, 18, 20, 22, 0, 3, 3, 23, 22, 24, 4, 0, 0, 22, 24,
+	25, 6, 4, 4, 24, 25, 26, 8, 6, 6, 25, 26, 27, 10, 8, 8, 26, 27, 28, 12, 10, 10, 27, 28,
+	29, 14, 12, 12, 28, 29, 30, 16, 14, 14, 29, 30, 31, 18, 16, 16, 30, 31, 32, 20, 18, 18, 31, 32,
+	33, 22, 23, 23, 34, 33, 35, 24, 22, 22, 33, 35, 36, 25, 24, 24, 35, 36, 37, 26, 25, 25, 36, 37,
+	38, 27, 26, 26, 37, 38, 39, 28, 27, 27, 38, 39, 40, 29, 28, 28, 39, 40, 41, 30, 29, 29, 40, 41,
+	42, 31, 30, 30, 41, 42, 43, 32, 31, 31, 42, 43, 44, 33, 34, 34, 45, 44, 46, 35, 33, 33, 44, 46,
+	47, 36, 35, 35, 46, 47, 48, 37, 36, 36, 47, 48, 49, 38, 37, 37, 48, 49, 50, 39, 38, 38, 49, 50,
+	51, 40, 39, 39, 50, 51, 52, 41, 40, 40, 51, 52, 53, 42, 41, 41, 52, 53, 54, 43, 42, 42, 53, 54,
+	55, 44, 45, 45, 56, 55, 57, 46, 44, 44, 55, 57, 58, 47, 46, 46, 57, 58, 59, 48, 47, 47, 58, 59,
+	60, 49, 48, 48, 59, 60, 61, 50, 49, 49, 60, 61, 62, 51, 50, 50, 61, 62, 63, 52, 51, 51, 62, 63,
+	64, 53, 52, 52, 63, 64, 65, 54, 53, 53, 64, 65, 66, 55, 56, 56, 67, 66, 68, 57, 55, 55, 66, 68,
+	69, 58, 57, 57, 68, 69, 70, 59, 58, 58, 69, 70, 71, 60, 59, 59, 70, 71, 72, 61, 60, 60, 71, 72,
+	73, 62, 61, 61, 72, 73, 74, 63, 62, 62, 73, 74, 75, 64, 63, 63, 74, 75, 76, 65, 64, 64, 75, 76,
+	77, 66, 67, 67, 78, 77, 79, 68, 66, 66, 77, 79, 80, 69, 68, 68, 79, 80, 81, 70, 69, 69, 80, 81,
+	82, 71, 70, 70, 81, 82, 83, 72, 71, 71, 82, 83, 84, 73, 72, 72, 83, 84, 85, 74, 73, 73, 84, 85,
+	86, 75, 74, 74, 85, 86, 87, 76, 75, 75, 86, 87, 88, 77, 78, 78, 89, 88, 90, 79, 77, 77, 88, 90,
+	91, 80, 79, 79, 90, 91, 92, 81, 80, 80, 91, 92, 93, 82, 81, 81, 92, 93, 94, 83, 82, 82, 93, 94,
+	95, 84, 83, 83, 94, 95, 96, 85, 84, 84, 95, 96, 97, 86, 85, 85, 96, 97, 98, 87, 86, 86, 97, 98,
+	99, 88, 89, 89, 100, 99, 101, 90, 88, 88, 99, 101, 102, 91, 90, 90, 101, 102, 103, 92, 91, 91, 102, 103,
+	104, 93, 92, 92, 103, 104, 105, 94, 93, 93, 104, 105, 106, 95, 94, 94, 105, 106, 107, 96, 95, 95, 106, 107,
+	108, 97, 96, 96, 107, 108, 109, 98, 97, 97, 108, 109, 110, 99, 100, 100, 111, 110, 112, 101, 99, 99, 110, 112,
+	113, 102, 101, 101, 112, 113, 114, 103, 102, 102, 113, 114, 115, 104, 103, 103, 114, 115, 116, 105, 104, 104, 115, 116,
+	117, 106, 105, 105, 116, 117, 118, 107, 106, 106, 117, 118, 119, 108, 107, 107, 118, 119, 120, 109, 108, 108, 119, 120,
+	121, 122, 21, 21, 20, 121, 123, 124, 122, 122, 121, 123, 125, 126, 124, 124, 123, 125, 127, 128, 126, 126, 125, 127,
+	129, 130, 128, 128, 127, 129, 131, 132, 130, 130, 129, 131, 133, 134, 132, 132, 131, 133, 135, 136, 134, 134, 133, 135,
+	137, 138, 136, 136, 135, 137, 139, 140, 138, 138, 137, 139, 141, 121, 20, 20, 32, 141, 142, 123, 121, 121, 141, 142,
+	143, 125, 123, 123, 142, 143, 144, 127, 125, 125, 143, 144, 145, 129, 127, 127, 144, 145, 146, 131, 129, 129, 145, 146,
+	147, 133, 131, 131, 146, 147, 148, 135, 133, 133, 147, 148, 149, 137, 135, 135, 148, 149, 150, 139, 137, 137, 149, 150,
+	151, 141, 32, 32, 43, 151, 152, 142, 141, 141, 151, 152, 153, 143, 142, 142, 152, 153, 154, 144, 143, 143, 153, 154,
+	155, 145, 144, 144, 154, 155, 156, 146, 145, 145, 155, 156, 157, 147, 146, 146, 156, 157, 158, 148, 147, 147, 157, 158,
+	159, 149, 148, 148, 158, 159, 160, 150, 149, 149, 159, 160, 161, 151, 43, 43, 54, 161, 162, 152, 151, 151, 161, 162,
+	163, 153, 152, 152, 162, 163, 164, 154, 153, 153, 163, 164, 165, 155, 154, 154, 164, 165, 166, 156, 155, 155, 165, 166,
+	167, 157, 156, 156, 166, 167, 168, 158, 157, 157, 167, 168, 169, 159, 158, 158, 168, 169, 170, 160, 159, 159, 169, 170,
+	171, 161, 54, 54, 65, 171, 172, 162, 161, 161, 171, 172, 173, 163, 162, 162, 172, 173, 174, 164, 163, 163, 173, 174,
+	175, 165, 164, 164, 174, 175, 176, 166, 165, 165, 175, 176, 177, 167, 166, 166, 176, 177, 178, 168, 167, 167, 177, 178,
+	179, 169, 168, 168, 178, 179, 180, 170, 169, 169, 179, 180, 181, 171, 65, 65, 76, 181, 182, 172, 171, 171, 181, 182,
+	183, 173, 172, 172, 182, 183, 184, 174, 173, 173, 183, 184, 185, 175, 174, 174, 184, 185, 186, 176, 175, 175, 185, 186,
+	187, 177, 176, 176, 186, 187, 188, 178, 177, 177, 187, 188, 189, 179, 178, 178, 188, 189, 190, 180, 179, 179, 189, 190,
+	191, 181, 76, 76, 87, 191, 192, 182, 181, 181, 191, 192, 193, 183, 182, 182, 192, 193, 194, 184, 183, 183, 193, 194,
+	195, 185, 184, 184, 194, 195, 196, 186, 185, 185, 195, 196, 197, 187, 186, 186, 196, 197, 198, 188, 187, 187, 197, 198,
+	199, 189, 188, 188, 198, 199, 200, 190, 189, 189, 199, 200, 201, 191, 87, 87, 98, 201, 202, 192, 191, 191, 201, 202,
+	203, 193, 192, 192, 202, 203, 204, 194, 193, 193, 203, 204, 205, 195, 194, 194, 204, 205, 206, 196, 195, 195, 205, 206,
+	207, 197, 196, 196, 206, 207, 208, 198, 197, 197, 207, 208, 209, 199, 198, 198, 208, 209, 210, 200, 199, 199, 209, 210,
+	211, 201, 98, 98, 109, 211, 212, 202, 201, 201, 211, 212, 213, 203, 202, 202, 212, 213, 214, 204, 203, 203, 213, 214,
+	215, 205, 204, 204, 214, 215, 216, 206, 205, 205, 215, 216, 217, 207, 206, 206, 216, 217, 218, 208, 207, 207, 217, 218,
+	219, 209, 208, 208, 218, 219, 220, 210, 209, 209, 219, 220, 221, 211, 109, 109, 120, 221, 222, 212, 211, 211, 221, 222,
+	223, 213, 212, 212, 222, 223, 224, 214, 213, 213, 223, 224, 225, 215, 214, 214, 224, 225, 226, 216, 215, 215, 225, 226,
+	227, 217, 216, 216, 226, 227, 228, 218, 217, 217, 227, 228, 229, 219, 218, 218, 228, 229, 230, 220, 219, 219, 229, 230,
+	231, 232, 140, 140, 139, 231, 233, 234, 232, 232, 231, 233, 235, 236, 234, 234, 233, 235, 237, 238, 236, 236, 235, 237,
+	239, 240, 238, 238, 237, 239, 241, 242, 240, 240, 239, 241, 243, 244, 242, 242, 241, 243, 245, 246, 244, 244, 243, 245,
+	247, 248, 246, 246, 245, 247, 249, 250, 248, 248, 247, 249, 251, 231, 139, 139, 150, 251, 252, 233, 231, 231, 251, 252,
+	253, 235, 233, 233, 252, 253, 254, 237, 235, 235, 253, 254, 255, 239, 237, 237, 254, 255, 256, 241, 239, 239, 255, 256,
+	257, 243, 241, 241, 256, 257, 258, 245, 243, 243, 257, 258, 259, 247, 245, 245, 258, 259, 260, 249, 247, 247, 259, 260,
+	261, 251, 150, 150, 160, 261, 262, 252, 251, 251, 261, 262, 263, 253, 252, 252, 262, 263, 264, 254, 253, 253, 263, 264,
+	265, 255, 254, 254, 264, 265, 266, 256, 255, 255, 265, 266, 267, 257, 256, 256, 266, 267, 268, 258, 257, 257, 267, 268,
+	269, 259, 258, 258, 268, 269, 270, 260, 259, 259, 269, 270, 271, 261, 160, 160, 170, 271, 272, 262, 261, 261, 271, 272,
+	273, 263, 262, 262, 272, 273, 274, 264, 263, 263, 273, 274, 275, 265, 264, 264, 274, 275, 276, 266, 265, 265, 275, 276,
+	277, 267, 266, 266, 276, 277, 278, 268, 267, 267, 277, 278, 279, 269, 268, 268, 278, 279, 280, 270, 269, 269, 279, 280,
+	281, 271, 170, 170, 180, 281, 282, 272, 271, 271, 281, 282, 283, 273, 272, 272, 282, 283, 284, 274, 273, 273, 283, 284,
+	285, 275, 274, 274, 284, 285, 286, 276, 275, 275, 285, 286, 287, 277, 276, 276, 286, 287, 288, 278, 277, 277, 287, 288,
+	289, 279, 278, 278, 288, 289, 290, 280, 279, 279, 289, 290, 291, 281, 180, 180, 190, 291, 292, 282, 281, 281, 291, 292,
+	293, 283, 282, 282, 292, 293, 294, 284, 283, 283, 293, 294, 295, 285, 284, 284, 294, 295, 296, 286, 285, 285, 295, 296,
+	297, 287, 286, 286, 296, 297, 298, 288, 287, 287, 297, 298, 299, 289, 288, 288, 298, 299, 300, 290, 289, 289, 299, 300,
+	301, 291, 190, 190, 200, 301, 302, 292, 291, 291, 301, 302, 303, 293, 292, 292, 302, 303, 304, 294, 293, 293, 303, 304,
+	305, 295, 294, 294, 304, 305, 306, 296, 295, 295, 305, 306, 307, 297, 296, 296, 306, 307, 308, 298, 297, 297, 307, 308,
+	309, 299, 298, 298, 308, 309, 310, 300, 299, 299, 309, 310, 311, 301, 200, 200, 210, 311, 312, 302, 301, 301, 311, 312,
+	313, 303, 302, 302, 312, 313, 314, 304, 303, 303, 313, 314, 315, 305, 304, 304, 314, 315, 316, 306, 305, 305, 315, 316,
+	317, 307, 306, 306, 316, 317, 318, 308, 307, 307, 317, 318, 319, 309, 308, 308, 318, 319, 320, 310, 309, 309, 319, 320,
+	321, 311, 210, 210, 220, 321, 322, 312, 311, 311, 321, 322, 323, 313, 312, 312, 322, 323, 324, 314, 313, 313, 323, 324,
+	325, 315, 314, 314, 324, 325, 326, 316, 315, 315, 325, 326, 327, 317, 316, 316, 326, 327, 328, 318, 317, 317, 327, 328,
+	329, 319, 318, 318, 328, 329, 330, 320, 319, 319, 329, 330, 331, 321, 220, 220, 230, 331, 332, 322, 321, 321, 331, 332,
+	333, 323, 322, 322, 332, 333, 334, 324, 323, 323, 333, 334, 335, 325, 324, 324, 334, 335, 336, 326, 325, 325, 335, 336,
+	337, 327, 326, 326, 336, 337, 338, 328, 327, 327, 337, 338, 339, 329, 328, 328, 338, 339, 340, 330, 329, 329, 339, 340,
+	341, 342, 250, 250, 249, 341, 343, 344, 342, 342, 341, 343, 345, 346, 344, 344, 343, 345, 347, 348, 346, 346, 345, 347,
+	349, 350, 348, 348, 347, 349, 351, 352, 350, 350, 349, 351, 353, 354, 352, 352, 351, 353, 355, 356, 354, 354, 353, 355,
+	357, 358, 356, 356, 355, 357, 3, 2, 358, 358, 357, 3, 359, 341, 249, 249, 260, 359, 360, 343, 341, 341, 359, 360,
+	361, 345, 343, 343, 360, 361, 362, 347, 345, 345, 361, 362, 363, 349, 347, 347, 362, 363, 364, 351, 349, 349, 363, 364,
+	365, 353, 351, 351, 364, 365, 366, 355, 353, 353, 365, 366, 367, 357, 355, 355, 366, 367, 23, 3, 357, 357, 367, 23,
+	368, 359, 260, 260, 270, 368, 369, 360, 359, 359, 368, 369, 370, 361, 360, 360, 369, 370, 371, 362, 361, 361, 370, 371,
+	372, 363, 362, 362, 371, 372, 373, 364, 363, 363, 372, 373, 374, 365, 364, 364, 373, 374, 375, 366, 365, 365, 374, 375,
+	376, 367, 366, 366, 375, 376, 34, 23, 367, 367, 376, 34, 377, 368, 270, 270, 280, 377, 378, 369, 368, 368, 377, 378,
+	379, 370, 369, 369, 378, 379, 380, 371, 370, 370, 379, 380, 381, 372, 371, 371, 380, 381, 382, 373, 372, 372, 381, 382,
+	383, 374, 373, 373, 382, 383, 384, 375, 374, 374, 383, 384, 385, 376, 375, 375, 384, 385, 45, 34, 376, 376, 385, 45,
+	386, 377, 280, 280, 290, 386, 387, 378, 377, 377, 386, 387, 388, 379, 378, 378, 387, 388, 389, 380, 379, 379, 388, 389,
+	390, 381, 380, 380, 389, 390, 391, 382, 381, 381, 390, 391, 392, 383, 382, 382, 391, 392, 393, 384, 383, 383, 392, 393,
+	394, 385, 384, 384, 393, 394, 56, 45, 385, 385, 394, 56, 395, 386, 290, 290, 300, 395, 396, 387, 386, 386, 395, 396,
+	397, 388, 387, 387, 396, 397, 398, 389, 388, 388, 397, 398, 399, 390, 389, 389, 398, 399, 400, 391, 390, 390, 399, 400,
+	401, 392, 391, 391, 400, 401, 402, 393, 392, 392, 401, 402, 403, 394, 393, 393, 402, 403, 67, 56, 394, 394, 403, 67,
+	404, 395, 300, 300, 310, 404, 405, 396, 395, 395, 404, 405, 406, 397, 396, 396, 405, 406, 407, 398, 397, 397, 406, 407,
+	408, 399, 398, 398, 407, 408, 409, 400, 399, 399, 408, 409, 410, 401, 400, 400, 409, 410, 411, 402, 401, 401, 410, 411,
+	412, 403, 402, 402, 411, 412, 78, 67, 403, 403, 412, 78, 413, 404, 310, 310, 320, 413, 414, 405, 404, 404, 413, 414,
+	415, 406, 405, 405, 414, 415, 416, 407, 406, 406, 415, 416, 417, 408, 407, 407, 416, 417, 418, 409, 408, 408, 417, 418,
+	419, 410, 409, 409, 418, 419, 420, 411, 410, 410, 419, 420, 421, 412, 411, 411, 420, 421, 89, 78, 412, 412, 421, 89,
+	422, 413, 320, 320, 330, 422, 423, 414, 413, 413, 422, 423, 424, 415, 414, 414, 423, 424, 425, 416, 415, 415, 424, 425,
+	426, 417, 416, 416, 425, 426, 427, 418, 417, 417, 426, 427, 428, 419, 418, 418, 427, 428, 429, 420, 419, 419, 428, 429,
+	430, 421, 420, 420, 429, 430, 100, 89, 421, 421, 430, 100, 431, 422, 330, 330, 340, 431, 432, 423, 422, 422, 431, 432,
+	433, 424, 423, 423, 432, 433, 434, 425, 424, 424, 433, 434, 435, 426, 425, 425, 434, 435, 436, 427, 426, 426, 435, 436,
+	437, 428, 427, 427, 436, 437, 438, 429, 428, 428, 437, 438, 439, 430, 429, 429, 438, 439, 111, 100, 430, 430, 439, 111,
+	440, 110, 111, 111, 441, 440, 442, 112, 110, 110, 440, 442, 443, 113, 112, 112, 442, 443, 444, 114, 113, 113, 443, 444,
+	445, 115, 114, 114, 444, 445, 446, 116, 115, 115, 445, 446, 447, 117, 116, 116, 446, 447, 448, 118, 117, 117, 447, 448,
+	449, 119, 118, 118, 448, 449, 450, 120, 119, 119, 449, 450, 451, 440, 441, 441, 452, 451, 453, 442, 440, 440, 451, 453,
+	454, 443, 442, 442, 453, 454, 455, 444, 443, 443, 454, 455, 456, 445, 444, 444, 455, 456, 457, 446, 445, 445, 456, 457,
+	458, 447, 446, 446, 457, 458, 459, 448, 447, 447, 458, 459, 460, 449, 448, 448, 459, 460, 461, 450, 449, 449, 460, 461,
+	462, 451, 452, 452, 463, 462, 464, 453, 451, 451, 462, 464, 465, 454, 453, 453, 464, 465, 466, 455, 454, 454, 465, 466,
+	467, 456, 455, 455, 466, 467, 468, 457, 456, 456, 467, 468, 469, 458, 457, 457, 468, 469, 470, 459, 458, 458, 469, 470,
+	471, 460, 459, 459, 470, 471, 472, 461, 460, 460, 471, 472, 473, 462, 463, 463, 474, 473, 475, 464, 462, 462, 473, 475,
+	476, 465, 464, 464, 475, 476, 477, 466, 465, 465, 476, 477, 478, 467, 466, 466, 477, 478, 479, 468, 467, 467, 478, 479,
+	480, 469, 468, 468, 479, 480, 481, 470, 469, 469, 480, 481, 482, 471, 470, 470, 481, 482, 483, 472, 471, 471, 482, 483,
+	484, 473, 474, 474, 485, 484, 486, 475, 473, 473, 484, 486, 487, 476, 475, 475, 486, 487, 488, 477, 476, 476, 487, 488,
+	489, 478, 477, 477, 488, 489, 490, 479, 478, 478, 489, 490, 491, 480, 479, 479, 490, 491, 492, 481, 480, 480, 491, 492,
+	493, 482, 481, 481, 492, 493, 494, 483, 482, 482, 493, 494, 495, 484, 485, 485, 496, 495, 497, 486, 484, 484, 495, 497,
+	498, 487, 486, 486, 497, 498, 499, 488, 487, 487, 498, 499, 500, 489, 488, 488, 499, 500, 501, 490, 489, 489, 500, 501,
+	502, 491, 490, 490, 501, 502, 503, 492, 491, 491, 502, 503, 504, 493, 492, 492, 503, 504, 505, 494, 493, 493, 504, 505,
+	506, 495, 496, 496, 507, 506, 508, 497, 495, 495, 506, 508, 509, 498, 497, 497, 508, 509, 510, 499, 498, 498, 509, 510,
+	511, 500, 499, 499, 510, 511, 512, 501, 500, 500, 511, 512, 513, 502, 501, 501, 512, 513, 514, 503, 502, 502, 513, 514,
+	515, 504, 503, 503, 514, 515, 516, 505, 504, 504, 515, 516, 517, 506, 507, 507, 518, 517, 519, 508, 506, 506, 517, 519,
+	520, 509, 508, 508, 519, 520, 521, 510, 509, 509, 520, 521, 522, 511, 510, 510, 521, 522, 523, 512, 511, 511, 522, 523,
+	524, 513, 512, 512, 523, 524, 525, 514, 513, 513, 524, 525, 526, 515, 514, 514, 525, 526, 527, 516, 515, 515, 526, 527,
+	528, 517, 518, 518, 529, 528, 530, 519, 517, 517, 528, 530, 531, 520, 519, 519, 530, 531, 532, 521, 520, 520, 531, 532,
+	533, 522, 521, 521, 532, 533, 534, 523, 522, 522, 533, 534, 535, 524, 523, 523, 534, 535, 536, 525, 524, 524, 535, 536,
+	537, 526, 525, 525, 536, 537, 538, 527, 526, 526, 537, 538, 539, 528, 529, 529, 540, 539, 541, 530, 528, 528, 539, 541,
+	542, 531, 530, 530, 541, 542, 543, 532, 531, 531, 542, 543, 544, 533, 532, 532, 543, 544, 545, 534, 533, 533, 544, 545,
+	546, 535, 534, 534, 545, 546, 547, 536, 535, 535, 546, 547, 548, 537, 536, 536, 547, 548, 549, 538, 537, 537, 548, 549,
+	550, 221, 120, 120, 450, 550, 551, 222, 221, 221, 550, 551, 552, 223, 222, 222, 551, 552, 553, 224, 223, 223, 552, 553,
+	554, 225, 224, 224, 553, 554, 555, 226, 225, 225, 554, 555, 556, 227, 226, 226, 555, 556, 557, 228, 227, 227, 556, 557,
+	558, 229, 228, 228, 557, 558, 559, 230, 229, 229, 558, 559, 560, 550, 450, 450, 461, 560, 561, 551, 550, 550, 560, 561,
+	562, 552, 551, 551, 561, 562, 563, 553, 552, 552, 562, 563, 564, 554, 553, 553, 563, 564, 565, 555, 554, 554, 564, 565,
+	566, 556, 555, 555, 565, 566, 567, 557, 556, 556, 566, 567, 568, 558, 557, 557, 567, 568, 569, 559, 558, 558, 568, 569,
+	570, 560, 461, 461, 472, 570, 571, 561, 560, 560, 570, 571, 572, 562, 561, 561, 571, 572, 573, 563, 562, 562, 572, 573,
+	574, 564, 563, 563, 573, 574, 575, 565, 564, 564, 574, 575, 576, 566, 565, 565, 575, 576, 577, 567, 566, 566, 576, 577,
+	578, 568, 567, 567, 577, 578, 579, 569, 568, 568, 578, 579, 580, 570, 472, 472, 483, 580, 581, 571, 570, 570, 580, 581,
+	582, 572, 571, 571, 581, 582, 583, 573, 572, 572, 582, 583, 584, 574, 573, 573, 583, 584, 585, 575, 574, 574, 584, 585,
+	586, 576, 575, 575, 585, 586, 587, 577, 576, 576, 586, 587, 588, 578, 577, 577, 587, 588, 589, 579, 578, 578, 588, 589,
+	590, 580, 483, 483, 494, 590, 591, 581, 580, 580, 590, 591, 592, 582, 581, 581, 591, 592, 593, 583, 582, 582, 592, 593,
+	594, 584, 583, 583, 593, 594, 595, 585, 584, 584, 594, 595, 596, 586, 585, 585, 595, 596, 597, 587, 586, 586, 596, 597,
+	598, 588, 587, 587, 597, 598, 599, 589, 588, 588, 598, 599, 600, 590, 494, 494, 505, 600, 601, 591, 590, 590, 600, 601,
+	602, 592, 591, 591, 601, 602, 603, 593, 592, 592, 602, 603, 604, 594, 593, 593, 603, 604, 605, 595, 594, 594, 604, 605,
+	606, 596, 595, 595, 605, 606, 607, 597, 596, 596, 606, 607, 608, 598, 597, 597, 607, 608, 609, 599, 598, 598, 608, 609,
+	610, 600, 505, 505, 516, 610, 611, 601, 600, 600, 610, 611, 612, 602, 601, 601, 611, 612, 613, 603, 602, 602, 612, 613,
+	614, 604, 603, 603, 613, 614, 615, 605, 604, 604, 614, 615, 616, 606, 605, 605, 615, 616, 617, 607, 606, 606, 616, 617,
+	618, 608, 607, 607, 617, 618, 619, 609, 608, 608, 618, 619, 620, 610, 516, 516, 527, 620, 621, 611, 610, 610, 620, 621,
+	622, 612, 611, 611, 621, 622, 623, 613, 612, 612, 622, 623, 624, 614, 613, 613, 623, 624, 625, 615, 614, 614, 624, 625,
+	626, 616, 615, 615, 625, 626, 627, 617, 616, 616, 626, 627, 628, 618, 617, 617, 627, 628, 629, 619, 618, 618, 628, 629,
+	630, 620, 527, 527, 538, 630, 631, 621, 620, 620, 630, 631, 632, 622, 621, 621, 631, 632, 633, 623, 622, 622, 632, 633,
+	634, 624, 623, 623, 633, 634, 635, 625, 624, 624, 634, 635, 636, 626, 625, 625, 635, 636, 637, 627, 626, 626, 636, 637,
+	638, 628, 627, 627, 637, 638, 639, 629, 628, 628, 638, 639, 640, 630, 538, 538, 549, 640, 641, 631, 630, 630, 640, 641,
+	642, 632, 631, 631, 641, 642, 643, 633, 632, 632, 642, 643, 644, 634, 633, 633, 643, 644, 645, 635, 634, 634, 644, 645,
+	646, 636, 635, 635, 645, 646, 647, 637, 636, 636, 646, 647, 648, 638, 637, 637, 647, 648, 649, 639, 638, 638, 648, 649,
+	650, 331, 230, 230, 559, 650, 651, 332, 331, 331, 650, 651, 652, 333, 332, 332, 651, 652, 653, 334, 333, 333, 652, 653,
+	654, 335, 334, 334, 653, 654, 655, 336, 335, 335, 654, 655, 656, 337, 336, 336, 655, 656, 657, 338, 337, 337, 656, 657,
+	658, 339, 338, 338, 657, 658, 659, 340, 339, 339, 658, 659, 660, 650, 559, 559, 569, 660, 661, 651, 650, 650, 660, 661,
+	662, 652, 651, 651, 661, 662, 663, 653, 652, 652, 662, 663, 664, 654, 653, 653, 663, 664, 665, 655, 654, 654, 664, 665,
+	666, 656, 655, 655, 665, 666, 667, 657, 656, 656, 666, 667, 668, 658, 657, 657, 667, 668, 669, 659, 658, 658, 668, 669,
+	670, 660, 569, 569, 579, 670, 671, 661, 660, 660, 670, 671, 672, 662, 661, 661, 671, 672, 673, 663, 662, 662, 672, 673,
+	674, 664, 663, 663, 673, 674, 675, 665, 664, 664, 674, 675, 676, 666, 665, 665, 675, 676, 677, 667, 666, 666, 676, 677,
+	678, 668, 667, 667, 677, 678, 679, 669, 668, 668, 678, 679, 680, 670, 579, 579, 589, 680, 681, 671, 670, 670, 680, 681,
+	682, 672, 671, 671, 681, 682, 683, 673, 672, 672, 682, 683, 684, 674, 673, 673, 683, 684, 685, 675, 674, 674, 684, 685,
+	686, 676, 675, 675, 685, 686, 687, 677, 676, 676, 686, 687, 688, 678, 677, 677, 687, 688, 689, 679, 678, 678, 688, 689,
+	690, 680, 589, 589, 599, 690, 691, 681, 680, 680, 690, 691, 692, 682, 681, 681, 691, 692, 693, 683, 682, 682, 692, 693,
+	694, 684, 683, 683, 693, 694, 695, 685, 684, 684, 694, 695, 696, 686, 685, 685, 695, 696, 697, 687, 686, 686, 696, 697,
+	698, 688, 687, 687, 697, 698, 699, 689, 688, 688, 698, 699, 700, 690, 599, 599, 609, 700, 701, 691, 690, 690, 700, 701,
+	702, 692, 691, 691, 701, 702, 703, 693, 692, 692, 702, 703, 704, 694, 693, 693, 703, 704, 705, 695, 694, 694, 704, 705,
+	706, 696, 695, 695, 705, 706, 707, 697, 696, 696, 706, 707, 708, 698, 697, 697, 707, 708, 709, 699, 698, 698, 708, 709,
+	710, 700, 609, 609, 619, 710, 711, 701, 700, 700, 710, 711, 712, 702, 701, 701, 711, 712, 713, 703, 702, 702, 712, 713,
+	714, 704, 703, 703, 713, 714, 715, 705, 704, 704, 714, 715, 716, 706, 705, 705, 715, 716, 717, 707, 706, 706, 716, 717,
+	718, 708, 707, 707, 717, 718, 719, 709, 708, 708, 718, 719, 720, 710, 619, 619, 629, 720, 721, 711, 710, 710, 720, 721,
+	722, 712, 711, 711, 721, 722, 723, 713, 712, 712, 722, 723, 724, 714, 713, 713, 723, 724, 725, 715, 714, 714, 724, 725,
+	726, 716, 715, 715, 725, 726, 727, 717, 716, 716, 726, 727, 728, 718, 717, 717, 727, 728, 729, 719, 718, 718, 728, 729,
+	730, 720, 629, 629, 639, 730, 731, 721, 720, 720, 730, 731, 732, 722, 721, 721, 731, 732, 733, 723, 722, 722, 732, 733,
+	734, 724, 723, 723, 733, 734, 735, 725, 724, 724, 734, 735, 736, 726, 725, 725, 735, 736, 737, 727, 726, 726, 736, 737,
+	738, 728, 727, 727, 737, 738, 739, 729, 728, 728, 738, 739, 740, 730, 639, 639, 649, 740, 741, 731, 730, 730, 740, 741,
+	742, 732, 731, 731, 741, 742, 743, 733, 732, 732, 742, 743, 744, 734, 733, 733, 743, 744, 745, 735, 734, 734, 744, 745,
+	746, 736, 735, 735, 745, 746, 747, 737, 736, 736, 746, 747, 748, 738, 737, 737, 747, 748, 749, 739, 738, 738, 748, 749,
+	750, 431, 340, 340, 659, 750, 751, 432, 431, 431, 750, 751, 752, 433, 432, 432, 751, 752, 753, 434, 433, 433, 752, 753,
+	754, 435, 434, 434, 753, 754, 755, 436, 435, 435, 754, 755, 756, 437, 436, 436, 755, 756, 757, 438, 437, 437, 756, 757,
+	758, 439, 438, 438, 757, 758, 441, 111, 439, 439, 758, 441, 759, 750, 659, 659, 669, 759, 760, 751, 750, 750, 759, 760,
+	761, 752, 751, 751, 760, 761, 762, 753, 752, 752, 761, 762, 763, 754, 753, 753, 762, 763, 764, 755, 754, 754, 763, 764,
+	765, 756, 755, 755, 764, 765, 766, 757, 756, 756, 765, 766, 767, 758, 757, 757, 766, 767, 452, 441, 758, 758, 767, 452,
+	768, 759, 669, 669, 679, 768, 769, 760, 759, 759, 768, 769, 770, 761, 760, 760, 769, 770, 771, 762, 761, 761, 770, 771,
+	772, 763, 762, 762, 771, 772, 773, 764, 763, 763, 772, 773, 774, 765, 764, 764, 773, 774, 775, 766, 765, 765, 774, 775,
+	776, 767, 766, 766, 775, 776, 463, 452, 767, 767, 776, 463, 777, 768, 679, 679, 689, 777, 778, 769, 768, 768, 777, 778,
+	779, 770, 769, 769, 778, 779, 780, 771, 770, 770, 779, 780, 781, 772, 771, 771, 780, 781, 782, 773, 772, 772, 781, 782,
+	783, 774, 773, 773, 782, 783, 784, 775, 774, 774, 783, 784, 785, 776, 775, 775, 784, 785, 474, 463, 776, 776, 785, 474,
+	786, 777, 689, 689, 699, 786, 787, 778, 777, 777, 786, 787, 788, 779, 778, 778, 787, 788, 789, 780, 779, 779, 788, 789,
+	790, 781, 780, 780, 789, 790, 791, 782, 781, 781, 790, 791, 792, 783, 782, 782, 791, 792, 793, 784, 783, 783, 792, 793,
+	794, 785, 784, 784, 793, 794, 485, 474, 785, 785, 794, 485, 795, 786, 699, 699, 709, 795, 796, 787, 786, 786, 795, 796,
+	797, 788, 787, 787, 796, 797, 798, 789, 788, 788, 797, 798, 799, 790, 789, 789, 798, 799, 800, 791, 790, 790, 799, 800,
+	801, 792, 791, 791, 800, 801, 802, 793, 792, 792, 801, 802, 803, 794, 793, 793, 802, 803, 496, 485, 794, 794, 803, 496,
+	804, 795, 709, 709, 719, 804, 805, 796, 795, 795, 804, 805, 806, 797, 796, 796, 805, 806, 807, 798, 797, 797, 806, 807,
+	808, 799, 798, 798, 807, 808, 809, 800, 799, 799, 808, 809, 810, 801, 800, 800, 809, 810, 811, 802, 801, 801, 810, 811,
+	812, 803, 802, 802, 811, 812, 507, 496, 803, 803, 812, 507, 813, 804, 719, 719, 729, 813, 814, 805, 804, 804, 813, 814,
+	815, 806, 805, 805, 814, 815, 816, 807, 806, 806, 815, 816, 817, 808, 807, 807, 816, 817, 818, 809, 808, 808, 817, 818,
+	819, 810, 809, 809, 818, 819, 820, 811, 810, 810, 819, 820, 821, 812, 811, 811, 820, 821, 518, 507, 812, 812, 821, 518,
+	822, 813, 729, 729, 739, 822, 823, 814, 813, 813, 822, 823, 824, 815, 814, 814, 823, 824, 825, 816, 815, 815, 824, 825,
+	826, 817, 816, 816, 825, 826, 827, 818, 817, 817, 826, 827, 828, 819, 818, 818, 827, 828, 829, 820, 819, 819, 828, 829,
+	830, 821, 820, 820, 829, 830, 529, 518, 821, 821, 830, 529, 831, 822, 739, 739, 749, 831, 832, 823, 822, 822, 831, 832,
+	833, 824, 823, 823, 832, 833, 834, 825, 824, 824, 833, 834, 835, 826, 825, 825, 834, 835, 836, 827, 826, 826, 835, 836,
+	837, 828, 827, 827, 836, 837, 838, 829, 828, 828, 837, 838, 839, 830, 829, 829, 838, 839, 540, 529, 830, 830, 839, 540,
+	840, 539, 540, 540, 841, 840, 842, 541, 539, 539, 840, 842, 843, 542, 541, 541, 842, 843, 844, 543, 542, 542, 843, 844,
+	845, 544, 543, 543, 844, 845, 846, 545, 544, 544, 845, 846, 847, 546, 545, 545, 846, 847, 848, 547, 546, 546, 847, 848,
+	849, 548, 547, 547, 848, 849, 850, 549, 548, 548, 849, 850, 851, 840, 841, 841, 852, 851, 853, 842, 840, 840, 851, 853,
+	854, 843, 842, 842, 853, 854, 855, 844, 843, 843, 854, 855, 856, 845, 844, 844, 855, 856, 857, 846, 845, 845, 856, 857,
+	858, 847, 846, 846, 857, 858, 859, 848, 847, 847, 858, 859, 860, 849, 848, 848, 859, 860, 861, 850, 849, 849, 860, 861,
+	862, 851, 852, 852, 863, 862, 864, 853, 851, 851, 862, 864, 865, 854, 853, 853, 864, 865, 866, 855, 854, 854, 865, 866,
+	867, 856, 855, 855, 866, 867, 868, 857, 856, 856, 867, 868, 869, 858, 857, 857, 868, 869, 870, 859, 858, 858, 869, 870,
+	871, 860, 859, 859, 870, 871, 872, 861, 860, 860, 871, 872, 873, 862, 863, 863, 874, 873, 875, 864, 862, 862, 873, 875,
+	876, 865, 864, 864, 875, 876, 877, 866, 865, 865, 876, 877, 878, 867, 866, 866, 877, 878, 879, 868, 867, 867, 878, 879,
+	880, 869, 868, 868, 879, 880, 881, 870, 869, 869, 880, 881, 882, 871, 870, 870, 881, 882, 883, 872, 871, 871, 882, 883,
+	884, 873, 874, 874, 885, 884, 886, 875, 873, 873, 884, 886, 887, 876, 875, 875, 886, 887, 888, 877, 876, 876, 887, 888,
+	889, 878, 877, 877, 888, 889, 890, 879, 878, 878, 889, 890, 891, 880, 879, 879, 890, 891, 892, 881, 880, 880, 891, 892,
+	893, 882, 881, 881, 892, 893, 894, 883, 882, 882, 893, 894, 895, 884, 885, 885, 896, 895, 897, 886, 884, 884, 895, 897,
+	898, 887, 886, 886, 897, 898, 899, 888, 887, 887, 898, 899, 900, 889, 888, 888, 899, 900, 901, 890, 889, 889, 900, 901,
+	902, 891, 890, 890, 901, 902, 903, 892, 891, 891, 902, 903, 904, 893, 892, 892, 903, 904, 905, 894, 893, 893, 904, 905,
+	906, 895, 896, 896, 907, 906, 908, 897, 895, 895, 906, 908, 909, 898, 897, 897, 908, 909, 910, 899, 898, 898, 909, 910,
+	911, 900, 899, 899, 910, 911, 912, 901, 900, 900, 911, 912, 913, 902, 901, 901, 912, 913, 914, 903, 902, 902, 913, 914,
+	915, 904, 903, 903, 914, 915, 916, 905, 904, 904, 915, 916, 917, 906, 907, 907, 918, 917, 919, 908, 906, 906, 917, 919,
+	920, 909, 908, 908, 919, 920, 921, 910, 909, 909, 920, 921, 922, 911, 910, 910, 921, 922, 923, 912, 911, 911, 922, 923,
+	924, 913, 912, 912, 923, 924, 925, 914, 913, 913, 924, 925, 926, 915, 914, 914, 925, 926, 927, 916, 915, 915, 926, 927,
+	928, 917, 918, 918, 929, 928, 930, 919, 917, 917, 928, 930, 931, 920, 919, 919, 930, 931, 932, 921, 920, 920, 931, 932,
+	933, 922, 921, 921, 932, 933, 934, 923, 922, 922, 933, 934, 935, 924, 923, 923, 934, 935, 936, 925, 924, 924, 935, 936,
+	937, 926, 925, 925, 936, 937, 938, 927, 926, 926, 937, 938, 939, 928, 929, 929, 940, 939, 941, 930, 928, 928, 939, 941,
+	942, 931, 930, 930, 941, 942, 943, 932, 931, 931, 942, 943, 944, 933, 932, 932, 943, 944, 945, 934, 933, 933, 944, 945,
+	946, 935, 934, 934, 945, 946, 947, 936, 935, 935, 946, 947, 948, 937, 936, 936, 947, 948, 949, 938, 937, 937, 948, 949,
+	950, 640, 549, 549, 850, 950, 951, 641, 640, 640, 950, 951, 952, 642, 641, 641, 951, 952, 953, 643, 642, 642, 952, 953,
+	954, 644, 643, 643, 953, 954, 955, 645, 644, 644, 954, 955, 956, 646, 645, 645, 955, 956, 957, 647, 646, 646, 956, 957,
+	958, 648, 647, 647, 957, 958, 959, 649, 648, 648, 958, 959, 960, 950, 850, 850, 861, 960, 961, 951, 950, 950, 960, 961,
+	962, 952, 951, 951, 961, 962, 963, 953, 952, 952, 962, 963, 964, 954, 953, 953, 963, 964, 965, 955, 954, 954, 964, 965,
+	966, 956, 955, 955, 965, 966, 967, 957, 956, 956, 966, 967, 968, 958, 957, 957, 967, 968, 969, 959, 958, 958, 968, 969,
+	970, 960, 861, 861, 872, 970, 971, 961, 960, 960, 970, 971, 972, 962, 961, 961, 971, 972, 973, 963, 962, 962, 972, 973,
+	974, 964, 963, 963, 973, 974, 975, 965, 964, 964, 974, 975, 976, 966, 965, 965, 975, 976, 977, 967, 966, 966, 976, 977,
+	978, 968, 967, 967, 977, 978, 979, 969, 968, 968, 978, 979, 980, 970, 872, 872, 883, 980, 981, 971, 970, 970, 980, 981,
+	982, 972, 971, 971, 981, 982, 983, 973, 972, 972, 982, 983, 984, 974, 973, 973, 983, 984, 985, 975, 974, 974, 984, 985,
+	986, 976, 975, 975, 985, 986, 987, 977, 976, 976, 986, 987, 988, 978, 977, 977, 987, 988, 989, 979, 978, 978, 988, 989,
+	990, 980, 883, 883, 894, 990, 991, 981, 980, 980, 990, 991, 992, 982, 981, 981, 991, 992, 993, 983, 982, 982, 992, 993,
+	994, 984, 983, 983, 993, 994, 995, 985, 984, 984, 994, 995, 996, 986, 985, 985, 995, 996, 997, 987, 986, 986, 996, 997,
+	998, 988, 987, 987, 997, 998, 999, 989, 988, 988, 998, 999, 1000, 990, 894, 894, 905, 1000, 1001, 991, 990, 990, 1000, 1001,
+	1002, 992, 991, 991, 1001, 1002, 1003, 993, 992, 992, 1002, 1003, 1004, 994, 993, 993, 1003, 1004, 1005, 995, 994, 994, 1004, 1005,
+	1006, 996, 995, 995, 1005, 1006, 1007, 997, 996, 996, 1006, 1007, 1008, 998, 997, 997, 1007, 1008, 1009, 999, 998, 998, 1008, 1009,
+	1010, 1000, 905, 905, 916, 1010, 1011, 1001, 1000, 1000, 1010, 1011, 1012, 1002, 1001, 1001, 1011, 1012, 1013, 1003, 1002, 1002, 1012, 1013,
+	1014, 1004, 1003, 1003, 1013, 1014, 1015, 1005, 1004, 1004, 1014, 1015, 1016, 1006, 1005, 1005, 1015, 1016, 1017, 1007, 1006, 1006, 1016, 1017,
+	1018, 1008, 1007, 1007, 1017, 1018, 1019, 1009, 1008, 1008, 1018, 1019, 1020, 1010, 916, 916, 927, 1020, 1021, 1011, 1010, 1010, 1020, 1021,
+	1022, 1012, 1011, 1011, 1021, 1022, 1023, 1013, 1012, 1012, 1022, 1023, 1024, 1014, 1013, 1013, 1023, 1024, 1025, 1015, 1014, 1014, 1024, 1025,
+	1026, 1016, 1015, 1015, 1025, 1026, 1027, 1017, 1016, 1016, 1026, 1027, 1028, 1018, 1017, 1017, 1027, 1028, 1029, 1019, 1018, 1018, 1028, 1029,
+	1030, 1020, 927, 927, 938, 1030, 1031, 1021, 1020, 1020, 1030, 1031, 1032, 1022, 1021, 1021, 1031, 1032, 1033, 1023, 1022, 1022, 1032, 1033,
+	1034, 1024, 1023, 1023, 1033, 1034, 1035, 1025, 1024, 1024, 1034, 1035, 1036, 1026, 1025, 1025, 1035, 1036, 1037, 1027, 1026, 1026, 1036, 1037,
+	1038, 1028, 1027, 1027, 1037, 1038, 1039, 1029, 1028, 1028, 1038, 1039, 1040, 1030, 938, 938, 949, 1040, 1041, 1031, 1030, 1030, 1040, 1041,
+	1042, 1032, 1031, 1031, 1041, 1042, 1043, 1033, 1032, 1032, 1042, 1043, 1044, 1034, 1033, 1033, 1043, 1044, 1045, 1035, 1034, 1034, 1044, 1045,
+	1046, 1036, 1035, 1035, 1045, 1046, 1047, 1037, 1036, 1036, 1046, 1047, 1048, 1038, 1037, 1037, 1047, 1048, 1049, 1039, 1038, 1038, 1048, 1049,
+	1050, 740, 649, 649, 959, 1050, 1051, 741, 740, 740, 1050, 1051, 1052, 742, 741, 741, 1051, 1052, 1053, 743, 742, 742, 1052, 1053,
+	1054, 744, 743, 743, 1053, 1054, 1055, 745, 744, 744, 1054, 1055, 1056, 746, 745, 745, 1055, 1056, 1057, 747, 746, 746, 1056, 1057,
+	1058, 748, 747, 747, 1057, 1058, 1059, 749, 748, 748, 1058, 1059, 1060, 1050, 959, 959, 969, 1060, 1061, 1051, 1050, 1050, 1060, 1061,
+	1062, 1052, 1051, 1051, 1061, 1062, 1063, 1053, 1052, 1052, 1062, 1063, 1064, 1054, 1053, 1053, 1063, 1064, 1065, 1055, 1054, 1054, 1064, 1065,
+	1066, 1056, 1055, 1055, 1065, 1066, 1067, 1057, 1056, 1056, 1066, 1067, 1068, 1058, 1057, 1057, 1067, 1068, 1069, 1059, 1058, 1058, 1068, 1069,
+	1070, 1060, 969, 969, 979, 1070, 1071, 1061, 1060, 1060, 1070, 1071, 1072, 1062, 1061, 1061, 1071, 1072, 1073, 1063, 1062, 1062, 1072, 1073,
+	1074, 1064, 1063, 1063, 1073, 1074, 1075, 1065, 1064, 1064, 1074, 1075, 1076, 1066, 1065, 1065, 1075, 1076, 1077, 1067, 1066, 1066, 1076, 1077,
+	1078, 1068, 1067, 1067, 1077, 1078, 1079, 1069, 1068, 1068, 1078, 1079, 1080, 1070, 979, 979, 989, 1080, 1081, 1071, 1070, 1070, 1080, 1081,
+	1082, 1072, 1071, 1071, 1081, 1082, 1083, 1073, 1072, 1072, 1082, 1083, 1084, 1074, 1073, 1073, 1083, 1084, 1085, 1075, 1074, 1074, 1084, 1085,
+	1086, 1076, 1075, 1075, 1085, 1086, 1087, 1077, 1076, 1076, 1086, 1087, 1088, 1078, 1077, 1077, 1087, 1088, 1089, 1079, 1078, 1078, 1088, 1089,
+	1090, 1080, 989, 989, 999, 1090, 1091, 1081, 1080, 1080, 1090, 1091, 1092, 1082, 1081, 1081, 1091, 1092, 1093, 1083, 1082, 1082, 1092, 1093,
+	1094, 1084, 1083, 1083, 1093, 1094, 1095, 1085, 1084, 1084, 1094, 1095, 1096, 1086, 1085, 1085, 1095, 1096, 1097, 1087, 1086, 1086, 1096, 1097,
+	1098, 1088, 1087, 1087, 1097, 1098, 1099, 1089, 1088, 1088, 1098, 1099, 1100, 1090, 999, 999, 1009, 1100, 1101, 1091, 1090, 1090, 1100, 1101,
+	1102, 1092, 1091, 1091, 1101, 1102, 1103, 1093, 1092, 1092, 1102, 1103, 1104, 1094, 1093, 1093, 1103, 1104, 1105, 1095, 1094, 1094, 1104, 1105,
+	1106, 1096, 1095, 1095, 1105, 1106, 1107, 1097, 1096, 1096, 1106, 1107, 1108, 1098, 1097, 1097, 1107, 1108, 1109, 1099, 1098, 1098, 1108, 1109,
+	1110, 1100, 1009, 1009, 1019, 1110, 1111, 1101, 1100, 1100, 1110, 1111, 1112, 1102, 1101, 1101, 1111, 1112, 1113, 1103, 1102, 1102, 1112, 1113,
+	1114, 1104, 1103, 1103, 1113, 1114, 1115, 1105, 1104, 1104, 1114, 1115, 1116, 1106, 1105, 1105, 1115, 1116, 1117, 1107, 1106, 1106, 1116, 1117,
+	1118, 1108, 1107, 1107, 1117, 1118, 1119, 1109, 1108, 1108, 1118, 1119, 1120, 1110, 1019, 1019, 1029, 1120, 1121, 1111, 1110, 1110, 1120, 1121,
+	1122, 1112, 1111, 1111, 1121, 1122, 1123, 1113, 1112, 1112, 1122, 1123, 1124, 1114, 1113, 1113, 1123, 1124, 1125, 1115, 1114, 1114, 1124, 1125,
+	1126, 1116, 1115, 1115, 1125, 1126, 1127, 1117, 1116, 1116, 1126, 1127, 1128, 1118, 1117, 1117, 1127, 1128, 1129, 1119, 1118, 1118, 1128, 1129,
+	1130, 1120, 1029, 1029, 1039, 1130, 1131, 1121, 1120, 1120, 1130, 1131, 1132, 1122, 1121, 1121, 1131, 1132, 1133, 1123, 1122, 1122, 1132, 1133,
+	1134, 1124, 1123, 1123, 1133, 1134, 1135, 1125, 1124, 1124, 1134, 1135, 1136, 1126, 1125, 1125, 1135, 1136, 1137, 1127, 1126, 1126, 1136, 1137,
+	1138, 1128, 1127, 1127, 1137, 1138, 1139, 1129, 1128, 1128, 1138, 1139, 1140, 1130, 1039, 1039, 1049, 1140, 1141, 1131, 1130, 1130, 1140, 1141,
+	1142, 1132, 1131, 1131, 1141, 1142, 1143, 1133, 1132, 1132, 1142, 1143, 1144, 1134, 1133, 1133, 1143, 1144, 1145, 1135, 1134, 1134, 1144, 1145,
+	1146, 1136, 1135, 1135, 1145, 1146, 1147, 1137, 1136, 1136, 1146, 1147, 1148, 1138, 1137, 1137, 1147, 1148, 1149, 1139, 1138, 1138, 1148, 1149,
+	1150, 831, 749, 749, 1059, 1150, 1151, 832, 831, 831, 1150, 1151, 1152, 833, 832, 832, 1151, 1152, 1153, 834, 833, 833, 1152, 1153,
+	1154, 835, 834, 834, 1153, 1154, 1155, 836, 835, 835, 1154, 1155, 1156, 837, 836, 836, 1155, 1156, 1157, 838, 837, 837, 1156, 1157,
+	1158, 839, 838, 838, 1157, 1158, 841, 540, 839, 839, 1158, 841, 1159, 1150, 1059, 1059, 1069, 1159, 1160, 1151, 1150, 1150, 1159, 1160,
+	1161, 1152, 1151, 1151, 1160, 1161, 1162, 1153, 1152, 1152, 1161, 1162, 1163, 1154, 1153, 1153, 1162, 1163, 1164, 1155, 1154, 1154, 1163, 1164,
+	1165, 1156, 1155, 1155, 1164, 1165, 1166, 1157, 1156, 1156, 1165, 1166, 1167, 1158, 1157, 1157, 1166, 1167, 852, 841, 1158, 1158, 1167, 852,
+	1168, 1159, 1069, 1069, 1079, 1168, 1169, 1160, 1159, 1159, 1168, 1169, 1170, 1161, 1160, 1160, 1169, 1170, 1171, 1162, 1161, 1161, 1170, 1171,
+	1172, 1163, 1162, 1162, 1171, 1172, 1173, 1164, 1163, 1163, 1172, 1173, 1174, 1165, 1164, 1164, 1173, 1174, 1175, 1166, 1165, 1165, 1174, 1175,
+	1176, 1167, 1166, 1166, 1175, 1176, 863, 852, 1167, 1167, 1176, 863, 1177, 1168, 1079, 1079, 1089, 1177, 1178, 1169, 1168, 1168, 1177, 1178,
+	1179, 1170, 1169, 1169, 1178, 1179, 1180, 1171, 1170, 1170, 1179, 1180, 1181, 1172, 1171, 1171, 1180, 1181, 1182, 1173, 1172, 1172, 1181, 1182,
+	1183, 1174, 1173, 1173, 1182, 1183, 1184, 1175, 1174, 1174, 1183, 1184, 1185, 1176, 1175, 1175, 1184, 1185, 874, 863, 1176, 1176, 1185, 874,
+	1186, 1177, 1089, 1089, 1099, 1186, 1187, 1178, 1177, 1177, 1186, 1187, 1188, 1179, 1178, 1178, 1187, 1188, 1189, 1180, 1179, 1179, 1188, 1189,
+	1190, 1181, 1180, 1180, 1189, 1190, 1191, 1182, 1181, 1181, 1190, 1191, 1192, 1183, 1182, 1182, 1191, 1192, 1193, 1184, 1183, 1183, 1192, 1193,
+	1194, 1185, 1184, 1184, 1193, 1194, 885, 874, 1185, 1185, 1194, 885, 1195, 1186, 1099, 1099, 1109, 1195, 1196, 1187, 1186, 1186, 1195, 1196,
+	1197, 1188, 1187, 1187, 1196, 1197, 1198, 1189, 1188, 1188, 1197, 1198, 1199, 1190, 1189, 1189, 1198, 1199, 1200, 1191, 1190, 1190, 1199, 1200,
+	1201, 1192, 1191, 1191, 1200, 1201, 1202, 1193, 1192, 1192, 1201, 1202, 1203, 1194, 1193, 1193, 1202, 1203, 896, 885, 1194, 1194, 1203, 896,
+	1204, 1195, 1109, 1109, 1119, 1204, 1205, 1196, 1195, 1195, 1204, 1205, 1206, 1197, 1196, 1196, 1205, 1206, 1207, 1198, 1197, 1197, 1206, 1207,
+	1208, 1199, 1198, 1198, 1207, 1208, 1209, 1200, 1199, 1199, 1208, 1209, 1210, 1201, 1200, 1200, 1209, 1210, 1211, 1202, 1201, 1201, 1210, 1211,
+	1212, 1203, 1202, 1202, 1211, 1212, 907, 896, 1203, 1203, 1212, 907, 1213, 1204, 1119, 1119, 1129, 1213, 1214, 1205, 1204, 1204, 1213, 1214,
+	1215, 1206, 1205, 1205, 1214, 1215, 1216, 1207, 1206, 1206, 1215, 1216, 1217, 1208, 1207, 1207, 1216, 1217, 1218, 1209, 1208, 1208, 1217, 1218,
+	1219, 1210, 1209, 1209, 1218, 1219, 1220, 1211, 1210, 1210, 1219, 1220, 1221, 1212, 1211, 1211, 1220, 1221, 918, 907, 1212, 1212, 1221, 918,
+	1222, 1213, 1129, 1129, 1139, 1222, 1223, 1214, 1213, 1213, 1222, 1223, 1224, 1215, 1214, 1214, 1223, 1224, 1225, 1216, 1215, 1215, 1224, 1225,
+	1226, 1217, 1216, 1216, 1225, 1226, 1227, 1218, 1217, 1217, 1226, 1227, 1228, 1219, 1218, 1218, 1227, 1228, 1229, 1220, 1219, 1219, 1228, 1229,
+	1230, 1221, 1220, 1220, 1229, 1230, 929, 918, 1221, 1221, 1230, 929, 1231, 1222, 1139, 1139, 1149, 1231, 1232, 1223, 1222, 1222, 1231, 1232,
+	1233, 1224, 1223, 1223, 1232, 1233, 1234, 1225, 1224, 1224, 1233, 1234, 1235, 1226, 1225, 1225, 1234, 1235, 1236, 1227, 1226, 1226, 1235, 1236,
+	1237, 1228, 1227, 1227, 1236, 1237, 1238, 1229, 1228, 1228, 1237, 1238, 1239, 1230, 1229, 1229, 1238, 1239, 940, 929, 1230, 1230, 1239, 940,
+	1240, 1241, 1242, 1242, 1243, 1240, 1244, 1245, 1241, 1241, 1240, 1244, 1246, 1247, 1245, 1245, 1244, 1246, 1248, 1249, 1247, 1247, 1246, 1248,
+	1250, 1251, 1249, 1249, 1248, 1250, 1252, 1253, 1251, 1251, 1250, 1252, 1254, 1255, 1253, 1253, 1252, 1254, 1256, 1257, 1255, 1255, 1254, 1256,
+	1258, 1259, 1257, 1257, 1256, 1258, 1260, 1261, 1259, 1259, 1258, 1260, 1262, 1240, 1243, 1243, 1263, 1262, 1264, 1244, 1240, 1240, 1262, 1264,
+	1265, 1246, 1244, 1244, 1264, 1265, 1266, 1248, 1246, 1246, 1265, 1266, 1267, 1250, 1248, 1248, 1266, 1267, 1268, 1252, 1250, 1250, 1267, 1268,
+	1269, 1254, 1252, 1252, 1268, 1269, 1270, 1256, 1254, 1254, 1269, 1270, 1271, 1258, 1256, 1256, 1270, 1271, 1272, 1260, 1258, 1258, 1271, 1272,
+	1273, 1262, 1263, 1263, 1274, 1273, 1275, 1264, 1262, 1262, 1273, 1275, 1276, 1265, 1264, 1264, 1275, 1276, 1277, 1266, 1265, 1265, 1276, 1277,
+	1278, 1267, 1266, 1266, 1277, 1278, 1279, 1268, 1267, 1267, 1278, 1279, 1280, 1269, 1268, 1268, 1279, 1280, 1281, 1270, 1269, 1269, 1280, 1281,
+	1282, 1271, 1270, 1270, 1281, 1282, 1283, 1272, 1271, 1271, 1282, 1283, 1284, 1273, 1274, 1274, 1285, 1284, 1286, 1275, 1273, 1273, 1284, 1286,
+	1287, 1276, 1275, 1275, 1286, 1287, 1288, 1277, 1276, 1276, 1287, 1288, 1289, 1278, 1277, 1277, 1288, 1289, 1290, 1279, 1278, 1278, 1289, 1290,
+	1291, 1280, 1279, 1279, 1290, 1291, 1292, 1281, 1280, 1280, 1291, 1292, 1293, 1282, 1281, 1281, 1292, 1293, 1294, 1283, 1282, 1282, 1293, 1294,
+	1295, 1284, 1285, 1285, 1296, 1295, 1297, 1286, 1284, 1284, 1295, 1297, 1298, 1287, 1286, 1286, 1297, 1298, 1299, 1288, 1287, 1287, 1298, 1299,
+	1300, 1289, 1288, 1288, 1299, 1300, 1301, 1290, 1289, 1289, 1300, 1301, 1302, 1291, 1290, 1290, 1301, 1302, 1303, 1292, 1291, 1291, 1302, 1303,
+	1304, 1293, 1292, 1292, 1303, 1304, 1305, 1294, 1293, 1293, 1304, 1305, 1306, 1295, 1296, 1296, 1307, 1306, 1308, 1297, 1295, 1295, 1306, 1308,
+	1309, 1298, 1297, 1297, 1308, 1309, 1310, 1299, 1298, 1298, 1309, 1310, 1311, 1300, 1299, 1299, 1310, 1311, 1312, 1301, 1300, 1300, 1311, 1312,
+	1313, 1302, 1301, 1301, 1312, 1313, 1314, 1303, 1302, 1302, 1313, 1314, 1315, 1304, 1303, 1303, 1314, 1315, 1316, 1305, 1304, 1304, 1315, 1316,
+	1317, 1306, 1307, 1307, 1318, 1317, 1319, 1308, 1306, 1306, 1317, 1319, 1320, 1309, 1308, 1308, 1319, 1320, 1321, 1310, 1309, 1309, 1320, 1321,
+	1322, 1311, 1310, 1310, 1321, 1322, 1323, 1312, 1311, 1311, 1322, 1323, 1324, 1313, 1312, 1312, 1323, 1324, 1325, 1314, 1313, 1313, 1324, 1325,
+	1326, 1315, 1314, 1314, 1325, 1326, 1327, 1316, 1315, 1315, 1326, 1327, 1328, 1317, 1318, 1318, 1329, 1328, 1330, 1319, 1317, 1317, 1328, 1330,
+	1331, 1320, 1319, 1319, 1330, 1331, 1332, 1321, 1320, 1320, 1331, 1332, 1333, 1322, 1321, 1321, 1332, 1333, 1334, 1323, 1322, 1322, 1333, 1334,
+	1335, 1324, 1323, 1323, 1334, 1335, 1336, 1325, 1324, 1324, 1335, 1336, 1337, 1326, 1325, 1325, 1336, 1337, 1338, 1327, 1326, 1326, 1337, 1338,
+	1339, 1328, 1329, 1329, 1340, 1339, 1341, 1330, 1328, 1328, 1339, 1341, 1342, 1331, 1330, 1330, 1341, 1342, 1343, 1332, 1331, 1331, 1342, 1343,
+	1344, 1333, 1332, 1332, 1343, 1344, 1345, 1334, 1333, 1333, 1344, 1345, 1346, 1335, 1334, 1334, 1345, 1346, 1347, 1336, 1335, 1335, 1346, 1347,
+	1348, 1337, 1336, 1336, 1347, 1348, 1349, 1338, 1337, 1337, 1348, 1349, 1350, 1339, 1340, 1340, 1351, 1350, 1352, 1341, 1339, 1339, 1350, 1352,
+	1353, 1342, 1341, 1341, 1352, 1353, 1354, 1343, 1342, 1342, 1353, 1354, 1355, 1344, 1343, 1343, 1354, 1355, 1356, 1345, 1344, 1344, 1355, 1356,
+	1357, 1346, 1345, 1345, 1356, 1357, 1358, 1347, 1346, 1346, 1357, 1358, 1359, 1348, 1347, 1347, 1358, 1359, 1360, 1349, 1348, 1348, 1359, 1360,
+	1361, 1362, 1261, 1261, 1260, 1361, 1363, 1364, 1362, 1362, 1361, 1363, 1365, 1366, 1364, 1364, 1363, 1365, 1367, 1368, 1366, 1366, 1365, 1367,
+	1369, 1370, 1368, 1368, 1367, 1369, 1371, 1372, 1370, 1370, 1369, 1371, 1373, 1374, 1372, 1372, 1371, 1373, 1375, 1376, 1374, 1374, 1373, 1375,
+	1377, 1378, 1376, 1376, 1375, 1377, 1243, 1242, 1378, 1378, 1377, 1243, 1379, 1361, 1260, 1260, 1272, 1379, 1380, 1363, 1361, 1361, 1379, 1380,
+	1381, 1365, 1363, 1363, 1380, 1381, 1382, 1367, 1365, 1365, 1381, 1382, 1383, 1369, 1367, 1367, 1382, 1383, 1384, 1371, 1369, 1369, 1383, 1384,
+	1385, 1373, 1371, 1371, 1384, 1385, 1386, 1375, 1373, 1373, 1385, 1386, 1387, 1377, 1375, 1375, 1386, 1387, 1263, 1243, 1377, 1377, 1387, 1263,
+	1388, 1379, 1272, 1272, 1283, 1388, 1389, 1380, 1379, 1379, 1388, 1389, 1390, 1381, 1380, 1380, 1389, 1390, 1391, 1382, 1381, 1381, 1390, 1391,
+	1392, 1383, 1382, 1382, 1391, 1392, 1393, 1384, 1383, 1383, 1392, 1393, 1394, 1385, 1384, 1384, 1393, 1394, 1395, 1386, 1385, 1385, 1394, 1395,
+	1396, 1387, 1386, 1386, 1395, 1396, 1274, 1263, 1387, 1387, 1396, 1274, 1397, 1388, 1283, 1283, 1294, 1397, 1398, 1389, 1388, 1388, 1397, 1398,
+	1399, 1390, 1389, 1389, 1398, 1399, 1400, 1391, 1390, 1390, 1399, 1400, 1401, 1392, 1391, 1391, 1400, 1401, 1402, 1393, 1392, 1392, 1401, 1402,
+	1403, 1394, 1393, 1393, 1402, 1403, 1404, 1395, 1394, 1394, 1403, 1404, 1405, 1396, 1395, 1395, 1404, 1405, 1285, 1274, 1396, 1396, 1405, 1285,
+	1406, 1397, 1294, 1294, 1305, 1406, 1407, 1398, 1397, 1397, 1406, 1407, 1408, 1399, 1398, 1398, 1407, 1408, 1409, 1400, 1399, 1399, 1408, 1409,
+	1410, 1401, 1400, 1400, 1409, 1410, 1411, 1402, 1401, 1401, 1410, 1411, 1412, 1403, 1402, 1402, 1411, 1412, 1413, 1404, 1403, 1403, 1412, 1413,
+	1414, 1405, 1404, 1404, 1413, 1414, 1296, 1285, 1405, 1405, 1414, 1296, 1415, 1406, 1305, 1305, 1316, 1415, 1416, 1407, 1406, 1406, 1415, 1416,
+	1417, 1408, 1407, 1407, 1416, 1417, 1418, 1409, 1408, 1408, 1417, 1418, 1419, 1410, 1409, 1409, 1418, 1419, 1420, 1411, 1410, 1410, 1419, 1420,
+	1421, 1412, 1411, 1411, 1420, 1421, 1422, 1413, 1412, 1412, 1421, 1422, 1423, 1414, 1413, 1413, 1422, 1423, 1307, 1296, 1414, 1414, 1423, 1307,
+	1424, 1415, 1316, 1316, 1327, 1424, 1425, 1416, 1415, 1415, 1424, 1425, 1426, 1417, 1416, 1416, 1425, 1426, 1427, 1418, 1417, 1417, 1426, 1427,
+	1428, 1419, 1418, 1418, 1427, 1428, 1429, 1420, 1419, 1419, 1428, 1429, 1430, 1421, 1420, 1420, 1429, 1430, 1431, 1422, 1421, 1421, 1430, 1431,
+	1432, 1423, 1422, 1422, 1431, 1432, 1318, 1307, 1423, 1423, 1432, 1318, 1433, 1424, 1327, 1327, 1338, 1433, 1434, 1425, 1424, 1424, 1433, 1434,
+	1435, 1426, 1425, 1425, 1434, 1435, 1436, 1427, 1426, 1426, 1435, 1436, 1437, 1428, 1427, 1427, 1436, 1437, 1438, 1429, 1428, 1428, 1437, 1438,
+	1439, 1430, 1429, 1429, 1438, 1439, 1440, 1431, 1430, 1430, 1439, 1440, 1441, 1432, 1431, 1431, 1440, 1441, 1329, 1318, 1432, 1432, 1441, 1329,
+	1442, 1433, 1338, 1338, 1349, 1442, 1443, 1434, 1433, 1433, 1442, 1443, 1444, 1435, 1434, 1434, 1443, 1444, 1445, 1436, 1435, 1435, 1444, 1445,
+	1446, 1437, 1436, 1436, 1445, 1446, 1447, 1438, 1437, 1437, 1446, 1447, 1448, 1439, 1438, 1438, 1447, 1448, 1449, 1440, 1439, 1439, 1448, 1449,
+	1450, 1441, 1440, 1440, 1449, 1450, 1340, 1329, 1441, 1441, 1450, 1340, 1451, 1442, 1349, 1349, 1360, 1451, 1452, 1443, 1442, 1442, 1451, 1452,
+	1453, 1444, 1443, 1443, 1452, 1453, 1454, 1445, 1444, 1444, 1453, 1454, 1455, 1446, 1445, 1445, 1454, 1455, 1456, 1447, 1446, 1446, 1455, 1456,
+	1457, 1448, 1447, 1447, 1456, 1457, 1458, 1449, 1448, 1448, 1457, 1458, 1459, 1450, 1449, 1449, 1458, 1459, 1351, 1340, 1450, 1450, 1459, 1351,
+	1460, 1350, 1351, 1351, 1461, 1460, 1462, 1352, 1350, 1350, 1460, 1462, 1463, 1353, 1352, 1352, 1462, 1463, 1464, 1354, 1353, 1353, 1463, 1464,
+	1465, 1355, 1354, 1354, 1464, 1465, 1466, 1356, 1355, 1355, 1465, 1466, 1467, 1357, 1356, 1356, 1466, 1467, 1468, 1358, 1357, 1357, 1467, 1468,
+	1469, 1359, 1358, 1358, 1468, 1469, 1470, 1360, 1359, 1359, 1469, 1470, 1471, 1460, 1461, 1461, 1472, 1471, 1473, 1462, 1460, 1460, 1471, 1473,
+	1474, 1463, 1462, 1462, 1473, 1474, 1475, 1464, 1463, 1463, 1474, 1475, 1476, 1465, 1464, 1464, 1475, 1476, 1477, 1466, 1465, 1465, 1476, 1477,
+	1478, 1467, 1466, 1466, 1477, 1478, 1479, 1468, 1467, 1467, 1478, 1479, 1480, 1469, 1468, 1468, 1479, 1480, 1481, 1470, 1469, 1469, 1480, 1481,
+	1482, 1471, 1472, 1472, 1483, 1482, 1484, 1473, 1471, 1471, 1482, 1484, 1485, 1474, 1473, 1473, 1484, 1485, 1486, 1475, 1474, 1474, 1485, 1486,
+	1487, 1476, 1475, 1475, 1486, 1487, 1488, 1477, 1476, 1476, 1487, 1488, 1489, 1478, 1477, 1477, 1488, 1489, 1490, 1479, 1478, 1478, 1489, 1490,
+	1491, 1480, 1479, 1479, 1490, 1491, 1492, 1481, 1480, 1480, 1491, 1492, 1493, 1482, 1483, 1483, 1494, 1493, 1495, 1484, 1482, 1482, 1493, 1495,
+	1496, 1485, 1484, 1484, 1495, 1496, 1497, 1486, 1485, 1485, 1496, 1497, 1498, 1487, 1486, 1486, 1497, 1498, 1499, 1488, 1487, 1487, 1498, 1499,
+	1500, 1489, 1488, 1488, 1499, 1500, 1501, 1490, 1489, 1489, 1500, 1501, 1502, 1491, 1490, 1490, 1501, 1502, 1503, 1492, 1491, 1491, 1502, 1503,
+	1504, 1493, 1494, 1494, 1505, 1504, 1506, 1495, 1493, 1493, 1504, 1506, 1507, 1496, 1495, 1495, 1506, 1507, 1508, 1497, 1496, 1496, 1507, 1508,
+	1509, 1498, 1497, 1497, 1508, 1509, 1510, 1499, 1498, 1498, 1509, 1510, 1511, 1500, 1499, 1499, 1510, 1511, 1512, 1501, 1500, 1500, 1511, 1512,
+	1513, 1502, 1501, 1501, 1512, 1513, 1514, 1503, 1502, 1502, 1513, 1514, 1515, 1504, 1505, 1505, 1516, 1515, 1517, 1506, 1504, 1504, 1515, 1517,
+	1518, 1507, 1506, 1506, 1517, 1518, 1519, 1508, 1507, 1507, 1518, 1519, 1520, 1509, 1508, 1508, 1519, 1520, 1521, 1510, 1509, 1509, 1520, 1521,
+	1522, 1511, 1510, 1510, 1521, 1522, 1523, 1512, 1511, 1511, 1522, 1523, 1524, 1513, 1512, 1512, 1523, 1524, 1525, 1514, 1513, 1513, 1524, 1525,
+	1526, 1515, 1516, 1516, 1527, 1526, 1528, 1517, 1515, 1515, 1526, 1528, 1529, 1518, 1517, 1517, 1528, 1529, 1530, 1519, 1518, 1518, 1529, 1530,
+	1531, 1520, 1519, 1519, 1530, 1531, 1532, 1521, 1520, 1520, 1531, 1532, 1533, 1522, 1521, 1521, 1532, 1533, 1534, 1523, 1522, 1522, 1533, 1534,
+	1535, 1524, 1523, 1523, 1534, 1535, 1536, 1525, 1524, 1524, 1535, 1536, 1537, 1526, 1527, 1527, 1538, 1537, 1539, 1528, 1526, 1526, 1537, 1539,
+	1540, 1529, 1528, 1528, 1539, 1540, 1541, 1530, 1529, 1529, 1540, 1541, 1542, 1531, 1530, 1530, 1541, 1542, 1543, 1532, 1531, 1531, 1542, 1543,
+	1544, 1533, 1532, 1532, 1543, 1544, 1545, 1534, 1533, 1533, 1544, 1545, 1546, 1535, 1534, 1534, 1545, 1546, 1547, 1536, 1535, 1535, 1546, 1547,
+	1548, 1537, 1538, 1538, 1549, 1548, 1550, 1539, 1537, 1537, 1548, 1550, 1551, 1540, 1539, 1539, 1550, 1551, 1552, 1541, 1540, 1540, 1551, 1552,
+	1553, 1542, 1541, 1541, 1552, 1553, 1554, 1543, 1542, 1542, 1553, 1554, 1555, 1544, 1543, 1543, 1554, 1555, 1556, 1545, 1544, 1544, 1555, 1556,
+	1557, 1546, 1545, 1545, 1556, 1557, 1558, 1547, 1546, 1546, 1557, 1558, 1559, 1548, 1549, 1549, 649, 1559, 1560, 1550, 1548, 1548, 1559, 1560,
+	1561, 1551, 1550, 1550, 1560, 1561, 1562, 1552, 1551, 1551, 1561, 1562, 1563, 1553, 1552, 1552, 1562, 1563, 1564, 1554, 1553, 1553, 1563, 1564,
+	1565, 1555, 1554, 1554, 1564, 1565, 1566, 1556, 1555, 1555, 1565, 1566, 1567, 1557, 1556, 1556, 1566, 1567, 1568, 1558, 1557, 1557, 1567, 1568,
+	1569, 1451, 1360, 1360, 1470, 1569, 1570, 1452, 1451, 1451, 1569, 1570, 1571, 1453, 1452, 1452, 1570, 1571, 1572, 1454, 1453, 1453, 1571, 1572,
+	1573, 1455, 1454, 1454, 1572, 1573, 1574, 1456, 1455, 1455, 1573, 1574, 1575, 1457, 1456, 1456, 1574, 1575, 1576, 1458, 1457, 1457, 1575, 1576,
+	1577, 1459, 1458, 1458, 1576, 1577, 1461, 1351, 1459, 1459, 1577, 1461, 1578, 1569, 1470, 1470, 1481, 1578, 1579, 1570, 1569, 1569, 1578, 1579,
+	1580, 1571, 1570, 1570, 1579, 1580, 1581, 1572, 1571, 1571, 1580, 1581, 1582, 1573, 1572, 1572, 1581, 1582, 1583, 1574, 1573, 1573, 1582, 1583,
+	1584, 1575, 1574, 1574, 1583, 1584, 1585, 1576, 1575, 1575, 1584, 1585, 1586, 1577, 1576, 1576, 1585, 1586, 1472, 1461, 1577, 1577, 1586, 1472,
+	1587, 1578, 1481, 1481, 1492, 1587, 1588, 1579, 1578, 1578, 1587, 1588, 1589, 1580, 1579, 1579, 1588, 1589, 1590, 1581, 1580, 1580, 1589, 1590,
+	1591, 1582, 1581, 1581, 1590, 1591, 1592, 1583, 1582, 1582, 1591, 1592, 1593, 1584, 1583, 1583, 1592, 1593, 1594, 1585, 1584, 1584, 1593, 1594,
+	1595, 1586, 1585, 1585, 1594, 1595, 1483, 1472, 1586, 1586, 1595, 1483, 1596, 1587, 1492, 1492, 1503, 1596, 1597, 1588, 1587, 1587, 1596, 1597,
+	1598, 1589, 1588, 1588, 1597, 1598, 1599, 1590, 1589, 1589, 1598, 1599, 1600, 1591, 1590, 1590, 1599, 1600, 1601, 1592, 1591, 1591, 1600, 1601,
+	1602, 1593, 1592, 1592, 1601, 1602, 1603, 1594, 1593, 1593, 1602, 1603, 1604, 1595, 1594, 1594, 1603, 1604, 1494, 1483, 1595, 1595, 1604, 1494,
+	1605, 1596, 1503, 1503, 1514, 1605, 1606, 1597, 1596, 1596, 1605, 1606, 1607, 1598, 1597, 1597, 1606, 1607, 1608, 1599, 1598, 1598, 1607, 1608,
+	1609, 1600, 1599, 1599, 1608, 1609, 1610, 1601, 1600, 1600, 1609, 1610, 1611, 1602, 1601, 1601, 1610, 1611, 1612, 1603, 1602, 1602, 1611, 1612,
+	1613, 1604, 1603, 1603, 1612, 1613, 1505, 1494, 1604, 1604, 1613, 1505, 1614, 1605, 1514, 1514, 1525, 1614, 1615, 1606, 1605, 1605, 1614, 1615,
+	1616, 1607, 1606, 1606, 1615, 1616, 1617, 1608, 1607, 1607, 1616, 1617, 1618, 1609, 1608, 1608, 1617, 1618, 1619, 1610, 1609, 1609, 1618, 1619,
+	1620, 1611, 1610, 1610, 1619, 1620, 1621, 1612, 1611, 1611, 1620, 1621, 1622, 1613, 1612, 1612, 1621, 1622, 1516, 1505, 1613, 1613, 1622, 1516,
+	1623, 1614, 1525, 1525, 1536, 1623, 1624, 1615, 1614, 1614, 1623, 1624, 1625, 1616, 1615, 1615, 1624, 1625, 1626, 1617, 1616, 1616, 1625, 1626,
+	1627, 1618, 1617, 1617, 1626, 1627, 1628, 1619, 1618, 1618, 1627, 1628, 1629, 1620, 1619, 1619, 1628, 1629, 1630, 1621, 1620, 1620, 1629, 1630,
+	1631, 1622, 1621, 1621, 1630, 1631, 1527, 1516, 1622, 1622, 1631, 1527, 1632, 1623, 1536, 1536, 1547, 1632, 1633, 1624, 1623, 1623, 1632, 1633,
+	1634, 1625, 1624, 1624, 1633, 1634, 1635, 1626, 1625, 1625, 1634, 1635, 1636, 1627, 1626, 1626, 1635, 1636, 1637, 1628, 1627, 1627, 1636, 1637,
+	1638, 1629, 1628, 1628, 1637, 1638, 1639, 1630, 1629, 1629, 1638, 1639, 1640, 1631, 1630, 1630, 1639, 1640, 1538, 1527, 1631, 1631, 1640, 1538,
+	1641, 1632, 1547, 1547, 1558, 1641, 1642, 1633, 1632, 1632, 1641, 1642, 1643, 1634, 1633, 1633, 1642, 1643, 1644, 1635, 1634, 1634, 1643, 1644,
+	1645, 1636, 1635, 1635, 1644, 1645, 1646, 1637, 1636, 1636, 1645, 1646, 1647, 1638, 1637, 1637, 1646, 1647, 1648, 1639, 1638, 1638, 1647, 1648,
+	1649, 1640, 1639, 1639, 1648, 1649, 1549, 1538, 1640, 1640, 1649, 1549, 1650, 1641, 1558, 1558, 1568, 1650, 1651, 1642, 1641, 1641, 1650, 1651,
+	1652, 1643, 1642, 1642, 1651, 1652, 1653, 1644, 1643, 1643, 1652, 1653, 1654, 1645, 1644, 1644, 1653, 1654, 1655, 1646, 1645, 1645, 1654, 1655,
+	1656, 1647, 1646, 1646, 1655, 1656, 1657, 1648, 1647, 1647, 1656, 1657, 1658, 1649, 1648, 1648, 1657, 1658, 649, 1549, 1649, 1649, 1658, 649,
+	1659, 1660, 1661, 1661, 1662, 1659, 1663, 1664, 1660, 1660, 1659, 1663, 1665, 1666, 1664, 1664, 1663, 1665, 1667, 1668, 1666, 1666, 1665, 1667,
+	1669, 1670, 1668, 1668, 1667, 1669, 1671, 1672, 1670, 1670, 1669, 1671, 1673, 1674, 1672, 1672, 1671, 1673, 1675, 1676, 1674, 1674, 1673, 1675,
+	1677, 1678, 1676, 1676, 1675, 1677, 1679, 1680, 1678, 1678, 1677, 1679, 1681, 1659, 1662, 1662, 1682, 1681, 1683, 1663, 1659, 1659, 1681, 1683,
+	1684, 1665, 1663, 1663, 1683, 1684, 1685, 1667, 1665, 1665, 1684, 1685, 1686, 1669, 1667, 1667, 1685, 1686, 1687, 1671, 1669, 1669, 1686, 1687,
+	1688, 1673, 1671, 1671, 1687, 1688, 1689, 1675, 1673, 1673, 1688, 1689, 1690, 1677, 1675, 1675, 1689, 1690, 1691, 1679, 1677, 1677, 1690, 1691,
+	1692, 1681, 1682, 1682, 1693, 1692, 1694, 1683, 1681, 1681, 1692, 1694, 1695, 1684, 1683, 1683, 1694, 1695, 1696, 1685, 1684, 1684, 1695, 1696,
+	1697, 1686, 1685, 1685, 1696, 1697, 1698, 1687, 1686, 1686, 1697, 1698, 1699, 1688, 1687, 1687, 1698, 1699, 1700, 1689, 1688, 1688, 1699, 1700,
+	1701, 1690, 1689, 1689, 1700, 1701, 1702, 1691, 1690, 1690, 1701, 1702, 1703, 1692, 1693, 1693, 1704, 1703, 1705, 1694, 1692, 1692, 1703, 1705,
+	1706, 1695, 1694, 1694, 1705, 1706, 1707, 1696, 1695, 1695, 1706, 1707, 1708, 1697, 1696, 1696, 1707, 1708, 1709, 1698, 1697, 1697, 1708, 1709,
+	1710, 1699, 1698, 1698, 1709, 1710, 1711, 1700, 1699, 1699, 1710, 1711, 1712, 1701, 1700, 1700, 1711, 1712, 1713, 1702, 1701, 1701, 1712, 1713,
+	1714, 1703, 1704, 1704, 1715, 1714, 1716, 1705, 1703, 1703, 1714, 1716, 1717, 1706, 1705, 1705, 1716, 1717, 1718, 1707, 1706, 1706, 1717, 1718,
+	1719, 1708, 1707, 1707, 1718, 1719, 1720, 1709, 1708, 1708, 1719, 1720, 1721, 1710, 1709, 1709, 1720, 1721, 1722, 1711, 1710, 1710, 1721, 1722,
+	1723, 1712, 1711, 1711, 1722, 1723, 1724, 1713, 1712, 1712, 1723, 1724, 1725, 1714, 1715, 1715, 1726, 1725, 1727, 1716, 1714, 1714, 1725, 1727,
+	1728, 1717, 1716, 1716, 1727, 1728, 1729, 1718, 1717, 1717, 1728, 1729, 1730, 1719, 1718, 1718, 1729, 1730, 1731, 1720, 1719, 1719, 1730, 1731,
+	1732, 1721, 1720, 1720, 1731, 1732, 1733, 1722, 1721, 1721, 1732, 1733, 1734, 1723, 1722, 1722, 1733, 1734, 1735, 1724, 1723, 1723, 1734, 1735,
+	1736, 1725, 1726, 1726, 1737, 1736, 1738, 1727, 1725, 1725, 1736, 1738, 1739, 1728, 1727, 1727, 1738, 1739, 1740, 1729, 1728, 1728, 1739, 1740,
+	1741, 1730, 1729, 1729, 1740, 1741, 1742, 1731, 1730, 1730, 1741, 1742, 1743, 1732, 1731, 1731, 1742, 1743, 1744, 1733, 1732, 1732, 1743, 1744,
+	1745, 1734, 1733, 1733, 1744, 1745, 1746, 1735, 1734, 1734, 1745, 1746, 1747, 1736, 1737, 1737, 1748, 1747, 1749, 1738, 1736, 1736, 1747, 1749,
+	1750, 1739, 1738, 1738, 1749, 1750, 1751, 1740, 1739, 1739, 1750, 1751, 1752, 1741, 1740, 1740, 1751, 1752, 1753, 1742, 1741, 1741, 1752, 1753,
+	1754, 1743, 1742, 1742, 1753, 1754, 1755, 1744, 1743, 1743, 1754, 1755, 1756, 1745, 1744, 1744, 1755, 1756, 1757, 1746, 1745, 1745, 1756, 1757,
+	1758, 1747, 1748, 1748, 1759, 1758, 1760, 1749, 1747, 1747, 1758, 1760, 1761, 1750, 1749, 1749, 1760, 1761, 1762, 1751, 1750, 1750, 1761, 1762,
+	1763, 1752, 1751, 1751, 1762, 1763, 1764, 1753, 1752, 1752, 1763, 1764, 1765, 1754, 1753, 1753, 1764, 1765, 1766, 1755, 1754, 1754, 1765, 1766,
+	1767, 1756, 1755, 1755, 1766, 1767, 1768, 1757, 1756, 1756, 1767, 1768, 1769, 1758, 1759, 1759, 1770, 1769, 1771, 1760, 1758, 1758, 1769, 1771,
+	1772, 1761, 1760, 1760, 1771, 1772, 1773, 1762, 1761, 1761, 1772, 1773, 1774, 1763, 1762, 1762, 1773, 1774, 1775, 1764, 1763, 1763, 1774, 1775,
+	1776, 1765, 1764, 1764, 1775, 1776, 1777, 1766, 1765, 1765, 1776, 1777, 1778, 1767, 1766, 1766, 1777, 1778, 1779, 1768, 1767, 1767, 1778, 1779,
+	1780, 1781, 1680, 1680, 1679, 1780, 1782, 1783, 1781, 1781, 1780, 1782, 1784, 1785, 1783, 1783, 1782, 1784, 1786, 1787, 1785, 1785, 1784, 1786,
+	1788, 1789, 1787, 1787, 1786, 1788, 1790, 1791, 1789, 1789, 1788, 1790, 1792, 1793, 1791, 1791, 1790, 1792, 1794, 1795, 1793, 1793, 1792, 1794,
+	1796, 1797, 1795, 1795, 1794, 1796, 1662, 1661, 1797, 1797, 1796, 1662, 1798, 1780, 1679, 1679, 1691, 1798, 1799, 1782, 1780, 1780, 1798, 1799,
+	1800, 1784, 1782, 1782, 1799, 1800, 1801, 1786, 1784, 1784, 1800, 1801, 1802, 1788, 1786, 1786, 1801, 1802, 1803, 1790, 1788, 1788, 1802, 1803,
+	1804, 1792, 1790, 1790, 1803, 1804, 1805, 1794, 1792, 1792, 1804, 1805, 1806, 1796, 1794, 1794, 1805, 1806, 1682, 1662, 1796, 1796, 1806, 1682,
+	1807, 1798, 1691, 1691, 1702, 1807, 1808, 1799, 1798, 1798, 1807, 1808, 1809, 1800, 1799, 1799, 1808, 1809, 1810, 1801, 1800, 1800, 1809, 1810,
+	1811, 1802, 1801, 1801, 1810, 1811, 1812, 1803, 1802, 1802, 1811, 1812, 1813, 1804, 1803, 1803, 1812, 1813, 1814, 1805, 1804, 1804, 1813, 1814,
+	1815, 1806, 1805, 1805, 1814, 1815, 1693, 1682, 1806, 1806, 1815, 1693, 1816, 1807, 1702, 1702, 1713, 1816, 1817, 1808, 1807, 1807, 1816, 1817,
+	1818, 1809, 1808, 1808, 1817, 1818, 1819, 1810, 1809, 1809, 1818, 1819, 1820, 1811, 1810, 1810, 1819, 1820, 1821, 1812, 1811, 1811, 1820, 1821,
+	1822, 1813, 1812, 1812, 1821, 1822, 1823, 1814, 1813, 1813, 1822, 1823, 1824, 1815, 1814, 1814, 1823, 1824, 1704, 1693, 1815, 1815, 1824, 1704,
+	1825, 1816, 1713, 1713, 1724, 1825, 1826, 1817, 1816, 1816, 1825, 1826, 1827, 1818, 1817, 1817, 1826, 1827, 1828, 1819, 1818, 1818, 1827, 1828,
+	1829, 1820, 1819, 1819, 1828, 1829, 1830, 1821, 1820, 1820, 1829, 1830, 1831, 1822, 1821, 1821, 1830, 1831, 1832, 1823, 1822, 1822, 1831, 1832,
+	1833, 1824, 1823, 1823, 1832, 1833, 1715, 1704, 1824, 1824, 1833, 1715, 1834, 1825, 1724, 1724, 1735, 1834, 1835, 1826, 1825, 1825, 1834, 1835,
+	1836, 1827, 1826, 1826, 1835, 1836, 1837, 1828, 1827, 1827, 1836, 1837, 1838, 1829, 1828, 1828, 1837, 1838, 1839, 1830, 1829, 1829, 1838, 1839,
+	1840, 1831, 1830, 1830, 1839, 1840, 1841, 1832, 1831, 1831, 1840, 1841, 1842, 1833, 1832, 1832, 1841, 1842, 1726, 1715, 1833, 1833, 1842, 1726,
+	1843, 1834, 1735, 1735, 1746, 1843, 1844, 1835, 1834, 1834, 1843, 1844, 1845, 1836, 1835, 1835, 1844, 1845, 1846, 1837, 1836, 1836, 1845, 1846,
+	1847, 1838, 1837, 1837, 1846, 1847, 1848, 1839, 1838, 1838, 1847, 1848, 1849, 1840, 1839, 1839, 1848, 1849, 1850, 1841, 1840, 1840, 1849, 1850,
+	1851, 1842, 1841, 1841, 1850, 1851, 1737, 1726, 1842, 1842, 1851, 1737, 1852, 1843, 1746, 1746, 1757, 1852, 1853, 1844, 1843, 1843, 1852, 1853,
+	1854, 1845, 1844, 1844, 1853, 1854, 1855, 1846, 1845, 1845, 1854, 1855, 1856, 1847, 1846, 1846, 1855, 1856, 1857, 1848, 1847, 1847, 1856, 1857,
+	1858, 1849, 1848, 1848, 1857, 1858, 1859, 1850, 1849, 1849, 1858, 1859, 1860, 1851, 1850, 1850, 1859, 1860, 1748, 1737, 1851, 1851, 1860, 1748,
+	1861, 1852, 1757, 1757, 1768, 1861, 1862, 1853, 1852, 1852, 1861, 1862, 1863, 1854, 1853, 1853, 1862, 1863, 1864, 1855, 1854, 1854, 1863, 1864,
+	1865, 1856, 1855, 1855, 1864, 1865, 1866, 1857, 1856, 1856, 1865, 1866, 1867, 1858, 1857, 1857, 1866, 1867, 1868, 1859, 1858, 1858, 1867, 1868,
+	1869, 1860, 1859, 1859, 1868, 1869, 1759, 1748, 1860, 1860, 1869, 1759, 1870, 1861, 1768, 1768, 1779, 1870, 1871, 1862, 1861, 1861, 1870, 1871,
+	1872, 1863, 1862, 1862, 1871, 1872, 1873, 1864, 1863, 1863, 1872, 1873, 1874, 1865, 1864, 1864, 1873, 1874, 1875, 1866, 1865, 1865, 1874, 1875,
+	1876, 1867, 1866, 1866, 1875, 1876, 1877, 1868, 1867, 1867, 1876, 1877, 1878, 1869, 1868, 1868, 1877, 1878, 1770, 1759, 1869, 1869, 1878, 1770,
+	1879, 1769, 1770, 1770, 1880, 1879, 1881, 1771, 1769, 1769, 1879, 1881, 1882, 1772, 1771, 1771, 1881, 1882, 1883, 1773, 1772, 1772, 1882, 1883,
+	1884, 1774, 1773, 1773, 1883, 1884, 1885, 1775, 1774, 1774, 1884, 1885, 1886, 1776, 1775, 1775, 1885, 1886, 1887, 1777, 1776, 1776, 1886, 1887,
+	1888, 1778, 1777, 1777, 1887, 1888, 1889, 1779, 1778, 1778, 1888, 1889, 1890, 1879, 1880, 1880, 1891, 1890, 1892, 1881, 1879, 1879, 1890, 1892,
+	1893, 1882, 1881, 1881, 1892, 1893, 1894, 1883, 1882, 1882, 1893, 1894, 1895, 1884, 1883, 1883, 1894, 1895, 1896, 1885, 1884, 1884, 1895, 1896,
+	1897, 1886, 1885, 1885, 1896, 1897, 1898, 1887, 1886, 1886, 1897, 1898, 1899, 1888, 1887, 1887, 1898, 1899, 1900, 1889, 1888, 1888, 1899, 1900,
+	1901, 1890, 1891, 1891, 1902, 1901, 1903, 1892, 1890, 1890, 1901, 1903, 1904, 1893, 1892, 1892, 1903, 1904, 1905, 1894, 1893, 1893, 1904, 1905,
+	1906, 1895, 1894, 1894, 1905, 1906, 1907, 1896, 1895, 1895, 1906, 1907, 1908, 1897, 1896, 1896, 1907, 1908, 1909, 1898, 1897, 1897, 1908, 1909,
+	1910, 1899, 1898, 1898, 1909, 1910, 1911, 1900, 1899, 1899, 1910, 1911, 1912, 1901, 1902, 1902, 1913, 1912, 1914, 1903, 1901, 1901, 1912, 1914,
+	1915, 1904, 1903, 1903, 1914, 1915, 1916, 1905, 1904, 1904, 1915, 1916, 1917, 1906, 1905, 1905, 1916, 1917, 1918, 1907, 1906, 1906, 1917, 1918,
+	1919, 1908, 1907, 1907, 1918, 1919, 1920, 1909, 1908, 1908, 1919, 1920, 1921, 1910, 1909, 1909, 1920, 1921, 1922, 1911, 1910, 1910, 1921, 1922,
+	1923, 1912, 1913, 1913, 1924, 1923, 1925, 1914, 1912, 1912, 1923, 1925, 1926, 1915, 1914, 1914, 1925, 1926, 1927, 1916, 1915, 1915, 1926, 1927,
+	1928, 1917, 1916, 1916, 1927, 1928, 1929, 1918, 1917, 1917, 1928, 1929, 1930, 1919, 1918, 1918, 1929, 1930, 1931, 1920, 1919, 1919, 1930, 1931,
+	1932, 1921, 1920, 1920, 1931, 1932, 1933, 1922, 1921, 1921, 1932, 1933, 1934, 1923, 1924, 1924, 1935, 1934, 1936, 1925, 1923, 1923, 1934, 1936,
+	1937, 1926, 1925, 1925, 1936, 1937, 1938, 1927, 1926, 1926, 1937, 1938, 1939, 1928, 1927, 1927, 1938, 1939, 1940, 1929, 1928, 1928, 1939, 1940,
+	1941, 1930, 1929, 1929, 1940, 1941, 1942, 1931, 1930, 1930, 1941, 1942, 1943, 1932, 1931, 1931, 1942, 1943, 1944, 1933, 1932, 1932, 1943, 1944,
+	1945, 1934, 1935, 1935, 1946, 1945, 1947, 1936, 1934, 1934, 1945, 1947, 1948, 1937, 1936, 1936, 1947, 1948, 1949, 1938, 1937, 1937, 1948, 1949,
+	1950, 1939, 1938, 1938, 1949, 1950, 1951, 1940, 1939, 1939, 1950, 1951, 1952, 1941, 1940, 1940, 1951, 1952, 1953, 1942, 1941, 1941, 1952, 1953,
+	1954, 1943, 1942, 1942, 1953, 1954, 1955, 1944, 1943, 1943, 1954, 1955, 1956, 1945, 1946, 1946, 1957, 1956, 1958, 1947, 1945, 1945, 1956, 1958,
+	1959, 1948, 1947, 1947, 1958, 1959, 1960, 1949, 1948, 1948, 1959, 1960, 1961, 1950, 1949, 1949, 1960, 1961, 1962, 1951, 1950, 1950, 1961, 1962,
+	1963, 1952, 1951, 1951, 1962, 1963, 1964, 1953, 1952, 1952, 1963, 1964, 1965, 1954, 1953, 1953, 1964, 1965, 1966, 1955, 1954, 1954, 1965, 1966,
+	1967, 1956, 1957, 1957, 1968, 1967, 1969, 1958, 1956, 1956, 1967, 1969, 1970, 1959, 1958, 1958, 1969, 1970, 1971, 1960, 1959, 1959, 1970, 1971,
+	1972, 1961, 1960, 1960, 1971, 1972, 1973, 1962, 1961, 1961, 1972, 1973, 1974, 1963, 1962, 1962, 1973, 1974, 1975, 1964, 1963, 1963, 1974, 1975,
+	1976, 1965, 1964, 1964, 1975, 1976, 1977, 1966, 1965, 1965, 1976, 1977, 1978, 1967, 1968, 1968, 1979, 1978, 1980, 1969, 1967, 1967, 1978, 1980,
+	1981, 1970, 1969, 1969, 1980, 1981, 1982, 1971, 1970, 1970, 1981, 1982, 1983, 1972, 1971, 1971, 1982, 1983, 1984, 1973, 1972, 1972, 1983, 1984,
+	1985, 1974, 1973, 1973, 1984, 1985, 1986, 1975, 1974, 1974, 1985, 1986, 1987, 1976, 1975, 1975, 1986, 1987, 1988, 1977, 1976, 1976, 1987, 1988,
+	1989, 1870, 1779, 1779, 1889, 1989, 1990, 1871, 1870, 1870, 1989, 1990, 1991, 1872, 1871, 1871, 1990, 1991, 1992, 1873, 1872, 1872, 1991, 1992,
+	1993, 1874, 1873, 1873, 1992, 1993, 1994, 1875, 1874, 1874, 1993, 1994, 1995, 1876, 1875, 1875, 1994, 1995, 1996, 1877, 1876, 1876, 1995, 1996,
+	1997, 1878, 1877, 1877, 1996, 1997, 1880, 1770, 1878, 1878, 1997, 1880, 1998, 1989, 1889, 1889, 1900, 1998, 1999, 1990, 1989, 1989, 1998, 1999,
+	2000, 1991, 1990, 1990, 1999, 2000, 2001, 1992, 1991, 1991, 2000, 2001, 2002, 1993, 1992, 1992, 2001, 2002, 2003, 1994, 1993, 1993, 2002, 2003,
+	2004, 1995, 1994, 1994, 2003, 2004, 2005, 1996, 1995, 1995, 2004, 2005, 2006, 1997, 1996, 1996, 2005, 2006, 1891, 1880, 1997, 1997, 2006, 1891,
+	2007, 1998, 1900, 1900, 1911, 2007, 2008, 1999, 1998, 1998, 2007, 2008, 2009, 2000, 1999, 1999, 2008, 2009, 2010, 2001, 2000, 2000, 2009, 2010,
+	2011, 2002, 2001, 2001, 2010, 2011, 2012, 2003, 2002, 2002, 2011, 2012, 2013, 2004, 2003, 2003, 2012, 2013, 2014, 2005, 2004, 2004, 2013, 2014,
+	2015, 2006, 2005, 2005, 2014, 2015, 1902, 1891, 2006, 2006, 2015, 1902, 2016, 2007, 1911, 1911, 1922, 2016, 2017, 2008, 2007, 2007, 2016, 2017,
+	2018, 2009, 2008, 2008, 2017, 2018, 2019, 2010, 2009, 2009, 2018, 2019, 2020, 2011, 2010, 2010, 2019, 2020, 2021, 2012, 2011, 2011, 2020, 2021,
+	2022, 2013, 2012, 2012, 2021, 2022, 2023, 2014, 2013, 2013, 2022, 2023, 2024, 2015, 2014, 2014, 2023, 2024, 1913, 1902, 2015, 2015, 2024, 1913,
+	2025, 2016, 1922, 1922, 1933, 2025, 2026, 2017, 2016, 2016, 2025, 2026, 2027, 2018, 2017, 2017, 2026, 2027, 2028, 2019, 2018, 2018, 2027, 2028,
+	2029, 2020, 2019, 2019, 2028, 2029, 2030, 2021, 2020, 2020, 2029, 2030, 2031, 2022, 2021, 2021, 2030, 2031, 2032, 2023, 2022, 2022, 2031, 2032,
+	2033, 2024, 2023, 2023, 2032, 2033, 1924, 1913, 2024, 2024, 2033, 1924, 2034, 2025, 1933, 1933, 1944, 2034, 2035, 2026, 2025, 2025, 2034, 2035,
+	2036, 2027, 2026, 2026, 2035, 2036, 2037, 2028, 2027, 2027, 2036, 2037, 2038, 2029, 2028, 2028, 2037, 2038, 2039, 2030, 2029, 2029, 2038, 2039,
+	2040, 2031, 2030, 2030, 2039, 2040, 2041, 2032, 2031, 2031, 2040, 2041, 2042, 2033, 2032, 2032, 2041, 2042, 1935, 1924, 2033, 2033, 2042, 1935,
+	2043, 2034, 1944, 1944, 1955, 2043, 2044, 2035, 2034, 2034, 2043, 2044, 2045, 2036, 2035, 2035, 2044, 2045, 2046, 2037, 2036, 2036, 2045, 2046,
+	2047, 2038, 2037, 2037, 2046, 2047, 2048, 2039, 2038, 2038, 2047, 2048, 2049, 2040, 2039, 2039, 2048, 2049, 2050, 2041, 2040, 2040, 2049, 2050,
+	2051, 2042, 2041, 2041, 2050, 2051, 1946, 1935, 2042, 2042, 2051, 1946, 2052, 2043, 1955, 1955, 1966, 2052, 2053, 2044, 2043, 2043, 2052, 2053,
+	2054, 2045, 2044, 2044, 2053, 2054, 2055, 2046, 2045, 2045, 2054, 2055, 2056, 2047, 2046, 2046, 2055, 2056, 2057, 2048, 2047, 2047, 2056, 2057,
+	2058, 2049, 2048, 2048, 2057, 2058, 2059, 2050, 2049, 2049, 2058, 2059, 2060, 2051, 2050, 2050, 2059, 2060, 1957, 1946, 2051, 2051, 2060, 1957,
+	2061, 2052, 1966, 1966, 1977, 2061, 2062, 2053, 2052, 2052, 2061, 2062, 2063, 2054, 2053, 2053, 2062, 2063, 2064, 2055, 2054, 2054, 2063, 2064,
+	2065, 2056, 2055, 2055, 2064, 2065, 2066, 2057, 2056, 2056, 2065, 2066, 2067, 2058, 2057, 2057, 2066, 2067, 2068, 2059, 2058, 2058, 2067, 2068,
+	2069, 2060, 2059, 2059, 2068, 2069, 1968, 1957, 2060, 2060, 2069, 1968, 2070, 2061, 1977, 1977, 1988, 2070, 2071, 2062, 2061, 2061, 2070, 2071,
+	2072, 2063, 2062, 2062, 2071, 2072, 2073, 2064, 2063, 2063, 2072, 2073, 2074, 2065, 2064, 2064, 2073, 2074, 2075, 2066, 2065, 2065, 2074, 2075,
+	2076, 2067, 2066, 2066, 2075, 2076, 2077, 2068, 2067, 2067, 2076, 2077, 2078, 2069, 2068, 2068, 2077, 2078, 1979, 1968, 2069, 2069, 2078, 1979,
+	2079, 2080, 2081, 2079, 2081, 2082, 2079, 2082, 2083, 2079, 2083, 2084, 2079, 2084, 2085, 2079, 2085, 2086, 2079, 2086, 2087, 2079, 2087, 2088,
+	2079, 2088, 2089, 2079, 2089, 2090, 2091, 2081, 2080, 2080, 2092, 2091, 2093, 2082, 2081, 2081, 2091, 2093, 2094, 2083, 2082, 2082, 2093, 2094,
+	2095, 2084, 2083, 2083, 2094, 2095, 2096, 2085, 2084, 2084, 2095, 2096, 2097, 2086, 2085, 2085, 2096, 2097, 2098, 2087, 2086, 2086, 2097, 2098,
+	2099, 2088, 2087, 2087, 2098, 2099, 2100, 2089, 2088, 2088, 2099, 2100, 2101, 2090, 2089, 2089, 2100, 2101, 2102, 2091, 2092, 2092, 2103, 2102,
+	2104, 2093, 2091, 2091, 2102, 2104, 2105, 2094, 2093, 2093, 2104, 2105, 2106, 2095, 2094, 2094, 2105, 2106, 2107, 2096, 2095, 2095, 2106, 2107,
+	2108, 2097, 2096, 2096, 2107, 2108, 2109, 2098, 2097, 2097, 2108, 2109, 2110, 2099, 2098, 2098, 2109, 2110, 2111, 2100, 2099, 2099, 2110, 2111,
+	2112, 2101, 2100, 2100, 2111, 2112, 2113, 2102, 2103, 2103, 2114, 2113, 2115, 2104, 2102, 2102, 2113, 2115, 2116, 2105, 2104, 2104, 2115, 2116,
+	2117, 2106, 2105, 2105, 2116, 2117, 2118, 2107, 2106, 2106, 2117, 2118, 2119, 2108, 2107, 2107, 2118, 2119, 2120, 2109, 2108, 2108, 2119, 2120,
+	2121, 2110, 2109, 2109, 2120, 2121, 2122, 2111, 2110, 2110, 2121, 2122, 2123, 2112, 2111, 2111, 2122, 2123, 2124, 2113, 2114, 2114, 2125, 2124,
+	2126, 2115, 2113, 2113, 2124, 2126, 2127, 2116, 2115, 2115, 2126, 2127, 2128, 2117, 2116, 2116, 2127, 2128, 2129, 2118, 2117, 2117, 2128, 2129,
+	2130, 2119, 2118, 2118, 2129, 2130, 2131, 2120, 2119, 2119, 2130, 2131, 2132, 2121, 2120, 2120, 2131, 2132, 2133, 2122, 2121, 2121, 2132, 2133,
+	2134, 2123, 2122, 2122, 2133, 2134, 2135, 2124, 2125, 2125, 2136, 2135, 2137, 2126, 2124, 2124, 2135, 2137, 2138, 2127, 2126, 2126, 2137, 2138,
+	2139, 2128, 2127, 2127, 2138, 2139, 2140, 2129, 2128, 2128, 2139, 2140, 2141, 2130, 2129, 2129, 2140, 2141, 2142, 2131, 2130, 2130, 2141, 2142,
+	2143, 2132, 2131, 2131, 2142, 2143, 2144, 2133, 2132, 2132, 2143, 2144, 2145, 2134, 2133, 2133, 2144, 2145, 2146, 2135, 2136, 2136, 2147, 2146,
+	2148, 2137, 2135, 2135, 2146, 2148, 2149, 2138, 2137, 2137, 2148, 2149, 2150, 2139, 2138, 2138, 2149, 2150, 2151, 2140, 2139, 2139, 2150, 2151,
+	2152, 2141, 2140, 2140, 2151, 2152, 2153, 2142, 2141, 2141, 2152, 2153, 2154, 2143, 2142, 2142, 2153, 2154, 2155, 2144, 2143, 2143, 2154, 2155,
+	2156, 2145, 2144, 2144, 2155, 2156, 2157, 2146, 2147, 2147, 2158, 2157, 2159, 2148, 2146, 2146, 2157, 2159, 2160, 2149, 2148, 2148, 2159, 2160,
+	2161, 2150, 2149, 2149, 2160, 2161, 2162, 2151, 2150, 2150, 2161, 2162, 2163, 2152, 2151, 2151, 2162, 2163, 2164, 2153, 2152, 2152, 2163, 2164,
+	2165, 2154, 2153, 2153, 2164, 2165, 2166, 2155, 2154, 2154, 2165, 2166, 2167, 2156, 2155, 2155, 2166, 2167, 2168, 2157, 2158, 2158, 2169, 2168,
+	2170, 2159, 2157, 2157, 2168, 2170, 2171, 2160, 2159, 2159, 2170, 2171, 2172, 2161, 2160, 2160, 2171, 2172, 2173, 2162, 2161, 2161, 2172, 2173,
+	2174, 2163, 2162, 2162, 2173, 2174, 2175, 2164, 2163, 2163, 2174, 2175, 2176, 2165, 2164, 2164, 2175, 2176, 2177, 2166, 2165, 2165, 2176, 2177,
+	2178, 2167, 2166, 2166, 2177, 2178, 2179, 2168, 2169, 2169, 2180, 2179, 2181, 2170, 2168, 2168, 2179, 2181, 2182, 2171, 2170, 2170, 2181, 2182,
+	2183, 2172, 2171, 2171, 2182, 2183, 2184, 2173, 2172, 2172, 2183, 2184, 2185, 2174, 2173, 2173, 2184, 2185, 2186, 2175, 2174, 2174, 2185, 2186,
+	2187, 2176, 2175, 2175, 2186, 2187, 2188, 2177, 2176, 2176, 2187, 2188, 2189, 2178, 2177, 2177, 2188, 2189, 2079, 2090, 2190, 2079, 2190, 2191,
+	2079, 2191, 2192, 2079, 2192, 2193, 2079, 2193, 2194, 2079, 2194, 2195, 2079, 2195, 2196, 2079, 2196, 2197, 2079, 2197, 2198, 2079, 2198, 2199,
+	2200, 2190, 2090, 2090, 2101, 2200, 2201, 2191, 2190, 2190, 2200, 2201, 2202, 2192, 2191, 2191, 2201, 2202, 2203, 2193, 2192, 2192, 2202, 2203,
+	2204, 2194, 2193, 2193, 2203, 2204, 2205, 2195, 2194, 2194, 2204, 2205, 2206, 2196, 2195, 2195, 2205, 2206, 2207, 2197, 2196, 2196, 2206, 2207,
+	2208, 2198, 2197, 2197, 2207, 2208, 2209, 2199, 2198, 2198, 2208, 2209, 2210, 2200, 2101, 2101, 2112, 2210, 2211, 2201, 2200, 2200, 2210, 2211,
+	2212, 2202, 2201, 2201, 2211, 2212, 2213, 2203, 2202, 2202, 2212, 2213, 2214, 2204, 2203, 2203, 2213, 2214, 2215, 2205, 2204, 2204, 2214, 2215,
+	2216, 2206, 2205, 2205, 2215, 2216, 2217, 2207, 2206, 2206, 2216, 2217, 2218, 2208, 2207, 2207, 2217, 2218, 2219, 2209, 2208, 2208, 2218, 2219,
+	2220, 2210, 2112, 2112, 2123, 2220, 2221, 2211, 2210, 2210, 2220, 2221, 2222, 2212, 2211, 2211, 2221, 2222, 2223, 2213, 2212, 2212, 2222, 2223,
+	2224, 2214, 2213, 2213, 2223, 2224, 2225, 2215, 2214, 2214, 2224, 2225, 2226, 2216, 2215, 2215, 2225, 2226, 2227, 2217, 2216, 2216, 2226, 2227,
+	2228, 2218, 2217, 2217, 2227, 2228, 2229, 2219, 2218, 2218, 2228, 2229, 2230, 2220, 2123, 2123, 2134, 2230, 2231, 2221, 2220, 2220, 2230, 2231,
+	2232, 2222, 2221, 2221, 2231, 2232, 2233, 2223, 2222, 2222, 2232, 2233, 2234, 2224, 2223, 2223, 2233, 2234, 2235, 2225, 2224, 2224, 2234, 2235,
+	2236, 2226, 2225, 2225, 2235, 2236, 2237, 2227, 2226, 2226, 2236, 2237, 2238, 2228, 2227, 2227, 2237, 2238, 2239, 2229, 2228, 2228, 2238, 2239,
+	2240, 2230, 2134, 2134, 2145, 2240, 2241, 2231, 2230, 2230, 2240, 2241, 2242, 2232, 2231, 2231, 2241, 2242, 2243, 2233, 2232, 2232, 2242, 2243,
+	2244, 2234, 2233, 2233, 2243, 2244, 2245, 2235, 2234, 2234, 2244, 2245, 2246, 2236, 2235, 2235, 2245, 2246, 2247, 2237, 2236, 2236, 2246, 2247,
+	2248, 2238, 2237, 2237, 2247, 2248, 2249, 2239, 2238, 2238, 2248, 2249, 2250, 2240, 2145, 2145, 2156, 2250, 2251, 2241, 2240, 2240, 2250, 2251,
+	2252, 2242, 2241, 2241, 2251, 2252, 2253, 2243, 2242, 2242, 2252, 2253, 2254, 2244, 2243, 2243, 2253, 2254, 2255, 2245, 2244, 2244, 2254, 2255,
+	2256, 2246, 2245, 2245, 2255, 2256, 2257, 2247, 2246, 2246, 2256, 2257, 2258, 2248, 2247, 2247, 2257, 2258, 2259, 2249, 2248, 2248, 2258, 2259,
+	2260, 2250, 2156, 2156, 2167, 2260, 2261, 2251, 2250, 2250, 2260, 2261, 2262, 2252, 2251, 2251, 2261, 2262, 2263, 2253, 2252, 2252, 2262, 2263,
+	2264, 2254, 2253, 2253, 2263, 2264, 2265, 2255, 2254, 2254, 2264, 2265, 2266, 2256, 2255, 2255, 2265, 2266, 2267, 2257, 2256, 2256, 2266, 2267,
+	2268, 2258, 2257, 2257, 2267, 2268, 2269, 2259, 2258, 2258, 2268, 2269, 2270, 2260, 2167, 2167, 2178, 2270, 2271, 2261, 2260, 2260, 2270, 2271,
+	2272, 2262, 2261, 2261, 2271, 2272, 2273, 2263, 2262, 2262, 2272, 2273, 2274, 2264, 2263, 2263, 2273, 2274, 2275, 2265, 2264, 2264, 2274, 2275,
+	2276, 2266, 2265, 2265, 2275, 2276, 2277, 2267, 2266, 2266, 2276, 2277, 2278, 2268, 2267, 2267, 2277, 2278, 2279, 2269, 2268, 2268, 2278, 2279,
+	2280, 2270, 2178, 2178, 2189, 2280, 2281, 2271, 2270, 2270, 2280, 2281, 2282, 2272, 2271, 2271, 2281, 2282, 2283, 2273, 2272, 2272, 2282, 2283,
+	2284, 2274, 2273, 2273, 2283, 2284, 2285, 2275, 2274, 2274, 2284, 2285, 2286, 2276, 2275, 2275, 2285, 2286, 2287, 2277, 2276, 2276, 2286, 2287,
+	2288, 2278, 2277, 2277, 2287, 2288, 2289, 2279, 2278, 2278, 2288, 2289, 2079, 2199, 2290, 2079, 2290, 2291, 2079, 2291, 2292, 2079, 2292, 2293,
+	2079, 2293, 2294, 2079, 2294, 2295, 2079, 2295, 2296, 2079, 2296, 2297, 2079, 2297, 2298, 2079, 2298, 2299, 2300, 2290, 2199, 2199, 2209, 2300,
+	2301, 2291, 2290, 2290, 2300, 2301, 2302, 2292, 2291, 2291, 2301, 2302, 2303, 2293, 2292, 2292, 2302, 2303, 2304, 2294, 2293, 2293, 2303, 2304,
+	2305, 2295, 2294, 2294, 2304, 2305, 2306, 2296, 2295, 2295, 2305, 2306, 2307, 2297, 2296, 2296, 2306, 2307, 2308, 2298, 2297, 2297, 2307, 2308,
+	2309, 2299, 2298, 2298, 2308, 2309, 2310, 2300, 2209, 2209, 2219, 2310, 2311, 2301, 2300, 2300, 2310, 2311, 2312, 2302, 2301, 2301, 2311, 2312,
+	2313, 2303, 2302, 2302, 2312, 2313, 2314, 2304, 2303, 2303, 2313, 2314, 2315, 2305, 2304, 2304, 2314, 2315, 2316, 2306, 2305, 2305, 2315, 2316,
+	2317, 2307, 2306, 2306, 2316, 2317, 2318, 2308, 2307, 2307, 2317, 2318, 2319, 2309, 2308, 2308, 2318, 2319, 2320, 2310, 2219, 2219, 2229, 2320,
+	2321, 2311, 2310, 2310, 2320, 2321, 2322, 2312, 2311, 2311, 2321, 2322, 2323, 2313, 2312, 2312, 2322, 2323, 2324, 2314, 2313, 2313, 2323, 2324,
+	2325, 2315, 2314, 2314, 2324, 2325, 2326, 2316, 2315, 2315, 2325, 2326, 2327, 2317, 2316, 2316, 2326, 2327, 2328, 2318, 2317, 2317, 2327, 2328,
+	2329, 2319, 2318, 2318, 2328, 2329, 2330, 2320, 2229, 2229, 2239, 2330, 2331, 2321, 2320, 2320, 2330, 2331, 2332, 2322, 2321, 2321, 2331, 2332,
+	2333, 2323, 2322, 2322, 2332, 2333, 2334, 2324, 2323, 2323, 2333, 2334, 2335, 2325, 2324, 2324, 2334, 2335, 2336, 2326, 2325, 2325, 2335, 2336,
+	2337, 2327, 2326, 2326, 2336, 2337, 2338, 2328, 2327, 2327, 2337, 2338, 2339, 2329, 2328, 2328, 2338, 2339, 2340, 2330, 2239, 2239, 2249, 2340,
+	2341, 2331, 2330, 2330, 2340, 2341, 2342, 2332, 2331, 2331, 2341, 2342, 2343, 2333, 2332, 2332, 2342, 2343, 2344, 2334, 2333, 2333, 2343, 2344,
+	2345, 2335, 2334, 2334, 2344, 2345, 2346, 2336, 2335, 2335, 2345, 2346, 2347, 2337, 2336, 2336, 2346, 2347, 2348, 2338, 2337, 2337, 2347, 2348,
+	2349, 2339, 2338, 2338, 2348, 2349, 2350, 2340, 2249, 2249, 2259, 2350, 2351, 2341, 2340, 2340, 2350, 2351, 2352, 2342, 2341, 2341, 2351, 2352,
+	2353, 2343, 2342, 2342, 2352, 2353, 2354, 2344, 2343, 2343, 2353, 2354, 2355, 2345, 2344, 2344, 2354, 2355, 2356, 2346, 2345, 2345, 2355, 2356,
+	2357, 2347, 2346, 2346, 2356, 2357, 2358, 2348, 2347, 2347, 2357, 2358, 2359, 2349, 2348, 2348, 2358, 2359, 2360, 2350, 2259, 2259, 2269, 2360,
+	2361, 2351, 2350, 2350, 2360, 2361, 2362, 2352, 2351, 2351, 2361, 2362, 2363, 2353, 2352, 2352, 2362, 2363, 2364, 2354, 2353, 2353, 2363, 2364,
+	2365, 2355, 2354, 2354, 2364, 2365, 2366, 2356, 2355, 2355, 2365, 2366, 2367, 2357, 2356, 2356, 2366, 2367, 2368, 2358, 2357, 2357, 2367, 2368,
+	2369, 2359, 2358, 2358, 2368, 2369, 2370, 2360, 2269, 2269, 2279, 2370, 2371, 2361, 2360, 2360, 2370, 2371, 2372, 2362, 2361, 2361, 2371, 2372,
+	2373, 2363, 2362, 2362, 2372, 2373, 2374, 2364, 2363, 2363, 2373, 2374, 2375, 2365, 2364, 2364, 2374, 2375, 2376, 2366, 2365, 2365, 2375, 2376,
+	2377, 2367, 2366, 2366, 2376, 2377, 2378, 2368, 2367, 2367, 2377, 2378, 2379, 2369, 2368, 2368, 2378, 2379, 2380, 2370, 2279, 2279, 2289, 2380,
+	2381, 2371, 2370, 2370, 2380, 2381, 2382, 2372, 2371, 2371, 2381, 2382, 2383, 2373, 2372, 2372, 2382, 2383, 2384, 2374, 2373, 2373, 2383, 2384,
+	2385, 2375, 2374, 2374, 2384, 2385, 2386, 2376, 2375, 2375, 2385, 2386, 2387, 2377, 2376, 2376, 2386, 2387, 2388, 2378, 2377, 2377, 2387, 2388,
+	2389, 2379, 2378, 2378, 2388, 2389, 2079, 2299, 2390, 2079, 2390, 2391, 2079, 2391, 2392, 2079, 2392, 2393, 2079, 2393, 2394, 2079, 2394, 2395,
+	2079, 2395, 2396, 2079, 2396, 2397, 2079, 2397, 2398, 2079, 2398, 2080, 2399, 2390, 2299, 2299, 2309, 2399, 2400, 2391, 2390, 2390, 2399, 2400,
+	2401, 2392, 2391, 2391, 2400, 2401, 2402, 2393, 2392, 2392, 2401, 2402, 2403, 2394, 2393, 2393, 2402, 2403, 2404, 2395, 2394, 2394, 2403, 2404,
+	2405, 2396, 2395, 2395, 2404, 2405, 2406, 2397, 2396, 2396, 2405, 2406, 2407, 2398, 2397, 2397, 2406, 2407, 2092, 2080, 2398, 2398, 2407, 2092,
+	2408, 2399, 2309, 2309, 2319, 2408, 2409, 2400, 2399, 2399, 2408, 2409, 2410, 2401, 2400, 2400, 2409, 2410, 2411, 2402, 2401, 2401, 2410, 2411,
+	2412, 2403, 2402, 2402, 2411, 2412, 2413, 2404, 2403, 2403, 2412, 2413, 2414, 2405, 2404, 2404, 2413, 2414, 2415, 2406, 2405, 2405, 2414, 2415,
+	2416, 2407, 2406, 2406, 2415, 2416, 2103, 2092, 2407, 2407, 2416, 2103, 2417, 2408, 2319, 2319, 2329, 2417, 2418, 2409, 2408, 2408, 2417, 2418,
+	2419, 2410, 2409, 2409, 2418, 2419, 2420, 2411, 2410, 2410, 2419, 2420, 2421, 2412, 2411, 2411, 2420, 2421, 2422, 2413, 2412, 2412, 2421, 2422,
+	2423, 2414, 2413, 2413, 2422, 2423, 2424, 2415, 2414, 2414, 2423, 2424, 2425, 2416, 2415, 2415, 2424, 2425, 2114, 2103, 2416, 2416, 2425, 2114,
+	2426, 2417, 2329, 2329, 2339, 2426, 2427, 2418, 2417, 2417, 2426, 2427, 2428, 2419, 2418, 2418, 2427, 2428, 2429, 2420, 2419, 2419, 2428, 2429,
+	2430, 2421, 2420, 2420, 2429, 2430, 2431, 2422, 2421, 2421, 2430, 2431, 2432, 2423, 2422, 2422, 2431, 2432, 2433, 2424, 2423, 2423, 2432, 2433,
+	2434, 2425, 2424, 2424, 2433, 2434, 2125, 2114, 2425, 2425, 2434, 2125, 2435, 2426, 2339, 2339, 2349, 2435, 2436, 2427, 2426, 2426, 2435, 2436,
+	2437, 2428, 2427, 2427, 2436, 2437, 2438, 2429, 2428, 2428, 2437, 2438, 2439, 2430, 2429, 2429, 2438, 2439, 2440, 2431, 2430, 2430, 2439, 2440,
+	2441, 2432, 2431, 2431, 2440, 2441, 2442, 2433, 2432, 2432, 2441, 2442, 2443, 2434, 2433, 2433, 2442, 2443, 2136, 2125, 2434, 2434, 2443, 2136,
+	2444, 2435, 2349, 2349, 2359, 2444, 2445, 2436, 2435, 2435, 2444, 2445, 2446, 2437, 2436, 2436, 2445, 2446, 2447, 2438, 2437, 2437, 2446, 2447,
+	2448, 2439, 2438, 2438, 2447, 2448, 2449, 2440, 2439, 2439, 2448, 2449, 2450, 2441, 2440, 2440, 2449, 2450, 2451, 2442, 2441, 2441, 2450, 2451,
+	2452, 2443, 2442, 2442, 2451, 2452, 2147, 2136, 2443, 2443, 2452, 2147, 2453, 2444, 2359, 2359, 2369, 2453, 2454, 2445, 2444, 2444, 2453, 2454,
+	2455, 2446, 2445, 2445, 2454, 2455, 2456, 2447, 2446, 2446, 2455, 2456, 2457, 2448, 2447, 2447, 2456, 2457, 2458, 2449, 2448, 2448, 2457, 2458,
+	2459, 2450, 2449, 2449, 2458, 2459, 2460, 2451, 2450, 2450, 2459, 2460, 2461, 2452, 2451, 2451, 2460, 2461, 2158, 2147, 2452, 2452, 2461, 2158,
+	2462, 2453, 2369, 2369, 2379, 2462, 2463, 2454, 2453, 2453, 2462, 2463, 2464, 2455, 2454, 2454, 2463, 2464, 2465, 2456, 2455, 2455, 2464, 2465,
+	2466, 2457, 2456, 2456, 2465, 2466, 2467, 2458, 2457, 2457, 2466, 2467, 2468, 2459, 2458, 2458, 2467, 2468, 2469, 2460, 2459, 2459, 2468, 2469,
+	2470, 2461, 2460, 2460, 2469, 2470, 2169, 2158, 2461, 2461, 2470, 2169, 2471, 2462, 2379, 2379, 2389, 2471, 2472, 2463, 2462, 2462, 2471, 2472,
+	2473, 2464, 2463, 2463, 2472, 2473, 2474, 2465, 2464, 2464, 2473, 2474, 2475, 2466, 2465, 2465, 2474, 2475, 2476, 2467, 2466, 2466, 2475, 2476,
+	2477, 2468, 2467, 2467, 2476, 2477, 2478, 2469, 2468, 2468, 2477, 2478, 2479, 2470, 2469, 2469, 2478, 2479, 2180, 2169, 2470, 2470, 2479, 2180,
+	2480, 2179, 2180, 2180, 2481, 2480, 2482, 2181, 2179, 2179, 2480, 2482, 2483, 2182, 2181, 2181, 2482, 2483, 2484, 2183, 2182, 2182, 2483, 2484,
+	2485, 2184, 2183, 2183, 2484, 2485, 2486, 2185, 2184, 2184, 2485, 2486, 2487, 2186, 2185, 2185, 2486, 2487, 2488, 2187, 2186, 2186, 2487, 2488,
+	2489, 2188, 2187, 2187, 2488, 2489, 2490, 2189, 2188, 2188, 2489, 2490, 2491, 2480, 2481, 2481, 2492, 2491, 2493, 2482, 2480, 2480, 2491, 2493,
+	2494, 2483, 2482, 2482, 2493, 2494, 2495, 2484, 2483, 2483, 2494, 2495, 2496, 2485, 2484, 2484, 2495, 2496, 2497, 2486, 2485, 2485, 2496, 2497,
+	2498, 2487, 2486, 2486, 2497, 2498, 2499, 2488, 2487, 2487, 2498, 2499, 2500, 2489, 2488, 2488, 2499, 2500, 2501, 2490, 2489, 2489, 2500, 2501,
+	2502, 2491, 2492, 2492, 2503, 2502, 2504, 2493, 2491, 2491, 2502, 2504, 2505, 2494, 2493, 2493, 2504, 2505, 2506, 2495, 2494, 2494, 2505, 2506,
+	2507, 2496, 2495, 2495, 2506, 2507, 2508, 2497, 2496, 2496, 2507, 2508, 2509, 2498, 2497, 2497, 2508, 2509, 2510, 2499, 2498, 2498, 2509, 2510,
+	2511, 2500, 2499, 2499, 2510, 2511, 2512, 2501, 2500, 2500, 2511, 2512, 2513, 2502, 2503, 2503, 2514, 2513, 2515, 2504, 2502, 2502, 2513, 2515,
+	2516, 2505, 2504, 2504, 2515, 2516, 2517, 2506, 2505, 2505, 2516, 2517, 2518, 2507, 2506, 2506, 2517, 2518, 2519, 2508, 2507, 2507, 2518, 2519,
+	2520, 2509, 2508, 2508, 2519, 2520, 2521, 2510, 2509, 2509, 2520, 2521, 2522, 2511, 2510, 2510, 2521, 2522, 2523, 2512, 2511, 2511, 2522, 2523,
+	2524, 2513, 2514, 2514, 2525, 2524, 2526, 2515, 2513, 2513, 2524, 2526, 2527, 2516, 2515, 2515, 2526, 2527, 2528, 2517, 2516, 2516, 2527, 2528,
+	2529, 2518, 2517, 2517, 2528, 2529, 2530, 2519, 2518, 2518, 2529, 2530, 2531, 2520, 2519, 2519, 2530, 2531, 2532, 2521, 2520, 2520, 2531, 2532,
+	2533, 2522, 2521, 2521, 2532, 2533, 2534, 2523, 2522, 2522, 2533, 2534, 2535, 2524, 2525, 2525, 2536, 2535, 2537, 2526, 2524, 2524, 2535, 2537,
+	2538, 2527, 2526, 2526, 2537, 2538, 2539, 2528, 2527, 2527, 2538, 2539, 2540, 2529, 2528, 2528, 2539, 2540, 2541, 2530, 2529, 2529, 2540, 2541,
+	2542, 2531, 2530, 2530, 2541, 2542, 2543, 2532, 2531, 2531, 2542, 2543, 2544, 2533, 2532, 2532, 2543, 2544, 2545, 2534, 2533, 2533, 2544, 2545,
+	2546, 2535, 2536, 2536, 2547, 2546, 2548, 2537, 2535, 2535, 2546, 2548, 2549, 2538, 2537, 2537, 2548, 2549, 2550, 2539, 2538, 2538, 2549, 2550,
+	2551, 2540, 2539, 2539, 2550, 2551, 2552, 2541, 2540, 2540, 2551, 2552, 2553, 2542, 2541, 2541, 2552, 2553, 2554, 2543, 2542, 2542, 2553, 2554,
+	2555, 2544, 2543, 2543, 2554, 2555, 2556, 2545, 2544, 2544, 2555, 2556, 2557, 2546, 2547, 2547, 2558, 2557, 2559, 2548, 2546, 2546, 2557, 2559,
+	2560, 2549, 2548, 2548, 2559, 2560, 2561, 2550, 2549, 2549, 2560, 2561, 2562, 2551, 2550, 2550, 2561, 2562, 2563, 2552, 2551, 2551, 2562, 2563,
+	2564, 2553, 2552, 2552, 2563, 2564, 2565, 2554, 2553, 2553, 2564, 2565, 2566, 2555, 2554, 2554, 2565, 2566, 2567, 2556, 2555, 2555, 2566, 2567,
+	2568, 2557, 2558, 2558, 2569, 2568, 2570, 2559, 2557, 2557, 2568, 2570, 2571, 2560, 2559, 2559, 2570, 2571, 2572, 2561, 2560, 2560, 2571, 2572,
+	2573, 2562, 2561, 2561, 2572, 2573, 2574, 2563, 2562, 2562, 2573, 2574, 2575, 2564, 2563, 2563, 2574, 2575, 2576, 2565, 2564, 2564, 2575, 2576,
+	2577, 2566, 2565, 2565, 2576, 2577, 2578, 2567, 2566, 2566, 2577, 2578, 2579, 2568, 2569, 2569, 2580, 2579, 2581, 2570, 2568, 2568, 2579, 2581,
+	2582, 2571, 2570, 2570, 2581, 2582, 2583, 2572, 2571, 2571, 2582, 2583, 2584, 2573, 2572, 2572, 2583, 2584, 2585, 2574, 2573, 2573, 2584, 2585,
+	2586, 2575, 2574, 2574, 2585, 2586, 2587, 2576, 2575, 2575, 2586, 2587, 2588, 2577, 2576, 2576, 2587, 2588, 2589, 2578, 2577, 2577, 2588, 2589,
+	2590, 2280, 2189, 2189, 2490, 2590, 2591, 2281, 2280, 2280, 2590, 2591, 2592, 2282, 2281, 2281, 2591, 2592, 2593, 2283, 2282, 2282, 2592, 2593,
+	2594, 2284, 2283, 2283, 2593, 2594, 2595, 2285, 2284, 2284, 2594, 2595, 2596, 2286, 2285, 2285, 2595, 2596, 2597, 2287, 2286, 2286, 2596, 2597,
+	2598, 2288, 2287, 2287, 2597, 2598, 2599, 2289, 2288, 2288, 2598, 2599, 2600, 2590, 2490, 2490, 2501, 2600, 2601, 2591, 2590, 2590, 2600, 2601,
+	2602, 2592, 2591, 2591, 2601, 2602, 2603, 2593, 2592, 2592, 2602, 2603, 2604, 2594, 2593, 2593, 2603, 2604, 2605, 2595, 2594, 2594, 2604, 2605,
+	2606, 2596, 2595, 2595, 2605, 2606, 2607, 2597, 2596, 2596, 2606, 2607, 2608, 2598, 2597, 2597, 2607, 2608, 2609, 2599, 2598, 2598, 2608, 2609,
+	2610, 2600, 2501, 2501, 2512, 2610, 2611, 2601, 2600, 2600, 2610, 2611, 2612, 2602, 2601, 2601, 2611, 2612, 2613, 2603, 2602, 2602, 2612, 2613,
+	2614, 2604, 2603, 2603, 2613, 2614, 2615, 2605, 2604, 2604, 2614, 2615, 2616, 2606, 2605, 2605, 2615, 2616, 2617, 2607, 2606, 2606, 2616, 2617,
+	2618, 2608, 2607, 2607, 2617, 2618, 2619, 2609, 2608, 2608, 2618, 2619, 2620, 2610, 2512, 2512, 2523, 2620, 2621, 2611, 2610, 2610, 2620, 2621,
+	2622, 2612, 2611, 2611, 2621, 2622, 2623, 2613, 2612, 2612, 2622, 2623, 2624, 2614, 2613, 2613, 2623, 2624, 2625, 2615, 2614, 2614, 2624, 2625,
+	2626, 2616, 2615, 2615, 2625, 2626, 2627, 2617, 2616, 2616, 2626, 2627, 2628, 2618, 2617, 2617, 2627, 2628, 2629, 2619, 2618, 2618, 2628, 2629,
+	2630, 2620, 2523, 2523, 2534, 2630, 2631, 2621, 2620, 2620, 2630, 2631, 2632, 2622, 2621, 2621, 2631, 2632, 2633, 2623, 2622, 2622, 2632, 2633,
+	2634, 2624, 2623, 2623, 2633, 2634, 2635, 2625, 2624, 2624, 2634, 2635, 2636, 2626, 2625, 2625, 2635, 2636, 2637, 2627, 2626, 2626, 2636, 2637,
+	2638, 2628, 2627, 2627, 2637, 2638, 2639, 2629, 2628, 2628, 2638, 2639, 2640, 2630, 2534, 2534, 2545, 2640, 2641, 2631, 2630, 2630, 2640, 2641,
+	2642, 2632, 2631, 2631, 2641, 2642, 2643, 2633, 2632, 2632, 2642, 2643, 2644, 2634, 2633, 2633, 2643, 2644, 2645, 2635, 2634, 2634, 2644, 2645,
+	2646, 2636, 2635, 2635, 2645, 2646, 2647, 2637, 2636, 2636, 2646, 2647, 2648, 2638, 2637, 2637, 2647, 2648, 2649, 2639, 2638, 2638, 2648, 2649,
+	2650, 2640, 2545, 2545, 2556, 2650, 2651, 2641, 2640, 2640, 2650, 2651, 2652, 2642, 2641, 2641, 2651, 2652, 2653, 2643, 2642, 2642, 2652, 2653,
+	2654, 2644, 2643, 2643, 2653, 2654, 2655, 2645, 2644, 2644, 2654, 2655, 2656, 2646, 2645, 2645, 2655, 2656, 2657, 2647, 2646, 2646, 2656, 2657,
+	2658, 2648, 2647, 2647, 2657, 2658, 2659, 2649, 2648, 2648, 2658, 2659, 2660, 2650, 2556, 2556, 2567, 2660, 2661, 2651, 2650, 2650, 2660, 2661,
+	2662, 2652, 2651, 2651, 2661, 2662, 2663, 2653, 2652, 2652, 2662, 2663, 2664, 2654, 2653, 2653, 2663, 2664, 2665, 2655, 2654, 2654, 2664, 2665,
+	2666, 2656, 2655, 2655, 2665, 2666, 2667, 2657, 2656, 2656, 2666, 2667, 2668, 2658, 2657, 2657, 2667, 2668, 2669, 2659, 2658, 2658, 2668, 2669,
+	2670, 2660, 2567, 2567, 2578, 2670, 2671, 2661, 2660, 2660, 2670, 2671, 2672, 2662, 2661, 2661, 2671, 2672, 2673, 2663, 2662, 2662, 2672, 2673,
+	2674, 2664, 2663, 2663, 2673, 2674, 2675, 2665, 2664, 2664, 2674, 2675, 2676, 2666, 2665, 2665, 2675, 2676, 2677, 2667, 2666, 2666, 2676, 2677,
+	2678, 2668, 2667, 2667, 2677, 2678, 2679, 2669, 2668, 2668, 2678, 2679, 2680, 2670, 2578, 2578, 2589, 2680, 2681, 2671, 2670, 2670, 2680, 2681,
+	2682, 2672, 2671, 2671, 2681, 2682, 2683, 2673, 2672, 2672, 2682, 2683, 2684, 2674, 2673, 2673, 2683, 2684, 2685, 2675, 2674, 2674, 2684, 2685,
+	2686, 2676, 2675, 2675, 2685, 2686, 2687, 2677, 2676, 2676, 2686, 2687, 2688, 2678, 2677, 2677, 2687, 2688, 2689, 2679, 2678, 2678, 2688, 2689,
+	2690, 2380, 2289, 2289, 2599, 2690, 2691, 2381, 2380, 2380, 2690, 2691, 2692, 2382, 2381, 2381, 2691, 2692, 2693, 2383, 2382, 2382, 2692, 2693,
+	2694, 2384, 2383, 2383, 2693, 2694, 2695, 2385, 2384, 2384, 2694, 2695, 2696, 2386, 2385, 2385, 2695, 2696, 2697, 2387, 2386, 2386, 2696, 2697,
+	2698, 2388, 2387, 2387, 2697, 2698, 2699, 2389, 2388, 2388, 2698, 2699, 2700, 2690, 2599, 2599, 2609, 2700, 2701, 2691, 2690, 2690, 2700, 2701,
+	2702, 2692, 2691, 2691, 2701, 2702, 2703, 2693, 2692, 2692, 2702, 2703, 2704, 2694, 2693, 2693, 2703, 2704, 2705, 2695, 2694, 2694, 2704, 2705,
+	2706, 2696, 2695, 2695, 2705, 2706, 2707, 2697, 2696, 2696, 2706, 2707, 2708, 2698, 2697, 2697, 2707, 2708, 2709, 2699, 2698, 2698, 2708, 2709,
+	2710, 2700, 2609, 2609, 2619, 2710, 2711, 2701, 2700, 2700, 2710, 2711, 2712, 2702, 2701, 2701, 2711, 2712, 2713, 2703, 2702, 2702, 2712, 2713,
+	2714, 2704, 2703, 2703, 2713, 2714, 2715, 2705, 2704, 2704, 2714, 2715, 2716, 2706, 2705, 2705, 2715, 2716, 2717, 2707, 2706, 2706, 2716, 2717,
+	2718, 2708, 2707, 2707, 2717, 2718, 2719, 2709, 2708, 2708, 2718, 2719, 2720, 2710, 2619, 2619, 2629, 2720, 2721, 2711, 2710, 2710, 2720, 2721,
+	2722, 2712, 2711, 2711, 2721, 2722, 2723, 2713, 2712, 2712, 2722, 2723, 2724, 2714, 2713, 2713, 2723, 2724, 2725, 2715, 2714, 2714, 2724, 2725,
+	2726, 2716, 2715, 2715, 2725, 2726, 2727, 2717, 2716, 2716, 2726, 2727, 2728, 2718, 2717, 2717, 2727, 2728, 2729, 2719, 2718, 2718, 2728, 2729,
+	2730, 2720, 2629, 2629, 2639, 2730, 2731, 2721, 2720, 2720, 2730, 2731, 2732, 2722, 2721, 2721, 2731, 2732, 2733, 2723, 2722, 2722, 2732, 2733,
+	2734, 2724, 2723, 2723, 2733, 2734, 2735, 2725, 2724, 2724, 2734, 2735, 2736, 2726, 2725, 2725, 2735, 2736, 2737, 2727, 2726, 2726, 2736, 2737,
+	2738, 2728, 2727, 2727, 2737, 2738, 2739, 2729, 2728, 2728, 2738, 2739, 2740, 2730, 2639, 2639, 2649, 2740, 2741, 2731, 2730, 2730, 2740, 2741,
+	2742, 2732, 2731, 2731, 2741, 2742, 2743, 2733, 2732, 2732, 2742, 2743, 2744, 2734, 2733, 2733, 2743, 2744, 2745, 2735, 2734, 2734, 2744, 2745,
+	2746, 2736, 2735, 2735, 2745, 2746, 2747, 2737, 2736, 2736, 2746, 2747, 2748, 2738, 2737, 2737, 2747, 2748, 2749, 2739, 2738, 2738, 2748, 2749,
+	2750, 2740, 2649, 2649, 2659, 2750, 2751, 2741, 2740, 2740, 2750, 2751, 2752, 2742, 2741, 2741, 2751, 2752, 2753, 2743, 2742, 2742, 2752, 2753,
+	2754, 2744, 2743, 2743, 2753, 2754, 2755, 2745, 2744, 2744, 2754, 2755, 2756, 2746, 2745, 2745, 2755, 2756, 2757, 2747, 2746, 2746, 2756, 2757,
+	2758, 2748, 2747, 2747, 2757, 2758, 2759, 2749, 2748, 2748, 2758, 2759, 2760, 2750, 2659, 2659, 2669, 2760, 2761, 2751, 2750, 2750, 2760, 2761,
+	2762, 2752, 2751, 2751, 2761, 2762, 2763, 2753, 2752, 2752, 2762, 2763, 2764, 2754, 2753, 2753, 2763, 2764, 2765, 2755, 2754, 2754, 2764, 2765,
+	2766, 2756, 2755, 2755, 2765, 2766, 2767, 2757, 2756, 2756, 2766, 2767, 2768, 2758, 2757, 2757, 2767, 2768, 2769, 2759, 2758, 2758, 2768, 2769,
+	2770, 2760, 2669, 2669, 2679, 2770, 2771, 2761, 2760, 2760, 2770, 2771, 2772, 2762, 2761, 2761, 2771, 2772, 2773, 2763, 2762, 2762, 2772, 2773,
+	2774, 2764, 2763, 2763, 2773, 2774, 2775, 2765, 2764, 2764, 2774, 2775, 2776, 2766, 2765, 2765, 2775, 2776, 2777, 2767, 2766, 2766, 2776, 2777,
+	2778, 2768, 2767, 2767, 2777, 2778, 2779, 2769, 2768, 2768, 2778, 2779, 2780, 2770, 2679, 2679, 2689, 2780, 2781, 2771, 2770, 2770, 2780, 2781,
+	2782, 2772, 2771, 2771, 2781, 2782, 2783, 2773, 2772, 2772, 2782, 2783, 2784, 2774, 2773, 2773, 2783, 2784, 2785, 2775, 2774, 2774, 2784, 2785,
+	2786, 2776, 2775, 2775, 2785, 2786, 2787, 2777, 2776, 2776, 2786, 2787, 2788, 2778, 2777, 2777, 2787, 2788, 2789, 2779, 2778, 2778, 2788, 2789,
+	2790, 2471, 2389, 2389, 2699, 2790, 2791, 2472, 2471, 2471, 2790, 2791, 2792, 2473, 2472, 2472, 2791, 2792, 2793, 2474, 2473, 2473, 2792, 2793,
+	2794, 2475, 2474, 2474, 2793, 2794, 2795, 2476, 2475, 2475, 2794, 2795, 2796, 2477, 2476, 2476, 2795, 2796, 2797, 2478, 2477, 2477, 2796, 2797,
+	2798, 2479, 2478, 2478, 2797, 2798, 2481, 2180, 2479, 2479, 2798, 2481, 2799, 2790, 2699, 2699, 2709, 2799, 2800, 2791, 2790, 2790, 2799, 2800,
+	2801, 2792, 2791, 2791, 2800, 2801, 2802, 2793, 2792, 2792, 2801, 2802, 2803, 2794, 2793, 2793, 2802, 2803, 2804, 2795, 2794, 2794, 2803, 2804,
+	2805, 2796, 2795, 2795, 2804, 2805, 2806, 2797, 2796, 2796, 2805, 2806, 2807, 2798, 2797, 2797, 2806, 2807, 2492, 2481, 2798, 2798, 2807, 2492,
+	2808, 2799, 2709, 2709, 2719, 2808, 2809, 2800, 2799, 2799, 2808, 2809, 2810, 2801, 2800, 2800, 2809, 2810, 2811, 2802, 2801, 2801, 2810, 2811,
+	2812, 2803, 2802, 2802, 2811, 2812, 2813, 2804, 2803, 2803, 2812, 2813, 2814, 2805, 2804, 2804, 2813, 2814, 2815, 2806, 2805, 2805, 2814, 2815,
+	2816, 2807, 2806, 2806, 2815, 2816, 2503, 2492, 2807, 2807, 2816, 2503, 2817, 2808, 2719, 2719, 2729, 2817, 2818, 2809, 2808, 2808, 2817, 2818,
+	2819, 2810, 2809, 2809, 2818, 2819, 2820, 2811, 2810, 2810, 2819, 2820, 2821, 2812, 2811, 2811, 2820, 2821, 2822, 2813, 2812, 2812, 2821, 2822,
+	2823, 2814, 2813, 2813, 2822, 2823, 2824, 2815, 2814, 2814, 2823, 2824, 2825, 2816, 2815, 2815, 2824, 2825, 2514, 2503, 2816, 2816, 2825, 2514,
+	2826, 2817, 2729, 2729, 2739, 2826, 2827, 2818, 2817, 2817, 2826, 2827, 2828, 2819, 2818, 2818, 2827, 2828, 2829, 2820, 2819, 2819, 2828, 2829,
+	2830, 2821, 2820, 2820, 2829, 2830, 2831, 2822, 2821, 2821, 2830, 2831, 2832, 2823, 2822, 2822, 2831, 2832, 2833, 2824, 2823, 2823, 2832, 2833,
+	2834, 2825, 2824, 2824, 2833, 2834, 2525, 2514, 2825, 2825, 2834, 2525, 2835, 2826, 2739, 2739, 2749, 2835, 2836, 2827, 2826, 2826, 2835, 2836,
+	2837, 2828, 2827, 2827, 2836, 2837, 2838, 2829, 2828, 2828, 2837, 2838, 2839, 2830, 2829, 2829, 2838, 2839, 2840, 2831, 2830, 2830, 2839, 2840,
+	2841, 2832, 2831, 2831, 2840, 2841, 2842, 2833, 2832, 2832, 2841, 2842, 2843, 2834, 2833, 2833, 2842, 2843, 2536, 2525, 2834, 2834, 2843, 2536,
+	2844, 2835, 2749, 2749, 2759, 2844, 2845, 2836, 2835, 2835, 2844, 2845, 2846, 2837, 2836, 2836, 2845, 2846, 2847, 2838, 2837, 2837, 2846, 2847,
+	2848, 2839, 2838, 2838, 2847, 2848, 2849, 2840, 2839, 2839, 2848, 2849, 2850, 2841, 2840, 2840, 2849, 2850, 2851, 2842, 2841, 2841, 2850, 2851,
+	2852, 2843, 2842, 2842, 2851, 2852, 2547, 2536, 2843, 2843, 2852, 2547, 2853, 2844, 2759, 2759, 2769, 2853, 2854, 2845, 2844, 2844, 2853, 2854,
+	2855, 2846, 2845, 2845, 2854, 2855, 2856, 2847, 2846, 2846, 2855, 2856, 2857, 2848, 2847, 2847, 2856, 2857, 2858, 2849, 2848, 2848, 2857, 2858,
+	2859, 2850, 2849, 2849, 2858, 2859, 2860, 2851, 2850, 2850, 2859, 2860, 2861, 2852, 2851, 2851, 2860, 2861, 2558, 2547, 2852, 2852, 2861, 2558,
+	2862, 2853, 2769, 2769, 2779, 2862, 2863, 2854, 2853, 2853, 2862, 2863, 2864, 2855, 2854, 2854, 2863, 2864, 2865, 2856, 2855, 2855, 2864, 2865,
+	2866, 2857, 2856, 2856, 2865, 2866, 2867, 2858, 2857, 2857, 2866, 2867, 2868, 2859, 2858, 2858, 2867, 2868, 2869, 2860, 2859, 2859, 2868, 2869,
+	2870, 2861, 2860, 2860, 2869, 2870, 2569, 2558, 2861, 2861, 2870, 2569, 2871, 2862, 2779, 2779, 2789, 2871, 2872, 2863, 2862, 2862, 2871, 2872,
+	2873, 2864, 2863, 2863, 2872, 2873, 2874, 2865, 2864, 2864, 2873, 2874, 2875, 2866, 2865, 2865, 2874, 2875, 2876, 2867, 2866, 2866, 2875, 2876,
+	2877, 2868, 2867, 2867, 2876, 2877, 2878, 2869, 2868, 2868, 2877, 2878, 2879, 2870, 2869, 2869, 2878, 2879, 2580, 2569, 2870, 2870, 2879, 2580,
+	2880, 2881, 2882, 2880, 2882, 2883, 2880, 2883, 2884, 2880, 2884, 2885, 2880, 2885, 2886, 2880, 2886, 2887, 2880, 2887, 2888, 2880, 2888, 2889,
+	2880, 2889, 2890, 2880, 2890, 2891, 2892, 2882, 2881, 2881, 2893, 2892, 2894, 2883, 2882, 2882, 2892, 2894, 2895, 2884, 2883, 2883, 2894, 2895,
+	2896, 2885, 2884, 2884, 2895, 2896, 2897, 2886, 2885, 2885, 2896, 2897, 2898, 2887, 2886, 2886, 2897, 2898, 2899, 2888, 2887, 2887, 2898, 2899,
+	2900, 2889, 2888, 2888, 2899, 2900, 2901, 2890, 2889, 2889, 2900, 2901, 2902, 2891, 2890, 2890, 2901, 2902, 2903, 2892, 2893, 2893, 2904, 2903,
+	2905, 2894, 2892, 2892, 2903, 2905, 2906, 2895, 2894, 2894, 2905, 2906, 2907, 2896, 2895, 2895, 2906, 2907, 2908, 2897, 2896, 2896, 2907, 2908,
+	2909, 2898, 2897, 2897, 2908, 2909, 2910, 2899, 2898, 2898, 2909, 2910, 2911, 2900, 2899, 2899, 2910, 2911, 2912, 2901, 2900, 2900, 2911, 2912,
+	2913, 2902, 2901, 2901, 2912, 2913, 2914, 2903, 2904, 2904, 2915, 2914, 2916, 2905, 2903, 2903, 2914, 2916, 2917, 2906, 2905, 2905, 2916, 2917,
+	2918, 2907, 2906, 2906, 2917, 2918, 2919, 2908, 2907, 2907, 2918, 2919, 2920, 2909, 2908, 2908, 2919, 2920, 2921, 2910, 2909, 2909, 2920, 2921,
+	2922, 2911, 2910, 2910, 2921, 2922, 2923, 2912, 2911, 2911, 2922, 2923, 2924, 2913, 2912, 2912, 2923, 2924, 2925, 2914, 2915, 2915, 2926, 2925,
+	2927, 2916, 2914, 2914, 2925, 2927, 2928, 2917, 2916, 2916, 2927, 2928, 2929, 2918, 2917, 2917, 2928, 2929, 2930, 2919, 2918, 2918, 2929, 2930,
+	2931, 2920, 2919, 2919, 2930, 2931, 2932, 2921, 2920, 2920, 2931, 2932, 2933, 2922, 2921, 2921, 2932, 2933, 2934, 2923, 2922, 2922, 2933, 2934,
+	2935, 2924, 2923, 2923, 2934, 2935, 2936, 2925, 2926, 2926, 2937, 2936, 2938, 2927, 2925, 2925, 2936, 2938, 2939, 2928, 2927, 2927, 2938, 2939,
+	2940, 2929, 2928, 2928, 2939, 2940, 2941, 2930, 2929, 2929, 2940, 2941, 2942, 2931, 2930, 2930, 2941, 2942, 2943, 2932, 2931, 2931, 2942, 2943,
+	2944, 2933, 2932, 2932, 2943, 2944, 2945, 2934, 2933, 2933, 2944, 2945, 2946, 2935, 2934, 2934, 2945, 2946, 2947, 2936, 2937, 2937, 2948, 2947,
+	2949, 2938, 2936, 2936, 2947, 2949, 2950, 2939, 2938, 2938, 2949, 2950, 2951, 2940, 2939, 2939, 2950, 2951, 2952, 2941, 2940, 2940, 2951, 2952,
+	2953, 2942, 2941, 2941, 2952, 2953, 2954, 2943, 2942, 2942, 2953, 2954, 2955, 2944, 2943, 2943, 2954, 2955, 2956, 2945, 2944, 2944, 2955, 2956,
+	2957, 2946, 2945, 2945, 2956, 2957, 2958, 2947, 2948, 2948, 2959, 2958, 2960, 2949, 2947, 2947, 2958, 2960, 2961, 2950, 2949, 2949, 2960, 2961,
+	2962, 2951, 2950, 2950, 2961, 2962, 2963, 2952, 2951, 2951, 2962, 2963, 2964, 2953, 2952, 2952, 2963, 2964, 2965, 2954, 2953, 2953, 2964, 2965,
+	2966, 2955, 2954, 2954, 2965, 2966, 2967, 2956, 2955, 2955, 2966, 2967, 2968, 2957, 2956, 2956, 2967, 2968, 2969, 2958, 2959, 2959, 2970, 2969,
+	2971, 2960, 2958, 2958, 2969, 2971, 2972, 2961, 2960, 2960, 2971, 2972, 2973, 2962, 2961, 2961, 2972, 2973, 2974, 2963, 2962, 2962, 2973, 2974,
+	2975, 2964, 2963, 2963, 2974, 2975, 2976, 2965, 2964, 2964, 2975, 2976, 2977, 2966, 2965, 2965, 2976, 2977, 2978, 2967, 2966, 2966, 2977, 2978,
+	2979, 2968, 2967, 2967, 2978, 2979, 1239, 2969, 2970, 2970, 940, 1239, 1238, 2971, 2969, 2969, 1239, 1238, 1237, 2972, 2971, 2971, 1238, 1237,
+	1236, 2973, 2972, 2972, 1237, 1236, 1235, 2974, 2973, 2973, 1236, 1235, 1234, 2975, 2974, 2974, 1235, 1234, 1233, 2976, 2975, 2975, 1234, 1233,
+	1232, 2977, 2976, 2976, 1233, 1232, 1231, 2978, 2977, 2977, 1232, 1231, 1149, 2979, 2978, 2978, 1231, 1149, 2880, 2891, 2980, 2880, 2980, 2981,
+	2880, 2981, 2982, 2880, 2982, 2983, 2880, 2983, 2984, 2880, 2984, 2985, 2880, 2985, 2986, 2880, 2986, 2987, 2880, 2987, 2988, 2880, 2988, 2989,
+	2990, 2980, 2891, 2891, 2902, 2990, 2991, 2981, 2980, 2980, 2990, 2991, 2992, 2982, 2981, 2981, 2991, 2992, 2993, 2983, 2982, 2982, 2992, 2993,
+	2994, 2984, 2983, 2983, 2993, 2994, 2995, 2985, 2984, 2984, 2994, 2995, 2996, 2986, 2985, 2985, 2995, 2996, 2997, 2987, 2986, 2986, 2996, 2997,
+	2998, 2988, 2987, 2987, 2997, 2998, 2999, 2989, 2988, 2988, 2998, 2999, 3000, 2990, 2902, 2902, 2913, 3000, 3001, 2991, 2990, 2990, 3000, 3001,
+	3002, 2992, 2991, 2991, 3001, 3002, 3003, 2993, 2992, 2992, 3002, 3003, 3004, 2994, 2993, 2993, 3003, 3004, 3005, 2995, 2994, 2994, 3004, 3005,
+	3006, 2996, 2995, 2995, 3005, 3006, 3007, 2997, 2996, 2996, 3006, 3007, 3008, 2998, 2997, 2997, 3007, 3008, 3009, 2999, 2998, 2998, 3008, 3009,
+	3010, 3000, 2913, 2913, 2924, 3010, 3011, 3001, 3000, 3000, 3010, 3011, 3012, 3002, 3001, 3001, 3011, 3012, 3013, 3003, 3002, 3002, 3012, 3013,
+	3014, 3004, 3003, 3003, 3013, 3014, 3015, 3005, 3004, 3004, 3014, 3015, 3016, 3006, 3005, 3005, 3015, 3016, 3017, 3007, 3006, 3006, 3016, 3017,
+	3018, 3008, 3007, 3007, 3017, 3018, 3019, 3009, 3008, 3008, 3018, 3019, 3020, 3010, 2924, 2924, 2935, 3020, 3021, 3011, 3010, 3010, 3020, 3021,
+	3022, 3012, 3011, 3011, 3021, 3022, 3023, 3013, 3012, 3012, 3022, 3023, 3024, 3014, 3013, 3013, 3023, 3024, 3025, 3015, 3014, 3014, 3024, 3025,
+	3026, 3016, 3015, 3015, 3025, 3026, 3027, 3017, 3016, 3016, 3026, 3027, 3028, 3018, 3017, 3017, 3027, 3028, 3029, 3019, 3018, 3018, 3028, 3029,
+	3030, 3020, 2935, 2935, 2946, 3030, 3031, 3021, 3020, 3020, 3030, 3031, 3032, 3022, 3021, 3021, 3031, 3032, 3033, 3023, 3022, 3022, 3032, 3033,
+	3034, 3024, 3023, 3023, 3033, 3034, 3035, 3025, 3024, 3024, 3034, 3035, 3036, 3026, 3025, 3025, 3035, 3036, 3037, 3027, 3026, 3026, 3036, 3037,
+	3038, 3028, 3027, 3027, 3037, 3038, 3039, 3029, 3028, 3028, 3038, 3039, 3040, 3030, 2946, 2946, 2957, 3040, 3041, 3031, 3030, 3030, 3040, 3041,
+	3042, 3032, 3031, 3031, 3041, 3042, 3043, 3033, 3032, 3032, 3042, 3043, 3044, 3034, 3033, 3033, 3043, 3044, 3045, 3035, 3034, 3034, 3044, 3045,
+	3046, 3036, 3035, 3035, 3045, 3046, 3047, 3037, 3036, 3036, 3046, 3047, 3048, 3038, 3037, 3037, 3047, 3048, 3049, 3039, 3038, 3038, 3048, 3049,
+	3050, 3040, 2957, 2957, 2968, 3050, 3051, 3041, 3040, 3040, 3050, 3051, 3052, 3042, 3041, 3041, 3051, 3052, 3053, 3043, 3042, 3042, 3052, 3053,
+	3054, 3044, 3043, 3043, 3053, 3054, 3055, 3045, 3044, 3044, 3054, 3055, 3056, 3046, 3045, 3045, 3055, 3056, 3057, 3047, 3046, 3046, 3056, 3057,
+	3058, 3048, 3047, 3047, 3057, 3058, 3059, 3049, 3048, 3048, 3058, 3059, 3060, 3050, 2968, 2968, 2979, 3060, 3061, 3051, 3050, 3050, 3060, 3061,
+	3062, 3052, 3051, 3051, 3061, 3062, 3063, 3053, 3052, 3052, 3062, 3063, 3064, 3054, 3053, 3053, 3063, 3064, 3065, 3055, 3054, 3054, 3064, 3065,
+	3066, 3056, 3055, 3055, 3065, 3066, 3067, 3057, 3056, 3056, 3066, 3067, 3068, 3058, 3057, 3057, 3067, 3068, 3069, 3059, 3058, 3058, 3068, 3069,
+	1148, 3060, 2979, 2979, 1149, 1148, 1147, 3061, 3060, 3060, 1148, 1147, 1146, 3062, 3061, 3061, 1147, 1146, 1145, 3063, 3062, 3062, 1146, 1145,
+	1144, 3064, 3063, 3063, 1145, 1144, 1143, 3065, 3064, 3064, 1144, 1143, 1142, 3066, 3065, 3065, 1143, 1142, 1141, 3067, 3066, 3066, 1142, 1141,
+	1140, 3068, 3067, 3067, 1141, 1140, 1049, 3069, 3068, 3068, 1140, 1049, 2880, 2989, 3070, 2880, 3070, 3071, 2880, 3071, 3072, 2880, 3072, 3073,
+	2880, 3073, 3074, 2880, 3074, 3075, 2880, 3075, 3076, 2880, 3076, 3077, 2880, 3077, 3078, 2880, 3078, 3079, 3080, 3070, 2989, 2989, 2999, 3080,
+	3081, 3071, 3070, 3070, 3080, 3081, 3082, 3072, 3071, 3071, 3081, 3082, 3083, 3073, 3072, 3072, 3082, 3083, 3084, 3074, 3073, 3073, 3083, 3084,
+	3085, 3075, 3074, 3074, 3084, 3085, 3086, 3076, 3075, 3075, 3085, 3086, 3087, 3077, 3076, 3076, 3086, 3087, 3088, 3078, 3077, 3077, 3087, 3088,
+	3089, 3079, 3078, 3078, 3088, 3089, 3090, 3080, 2999, 2999, 3009, 3090, 3091, 3081, 3080, 3080, 3090, 3091, 3092, 3082, 3081, 3081, 3091, 3092,
+	3093, 3083, 3082, 3082, 3092, 3093, 3094, 3084, 3083, 3083, 3093, 3094, 3095, 3085, 3084, 3084, 3094, 3095, 3096, 3086, 3085, 3085, 3095, 3096,
+	3097, 3087, 3086, 3086, 3096, 3097, 3098, 3088, 3087, 3087, 3097, 3098, 3099, 3089, 3088, 3088, 3098, 3099, 3100, 3090, 3009, 3009, 3019, 3100,
+	3101, 3091, 3090, 3090, 3100, 3101, 3102, 3092, 3091, 3091, 3101, 3102, 3103, 3093, 3092, 3092, 3102, 3103, 3104, 3094, 3093, 3093, 3103, 3104,
+	3105, 3095, 3094, 3094, 3104, 3105, 3106, 3096, 3095, 3095, 3105, 3106, 3107, 3097, 3096, 3096, 3106, 3107, 3108, 3098, 3097, 3097, 3107, 3108,
+	3109, 3099, 3098, 3098, 3108, 3109, 3110, 3100, 3019, 3019, 3029, 3110, 3111, 3101, 3100, 3100, 3110, 3111, 3112, 3102, 3101, 3101, 3111, 3112,
+	3113, 3103, 3102, 3102, 3112, 3113, 3114, 3104, 3103, 3103, 3113, 3114, 3115, 3105, 3104, 3104, 3114, 3115, 3116, 3106, 3105, 3105, 3115, 3116,
+	3117, 3107, 3106, 3106, 3116, 3117, 3118, 3108, 3107, 3107, 3117, 3118, 3119, 3109, 3108, 3108, 3118, 3119, 3120, 3110, 3029, 3029, 3039, 3120,
+	3121, 3111, 3110, 3110, 3120, 3121, 3122, 3112, 3111, 3111, 3121, 3122, 3123, 3113, 3112, 3112, 3122, 3123, 3124, 3114, 3113, 3113, 3123, 3124,
+	3125, 3115, 3114, 3114, 3124, 3125, 3126, 3116, 3115, 3115, 3125, 3126, 3127, 3117, 3116, 3116, 3126, 3127, 3128, 3118, 3117, 3117, 3127, 3128,
+	3129, 3119, 3118, 3118, 3128, 3129, 3130, 3120, 3039, 3039, 3049, 3130, 3131, 3121, 3120, 3120, 3130, 3131, 3132, 3122, 3121, 3121, 3131, 3132,
+	3133, 3123, 3122, 3122, 3132, 3133, 3134, 3124, 3123, 3123, 3133, 3134, 3135, 3125, 3124, 3124, 3134, 3135, 3136, 3126, 3125, 3125, 3135, 3136,
+	3137, 3127, 3126, 3126, 3136, 3137, 3138, 3128, 3127, 3127, 3137, 3138, 3139, 3129, 3128, 3128, 3138, 3139, 3140, 3130, 3049, 3049, 3059, 3140,
+	3141, 3131, 3130, 3130, 3140, 3141, 3142, 3132, 3131, 3131, 3141, 3142, 3143, 3133, 3132, 3132, 3142, 3143, 3144, 3134, 3133, 3133, 3143, 3144,
+	3145, 3135, 3134, 3134, 3144, 3145, 3146, 3136, 3135, 3135, 3145, 3146, 3147, 3137, 3136, 3136, 3146, 3147, 3148, 3138, 3137, 3137, 3147, 3148,
+	3149, 3139, 3138, 3138, 3148, 3149, 3150, 3140, 3059, 3059, 3069, 3150, 3151, 3141, 3140, 3140, 3150, 3151, 3152, 3142, 3141, 3141, 3151, 3152,
+	3153, 3143, 3142, 3142, 3152, 3153, 3154, 3144, 3143, 3143, 3153, 3154, 3155, 3145, 3144, 3144, 3154, 3155, 3156, 3146, 3145, 3145, 3155, 3156,
+	3157, 3147, 3146, 3146, 3156, 3157, 3158, 3148, 3147, 3147, 3157, 3158, 3159, 3149, 3148, 3148, 3158, 3159, 1048, 3150, 3069, 3069, 1049, 1048,
+	1047, 3151, 3150, 3150, 1048, 1047, 1046, 3152, 3151, 3151, 1047, 1046, 1045, 3153, 3152, 3152, 1046, 1045, 1044, 3154, 3153, 3153, 1045, 1044,
+	1043, 3155, 3154, 3154, 1044, 1043, 1042, 3156, 3155, 3155, 1043, 1042, 1041, 3157, 3156, 3156, 1042, 1041, 1040, 3158, 3157, 3157, 1041, 1040,
+	949, 3159, 3158, 3158, 1040, 949, 2880, 3079, 3160, 2880, 3160, 3161, 2880, 3161, 3162, 2880, 3162, 3163, 2880, 3163, 3164, 2880, 3164, 3165,
+	2880, 3165, 3166, 2880, 3166, 3167, 2880, 3167, 3168, 2880, 3168, 2881, 3169, 3160, 3079, 3079, 3089, 3169, 3170, 3161, 3160, 3160, 3169, 3170,
+	3171, 3162, 3161, 3161, 3170, 3171, 3172, 3163, 3162, 3162, 3171, 3172, 3173, 3164, 3163, 3163, 3172, 3173, 3174, 3165, 3164, 3164, 3173, 3174,
+	3175, 3166, 3165, 3165, 3174, 3175, 3176, 3167, 3166, 3166, 3175, 3176, 3177, 3168, 3167, 3167, 3176, 3177, 2893, 2881, 3168, 3168, 3177, 2893,
+	3178, 3169, 3089, 3089, 3099, 3178, 3179, 3170, 3169, 3169, 3178, 3179, 3180, 3171, 3170, 3170, 3179, 3180, 3181, 3172, 3171, 3171, 3180, 3181,
+	3182, 3173, 3172, 3172, 3181, 3182, 3183, 3174, 3173, 3173, 3182, 3183, 3184, 3175, 3174, 3174, 3183, 3184, 3185, 3176, 3175, 3175, 3184, 3185,
+	3186, 3177, 3176, 3176, 3185, 3186, 2904, 2893, 3177, 3177, 3186, 2904, 3187, 3178, 3099, 3099, 3109, 3187, 3188, 3179, 3178, 3178, 3187, 3188,
+	3189, 3180, 3179, 3179, 3188, 3189, 3190, 3181, 3180, 3180, 3189, 3190, 3191, 3182, 3181, 3181, 3190, 3191, 3192, 3183, 3182, 3182, 3191, 3192,
+	3193, 3184, 3183, 3183, 3192, 3193, 3194, 3185, 3184, 3184, 3193, 3194, 3195, 3186, 3185, 3185, 3194, 3195, 2915, 2904, 3186, 3186, 3195, 2915,
+	3196, 3187, 3109, 3109, 3119, 3196, 3197, 3188, 3187, 3187, 3196, 3197, 3198, 3189, 3188, 3188, 3197, 3198, 3199, 3190, 3189, 3189, 3198, 3199,
+	3200, 3191, 3190, 3190, 3199, 3200, 3201, 3192, 3191, 3191, 3200, 3201, 3202, 3193, 3192, 3192, 3201, 3202, 3203, 3194, 3193, 3193, 3202, 3203,
+	3204, 3195, 3194, 3194, 3203, 3204, 2926, 2915, 3195, 3195, 3204, 2926, 3205, 3196, 3119, 3119, 3129, 3205, 3206, 3197, 3196, 3196, 3205, 3206,
+	3207, 3198, 3197, 3197, 3206, 3207, 3208, 3199, 3198, 3198, 3207, 3208, 3209, 3200, 3199, 3199, 3208, 3209, 3210, 3201, 3200, 3200, 3209, 3210,
+	3211, 3202, 3201, 3201, 3210, 3211, 3212, 3203, 3202, 3202, 3211, 3212, 3213, 3204, 3203, 3203, 3212, 3213, 2937, 2926, 3204, 3204, 3213, 2937,
+	3214, 3205, 3129, 3129, 3139, 3214, 3215, 3206, 3205, 3205, 3214, 3215, 3216, 3207, 3206, 3206, 3215, 3216, 3217, 3208, 3207, 3207, 3216, 3217,
+	3218, 3209, 3208, 3208, 3217, 3218, 3219, 3210, 3209, 3209, 3218, 3219, 3220, 3211, 3210, 3210, 3219, 3220, 3221, 3212, 3211, 3211, 3220, 3221,
+	3222, 3213, 3212, 3212, 3221, 3222, 2948, 2937, 3213, 3213, 3222, 2948, 3223, 3214, 3139, 3139, 3149, 3223, 3224, 3215, 3214, 3214, 3223, 3224,
+	3225, 3216, 3215, 3215, 3224, 3225, 3226, 3217, 3216, 3216, 3225, 3226, 3227, 3218, 3217, 3217, 3226, 3227, 3228, 3219, 3218, 3218, 3227, 3228,
+	3229, 3220, 3219, 3219, 3228, 3229, 3230, 3221, 3220, 3220, 3229, 3230, 3231, 3222, 3221, 3221, 3230, 3231, 2959, 2948, 3222, 3222, 3231, 2959,
+	3232, 3223, 3149, 3149, 3159, 3232, 3233, 3224, 3223, 3223, 3232, 3233, 3234, 3225, 3224, 3224, 3233, 3234, 3235, 3226, 3225, 3225, 3234, 3235,
+	3236, 3227, 3226, 3226, 3235, 3236, 3237, 3228, 3227, 3227, 3236, 3237, 3238, 3229, 3228, 3228, 3237, 3238, 3239, 3230, 3229, 3229, 3238, 3239,
+	3240, 3231, 3230, 3230, 3239, 3240, 2970, 2959, 3231, 3231, 3240, 2970, 948, 3232, 3159, 3159, 949, 948, 947, 3233, 3232, 3232, 948, 947,
+	946, 3234, 3233, 3233, 947, 946, 945, 3235, 3234, 3234, 946, 945, 944, 3236, 3235, 3235, 945, 944, 943, 3237, 3236, 3236, 944, 943,
+	942, 3238, 3237, 3237, 943, 942, 941, 3239, 3238, 3238, 942, 941, 939, 3240, 3239, 3239, 941, 939, 940, 2970, 3240, 3240, 939, 940
+};
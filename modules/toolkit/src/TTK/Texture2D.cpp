@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include "Logging.h"
+#include "PixelUploadRing.h"
 
 namespace TTK {
 	Texture2D::Texture2D() :
@@ -119,11 +120,10 @@ namespace TTK {
 		if (newDataPtr == nullptr)
 			return;
 
-		glBindTexture(m_Target, m_TexID);
-
-		if (newDataPtr != nullptr)
-			glTexSubImage2D(m_Target, 0, 0, 0, m_TexWidth, m_TexHeight, m_TextureFormat, m_DataType, newDataPtr);
-
-		glBindTexture(m_Target, 0);
+		// Going through the upload ring means the driver doesn't have to copy our data before this returns. We fence
+		// right away, since TTK doesn't have a good place to do it once per frame
+		PixelUploadRing& ring = PixelUploadRing::Global();
+		ring.Upload2D(m_TexID, 0, 0, 0, m_TexWidth, m_TexHeight, m_TextureFormat, m_DataType, newDataPtr);
+		ring.Submit();
 	}
 }
@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK texture atlas
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "TTK/TextureAtlas.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stb_image.h>
+#include "Logging.h"
+
+TTK::TextureAtlas::TextureAtlas(int pageSize, int padding) :
+	m_Packer(pageSize, padding)
+{ }
+
+TTK::TextureAtlas::~TextureAtlas() {
+	if (!m_Pages.empty())
+		glDeleteTextures((GLsizei)m_Pages.size(), m_Pages.data());
+}
+
+int TTK::TextureAtlas::Add(const std::string& fileName) {
+	// Sheets are often shared between sprites, so only pack them once
+	int existing = Find(fileName);
+	if (existing != -1)
+		return existing;
+
+	int width, height, numChannels;
+	uint8_t* data = stbi_load(fileName.c_str(), &width, &height, &numChannels, 4);
+	if (data == nullptr) {
+		LOG_ERROR("Failed to load \"{}\" into texture atlas ({})", fileName, stbi_failure_reason());
+		return -1;
+	}
+	int result = Add(fileName, data, width, height);
+	stbi_image_free(data);
+	return result;
+}
+
+int TTK::TextureAtlas::Add(const std::string& name, const uint8_t* rgba, int width, int height) {
+	if (width <= 0 || height <= 0) {
+		LOG_ERROR("Cannot add \"{}\" to texture atlas, it is empty ({}x{})", name, width, height);
+		return -1;
+	}
+
+	Region region;
+	region.Texture = 0;
+	region.Page    = -1;
+	region.X       = 0;
+	region.Y       = 0;
+	region.Width   = width;
+	region.Height  = height;
+	region.UVRect  = glm::vec4(0.0f);
+
+	int index = (int)m_Regions.size();
+	m_Regions.push_back(region);
+	m_PackerIndices.push_back(m_Packer.Add(rgba, width, height));
+	m_Names[name] = index;
+	return index;
+}
+
+void TTK::TextureAtlas::Build() {
+	int numFailed = m_Packer.Pack();
+	if (numFailed > 0)
+		LOG_WARN("{} images are too big to fit in a {}x{} texture atlas page, they will not be drawn", numFailed, m_Packer.GetPageSize(), m_Packer.GetPageSize());
+
+	// Only the pages that were just packed need uploading, the older ones were released after their upload
+	for (int page = (int)m_PackerPages.size(); page < m_Packer.GetPageCount(); page++)
+		m_PackerPages.push_back(__UploadPage(m_Packer.GetPagePixels(page).data(), m_Packer.GetPageSize(), m_Packer.GetPageSize()));
+	m_Packer.ReleasePages();
+
+	const std::vector<AtlasPacker::Placement>& placements = m_Packer.GetPlacements();
+	for (size_t ix = 0; ix < m_Regions.size(); ix++) {
+		Region& region = m_Regions[ix];
+		if (region.Texture != 0 || m_PackerIndices[ix] == -1)
+			continue;
+		const AtlasPacker::Placement& placement = placements[m_PackerIndices[ix]];
+		if (placement.Page == -1)
+			continue;
+		region.Page = m_PackerPages[placement.Page];
+		region.X    = placement.X;
+		region.Y    = placement.Y;
+		__UpdateRegion(region);
+	}
+}
+
+bool TTK::TextureAtlas::LoadFromFile(const std::string& layoutPath) {
+	std::ifstream file(layoutPath);
+	if (!file) {
+		LOG_ERROR("Failed to open texture atlas \"{}\"", layoutPath);
+		return false;
+	}
+	std::filesystem::path folder = std::filesystem::path(layoutPath).parent_path();
+
+	// The page indices in the file, mapped to our own
+	std::vector<int> pages;
+	std::string line;
+	while (std::getline(file, line)) {
+		std::istringstream stream(line);
+		std::string type;
+		stream >> type;
+		if (type == "page") {
+			int width, height;
+			std::string pageFile;
+			stream >> width >> height;
+			std::getline(stream >> std::ws, pageFile);
+
+			std::string pagePath = (folder / pageFile).string();
+			int imageWidth, imageHeight, numChannels;
+			uint8_t* data = stbi_load(pagePath.c_str(), &imageWidth, &imageHeight, &numChannels, 4);
+			if (data == nullptr || imageWidth != width || imageHeight != height) {
+				LOG_ERROR("Failed to load texture atlas page \"{}\"", pagePath);
+				stbi_image_free(data);
+				return false;
+			}
+			pages.push_back(__UploadPage(data, width, height));
+			stbi_image_free(data);
+		}
+		else if (type == "region") {
+			Region region;
+			int page;
+			std::string name;
+			stream >> page >> region.X >> region.Y >> region.Width >> region.Height;
+			std::getline(stream >> std::ws, name);
+			if (stream.fail() || page < 0 || page >= (int)pages.size()) {
+				LOG_ERROR("Bad region \"{}\" in texture atlas \"{}\"", line, layoutPath);
+				return false;
+			}
+			region.Page = pages[page];
+			__UpdateRegion(region);
+
+			m_Names[name] = (int)m_Regions.size();
+			m_Regions.push_back(region);
+			m_PackerIndices.push_back(-1);
+		}
+		// Anything else (like blank lines and comments) is ignored
+	}
+	return true;
+}
+
+int TTK::TextureAtlas::Find(const std::string& name) const {
+	auto it = m_Names.find(name);
+	return it == m_Names.end() ? -1 : it->second;
+}
+
+glm::vec4 TTK::TextureAtlas::Remap(int region, const glm::vec4& uvRect) const {
+	const glm::vec4& bounds = m_Regions[region].UVRect;
+	glm::vec2 size = glm::vec2(bounds.z - bounds.x, bounds.w - bounds.y);
+	return glm::vec4(
+		bounds.x + uvRect.x * size.x, bounds.y + uvRect.y * size.y,
+		bounds.x + uvRect.z * size.x, bounds.y + uvRect.w * size.y);
+}
+
+int TTK::TextureAtlas::__UploadPage(const uint8_t* pixels, int width, int height) {
+	GLuint texture;
+	glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTextureStorage2D(texture, 1, GL_RGBA8, width, height);
+	glTextureSubImage2D(texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+	m_Pages.push_back(texture);
+	m_PageSizes.push_back(glm::ivec2(width, height));
+	return (int)m_Pages.size() - 1;
+}
+
+void TTK::TextureAtlas::__UpdateRegion(Region& region) {
+	glm::vec2 pageSize = glm::vec2(m_PageSizes[region.Page]);
+	region.Texture = m_Pages[region.Page];
+	region.UVRect  = glm::vec4(
+		region.X / pageSize.x, region.Y / pageSize.y,
+		(region.X + region.Width) / pageSize.x, (region.Y + region.Height) / pageSize.y);
+}
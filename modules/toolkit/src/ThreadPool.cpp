@@ -0,0 +1,108 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t numThreads) :
+	myActiveCount(0),
+	isStopping(false)
+{
+	if (numThreads == 0) {
+		// hardware_concurrency is allowed to return 0 if it doesn't know
+		size_t hardware = std::thread::hardware_concurrency();
+		numThreads = hardware > 1 ? hardware - 1 : 1;
+	}
+	myThreads.reserve(numThreads);
+	for (size_t ix = 0; ix < numThreads; ix++) {
+		myThreads.emplace_back(&ThreadPool::__WorkerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(myLock);
+		isStopping = true;
+	}
+	myWakeCondition.notify_all();
+	for (std::thread& thread : myThreads)
+		thread.join();
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& func, size_t grainSize) {
+	if (count == 0)
+		return;
+	grainSize = std::max(grainSize, (size_t)1);
+
+	// Every thread (including us) grabs the next batch of indices until we run out
+	struct Shared {
+		std::atomic<size_t>     Next{ 0 };
+		std::atomic<size_t>     Running{ 0 };
+		std::mutex              Lock;
+		std::condition_variable Done;
+	};
+	std::shared_ptr<Shared> shared = std::make_shared<Shared>();
+	auto worker = [shared, count, grainSize, &func]() {
+		for (size_t start = shared->Next.fetch_add(grainSize); start < count; start = shared->Next.fetch_add(grainSize)) {
+			size_t end = std::min(start + grainSize, count);
+			for (size_t ix = start; ix < end; ix++)
+				func(ix);
+		}
+		if (shared->Running.fetch_sub(1) == 1) {
+			std::lock_guard<std::mutex> lock(shared->Lock);
+			shared->Done.notify_all();
+		}
+	};
+
+	// No point waking more threads than we have batches for
+	size_t batches = (count + grainSize - 1) / grainSize;
+	size_t helpers = std::min(myThreads.size(), batches - 1);
+	shared->Running = helpers + 1;
+	for (size_t ix = 0; ix < helpers; ix++)
+		__Push(worker);
+	worker();
+
+	// Our helpers may still be finishing their last batch
+	std::unique_lock<std::mutex> lock(shared->Lock);
+	shared->Done.wait(lock, [&]() { return shared->Running.load() == 0; });
+}
+
+void ThreadPool::Wait() {
+	std::unique_lock<std::mutex> lock(myLock);
+	myIdleCondition.wait(lock, [this]() { return myQueue.empty() && myActiveCount == 0; });
+}
+
+ThreadPool& ThreadPool::Global() {
+	static ThreadPool pool;
+	return pool;
+}
+
+void ThreadPool::__Push(std::function<void()>&& task) {
+	{
+		std::lock_guard<std::mutex> lock(myLock);
+		myQueue.push_back(std::move(task));
+	}
+	myWakeCondition.notify_one();
+}
+
+void ThreadPool::__WorkerLoop() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(myLock);
+			myWakeCondition.wait(lock, [this]() { return isStopping || !myQueue.empty(); });
+			if (isStopping && myQueue.empty())
+				return;
+			task = std::move(myQueue.front());
+			myQueue.pop_front();
+			myActiveCount++;
+		}
+
+		task();
+
+		{
+			std::lock_guard<std::mutex> lock(myLock);
+			myActiveCount--;
+			if (myQueue.empty() && myActiveCount == 0)
+				myIdleCondition.notify_all();
+		}
+	}
+}
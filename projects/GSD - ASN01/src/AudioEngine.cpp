@@ -1,6 +1,7 @@
 // Code edited from: https://codyclaborn.me/tutorials/making-a-basic-fmod-audio-engine-in-c/
 
 #include "AudioEngine.h"
+#include "FrameArena.h"
 
 Implementation::Implementation()
 {
@@ -20,7 +21,9 @@ Implementation::~Implementation()
 
 void Implementation::Update()
 {
-	std::vector<ChannelMap::iterator> pStoppedChannels;
+	// This only lives for the update, so we keep it in the frame arena instead of the heap
+	FrameVector<ChannelMap::iterator> pStoppedChannels;
+	pStoppedChannels.reserve(mChannels.size());
 	for (auto it = mChannels.begin(), itEnd = mChannels.end(); it != itEnd; ++it)
 	{
 		bool bIsPlaying = false;
@@ -188,15 +188,22 @@ int main() {
 
 	TTK::Graphics::InitImGUI(window);
 
+	// All of our sprites are packed into one atlas, so the sprite batch can draw them without switching textures
+	TTK::TextureAtlas spriteAtlas(1024);
+	int marioRegion = spriteAtlas.Add("mario.png");
+	int yoshiRegion = spriteAtlas.Add("yoshi.png");
+	int axesRegion = spriteAtlas.Add("GSD - ASN01 - XYZ Axes.png");
+	spriteAtlas.Build();
+
 	TTK::SpriteSheetQuad mario;
-	mario.SliceSpriteSheet("mario.png", 1, 1, 0.5f);
+	mario.SliceSpriteSheet(spriteAtlas, marioRegion, 1, 1, 0.5f);
 	TTK::SpriteSheetQuad yoshi;
-	yoshi.SliceSpriteSheet("yoshi.png", 1, 1, 0.5f);
+	yoshi.SliceSpriteSheet(spriteAtlas, yoshiRegion, 1, 1, 0.5f);
 	TTK::SpriteSheetQuad* currentSprite = &mario;
 	
 	// the axes, which is getting drawn to the screen.
 	TTK::SpriteSheetQuad* axes = new TTK::SpriteSheetQuad();
-	axes->SliceSpriteSheet("GSD - ASN01 - XYZ Axes.png", 1, 1, 0.5f);
+	axes->SliceSpriteSheet(spriteAtlas, axesRegion, 1, 1, 0.5f);
 
 	float lastFrame = glfwGetTime();
 	
@@ -0,0 +1,113 @@
+#include "Benchmark.h"
+#include "Logging.h"
+
+#include <algorithm>
+
+BenchmarkRunner::BenchmarkRunner(GLFWwindow* window, int warmupFrames, int frames) :
+	myWindow(window),
+	myWarmupFrames(warmupFrames),
+	myFrames(frames)
+{ }
+
+void BenchmarkRunner::Run() {
+	glfwSwapInterval(0);
+
+	for (const Benchmark& benchmark : myBenchmarks) {
+		if (glfwWindowShouldClose(myWindow))
+			break;
+		LOG_INFO("Running {}...", benchmark.Name);
+		glfwSetWindowTitle(myWindow, benchmark.Name.c_str());
+
+		if (benchmark.Setup)
+			benchmark.Setup();
+
+		BenchmarkResult result;
+		result.Name = benchmark.Name;
+		double totalFrameMs = 0.0, totalWorkMs = 0.0;
+		for (int frame = 0; frame < myWarmupFrames + myFrames && !glfwWindowShouldClose(myWindow); frame++) {
+			auto start = std::chrono::high_resolution_clock::now();
+			glfwPollEvents();
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			double workMs = benchmark.Frame();
+			glfwSwapBuffers(myWindow);
+			double frameMs = ElapsedMs(start);
+
+			if (frame >= myWarmupFrames) {
+				result.Frames++;
+				totalFrameMs += frameMs;
+				totalWorkMs  += workMs;
+				result.WorstFrameMs = std::max(result.WorstFrameMs, frameMs);
+			}
+		}
+		// Make sure the GPU is done with everything before the next benchmark starts
+		glFinish();
+
+		if (benchmark.Teardown)
+			benchmark.Teardown();
+
+		if (result.Frames > 0) {
+			result.AvgFrameMs = totalFrameMs / result.Frames;
+			result.AvgWorkMs  = totalWorkMs / result.Frames;
+		}
+		myResults.push_back(result);
+	}
+}
+
+void BenchmarkRunner::PrintResults() const {
+	LOG_INFO("{:<48} {:>8} {:>12} {:>12} {:>12}", "Benchmark", "Frames", "Frame (ms)", "Worst (ms)", "Work (ms)");
+	for (const BenchmarkResult& result : myResults) {
+		LOG_INFO("{:<48} {:>8} {:>12.3f} {:>12.3f} {:>12.3f}", result.Name, result.Frames, result.AvgFrameMs, result.WorstFrameMs, result.AvgWorkMs);
+	}
+}
+
+void DrawTexturedRect(GLuint texture, const glm::vec4& rect) {
+	static GLuint program = 0;
+	static GLuint vao = 0;
+	if (program == 0) {
+		// We build the quad's corners from the vertex ID, so we don't need any vertex buffers
+		const char* vsSource = R"(
+			#version 450
+			uniform vec4 a_Rect;
+			layout (location = 0) out vec2 outUV;
+			void main() {
+				vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+				outUV = vec2(corner.x, 1.0 - corner.y);
+				gl_Position = vec4(mix(a_Rect.xy, a_Rect.zw, corner), 0.0, 1.0);
+			})";
+		const char* fsSource = R"(
+			#version 450
+			layout (location = 0) in vec2 inUV;
+			layout (location = 0) out vec4 outColor;
+			layout (binding = 0) uniform sampler2D s_Texture;
+			void main() {
+				outColor = texture(s_Texture, inUV);
+			})";
+		GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+		glShaderSource(vs, 1, &vsSource, nullptr);
+		glCompileShader(vs);
+		GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+		glShaderSource(fs, 1, &fsSource, nullptr);
+		glCompileShader(fs);
+		program = glCreateProgram();
+		glAttachShader(program, vs);
+		glAttachShader(program, fs);
+		glLinkProgram(program);
+		glDetachShader(program, vs);
+		glDetachShader(program, fs);
+		glDeleteShader(vs);
+		glDeleteShader(fs);
+
+		GLint linked = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linked);
+		LOG_ASSERT(linked == GL_TRUE, "Failed to build the benchmark's blit shader");
+
+		glCreateVertexArrays(1, &vao);
+	}
+
+	glUseProgram(program);
+	glUniform4fv(glGetUniformLocation(program, "a_Rect"), 1, &rect[0]);
+	glBindTextureUnit(0, texture);
+	glBindVertexArray(vao);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glBindVertexArray(0);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <GLM/glm.hpp>
+
+// The timings from running a single benchmark
+struct BenchmarkResult {
+	std::string Name;
+	int         Frames       = 0;
+	// The average and worst wall clock time for a whole frame, including the swap
+	double      AvgFrameMs   = 0.0;
+	double      WorstFrameMs = 0.0;
+	// The average CPU time spent in the part of the frame the benchmark is measuring
+	double      AvgWorkMs    = 0.0;
+};
+
+/*
+ * A single benchmark scenario. Setup is called once before the first frame, Frame is called every frame and
+ * returns how long the part of the frame we care about took on the CPU (in ms), and Teardown cleans up
+ */
+struct Benchmark {
+	std::string             Name;
+	std::function<void()>   Setup;
+	std::function<double()> Frame;
+	std::function<void()>   Teardown;
+};
+
+/*
+ * Runs a list of benchmarks one after the other in the same window, with vsync off so that we measure how
+ * long a frame actually takes rather than how long we waited for the display
+ */
+class BenchmarkRunner {
+public:
+	/*
+	 * @param window       The window to render to, it's context must be current
+	 * @param warmupFrames The number of frames to run each benchmark before we start timing it
+	 * @param frames       The number of frames to time each benchmark for
+	 */
+	BenchmarkRunner(GLFWwindow* window, int warmupFrames, int frames);
+
+	void Add(const Benchmark& benchmark) { myBenchmarks.push_back(benchmark); }
+
+	// Runs every benchmark in the order they were added, stopping early if the window is closed
+	void Run();
+	// Logs a table of all the results
+	void PrintResults() const;
+
+	const std::vector<BenchmarkResult>& GetResults() const { return myResults; }
+
+private:
+	GLFWwindow*                  myWindow;
+	int                          myWarmupFrames;
+	int                          myFrames;
+	std::vector<Benchmark>       myBenchmarks;
+	std::vector<BenchmarkResult> myResults;
+};
+
+// Gets the number of milliseconds since the given time
+inline double ElapsedMs(std::chrono::high_resolution_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+/*
+ * Draws a texture to a rectangle on the screen, so that the GPU actually has to use whatever we uploaded to it
+ * @param texture The GL handle of the 2D texture to draw
+ * @param rect    The rectangle to draw to, as min x, min y, max x, max y in normalized device coordinates
+ */
+void DrawTexturedRect(GLuint texture, const glm::vec4& rect = glm::vec4(-1.0f, -1.0f, 1.0f, 1.0f));
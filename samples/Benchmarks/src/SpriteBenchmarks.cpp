@@ -0,0 +1,165 @@
+#include "SpriteBenchmarks.h"
+#include "Logging.h"
+#include "TTK/SpriteAnimator.h"
+#include "TTK/SpriteBatch.h"
+#include "TTK/SpriteSheetQuad.h"
+#include "TTK/TextureAtlas.h"
+
+#include <GLM/gtc/matrix_transform.hpp>
+#include <cmath>
+#include <memory>
+#include <random>
+
+const int   SpriteCount     = 100000;
+const int   SheetFrames     = 8;
+const int   SheetFrameSize  = 32;
+const float SheetAnimTime   = 0.5f;
+// We step by a fixed amount so that every run animates the same way
+const float SpriteDeltaTime = 1.0f / 60.0f;
+
+// How a benchmark animates it's sprites
+enum class AnimationPath {
+	// A SpriteSheetQuad for every sprite
+	Quads,
+	// A single SpriteAnimator for all of the sprites
+	Animator
+};
+
+// Makes an atlas with a single sprite sheet in it, each frame is a ring that grows as the animation plays
+static std::unique_ptr<TTK::TextureAtlas> CreateSheetAtlas(int& region) {
+	const int width = SheetFrames * SheetFrameSize;
+	std::vector<uint8_t> pixels((size_t)width * SheetFrameSize * 4);
+	for (int y = 0; y < SheetFrameSize; y++) {
+		for (int x = 0; x < width; x++) {
+			int frame = x / SheetFrameSize;
+			glm::vec2 offset = glm::vec2(x % SheetFrameSize, y) - glm::vec2(SheetFrameSize * 0.5f);
+			float radius = 4.0f + frame * 1.5f;
+			bool inRing = std::abs(glm::length(offset) - radius) < 2.0f;
+			uint8_t* pixel = &pixels[((size_t)y * width + x) * 4];
+			pixel[0] = (uint8_t)(64 + frame * 24);
+			pixel[1] = (uint8_t)(255 - frame * 24);
+			pixel[2] = 160;
+			pixel[3] = inRing ? 255 : 0;
+		}
+	}
+	std::unique_ptr<TTK::TextureAtlas> result = std::make_unique<TTK::TextureAtlas>(256);
+	region = result->Add("ring", pixels.data(), width, SheetFrameSize);
+	result->Build();
+	return result;
+}
+
+static Benchmark MakeSpriteBenchmark(const std::string& name, AnimationPath path) {
+	struct State {
+		std::unique_ptr<TTK::TextureAtlas>   Atlas;
+		std::vector<TTK::SpriteSheetQuad>    Quads;
+		std::vector<glm::mat4>               Transforms;
+		std::unique_ptr<TTK::SpriteAnimator> Animator;
+	};
+	std::shared_ptr<State> state = std::make_shared<State>();
+
+	Benchmark result;
+	result.Name = name;
+	result.Setup = [=]() {
+		int region;
+		state->Atlas = CreateSheetAtlas(region);
+
+		// Scatter the sprites over the screen, starting on different frames so they don't all move together
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> position(-1.0f, 1.0f);
+		std::uniform_int_distribution<int> startFrame(0, SheetFrames - 1);
+		state->Transforms.resize(SpriteCount);
+		for (glm::mat4& transform : state->Transforms)
+			transform = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(position(random), position(random), 0.0f)), glm::vec3(0.01f, 0.018f, 1.0f));
+
+		if (path == AnimationPath::Quads) {
+			state->Quads.resize(SpriteCount);
+			for (TTK::SpriteSheetQuad& quad : state->Quads) {
+				quad.SliceSpriteSheet(*state->Atlas, region, SheetFrames, 1, SheetAnimTime);
+				for (int frame = startFrame(random); frame > 0; frame--)
+					quad.Update(SheetAnimTime / SheetFrames);
+			}
+		} else {
+			state->Animator = std::make_unique<TTK::SpriteAnimator>();
+			int clip = state->Animator->AddClip(*state->Atlas, region, SheetFrames, 1, SheetAnimTime);
+			for (const glm::mat4& transform : state->Transforms) {
+				TTK::SpriteAnimator::Handle sprite = state->Animator->Create(clip, transform);
+				state->Animator->SetTime(sprite, startFrame(random) * SheetAnimTime / SheetFrames);
+			}
+		}
+	};
+	result.Frame = [=]() {
+		auto start = std::chrono::high_resolution_clock::now();
+		if (path == AnimationPath::Quads) {
+			for (size_t ix = 0; ix < state->Quads.size(); ix++) {
+				state->Quads[ix].Update(SpriteDeltaTime);
+				state->Quads[ix].Draw(state->Transforms[ix]);
+			}
+		} else {
+			state->Animator->Update(SpriteDeltaTime);
+			state->Animator->Draw();
+		}
+		double workMs = ElapsedMs(start);
+
+		TTK::SpriteBatch::Instance().Flush();
+		TTK::SpriteBatch::Instance().EndFrame();
+		return workMs;
+	};
+	result.Teardown = [=]() {
+		state->Quads = std::vector<TTK::SpriteSheetQuad>();
+		state->Transforms = std::vector<glm::mat4>();
+		state->Animator.reset();
+		state->Atlas.reset();
+	};
+	return result;
+}
+
+void AddSpriteBenchmarks(BenchmarkRunner& runner) {
+	runner.Add(MakeSpriteBenchmark("100k animated sprites (SpriteSheetQuad)", AnimationPath::Quads));
+	runner.Add(MakeSpriteBenchmark("100k animated sprites (SpriteAnimator)",  AnimationPath::Animator));
+}
+
+bool TestSpriteAnimator() {
+	bool passed = true;
+	auto check = [&passed](bool condition, const char* what) {
+		if (!condition) {
+			LOG_ERROR("SpriteAnimator test failed: {}", what);
+			passed = false;
+		}
+	};
+
+	// 4 frames at 4 FPS, so the clip lasts exactly 1 second. The texture is never drawn, so it doesn't need to exist
+	TTK::SpriteAnimator animator;
+	std::vector<glm::vec4> frames(4, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+	int once = animator.AddClip(0, frames, 4.0f, false);
+	int loop = animator.AddClip(0, frames, 4.0f, true);
+
+	// Playing forwards, a clip that doesn't loop holds it's last frame
+	TTK::SpriteAnimator::Handle forward = animator.Create(once);
+	// Playing backwards from the end, it should count down to the first frame and hold it
+	TTK::SpriteAnimator::Handle reverse = animator.Create(once);
+	animator.SetTime(reverse, 1.0f);
+	animator.SetSpeed(reverse, -1.0f);
+	// A looping clip never finishes, in either direction
+	TTK::SpriteAnimator::Handle looping = animator.Create(loop);
+	animator.SetSpeed(looping, -1.0f);
+
+	check(!animator.IsFinished(forward), "forward clip finished before it started");
+	check(!animator.IsFinished(reverse), "reversed clip finished before it started");
+
+	animator.Update(0.6f);
+	check(!animator.IsFinished(forward), "forward clip finished early");
+	check(animator.GetFrame(forward) == 2, "forward clip is on the wrong frame");
+	check(!animator.IsFinished(reverse), "reversed clip finished early");
+	check(animator.GetFrame(reverse) == 1, "reversed clip is on the wrong frame");
+	check(animator.GetFrame(looping) == 1, "reversed looping clip did not wrap around");
+
+	// This takes the reversed clip's time below 0 in a single step
+	animator.Update(0.6f);
+	check(animator.IsFinished(forward), "forward clip did not finish");
+	check(animator.GetFrame(forward) == 3, "forward clip did not stop on it's last frame");
+	check(animator.IsFinished(reverse), "reversed clip did not finish");
+	check(animator.GetFrame(reverse) == 0, "reversed clip did not stop on it's first frame");
+	check(!animator.IsFinished(looping), "looping clip finished");
+
+	return passed;
+}
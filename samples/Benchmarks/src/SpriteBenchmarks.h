@@ -0,0 +1,16 @@
+#pragma once
+#include "Benchmark.h"
+
+/*
+ * Adds benchmarks for animating and drawing a crowd of 100k sprites through the TTK sprite batch, comparing
+ * one SpriteSheetQuad per sprite against a single TTK::SpriteAnimator that holds all of them
+ * @param runner The runner to add the benchmarks to
+ */
+void AddSpriteBenchmarks(BenchmarkRunner& runner);
+
+/*
+ * Checks that TTK::SpriteAnimator steps it's sprites correctly, so that the sprite benchmarks are timing a
+ * working animator. This does not need a GL context
+ * @returns True if every check passed, any failures are logged
+ */
+bool TestSpriteAnimator();
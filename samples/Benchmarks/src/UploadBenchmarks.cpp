@@ -0,0 +1,152 @@
+#include "UploadBenchmarks.h"
+#include "PixelUploadRing.h"
+#include "ThreadPool.h"
+
+#include <cstring>
+#include <memory>
+
+// How a benchmark gets it's pixels to the GPU
+enum class UploadPath {
+	// glTextureSubImage2D straight from our own memory
+	Direct,
+	// Copied into the upload ring on the main thread
+	Ring,
+	// Written straight into the upload ring so there is no extra copy (by the worker threads, for the video benchmark)
+	InRing
+};
+
+const int AtlasSize      = 2048;
+const int AtlasCellSize  = 64;
+const int CellsPerFrame  = 128;
+
+// Fills a row of a fake video frame, this stands in for the work a video decoder would do
+static void FillVideoRow(uint8_t* row, int width, int y, int frame) {
+	for (int x = 0; x < width; x++) {
+		row[x * 4 + 0] = (uint8_t)(x + frame * 4);
+		row[x * 4 + 1] = (uint8_t)(y + frame * 2);
+		row[x * 4 + 2] = (uint8_t)((x ^ y) + frame);
+		row[x * 4 + 3] = 255;
+	}
+}
+
+static GLuint CreateTexture(int width, int height) {
+	GLuint result;
+	glCreateTextures(GL_TEXTURE_2D, 1, &result);
+	glTextureStorage2D(result, 1, GL_RGBA8, width, height);
+	glTextureParameteri(result, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTextureParameteri(result, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	return result;
+}
+
+static Benchmark MakeVideoBenchmark(const std::string& name, int width, int height, UploadPath path) {
+	struct State {
+		GLuint               Texture = 0;
+		std::vector<uint8_t> Pixels;
+		int                  Frame   = 0;
+	};
+	std::shared_ptr<State> state = std::make_shared<State>();
+
+	Benchmark result;
+	result.Name = name;
+	result.Setup = [=]() {
+		state->Texture = CreateTexture(width, height);
+		state->Pixels.resize((size_t)width * height * 4);
+		state->Frame = 0;
+	};
+	result.Frame = [=]() {
+		auto start = std::chrono::high_resolution_clock::now();
+		int frame = state->Frame++;
+		PixelUploadRing& ring = PixelUploadRing::Global();
+
+		if (path == UploadPath::InRing) {
+			PixelUploadRing::Allocation block = ring.Allocate(state->Pixels.size());
+			ThreadPool::Global().ParallelFor(height, [&](size_t y) {
+				FillVideoRow(block.Data + y * width * 4, width, (int)y, frame);
+			}, 16);
+			ring.Upload2D(state->Texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, block);
+		} else {
+			ThreadPool::Global().ParallelFor(height, [&](size_t y) {
+				FillVideoRow(state->Pixels.data() + y * width * 4, width, (int)y, frame);
+			}, 16);
+			if (path == UploadPath::Direct)
+				glTextureSubImage2D(state->Texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, state->Pixels.data());
+			else
+				ring.Upload2D(state->Texture, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, state->Pixels.data());
+		}
+		ring.Submit();
+		double workMs = ElapsedMs(start);
+
+		DrawTexturedRect(state->Texture);
+		return workMs;
+	};
+	result.Teardown = [=]() {
+		glDeleteTextures(1, &state->Texture);
+		state->Pixels = std::vector<uint8_t>();
+	};
+	return result;
+}
+
+static Benchmark MakeAtlasBenchmark(const std::string& name, UploadPath path) {
+	struct State {
+		GLuint               Texture = 0;
+		std::vector<uint8_t> Cell;
+		int                  NextCell = 0;
+	};
+	std::shared_ptr<State> state = std::make_shared<State>();
+
+	Benchmark result;
+	result.Name = name;
+	result.Setup = [=]() {
+		state->Texture = CreateTexture(AtlasSize, AtlasSize);
+		state->Cell.resize(AtlasCellSize * AtlasCellSize * 4);
+		state->NextCell = 0;
+	};
+	result.Frame = [=]() {
+		auto start = std::chrono::high_resolution_clock::now();
+		PixelUploadRing& ring = PixelUploadRing::Global();
+		const int cellsPerRow = AtlasSize / AtlasCellSize;
+
+		for (int ix = 0; ix < CellsPerFrame; ix++) {
+			int cell = state->NextCell;
+			state->NextCell = (cell + 1) % (cellsPerRow * cellsPerRow);
+			int x = (cell % cellsPerRow) * AtlasCellSize;
+			int y = (cell / cellsPerRow) * AtlasCellSize;
+
+			// Each cell gets a flat color, so we can see which ones are being replaced
+			uint8_t* target = state->Cell.data();
+			PixelUploadRing::Allocation block;
+			if (path == UploadPath::InRing) {
+				block = ring.Allocate(state->Cell.size());
+				target = block.Data;
+			}
+			uint32_t color = 0xFF000000 | ((uint32_t)cell * 2654435761u & 0x00FFFFFF);
+			for (int pixel = 0; pixel < AtlasCellSize * AtlasCellSize; pixel++)
+				memcpy(target + pixel * 4, &color, 4);
+
+			if (path == UploadPath::Direct)
+				glTextureSubImage2D(state->Texture, 0, x, y, AtlasCellSize, AtlasCellSize, GL_RGBA, GL_UNSIGNED_BYTE, target);
+			else if (path == UploadPath::Ring)
+				ring.Upload2D(state->Texture, 0, x, y, AtlasCellSize, AtlasCellSize, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)target);
+			else
+				ring.Upload2D(state->Texture, 0, x, y, AtlasCellSize, AtlasCellSize, GL_RGBA, GL_UNSIGNED_BYTE, block);
+		}
+		ring.Submit();
+		double workMs = ElapsedMs(start);
+
+		DrawTexturedRect(state->Texture);
+		return workMs;
+	};
+	result.Teardown = [=]() {
+		glDeleteTextures(1, &state->Texture);
+	};
+	return result;
+}
+
+void AddUploadBenchmarks(BenchmarkRunner& runner) {
+	runner.Add(MakeVideoBenchmark("Video 1080p (glTexSubImage)",          1920, 1080, UploadPath::Direct));
+	runner.Add(MakeVideoBenchmark("Video 1080p (upload ring)",            1920, 1080, UploadPath::Ring));
+	runner.Add(MakeVideoBenchmark("Video 1080p (decoded into ring)",      1920, 1080, UploadPath::InRing));
+	runner.Add(MakeAtlasBenchmark("Atlas 128 cells/frame (glTexSubImage)", UploadPath::Direct));
+	runner.Add(MakeAtlasBenchmark("Atlas 128 cells/frame (upload ring)",   UploadPath::Ring));
+	runner.Add(MakeAtlasBenchmark("Atlas 128 cells/frame (in ring)",       UploadPath::InRing));
+}
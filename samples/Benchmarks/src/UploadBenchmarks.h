@@ -0,0 +1,11 @@
+#pragma once
+#include "Benchmark.h"
+
+/*
+ * Adds benchmarks for per-frame dynamic texture updates, comparing uploads straight from client memory
+ * against going through the PixelUploadRing:
+ *   - A 1080p "video" texture that is completely replaced every frame
+ *   - A 2048x2048 sprite atlas that has a batch of 64x64 cells replaced every frame
+ * @param runner The runner to add the benchmarks to
+ */
+void AddUploadBenchmarks(BenchmarkRunner& runner);
@@ -0,0 +1,63 @@
+/*
+ * Benchmarks
+ *
+ * Runs a set of rendering benchmarks one after the other and logs how long each one took. Every benchmark
+ * runs for the same number of frames with vsync off, so the numbers can be compared between runs
+ */
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "Logging.h"
+#include "PixelUploadRing.h"
+#include "Benchmark.h"
+#include "UploadBenchmarks.h"
+#include "SpriteBenchmarks.h"
+#include "TTK/SpriteBatch.h"
+
+// How many frames we run each benchmark for before we start timing, and how many frames we time
+const int WarmupFrames = 60;
+const int TimedFrames  = 600;
+
+int main() {
+	Logger::Init();
+
+	if (!TestSpriteAnimator())
+		LOG_WARN("The sprite animator failed it's tests, the sprite benchmarks may not be meaningful");
+
+	if (glfwInit() == GLFW_FALSE) {
+		LOG_WARN("Failed to initialize GLFW");
+		return 1;
+	}
+
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	GLFWwindow* window = glfwCreateWindow(1280, 720, "Benchmarks", nullptr, nullptr);
+	if (window == nullptr) {
+		LOG_WARN("Failed to create a window, the benchmarks need OpenGL 4.5");
+		glfwTerminate();
+		return 2;
+	}
+	glfwMakeContextCurrent(window);
+
+	if (gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) == 0) {
+		LOG_WARN("Failed to initialize Glad");
+		glfwTerminate();
+		return 3;
+	}
+	LOG_INFO("Renderer: {}", (const char*)glGetString(GL_RENDERER));
+	LOG_INFO("Version:  {}", (const char*)glGetString(GL_VERSION));
+
+	BenchmarkRunner runner(window, WarmupFrames, TimedFrames);
+	AddUploadBenchmarks(runner);
+	AddSpriteBenchmarks(runner);
+	runner.Run();
+	runner.PrintResults();
+	LOG_INFO("Upload ring: {} MB uploaded, {} stalls", PixelUploadRing::Global().GetBytesUploaded() / (1024 * 1024), PixelUploadRing::Global().GetStallCount());
+	TTK::SpriteBatch::DestroyContext();
+
+	glfwDestroyWindow(window);
+	glfwTerminate();
+	Logger::Uninitialize();
+	return 0;
+}
@@ -0,0 +1,126 @@
+#version 450
+
+layout(location = 0) in vec4 inColor;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec3 inWorldPos;
+layout(location = 3) in vec2 inUV;
+
+layout(location = 0) out vec4 outColor;
+
+uniform vec3  a_CameraPos;
+
+uniform vec3  a_AmbientColor;
+uniform float a_AmbientPower;
+
+uniform sampler2D s_Albedo;
+uniform sampler2D s_Metallic;
+
+uniform samplerCube s_Environment;
+
+uniform float a_LightShininess;
+
+#include "shadows.glsl"
+
+// These are filled in by ClusteredLighting, and must match light-cull.comp.glsl
+struct Light {
+	vec4 PositionRadius;
+	vec4 ColorIntensity;
+};
+
+layout (std140, binding = 4) uniform b_ClusterParams {
+	mat4  View;
+	vec4  ProjectionParams;
+	vec4  SliceParams;
+	uvec4 GridSize;
+	uvec4 Options;
+};
+
+layout (std430, binding = 4) readonly buffer b_Lights {
+	Light Lights[];
+};
+layout (std430, binding = 5) readonly buffer b_ClusterCounts {
+	uint ClusterCounts[];
+};
+layout (std430, binding = 6) readonly buffer b_ClusterIndices {
+	uint ClusterIndices[];
+};
+
+// Finds the cluster that this fragment falls in
+uint GetClusterIndex() {
+	float depth = -(View * vec4(inWorldPos, 1.0)).z;
+	// Slices are spaced out exponentially, so log(depth) maps linearly onto them
+	uint slice = uint(clamp(log(max(depth, 1e-4)) * SliceParams.x + SliceParams.y, 0.0, float(GridSize.z - 1)));
+	uvec2 tile = min(uvec2(gl_FragCoord.xy / SliceParams.zw * vec2(GridSize.xy)), GridSize.xy - 1);
+	return tile.x + tile.y * GridSize.x + slice * GridSize.x * GridSize.y;
+}
+
+// A cheap heatmap for the light count debug view (blue for few lights, through green, to red for many)
+vec3 Heatmap(float value) {
+	return clamp(vec3(value * 2.0 - 1.0, 1.0 - abs(value * 2.0 - 1.0), 1.0 - value * 2.0), 0.0, 1.0);
+}
+
+void main() {
+	// Re-normalize our input, so that it is always length 1
+	vec3 norm = normalize(inNormal);
+
+	// Determine the direction between the camera and the pixel
+	vec3 viewDir = normalize(a_CameraPos - inWorldPos);
+
+	uint cluster = GetClusterIndex();
+	uint lightCount = ClusterCounts[cluster];
+
+	if (Options.y != 0) {
+		outColor = vec4(Heatmap(float(lightCount) / 32.0), 1.0);
+		return;
+	}
+
+	vec3 diffuseOut = vec3(0.0);
+	vec3 specOut    = vec3(0.0);
+
+	// The directional light reaches everything, but may be shadowed
+	vec3 sunRadiance = GetSunRadiance(inWorldPos, norm);
+	if (SunDirection.w != 0.0) {
+		vec3 toSun = -SunDirection.xyz;
+		diffuseOut += max(dot(norm, toSun), 0.0) * sunRadiance;
+		specOut    += pow(max(dot(norm, normalize(toSun + viewDir)), 0.0), a_LightShininess) * sunRadiance;
+	}
+
+	// Only the lights that touch our cluster can reach us, so that's all we need to look at
+	for (uint ix = 0; ix < lightCount; ix++) {
+		Light light = Lights[ClusterIndices[cluster * Options.x + ix]];
+
+		vec3 toLight = light.PositionRadius.xyz - inWorldPos;
+		float distToLight = length(toLight);
+		toLight = toLight / max(distToLight, 1e-4);
+
+		// Inverse square falloff, windowed so that it reaches 0 at the light's radius (otherwise we'd see
+		// the edges of the clusters where a light stops being counted)
+		float falloff = clamp(1.0 - pow(distToLight / light.PositionRadius.w, 4.0), 0.0, 1.0);
+		float attenuation = (falloff * falloff) / (1.0 + distToLight * distToLight);
+		vec3 radiance = light.ColorIntensity.rgb * light.ColorIntensity.a * attenuation;
+
+		vec3 halfDir = normalize(toLight + viewDir);
+		float specPower = pow(max(dot(norm, halfDir), 0.0), a_LightShininess);
+		float diffuseFactor = max(dot(norm, toLight), 0.0);
+
+		diffuseOut += diffuseFactor * radiance;
+		specOut    += specPower * radiance;
+	}
+
+	// Our ambient is simply the color times the ambient power
+	vec3 ambientOut = a_AmbientColor * a_AmbientPower;
+
+	vec4 albedo = texture(s_Albedo, inUV);
+
+	vec3 reflection = normalize(reflect(-viewDir, norm));
+	vec4 environment = texture(s_Environment, reflection.xzy);
+	float metallic = texture(s_Metallic, inUV).r;
+
+	vec4 baseColor = mix(albedo * inColor, environment, metallic);
+
+	// Our result is our lighting multiplied by our object's color
+	vec3 result = (ambientOut + diffuseOut + specOut) * baseColor.rgb;
+
+	// Write the output
+	outColor = vec4(result, inColor.a * albedo.a);
+}
@@ -0,0 +1,51 @@
+#version 450
+
+// Converts a single image into the 6 faces of a cubemap, see TextureCube::LoadFromImage
+layout (local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout (binding = 0) uniform sampler2D s_Source;
+layout (binding = 0, rgba8) uniform writeonly imageCube o_Cubemap;
+
+// 0 for an equirectangular image, 1 for a horizontal cross, 2 for a vertical cross
+uniform int a_Layout;
+uniform int a_FaceSize;
+
+const float PI = 3.14159265359;
+
+// Gets the direction through the center of a texel in one of the cube's faces, following GL's cubemap conventions
+vec3 GetDirection(ivec3 texel) {
+    vec2 uv = (vec2(texel.xy) + 0.5) / float(a_FaceSize) * 2.0 - 1.0;
+    switch (texel.z) {
+        case 0:  return normalize(vec3( 1.0, -uv.y, -uv.x));
+        case 1:  return normalize(vec3(-1.0, -uv.y,  uv.x));
+        case 2:  return normalize(vec3( uv.x,  1.0,  uv.y));
+        case 3:  return normalize(vec3( uv.x, -1.0, -uv.y));
+        case 4:  return normalize(vec3( uv.x, -uv.y,  1.0));
+        default: return normalize(vec3(-uv.x, -uv.y, -1.0));
+    }
+}
+
+// Where each face sits in a cross layout, in units of faces (+X, -X, +Y, -Y, +Z, -Z)
+const ivec2 HorizontalCross[6] = ivec2[](ivec2(2, 1), ivec2(0, 1), ivec2(1, 0), ivec2(1, 2), ivec2(1, 1), ivec2(3, 1));
+const ivec2 VerticalCross[6]   = ivec2[](ivec2(2, 1), ivec2(0, 1), ivec2(1, 0), ivec2(1, 2), ivec2(1, 1), ivec2(1, 3));
+
+void main() {
+    ivec3 texel = ivec3(gl_GlobalInvocationID);
+    if (texel.x >= a_FaceSize || texel.y >= a_FaceSize)
+        return;
+
+    vec4 color;
+    if (a_Layout == 0) {
+        // Longitude goes around the image horizontally, latitude goes from the top of the image to the bottom
+        vec3 dir = GetDirection(texel);
+        vec2 uv = vec2(atan(dir.z, dir.x) / (2.0 * PI) + 0.5, acos(clamp(dir.y, -1.0, 1.0)) / PI);
+        color = textureLod(s_Source, uv, 0.0);
+    } else if (a_Layout == 1) {
+        color = texelFetch(s_Source, HorizontalCross[texel.z] * a_FaceSize + texel.xy, 0);
+    } else {
+        // The back face of a vertical cross is upside down, since it's folded over the bottom
+        ivec2 local = texel.z == 5 ? ivec2(a_FaceSize - 1) - texel.xy : texel.xy;
+        color = texelFetch(s_Source, VerticalCross[texel.z] * a_FaceSize + local, 0);
+    }
+    imageStore(o_Cubemap, texel, color);
+}
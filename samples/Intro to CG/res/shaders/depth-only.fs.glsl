@@ -0,0 +1,4 @@
+#version 410
+
+// Nothing to do here, the depth is written for us
+void main() { }
@@ -0,0 +1,13 @@
+#version 410
+
+// Used for the depth prepass, we only need our positions
+layout (location = 0) in vec3 inPosition;
+
+uniform mat4 a_ModelViewProjection;
+
+// The depth prepass draws with a different program, so our positions need to come out exactly the same in both
+invariant gl_Position;
+
+void main() {
+	gl_Position = a_ModelViewProjection * vec4(inPosition, 1);
+}
@@ -0,0 +1,9 @@
+#version 410
+
+// Draws a single triangle that covers the whole screen, use with glDrawArrays(GL_TRIANGLES, 0, 3) and no vertex buffers
+layout (location = 0) out vec2 outUV;
+
+void main() {
+	outUV = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(outUV * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -0,0 +1,49 @@
+#version 450
+
+// Builds one level of the hierarchical Z pyramid, see OcclusionCulling::BuildHiZ
+// Each texel keeps the furthest depth of the texels it covers in the level above it, so an object that is
+// in front of a texel's depth is in front of everything in that part of the screen
+layout (local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+// Used for the first level, which is copied from the depth buffer
+layout (binding = 0) uniform sampler2D s_Depth;
+// Used for every level after that
+layout (binding = 0, r32f) uniform readonly image2D s_Source;
+layout (binding = 1, r32f) uniform writeonly image2D o_Target;
+
+// True if we are copying from the depth buffer
+uniform int   a_FromDepth;
+// The sizes of the levels we are reading from and writing to, in texels
+uniform vec2  a_SourceSize;
+uniform vec2  a_TargetSize;
+
+float Load(ivec2 texel) {
+	texel = min(texel, ivec2(a_SourceSize) - 1);
+	return a_FromDepth != 0 ? texelFetch(s_Depth, texel, 0).r : imageLoad(s_Source, texel).r;
+}
+
+void main() {
+	ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 sourceSize = ivec2(a_SourceSize);
+	ivec2 targetSize = ivec2(a_TargetSize);
+	if (texel.x >= targetSize.x || texel.y >= targetSize.y)
+		return;
+
+	if (a_FromDepth != 0) {
+		imageStore(o_Target, texel, vec4(Load(texel)));
+		return;
+	}
+
+	ivec2 source = texel * 2;
+	float depth = max(max(Load(source), Load(source + ivec2(1, 0))), max(Load(source + ivec2(0, 1)), Load(source + ivec2(1, 1))));
+	// When the level above us has an odd size, the last row and column of texels need to cover an extra texel
+	bool extraX = (sourceSize.x & 1) != 0 && texel.x == targetSize.x - 1;
+	bool extraY = (sourceSize.y & 1) != 0 && texel.y == targetSize.y - 1;
+	if (extraX)
+		depth = max(depth, max(Load(source + ivec2(2, 0)), Load(source + ivec2(2, 1))));
+	if (extraY)
+		depth = max(depth, max(Load(source + ivec2(0, 2)), Load(source + ivec2(1, 2))));
+	if (extraX && extraY)
+		depth = max(depth, Load(source + ivec2(2, 2)));
+	imageStore(o_Target, texel, vec4(depth));
+}
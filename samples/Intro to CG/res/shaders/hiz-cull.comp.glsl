@@ -0,0 +1,90 @@
+#version 450
+
+// Tests the bounds of every draw against last frame's Hi-Z pyramid, and writes the indirect draw commands
+// for this frame, see OcclusionCulling::Cull
+layout (local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct DrawBounds {
+	// xyz is the world space center, w is the radius
+	vec4 CenterRadius;
+	// x is the number of indices (or vertices) to draw
+	uvec4 Counts;
+};
+
+// Matches DrawElementsIndirectCommand, see https://www.khronos.org/opengl/wiki/Vertex_Rendering#Indirect_rendering
+struct DrawCommand {
+	uint Count;
+	uint InstanceCount;
+	uint FirstIndex;
+	int  BaseVertex;
+	uint BaseInstance;
+};
+
+layout (std430, binding = 7) readonly buffer b_DrawBounds {
+	DrawBounds Bounds[];
+};
+layout (std430, binding = 8) writeonly buffer b_DrawCommands {
+	DrawCommand Commands[];
+};
+layout (std430, binding = 9) buffer b_CullStats {
+	uint VisibleCount;
+};
+
+layout (binding = 0) uniform sampler2D s_HiZ;
+
+uniform mat4  a_PrevViewProjection;
+uniform vec2  a_HiZSize;
+uniform int   a_HiZLevels;
+// If 0, everything is drawn (ex: when we don't have a Hi-Z pyramid from last frame)
+uniform int   a_Enabled;
+uniform int   a_DrawCount;
+
+bool IsVisible(vec4 sphere) {
+	// Project the corners of the sphere's bounding box with last frame's camera, to find the part of the screen it covered
+	vec2  uvMin    = vec2(1.0);
+	vec2  uvMax    = vec2(0.0);
+	float minDepth = 1.0;
+	for (int ix = 0; ix < 8; ix++) {
+		vec3 corner = sphere.xyz + sphere.w * vec3((ix & 1) != 0 ? 1.0 : -1.0, (ix & 2) != 0 ? 1.0 : -1.0, (ix & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = a_PrevViewProjection * vec4(corner, 1.0);
+		// Anything that crosses the near plane can't be tested, so we just assume it's visible
+		if (clip.w <= 0.0)
+			return true;
+		vec3 ndc = clip.xyz / clip.w;
+		uvMin    = min(uvMin, ndc.xy * 0.5 + 0.5);
+		uvMax    = max(uvMax, ndc.xy * 0.5 + 0.5);
+		minDepth = min(minDepth, ndc.z * 0.5 + 0.5);
+	}
+	// Off screen (frustum culling is left to the driver, we only care about occlusion)
+	if (any(greaterThan(uvMin, vec2(1.0))) || any(lessThan(uvMax, vec2(0.0))))
+		return true;
+	uvMin = clamp(uvMin, 0.0, 1.0);
+	uvMax = clamp(uvMax, 0.0, 1.0);
+
+	// Pick the level where our rectangle is at most 2 texels across, so that 4 samples cover all of it
+	vec2 size = (uvMax - uvMin) * a_HiZSize;
+	float level = ceil(log2(max(max(size.x, size.y), 1.0)));
+	// Our smallest level is still too detailed to cover the rectangle with 4 samples, this only happens for things
+	// that cover most of the screen anyways
+	if (level > float(a_HiZLevels - 1))
+		return true;
+	float maxDepth = max(
+		max(textureLod(s_HiZ, uvMin, level).r, textureLod(s_HiZ, vec2(uvMax.x, uvMin.y), level).r),
+		max(textureLod(s_HiZ, vec2(uvMin.x, uvMax.y), level).r, textureLod(s_HiZ, uvMax, level).r));
+
+	// If the closest point of the bounds is behind everything in that part of the screen, it's hidden
+	return minDepth <= maxDepth;
+}
+
+void main() {
+	uint index = gl_GlobalInvocationID.x;
+	if (index >= uint(a_DrawCount))
+		return;
+
+	DrawBounds bounds = Bounds[index];
+	bool visible = a_Enabled == 0 || IsVisible(bounds.CenterRadius);
+
+	Commands[index] = DrawCommand(bounds.Counts.x, visible ? 1 : 0, 0, 0, 0);
+	if (visible)
+		atomicAdd(VisibleCount, 1);
+}
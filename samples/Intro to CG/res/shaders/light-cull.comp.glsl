@@ -0,0 +1,89 @@
+#version 450
+
+// Assigns point lights to the clusters of the view frustum, see ClusteredLighting::Update
+// Each work group handles one depth slice, with one thread per cluster in that slice
+layout (local_size_x = 16, local_size_y = 9, local_size_z = 1) in;
+
+struct Light {
+    // xyz is the world position, w is the radius
+    vec4 PositionRadius;
+    // rgb is the color, a is the intensity
+    vec4 ColorIntensity;
+};
+
+layout (std140, binding = 4) uniform b_ClusterParams {
+    mat4  View;
+    // x and y are the projection's scale (Projection[0][0] and [1][1]), z and w are the near and far planes we slice between
+    vec4  ProjectionParams;
+    // x and y map log(depth) to a slice, z and w are the screen size in pixels
+    vec4  SliceParams;
+    // xyz is the number of clusters along each axis, w is the number of lights
+    uvec4 GridSize;
+    // x is the most lights we store for a single cluster, y is the debug view
+    uvec4 Options;
+};
+
+layout (std430, binding = 4) readonly buffer b_Lights {
+    Light Lights[];
+};
+layout (std430, binding = 5) writeonly buffer b_ClusterCounts {
+    uint ClusterCounts[];
+};
+layout (std430, binding = 6) writeonly buffer b_ClusterIndices {
+    uint ClusterIndices[];
+};
+
+const uint GroupSize = gl_WorkGroupSize.x * gl_WorkGroupSize.y;
+
+// The lights we are currently testing, in view space (xyz is the position, w is the radius)
+shared vec4 s_Lights[GroupSize];
+
+// Gets the view space distance to the near side of a slice
+float GetSliceDepth(uint slice) {
+    if (slice == 0)
+        return 0.0;
+    return ProjectionParams.z * pow(ProjectionParams.w / ProjectionParams.z, float(slice) / float(GridSize.z));
+}
+
+void main() {
+    uvec3 cluster = gl_GlobalInvocationID;
+    uint clusterIndex = cluster.x + cluster.y * GridSize.x + cluster.z * GridSize.x * GridSize.y;
+
+    // Work out the view space bounds of our cluster. The tile's corners are along rays from the camera, so the
+    // box spans from the tile at the near depth to the tile at the far depth
+    vec2 ndcMin = vec2(cluster.xy) / vec2(GridSize.xy) * 2.0 - 1.0;
+    vec2 ndcMax = vec2(cluster.xy + 1) / vec2(GridSize.xy) * 2.0 - 1.0;
+    float nearDepth = GetSliceDepth(cluster.z);
+    float farDepth  = GetSliceDepth(cluster.z + 1);
+    vec2 scale = 1.0 / ProjectionParams.xy;
+    vec3 boxMin = vec3(min(ndcMin * nearDepth, ndcMin * farDepth) * scale, -farDepth);
+    vec3 boxMax = vec3(max(ndcMax * nearDepth, ndcMax * farDepth) * scale, -nearDepth);
+
+    uint count = 0;
+    uint lightCount = GridSize.w;
+    uint localIndex = gl_LocalInvocationIndex;
+    for (uint batch = 0; batch < lightCount; batch += GroupSize) {
+        // Every thread transforms one light into view space, so we only do it once per group
+        uint lightIndex = batch + localIndex;
+        if (lightIndex < lightCount) {
+            Light light = Lights[lightIndex];
+            s_Lights[localIndex] = vec4((View * vec4(light.PositionRadius.xyz, 1.0)).xyz, light.PositionRadius.w);
+        }
+        barrier();
+
+        uint batchSize = min(GroupSize, lightCount - batch);
+        for (uint ix = 0; ix < batchSize; ix++) {
+            vec4 light = s_Lights[ix];
+            // Sphere vs box, using the closest point in the box to the light
+            vec3 closest = clamp(light.xyz, boxMin, boxMax);
+            vec3 delta = closest - light.xyz;
+            if (dot(delta, delta) <= light.w * light.w && count < Options.x) {
+                ClusterIndices[clusterIndex * Options.x + count] = batch + ix;
+                count++;
+            }
+        }
+        barrier();
+    }
+
+    ClusterCounts[clusterIndex] = count;
+}
@@ -17,6 +17,9 @@ uniform mat4 a_Model;
 uniform mat4 a_ModelView;
 uniform mat3 a_NormalMatrix;
 
+// The depth prepass draws with a different program, so our positions need to come out exactly the same in both
+invariant gl_Position;
+
 void main() {
 	outColor = inColor;
 	outNormal = a_NormalMatrix * inNormal;
@@ -0,0 +1,23 @@
+#version 450
+
+// Turns the overdraw counts into a heatmap, see OcclusionCulling::EndOverdraw
+layout (location = 0) in vec2 inUV;
+
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0, r32ui) uniform readonly uimage2D s_Overdraw;
+
+// How many layers of overdraw we show as full red
+uniform float a_MaxOverdraw;
+
+void main() {
+	uint count = imageLoad(s_Overdraw, ivec2(gl_FragCoord.xy)).r;
+	// Pixels that were never shaded are left black
+	if (count == 0) {
+		outColor = vec4(0.0, 0.0, 0.0, 1.0);
+		return;
+	}
+	// 1 layer is blue, going through green to red as the count goes up
+	float value = clamp(float(count - 1) / max(a_MaxOverdraw - 1.0, 1.0), 0.0, 1.0);
+	outColor = vec4(clamp(vec3(value * 2.0 - 1.0, 1.0 - abs(value * 2.0 - 1.0), 1.0 - value * 2.0), 0.0, 1.0), 1.0);
+}
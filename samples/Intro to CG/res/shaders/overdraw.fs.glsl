@@ -0,0 +1,11 @@
+#version 450
+
+// Counts how many fragments get shaded for each pixel, see OcclusionCulling::BeginOverdraw
+// Early fragment tests make sure that we only count fragments that pass the depth test, like a real shader would
+layout (early_fragment_tests) in;
+
+layout (binding = 0, r32ui) uniform coherent uimage2D o_Overdraw;
+
+void main() {
+	imageAtomicAdd(o_Overdraw, ivec2(gl_FragCoord.xy), 1u);
+}
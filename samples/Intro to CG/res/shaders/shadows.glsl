@@ -0,0 +1,64 @@
+// The directional light and it's cascaded shadow maps, filled in by ShadowMapping
+// Include this in a fragment shader with #include "shadows.glsl", after the #version line
+
+layout (std140, binding = 5) uniform b_Shadows {
+	// Takes world space positions into each cascade's shadow map, as texture coordinates and depth
+	mat4 ShadowMatrices[4];
+	// The view space depth where each cascade ends
+	vec4 CascadeSplits;
+	// The size of a shadow map texel in each cascade, in world units
+	vec4 CascadeTexelSizes;
+	// The row of the camera's view matrix that gives us view space z
+	vec4 ShadowViewZ;
+	// xyz is the direction the light travels, w is 0 if there is no light
+	vec4 SunDirection;
+	// rgb is the light's color, a is it's intensity
+	vec4 SunColor;
+	// x is 1 over the shadow map size, y is the normal offset in texels, z is the number of cascades, w is the PCF radius
+	vec4 ShadowOptions;
+};
+
+layout (binding = 8) uniform sampler2DArrayShadow s_ShadowMap;
+
+// Gets the cascade a world position falls in, or -1 if it's past the last one
+int GetShadowCascade(vec3 worldPos) {
+	float depth = -dot(ShadowViewZ, vec4(worldPos, 1.0));
+	for (int ix = 0; ix < int(ShadowOptions.z); ix++) {
+		if (depth < CascadeSplits[ix])
+			return ix;
+	}
+	return -1;
+}
+
+/*
+ * Gets how much of the directional light reaches a point, from 0 (fully shadowed) to 1 (fully lit)
+ * worldPos is the world position of the fragment, and normal is it's (normalized) world space normal
+ */
+float GetShadow(vec3 worldPos, vec3 normal) {
+	int cascade = GetShadowCascade(worldPos);
+	if (cascade < 0 || SunDirection.w == 0.0)
+		return 1.0;
+
+	// Push the sample point out along the normal by a few texels, this hides acne on surfaces that face away from the light
+	float slope = 1.0 - max(dot(normal, -SunDirection.xyz), 0.0);
+	vec3 offsetPos = worldPos + normal * CascadeTexelSizes[cascade] * ShadowOptions.y * slope;
+	vec3 coords = (ShadowMatrices[cascade] * vec4(offsetPos, 1.0)).xyz;
+
+	// Each tap already filters a 2x2 block in hardware, so a small grid of them is enough for soft edges
+	int radius = int(ShadowOptions.w);
+	float result = 0.0;
+	for (int y = -radius; y <= radius; y++) {
+		for (int x = -radius; x <= radius; x++) {
+			vec2 uv = coords.xy + vec2(x, y) * ShadowOptions.x;
+			result += texture(s_ShadowMap, vec4(uv, float(cascade), coords.z));
+		}
+	}
+	return result / float((radius * 2 + 1) * (radius * 2 + 1));
+}
+
+// Gets the light from the directional light that reaches a point, including it's shadows
+vec3 GetSunRadiance(vec3 worldPos, vec3 normal) {
+	if (SunDirection.w == 0.0)
+		return vec3(0.0);
+	return SunColor.rgb * SunColor.a * GetShadow(worldPos, normal);
+}
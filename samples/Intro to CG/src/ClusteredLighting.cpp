@@ -0,0 +1,91 @@
+#include "ClusteredLighting.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <cmath>
+#include "imgui.h"
+
+GLuint       ClusteredLighting::myParamsBuffer  = 0;
+GLuint       ClusteredLighting::myLightsBuffer  = 0;
+GLuint       ClusteredLighting::myCountsBuffer  = 0;
+GLuint       ClusteredLighting::myIndicesBuffer = 0;
+Shader::Sptr ClusteredLighting::myCullShader    = nullptr;
+uint32_t     ClusteredLighting::myLightCount    = 0;
+bool         ClusteredLighting::myShowHeatmap   = false;
+
+void ClusteredLighting::Init() {
+	LOG_ASSERT(myParamsBuffer == 0, "Clustered lighting has already been initialized!");
+
+	GLuint buffers[4];
+	glCreateBuffers(4, buffers);
+	myParamsBuffer  = buffers[0];
+	myLightsBuffer  = buffers[1];
+	myCountsBuffer  = buffers[2];
+	myIndicesBuffer = buffers[3];
+	glNamedBufferStorage(myParamsBuffer, sizeof(Params), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glNamedBufferStorage(myLightsBuffer, sizeof(GpuLight) * MaxLights, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	// These two are only ever touched by the GPU
+	glNamedBufferStorage(myCountsBuffer, sizeof(uint32_t) * ClusterCount, nullptr, 0);
+	glNamedBufferStorage(myIndicesBuffer, sizeof(uint32_t) * ClusterCount * MaxLightsPerCluster, nullptr, 0);
+	glObjectLabel(GL_BUFFER, myParamsBuffer, -1, "Cluster Params");
+	glObjectLabel(GL_BUFFER, myLightsBuffer, -1, "Lights");
+	glObjectLabel(GL_BUFFER, myCountsBuffer, -1, "Cluster Light Counts");
+	glObjectLabel(GL_BUFFER, myIndicesBuffer, -1, "Cluster Light Indices");
+
+	myCullShader = Shader::Create();
+	myCullShader->LoadCompute("shaders/light-cull.comp.glsl");
+}
+
+void ClusteredLighting::Shutdown() {
+	GLuint buffers[4] = { myParamsBuffer, myLightsBuffer, myCountsBuffer, myIndicesBuffer };
+	glDeleteBuffers(4, buffers);
+	myParamsBuffer = myLightsBuffer = myCountsBuffer = myIndicesBuffer = 0;
+	myCullShader = nullptr;
+	myLightCount = 0;
+}
+
+void ClusteredLighting::Update(const GpuLight* lights, size_t count, const Camera& camera, int width, int height) {
+	if (myCullShader == nullptr || width <= 0 || height <= 0)
+		return;
+
+	if (count > MaxLights) {
+		LOG_WARN("{} lights were submitted, but we can only draw {}", count, MaxLights);
+		count = MaxLights;
+	}
+	myLightCount = (uint32_t)count;
+	if (count > 0)
+		glNamedBufferSubData(myLightsBuffer, 0, sizeof(GpuLight) * count, lights);
+
+	// Pull the near and far planes back out of the projection, so that we don't need to keep track of them separately
+	const glm::mat4& projection = camera.Projection;
+	float nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+	float farPlane  = projection[3][2] / (projection[2][2] + 1.0f);
+	float sliceNear = std::max(SliceNear, nearPlane);
+
+	Params params;
+	params.View             = camera.GetView();
+	params.ProjectionParams = glm::vec4(projection[0][0], projection[1][1], sliceNear, farPlane);
+	// slice = log(depth / near) / log(far / near) * slices, split into a scale and bias on log(depth)
+	float sliceScale = GridSizeZ / std::log(farPlane / sliceNear);
+	params.SliceParams      = glm::vec4(sliceScale, -std::log(sliceNear) * sliceScale, (float)width, (float)height);
+	params.GridSize         = glm::uvec4(GridSizeX, GridSizeY, GridSizeZ, myLightCount);
+	params.Options          = glm::uvec4(MaxLightsPerCluster, myShowHeatmap ? 1 : 0, 0, 0);
+	glNamedBufferSubData(myParamsBuffer, 0, sizeof(Params), &params);
+
+	glBindBufferBase(GL_UNIFORM_BUFFER, ParamsBinding, myParamsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LightsBinding, myLightsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CountsBinding, myCountsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, IndicesBinding, myIndicesBuffer);
+
+	// One thread per cluster, with a work group for each depth slice
+	myCullShader->Bind();
+	myCullShader->Dispatch(1, 1, GridSizeZ);
+	// Our fragment shaders read the cluster lists that we just wrote
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void ClusteredLighting::DrawInspector() {
+	ImGui::Text("Lights: %u / %u", myLightCount, MaxLights);
+	ImGui::Text("Clusters: %ux%ux%u, up to %u lights each", GridSizeX, GridSizeY, GridSizeZ, MaxLightsPerCluster);
+	ImGui::Checkbox("Show Light Counts", &myShowHeatmap);
+}
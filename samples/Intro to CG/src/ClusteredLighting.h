@@ -0,0 +1,83 @@
+#pragma once
+#include <glad/glad.h>
+#include <GLM/glm.hpp>
+
+#include "Camera.h"
+#include "Shader.h"
+
+/*
+ * Forward+ lighting, with lights sorted into clusters. The view frustum is split into a grid of tiles on screen
+ * and exponentially spaced slices in depth. Every frame a compute shader works out which lights touch each
+ * cluster, so that shaders only have to look at the lights in the cluster their fragment falls in
+ *
+ * The light data is left bound to the binding points below for the rest of the frame, see
+ * blinn-phong-clustered.fs.glsl for how a shader uses them
+ */
+class ClusteredLighting {
+public:
+	// How many clusters we split the view into along each axis (X and Y must match the work group size in light-cull.comp.glsl)
+	static const uint32_t GridSizeX           = 16;
+	static const uint32_t GridSizeY           = 9;
+	static const uint32_t GridSizeZ           = 24;
+	static const uint32_t ClusterCount        = GridSizeX * GridSizeY * GridSizeZ;
+	// The most lights we can send in a frame, anything past this is dropped
+	static const uint32_t MaxLights           = 4096;
+	// The most lights that can touch a single cluster, anything past this is dropped
+	static const uint32_t MaxLightsPerCluster = 128;
+	// Where the first depth slice ends, everything closer than this shares a slice
+	static constexpr float SliceNear          = 0.1f;
+
+	// The uniform block and storage buffer bindings that we use
+	static const GLuint ParamsBinding  = 4;
+	static const GLuint LightsBinding  = 4;
+	static const GLuint CountsBinding  = 5;
+	static const GLuint IndicesBinding = 6;
+
+	// A light, as it's laid out on the GPU
+	struct GpuLight {
+		// xyz is the world position, w is the radius
+		glm::vec4 PositionRadius;
+		// rgb is the color, a is the intensity
+		glm::vec4 ColorIntensity;
+	};
+
+	// Creates our buffers and loads the culling shader, must be called once the GL context exists
+	static void Init();
+	// Deletes our buffers and shader
+	static void Shutdown();
+
+	/*
+	 * Uploads this frame's lights and assigns them to clusters, should be called once per frame before any
+	 * lit meshes are drawn
+	 * @param lights The lights to draw this frame
+	 * @param count  The number of lights in the array
+	 * @param camera The camera that we are rendering from (the clusters are built from it's projection)
+	 * @param width  The width of the screen, in pixels
+	 * @param height The height of the screen, in pixels
+	 */
+	static void Update(const GpuLight* lights, size_t count, const Camera& camera, int width, int height);
+
+	// Gets the number of lights that were sent in the last update
+	static uint32_t GetLightCount() { return myLightCount; }
+
+	// Draws an ImGui panel with our settings
+	static void DrawInspector();
+
+private:
+	// The layout of our uniform block, in std140
+	struct Params {
+		glm::mat4  View;
+		glm::vec4  ProjectionParams;
+		glm::vec4  SliceParams;
+		glm::uvec4 GridSize;
+		glm::uvec4 Options;
+	};
+
+	static GLuint       myParamsBuffer;
+	static GLuint       myLightsBuffer;
+	static GLuint       myCountsBuffer;
+	static GLuint       myIndicesBuffer;
+	static Shader::Sptr myCullShader;
+	static uint32_t     myLightCount;
+	static bool         myShowHeatmap;
+};
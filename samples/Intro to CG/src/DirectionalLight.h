@@ -0,0 +1,14 @@
+#pragma once
+#include <GLM/glm.hpp>
+
+/*
+ * A light that is infinitely far away, like the sun. Only the first directional light in a scene is used, and
+ * it's shadows are drawn by ShadowMapping
+ */
+struct DirectionalLight {
+	// The direction that the light travels in
+	glm::vec3 Direction   = glm::normalize(glm::vec3(-0.4f, -0.3f, -1.0f));
+	glm::vec3 Color       = glm::vec3(1.0f);
+	float     Intensity   = 1.0f;
+	bool      CastShadows = true;
+};
@@ -0,0 +1,199 @@
+#include "FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <chrono>
+
+#include <GLFW/glfw3.h>
+#include "imgui.h"
+#include "Logging.h"
+
+#ifdef WINDOWS
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <timeapi.h>
+// Only defined in newer SDKs, supported on Windows 10 1803 and up
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+// Needed for timeBeginPeriod
+#pragma comment(lib, "winmm.lib")
+#endif
+
+FramePacer::FramePacer() :
+	myMode(PacingMode::VSync),
+	myTargetFps(60.0f),
+	isAdaptiveSupported(false),
+	myLastFrameTime(0.0),
+	mySleepMean(0.002),
+	mySleepVariance(0.0),
+	myWaitTimer(nullptr),
+	myFrameTimes{ 0.0f },
+	myFrameIx(0),
+	myFrameCount(0)
+{
+#ifdef WINDOWS
+	// Try to get a high resolution waitable timer, otherwise fall back to regular sleeps with a 1ms scheduler period
+	myWaitTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (myWaitTimer == nullptr) {
+		timeBeginPeriod(1);
+		LOG_WARN("High resolution timers not available, frame limiting will spin more");
+	}
+#endif
+}
+
+FramePacer::~FramePacer() {
+#ifdef WINDOWS
+	if (myWaitTimer != nullptr) {
+		CloseHandle(myWaitTimer);
+	} else {
+		timeEndPeriod(1);
+	}
+#endif
+}
+
+void FramePacer::Init(GLFWwindow* window) {
+	// Adaptive vsync is exposed through the swap_control_tear extensions
+	isAdaptiveSupported =
+		glfwExtensionSupported("WGL_EXT_swap_control_tear") == GLFW_TRUE ||
+		glfwExtensionSupported("GLX_EXT_swap_control_tear") == GLFW_TRUE;
+	myLastFrameTime = glfwGetTime();
+	__ApplySwapInterval();
+}
+
+void FramePacer::SetMode(PacingMode mode) {
+	myMode = mode;
+	__ApplySwapInterval();
+}
+
+void FramePacer::SetTargetFps(float fps) {
+	LOG_ASSERT(fps > 0.0f, "Target frame rate must be greater than 0!");
+	myTargetFps = fps;
+}
+
+void FramePacer::EndFrame() {
+	// If we are capped, wait until our target frame time has elapsed
+	if (myMode == PacingMode::Capped) {
+		double target = myLastFrameTime + 1.0 / myTargetFps;
+		__WaitUntil(target);
+	}
+
+	double now = glfwGetTime();
+	myFrameTimes[myFrameIx] = static_cast<float>((now - myLastFrameTime) * 1000.0);
+	myFrameIx = (myFrameIx + 1) % WindowSize;
+	myFrameCount = std::min(myFrameCount + 1, WindowSize);
+	myLastFrameTime = now;
+}
+
+FrameStats FramePacer::GetStats() const {
+	FrameStats result;
+	if (myFrameCount == 0)
+		return result;
+
+	// Copy to the stack and sort, at our window size this is cheaper than anything fancy
+	float sorted[WindowSize];
+	std::copy(myFrameTimes, myFrameTimes + myFrameCount, sorted);
+	std::sort(sorted, sorted + myFrameCount);
+
+	float sum = 0.0f;
+	for (int ix = 0; ix < myFrameCount; ix++)
+		sum += sorted[ix];
+
+	// Nearest rank percentiles
+	auto percentile = [&](float p) {
+		int rank = static_cast<int>(std::ceil(p * myFrameCount)) - 1;
+		return sorted[std::clamp(rank, 0, myFrameCount - 1)];
+	};
+
+	result.Average = sum / myFrameCount;
+	result.P50     = percentile(0.50f);
+	result.P95     = percentile(0.95f);
+	result.P99     = percentile(0.99f);
+	result.Max     = sorted[myFrameCount - 1];
+	result.Samples = myFrameCount;
+	return result;
+}
+
+void FramePacer::DrawEditor() {
+	// Mode selection
+	if (ImGui::BeginCombo("Pacing Mode", (~myMode).c_str())) {
+		for (int ix = 0; ix < 4; ix++) {
+			PacingMode mode = static_cast<PacingMode>(ix);
+			bool enabled = mode != PacingMode::AdaptiveVSync || isAdaptiveSupported;
+			if (ImGui::Selectable((~mode).c_str(), mode == myMode, enabled ? 0 : ImGuiSelectableFlags_Disabled)) {
+				SetMode(mode);
+			}
+		}
+		ImGui::EndCombo();
+	}
+	if (myMode == PacingMode::Capped) {
+		ImGui::DragFloat("Target FPS", &myTargetFps, 1.0f, 10.0f, 1000.0f);
+	}
+
+	// Statistics over our window
+	FrameStats stats = GetStats();
+	ImGui::Text("Avg: %.2fms (%.0f FPS)", stats.Average, stats.Average > 0.0f ? 1000.0f / stats.Average : 0.0f);
+	ImGui::Text("p50: %.2fms  p95: %.2fms  p99: %.2fms  max: %.2fms", stats.P50, stats.P95, stats.P99, stats.Max);
+	ImGui::PlotLines("Frame Times", myFrameTimes, WindowSize, myFrameIx, nullptr, 0.0f, stats.Max * 1.25f, ImVec2(0, 60));
+}
+
+void FramePacer::__ApplySwapInterval() {
+	switch (myMode) {
+		case PacingMode::VSync:
+			glfwSwapInterval(1);
+			break;
+		case PacingMode::AdaptiveVSync:
+			// Fall back to regular vsync if the driver won't let us tear
+			glfwSwapInterval(isAdaptiveSupported ? -1 : 1);
+			break;
+		case PacingMode::Uncapped:
+		case PacingMode::Capped:
+		default:
+			glfwSwapInterval(0);
+			break;
+	}
+}
+
+void FramePacer::__SleepOnce() {
+#ifdef WINDOWS
+	if (myWaitTimer != nullptr) {
+		// Relative times are negative, in 100ns units
+		LARGE_INTEGER due;
+		due.QuadPart = -10000LL;
+		SetWaitableTimerEx(myWaitTimer, &due, 0, nullptr, nullptr, nullptr, 0);
+		WaitForSingleObject(myWaitTimer, INFINITE);
+		return;
+	}
+#endif
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void FramePacer::__WaitUntil(double time) {
+	double now = glfwGetTime();
+
+	// If we've fallen more than a frame behind, don't try to catch up by bursting frames
+	if (now - time > 1.0 / myTargetFps) {
+		return;
+	}
+
+	// Sleep in 1ms steps while our remaining time is larger than what a sleep might take
+	double estimate = mySleepMean + std::sqrt(mySleepVariance);
+	while (time - now > estimate) {
+		double start = glfwGetTime();
+		__SleepOnce();
+		now = glfwGetTime();
+
+		// Update our estimate of how long a sleep takes, as an exponential moving mean and variance so we keep adapting
+		const double alpha = 0.05;
+		double observed = now - start;
+		double delta = observed - mySleepMean;
+		mySleepMean    += alpha * delta;
+		mySleepVariance = (1.0 - alpha) * (mySleepVariance + alpha * delta * delta);
+		estimate = mySleepMean + std::sqrt(mySleepVariance);
+	}
+
+	// Spin for the remaining time, this is where our precision comes from
+	while (glfwGetTime() < time) { }
+}
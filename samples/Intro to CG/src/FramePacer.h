@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <EnumToString.h>
+
+struct GLFWwindow;
+
+// Determines how the game will pace it's frames
+ENUM(PacingMode, int,
+	Uncapped      = 0, // Swap interval of 0, render as fast as we can
+	VSync         = 1, // Swap interval of 1, wait for every vertical blank
+	AdaptiveVSync = 2, // Swap interval of -1, tear instead of stalling when we miss a blank (if supported)
+	Capped        = 3  // Swap interval of 0, limit to a target frame rate by sleeping and spinning
+);
+
+// Frame time statistics over the pacer's rolling window, all in milliseconds
+struct FrameStats {
+	float Average = 0.0f;
+	float P50     = 0.0f;
+	float P95     = 0.0f;
+	float P99     = 0.0f;
+	float Max     = 0.0f;
+	int   Samples = 0;
+};
+
+/*
+ * Handles the swap interval and frame rate limiting for a window, and keeps a rolling
+ * window of frame times so we can see how consistent our frames are
+ */
+class FramePacer {
+public:
+	// The number of frames that we keep in our rolling window
+	static const int WindowSize = 256;
+
+	FramePacer();
+	~FramePacer();
+
+	/*
+	 * Attaches this pacer to a window, this window's context must be current
+	 * @param window The window that we are pacing the frames for
+	 */
+	void Init(GLFWwindow* window);
+
+	/*
+	 * Sets the pacing mode, and updates the swap interval for the current context
+	 * @param mode The new pacing mode to use
+	 */
+	void SetMode(PacingMode mode);
+	PacingMode GetMode() const { return myMode; }
+
+	/*
+	 * Sets the frame rate to limit to when in PacingMode::Capped
+	 * @param fps The target frame rate, in frames per second
+	 */
+	void SetTargetFps(float fps);
+	float GetTargetFps() const { return myTargetFps; }
+
+	// Gets whether the driver supports adaptive vsync (swap_control_tear)
+	bool IsAdaptiveSupported() const { return isAdaptiveSupported; }
+
+	/*
+	 * Should be called once per frame, right after swapping buffers. In capped mode this will
+	 * wait until the target frame time has elapsed, then records the frame's duration
+	 */
+	void EndFrame();
+
+	// Calculates the frame time statistics over our rolling window
+	FrameStats GetStats() const;
+
+	// Draws the ImGui controls and statistics for this pacer
+	void DrawEditor();
+
+private:
+	PacingMode myMode;
+	float      myTargetFps;
+	bool       isAdaptiveSupported;
+
+	// The time at the end of the last frame, in seconds
+	double     myLastFrameTime;
+
+	// Moving mean and variance of how long a 1ms OS sleep actually takes, so we know when to stop sleeping and start spinning
+	double     mySleepMean;
+	double     mySleepVariance;
+	// Platform specific high resolution timer handle (if available)
+	void*      myWaitTimer;
+
+	// Our rolling window of frame times, in milliseconds
+	float      myFrameTimes[WindowSize];
+	int        myFrameIx;
+	int        myFrameCount;
+
+	void __ApplySwapInterval();
+	void __SleepOnce();
+	void __WaitUntil(double time);
+};
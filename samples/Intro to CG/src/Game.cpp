@@ -11,6 +11,7 @@
 #include <GLM/glm.hpp>
 #include <GLM/gtc/matrix_transform.hpp> 
 #include <GLM/gtc/random.hpp>
+#include <GLM/gtc/constants.hpp>
 
 #include "SceneManager.h"
 #include "MeshRenderer.h"
@@ -20,8 +21,19 @@
 #include "TextureCube.h"
 #include "TextureSampler.h"
 #include "ObjLoader.h"
+#include "ResourceManager.h"
+#include "TextureStreamer.h"
+#include "RenderTargetPool.h"
+#include "ClusteredLighting.h"
+#include "OcclusionCulling.h"
+#include "ShadowMapping.h"
+#include "DirectionalLight.h"
+#include "PointLight.h"
 
 #include "MemoryTracking.h"
+#include "Profiler.h"
+#include "FrameArena.h"
+#include "PixelUploadRing.h"
 
 #include <functional>
 
@@ -100,6 +112,16 @@ void Game::Run()
 	
 	// Run as long as the window is open
 	while (!glfwWindowShouldClose(myWindow)) {
+		// Anything in the frame arena from two frames ago is now free to re-use
+		FrameArena::NextFrame();
+		Profiler::BeginFrame();
+		// Drop any unused resources if we've gone over our VRAM budget
+		ResourceManager::Update();
+		// Upload any texture levels that have finished loading, and start loading the ones we need next
+		TextureStreamer::Update();
+		// Delete any transient render targets that we haven't needed in a while
+		RenderTargetPool::NextFrame();
+
 		// Poll for events from windows (clicks, keypressed, closing, all that)
 		glfwPollEvents();
 
@@ -109,15 +131,33 @@ void Game::Run()
 		Update(deltaTime);
 		Draw(deltaTime);
 
-		ImGuiNewFrame();
-		DrawGui(deltaTime);
-		ImGuiEndFrame();
+		{
+			PROFILE_GPU_SCOPE("ImGui");
+			MEMORY_TAG_SCOPE("ImGui");
+			ImGuiNewFrame();
+			DrawGui(deltaTime);
+			ImGuiEndFrame();
+		}
 
 		// Store this frames time for the next go around
 		prevFrame = thisFrame;
 
+		// Fence this frame's texture uploads, so their part of the upload ring can be re-used once the GPU is done with them
+		PixelUploadRing::Global().Submit();
+
 		// Present our image to windows
-		glfwSwapBuffers(myWindow);
+		{
+			PROFILE_SCOPE("Swap");
+			glfwSwapBuffers(myWindow);
+		}
+
+		// Wait out the rest of our frame if we're limiting, and record how long it took
+		{
+			PROFILE_SCOPE("Pacing");
+			myFramePacer.EndFrame();
+		}
+
+		Profiler::EndFrame();
 	}
 
 	LOG_INFO("Shutting down...");
@@ -170,9 +210,16 @@ void Game::Initialize() {
 	glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE);
 
 	glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+	// Set up our swap interval and frame time tracking
+	myFramePacer.Init(myWindow);
+
+	// Set up our profiler's GPU queries
+	Profiler::Init();
 }
 
 void Game::Shutdown() {
+	Profiler::Shutdown();
 	glfwTerminate();
 }
 
@@ -210,7 +257,7 @@ Mesh::Sptr MakeInvertedCube() {
 	};
 
 	// Create a new mesh from the data
-	return std::make_shared<Mesh>(verts, 8, indices, 36);
+	return Mesh::Create(verts, 8, indices, 36);
 }
 
 Mesh::Sptr MakeSubdividedPlane(float size, uint32_t numSections) {
@@ -270,7 +317,7 @@ Mesh::Sptr MakeSubdividedPlane(float size, uint32_t numSections) {
 		}
 	}
 	// Create the result, then clean up the arrays we used
-	Mesh::Sptr result = std::make_shared<Mesh>(vertices, vertexCount, indices, indexCount);
+	Mesh::Sptr result = Mesh::Create(vertices, vertexCount, indices, indexCount);
 	std::stringstream stream;
 	stream << "PLANE-" << size << "-" << numSections;
 	result->SetDebugName(stream.str());
@@ -306,11 +353,16 @@ void dtorSort(entt::entity, entt::registry& ecs) {
 	sortRenderers(ecs);
 }
 void Game::LoadContent() {
+	MEMORY_TAG_SCOPE("Content");
+
 	myCamera = std::make_shared<Camera>();
 	myCamera->SetPosition(glm::vec3(5, 5, 5));
 	myCamera->LookAt(glm::vec3(0), glm::vec3(0, 0, 1));
 	myCamera->Projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.01f, 1000.0f);
 
+	ClusteredLighting::Init();
+	OcclusionCulling::Init();
+	ShadowMapping::Init();
 		
 	// Create our 4 vertices
 	Vertex vertices[4] = {
@@ -328,21 +380,21 @@ void Game::LoadContent() {
 		2, 1, 3 
 	};
 	
-	Mesh::Sptr myMesh = std::make_shared<Mesh>(vertices, 4, indices, 6);		
+	Mesh::Sptr myMesh = Mesh::Create(vertices, 4, indices, 6);		
 
-	Mesh::Sptr monkey = ObjLoader::LoadObjToMesh("sphere.obj");
+	Mesh::Handle monkey = ResourceManager::LoadMesh("sphere.obj");
 
 	// New in tutorial 09
 	SamplerDesc desciption = SamplerDesc();
 	desciption.MinFilter = MinFilter::NearestMipNearest;
 	desciption.MagFilter = MagFilter::Nearest;
-	TextureSampler::Sptr NearestMipped = std::make_shared<TextureSampler>(desciption);
+	TextureSampler::Sptr NearestMipped = TextureSampler::Create(desciption);
 	NearestMipped->SetDebugName("Nearest");
 
 	desciption = SamplerDesc();
 	desciption.MinFilter = MinFilter::LinearMipLinear;
 	desciption.MagFilter = MagFilter::Linear;
-	TextureSampler::Sptr Trilinear = std::make_shared<TextureSampler>(desciption);
+	TextureSampler::Sptr Trilinear = TextureSampler::Create(desciption);
 	Trilinear->SetDebugName("Trilinear");
 
 	Samplers.push_back(nullptr);
@@ -358,8 +410,7 @@ void Game::LoadContent() {
 	scene->Registry().on_construct<MeshRenderer>().connect<&::ctorSort>();
 	scene->Registry().on_destroy<MeshRenderer>().connect<&::dtorSort>();
 
-	scene->SkyboxShader = std::make_shared<Shader>();
-	scene->SkyboxShader->Load("shaders/cubemap.vs.glsl", "shaders/cubemap.fs.glsl");
+	scene->SkyboxShader = ResourceManager::LoadShader("shaders/cubemap.vs.glsl", "shaders/cubemap.fs.glsl").ToShared();
 	scene->SkyboxMesh = MakeInvertedCube();
 	
 	std::string files[6] = {
@@ -370,48 +421,44 @@ void Game::LoadContent() {
 		std::string("cubemap/scene_ft.jpg"), 
 		std::string("cubemap/scene_bk.jpg"), 
 	};
-	scene->Skybox = TextureCube::LoadFromFiles(files, false);
+	scene->Skybox = ResourceManager::LoadTextureCube(files, false).ToShared();
 
 
-	Texture2D::Sptr albedo = Texture2D::LoadFromFile("color-grid.png");
+	Texture2D::Sptr albedo = ResourceManager::LoadTexture2D("color-grid.png").ToShared();
 	Textures.push_back(albedo); 
-	Texture2D::Sptr metallic = Texture2D::LoadFromFile("metallic.png");
-	Textures.push_back(albedo);
+	Texture2D::Sptr metallic = ResourceManager::LoadTexture2D("metallic.png").ToShared();
+	Textures.push_back(metallic);
 
 	Texture2DDescription tinyDesc = Texture2DDescription();
 	tinyDesc.Width = tinyDesc.Height = 1;
 	tinyDesc.Format = InternalFormat::RGB8;
 	tinyDesc.EnableMip = false;
 	
-	Texture2D::Sptr white = std::make_shared<Texture2D>(tinyDesc);
+	Texture2D::Sptr white = Texture2D::Create(tinyDesc);
 	uint8_t dataW[3] = { 0xFFu, 0xFFu, 0xFFu };
 	white->LoadData(&dataW, 1, 1, PixelFormat::Rgb, PixelType::UByte);
 	white->SetDebugName("<white>");
 	Textures.push_back(white);
 
-	Texture2D::Sptr gray = std::make_shared<Texture2D>(tinyDesc);
+	Texture2D::Sptr gray = Texture2D::Create(tinyDesc);
 	uint8_t dataG[3] = { 0x80u, 0x80u, 0x80u };
 	gray->LoadData(&dataG, 1, 1, PixelFormat::Rgb, PixelType::UByte);
 	gray->SetDebugName("<gray>");
 	Textures.push_back(gray);
 
-	Texture2D::Sptr lBlue = std::make_shared<Texture2D>(tinyDesc);
+	Texture2D::Sptr lBlue = Texture2D::Create(tinyDesc);
 	uint8_t dataLB[3] = { 0x80u, 0x80u, 0xFFu };
 	lBlue->LoadData(&dataLB, 1, 1, PixelFormat::Rgb, PixelType::UByte);
 	lBlue->SetDebugName("<light blue>");
 	Textures.push_back(lBlue);
 	 
-	Shader::Sptr phong = std::make_shared<Shader>();
-	phong->Load("shaders/lighting.vs.glsl", "shaders/blinn-phong-environment.fs.glsl"); 
+	// Lit by the scene's PointLights, see ClusteredLighting
+	Shader::Handle phong = ResourceManager::LoadShader("shaders/lighting.vs.glsl", "shaders/blinn-phong-clustered.fs.glsl");
 
-	Material::Sptr testMat = std::make_shared<Material>(phong);
-	testMat->Set("a_LightPos", { 2, 0, 4 });
-	testMat->Set("a_LightColor", { 1.0f, 1.0f, 1.0f });
+	Material::Sptr testMat = Material::Create(phong);
 	testMat->Set("a_AmbientColor", { 1.0f, 1.0f, 1.0f });
 	testMat->Set("a_AmbientPower", 0.1f);
-	testMat->Set("a_LightSpecPower", 0.5f);  
 	testMat->Set("a_LightShininess", 256.0f);
-	testMat->Set("a_LightAttenuation", 1.0f / 100.0f);
 	testMat->Set("s_Albedo", albedo, Trilinear);
 	testMat->Set("s_Metallic", metallic, Trilinear);
 	testMat->Set("s_Environment", scene->Skybox, Trilinear);
@@ -425,7 +472,6 @@ void Game::LoadContent() {
 	{
 		auto& ecs = GetRegistry("Test");  
 
-		if (false)
 		{
 			entt::entity e1 = ecs.create();  
 			MeshRenderer& m1 = ecs.assign<MeshRenderer>(e1);    
@@ -452,11 +498,10 @@ void Game::LoadContent() {
 		}
 		{
 
-			Shader::Sptr waterShader = std::make_shared<Shader>();
-			waterShader->Load("shaders/water-shader.vs.glsl", "shaders/water-shader.fs.glsl");
+			Shader::Handle waterShader = ResourceManager::LoadShader("shaders/water-shader.vs.glsl", "shaders/water-shader.fs.glsl");
 			waterShader->SetDebugName("Water Shader");
 
-			Material::Sptr testMat = std::make_shared<Material>(waterShader);
+			Material::Sptr testMat = Material::Create(waterShader);
 			testMat->IsBlendingEnabled = true;
 
 			testMat->Set("a_EnabledWaves", 4);
@@ -500,12 +545,46 @@ void Game::LoadContent() {
 			auto& up = ecs.get_or_assign<UpdateBehaviour>(e1);
 			up.Function = rotate;
 		}
+		// Our sun, which casts the scene's shadows
+		{
+			entt::entity e1 = ecs.create();
+			DirectionalLight& sun = ecs.assign<DirectionalLight>(e1);
+			sun.Color = glm::vec3(1.0f, 0.95f, 0.85f);
+			sun.Intensity = 0.8f;
+		}
+		// A field of small lights drifting over the floor, to show off the clustered lighting
+		for (int ix = 0; ix < 512; ix++) {
+			entt::entity e1 = ecs.create();
+			PointLight& light = ecs.assign<PointLight>(e1);
+			light.Color = glm::linearRand(glm::vec3(0.2f), glm::vec3(1.0f));
+			light.Intensity = 2.0f;
+			light.Radius = glm::linearRand(1.0f, 2.5f);
+			auto& transform = ecs.assign<TempTransform>(e1);
+			transform.Scale = glm::vec3(1.0f);
+			glm::vec2 center = glm::linearRand(glm::vec2(-10.0f), glm::vec2(10.0f));
+			transform.Position = glm::vec3(center, 0.5f);
+
+			float phase = glm::linearRand(0.0f, glm::two_pi<float>());
+			float speed = glm::linearRand(0.5f, 1.5f);
+			auto drift = [=](entt::entity e, float dt) {
+				float time = (float)glfwGetTime() * speed + phase;
+				CurrentRegistry().get<TempTransform>(e).Position = glm::vec3(center + glm::vec2(glm::cos(time), glm::sin(time)), 0.5f);
+			};
+			auto& up = ecs.get_or_assign<UpdateBehaviour>(e1);
+			up.Function = drift;
+		}
 	}
 
 }
 
 void Game::UnloadContent() {
 	SceneManager::DestroyScenes();
+	TextureStreamer::Clear();
+	RenderTargetPool::Clear();
+	ClusteredLighting::Shutdown();
+	OcclusionCulling::Shutdown();
+	ShadowMapping::Shutdown();
+	ResourceManager::Clear();
 }
 
 void Game::InitImGui() {
@@ -576,6 +655,8 @@ void Game::ImGuiEndFrame() {
 }
 
 void Game::Update(float deltaTime) {
+	PROFILE_SCOPE("Update");
+
 	glm::vec3 movement = glm::vec3(0.0f);
 	glm::vec3 rotation = glm::vec3(0.0f);
 
@@ -625,6 +706,8 @@ void Game::Update(float deltaTime) {
 }
 
 void Game::Draw(float deltaTime) {
+	PROFILE_GPU_SCOPE("Draw");
+
 	// Clear our screen every frame
 	glClearColor(myClearColor.x, myClearColor.y, myClearColor.z, myClearColor.w);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -633,13 +716,16 @@ void Game::Draw(float deltaTime) {
 	auto& ecs = CurrentRegistry();
 
 	// These will keep track of the current shader and material that we have bound
-	Material::Sptr mat = nullptr;
-	Shader::Sptr boundShader = nullptr;
+	// (raw pointers, since the renderers' handles keep them alive and we don't want to touch the ref counts every draw)
+	Material* mat = nullptr;
+	Shader* boundShader = nullptr;
 	   
 	auto scene = CurrentScene();
 	// Draw the skybox after everything else, if the scene has one
 	if (scene->Skybox)
 	{
+		PROFILE_GPU_SCOPE("Skybox");
+
 		// Disable culling
 		glDisable(GL_CULL_FACE);
 		// Set our depth test to less or equal (because we are at depth of 1.0f)
@@ -665,55 +751,167 @@ void Game::Draw(float deltaTime) {
 		glDepthFunc(GL_LESS);
 	}
 	
+	// We need the size of the screen to build our light clusters, and to work out how big things are on it
+	int screenWidth = 0, screenHeight = 0;
+	glfwGetFramebufferSize(myWindow, &screenWidth, &screenHeight);
+
+	// Gather up our lights and sort them into clusters, before anything that is lit gets drawn
+	{
+		PROFILE_GPU_SCOPE("Light Culling");
+		FrameVector<ClusteredLighting::GpuLight> lights;
+		lights.reserve(ecs.size<PointLight>());
+		ecs.view<PointLight, TempTransform>().each([&](const PointLight& light, const TempTransform& transform) {
+			lights.push_back({
+				glm::vec4(transform.Position, light.Radius),
+				glm::vec4(light.Color, light.Intensity)
+			});
+		});
+		ClusteredLighting::Update(lights.data(), lights.size(), *myCamera, screenWidth, screenHeight);
+	}
+
 	// A view will let us iterate over all of our entities that have the given component types
 	auto view = ecs.view<MeshRenderer>();
 
+	// Collect everything we're going to draw, along with it's bounds for occlusion culling
+	struct DrawItem {
+		const MeshRenderer* Renderer;
+		glm::mat4           World;
+		float               Scale;
+	};
+	FrameVector<DrawItem> draws;
+	FrameVector<OcclusionCulling::DrawBounds> bounds;
+	draws.reserve(view.size());
+	bounds.reserve(view.size());
 	for (const auto& entity : view) {
-		
-		// Get our shader
 		const MeshRenderer& renderer = ecs.get<MeshRenderer>(entity);
-		
+
 		// Early bail if mesh is invalid
 		if (renderer.Mesh == nullptr || renderer.Material == nullptr)
 			continue;
+
+		// We'll need some info about the entities position in the world
+		const TempTransform& transform = ecs.get_or_assign<TempTransform>(entity);
+		glm::mat4 world = transform.GetWorldTransform();
+		float scale = glm::max(glm::length(glm::vec3(world[0])), glm::max(glm::length(glm::vec3(world[1])), glm::length(glm::vec3(world[2]))));
+
+		draws.push_back({ &renderer, world, scale });
+		bounds.push_back({
+			glm::vec4(glm::vec3(world[3]), renderer.Mesh->GetBoundingRadius() * scale),
+			glm::uvec4((uint32_t)renderer.Mesh->GetDrawCount(), 0, 0, 0)
+		});
+	}
+
+	// Test our bounds against last frame's depth, this writes the indirect commands that all of our draws use
+	{
+		PROFILE_GPU_SCOPE("Occlusion Culling");
+		OcclusionCulling::Cull(bounds.data(), bounds.size());
+	}
+
+	// Draw any shadow cascades that need it, before anything that receives shadows
+	{
+		PROFILE_GPU_SCOPE("Shadows");
+		const DirectionalLight* sun = nullptr;
+		for (const auto& entity : ecs.view<DirectionalLight>()) {
+			sun = &ecs.get<DirectionalLight>(entity);
+			break;
+		}
+		FrameVector<ShadowMapping::ShadowCaster> casters;
+		casters.reserve(draws.size());
+		for (size_t ix = 0; ix < draws.size(); ix++) {
+			// Transparent things let the light through
+			if (!draws[ix].Renderer->Material->IsBlendingEnabled)
+				casters.push_back({ draws[ix].Renderer->Mesh.Get(), draws[ix].World, bounds[ix].CenterRadius });
+		}
+		ShadowMapping::Render(sun, *myCamera, casters.data(), casters.size());
+		glViewport(0, 0, screenWidth, screenHeight);
+	}
+
+	// Lay down the depth of our opaque meshes first, so that the expensive shaders only run once per pixel
+	bool prepass = OcclusionCulling::IsPrepassEnabled();
+	if (prepass) {
+		PROFILE_GPU_SCOPE("Depth Prepass");
+		Shader* depthShader = OcclusionCulling::GetDepthShader().get();
+		depthShader->Bind();
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		glDisable(GL_BLEND);
+		for (size_t ix = 0; ix < draws.size(); ix++) {
+			const MeshRenderer& renderer = *draws[ix].Renderer;
+			// Transparent things don't hide what's behind them
+			if (renderer.Material->IsBlendingEnabled)
+				continue;
+			if (renderer.Material->IsCullingEnabled)
+				glEnable(GL_CULL_FACE);
+			else
+				glDisable(GL_CULL_FACE);
+			depthShader->SetUniform("a_ModelViewProjection", myCamera->GetViewProjection() * draws[ix].World);
+			renderer.Mesh->DrawIndirect(OcclusionCulling::DrawCommandOffset(ix));
+		}
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+		// Next frame's culling is tested against this frame's depth
+		OcclusionCulling::BuildHiZ(*myCamera, screenWidth, screenHeight);
+
+		// Our opaque meshes are already in the depth buffer, so they only need to match it
+		glDepthFunc(GL_LEQUAL);
+	}
+
+	// Counts the fragments each pixel shades instead of drawing our materials
+	bool showOverdraw = OcclusionCulling::IsOverdrawEnabled();
+	if (showOverdraw)
+		OcclusionCulling::BeginOverdraw(screenWidth, screenHeight);
+
+	PROFILE_GPU_SCOPE("Meshes");
+
+	for (size_t ix = 0; ix < draws.size(); ix++) {
+		
+		// Get our shader
+		const MeshRenderer& renderer = *draws[ix].Renderer;
+		Shader* shader = showOverdraw ? OcclusionCulling::GetOverdrawShader().get() : renderer.Material->GetShader().Get();
 		
 		// If our shader has changed, we need to bind it and update our frame-level uniforms
-		if (renderer.Material->GetShader() != boundShader) {
-			boundShader = renderer.Material->GetShader();
+		if (shader != boundShader) {
+			boundShader = shader;
 			boundShader->Bind();
 			boundShader->SetUniform("a_CameraPos", myCamera->GetPosition());
 			boundShader->SetUniform("a_Time", (float)glfwGetTime());
 		}
 		
 		// If our material has changed, we need to apply it to the shader
-		if (renderer.Material != mat) {
-			mat = renderer.Material;
+		if (renderer.Material.Get() != mat) {
+			mat = renderer.Material.Get();
 			if (mat->PreFrame)
-				mat->PreFrame(mat);
+				mat->PreFrame(renderer.Material);
 			mat->Apply();
 		}
 		
-		// We'll need some info about the entities position in the world
-		const TempTransform& transform = ecs.get_or_assign<TempTransform>(entity);
-		
+		const glm::mat4& world = draws[ix].World;
+
 		// Our normal matrix is the inverse-transpose of our object's world rotation
-		glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(transform.GetWorldTransform())));
+		glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(world)));
 
 		// Update the MVP using the item's transform
-		mat->GetShader()->SetUniform(
-			"a_ModelViewProjection",
-			myCamera->GetViewProjection() *
-			transform.GetWorldTransform());  
+		shader->SetUniform("a_ModelViewProjection", myCamera->GetViewProjection() * world);
 
 		// Update the model matrix to the item's world transform
-		mat->GetShader()->SetUniform("a_Model", transform.GetWorldTransform());
+		shader->SetUniform("a_Model", world);
 
 		// Update the model matrix to the item's world transform
-		mat->GetShader()->SetUniform("a_NormalMatrix", normalMatrix);
+		shader->SetUniform("a_NormalMatrix", normalMatrix);
 
-		// Draw the item
-		renderer.Mesh->Draw();   
+		// Estimate how many pixels the mesh covers from it's bounding sphere, so that the streamer can load the right
+		// mip levels for it's textures (Projection[1][1] is 1 / tan(fov / 2), which maps view space onto the screen)
+		float distance = glm::max(glm::distance(glm::vec3(world[3]), myCamera->GetPosition()), 0.01f);
+		float screenSize = renderer.Mesh->GetBoundingRadius() * draws[ix].Scale * myCamera->Projection[1][1] * screenHeight / distance;
+		mat->ForEachTexture([screenSize](const ITexture* texture) { TextureStreamer::ReportUsage(texture, screenSize); });
+
+		// Draw the item, if the occlusion test decided it's hidden the command will draw 0 instances
+		renderer.Mesh->DrawIndirect(OcclusionCulling::DrawCommandOffset(ix));
 	}
+
+	if (showOverdraw)
+		OcclusionCulling::EndOverdraw();
+	if (prepass)
+		glDepthFunc(GL_LESS);
 }
 
 void Game::DrawGui(float deltaTime) {
@@ -757,37 +955,109 @@ void Game::DrawGui(float deltaTime) {
 		// Draw a formatted text line
 		ImGui::Text("Time: %f", glfwGetTime());
 
+		if (ImGui::CollapsingHeader("Frame Pacing")) {
+			myFramePacer.DrawEditor();
+		}
+		if (ImGui::CollapsingHeader("Resources")) {
+			ResourceManager::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Texture Streaming")) {
+			TextureStreamer::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Lighting")) {
+			ClusteredLighting::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Occlusion Culling")) {
+			OcclusionCulling::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Shadows")) {
+			ShadowMapping::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Render Targets")) {
+			RenderTargetPool::DrawInspector();
+		}
+		if (ImGui::CollapsingHeader("Frame Arena")) {
+			const LinearArena& arena = FrameArena::Previous();
+			ImGui::Text("Last frame: %zu / %zu bytes", arena.GetUsed(), arena.GetCapacity());
+			ImGui::Text("High water: %zu bytes, grown %zu times", arena.GetHighWater(), arena.GetGrowCount());
+		}
+
+		// Our memory counters are merged across threads, so we only grab them once
+		MemoryStats memory = MemoryTracking::GetStats();
 		{
 			static float data[100];
 			static int ix = 0;
-			data[ix++] = (float)MemoryTracking::NumAllocs;
+			data[ix++] = (float)memory.NumAllocs;
 			ix %= 100;
 			ImGui::PlotLines("Num Allocations", data, 100);
-			ImGui::Text("%d", MemoryTracking::NumAllocs);
+			ImGui::Text("%lld", (long long)memory.NumAllocs);
 		}
 		{
 			static float data[100];
 			static int ix = 0;
-			data[ix++] = (float)MemoryTracking::TotalAllocs;
+			data[ix++] = (float)memory.TotalAllocs;
 			ix %= 100;
 			ImGui::PlotLines("Total Allocations", data, 100);
-			ImGui::Text("%d", MemoryTracking::TotalAllocs);
+			ImGui::Text("%lld", (long long)memory.TotalAllocs);
 		}
 		{
 			static float data[100];
 			static int ix = 0;
-			data[ix++] = (float)MemoryTracking::NumBytes;
+			data[ix++] = (float)memory.NumBytes;
 			ix %= 100;
 			ImGui::PlotLines("Num Bytes", data, 100);
-			ImGui::Text("%d", MemoryTracking::NumBytes);
+			ImGui::Text("%lld", (long long)memory.NumBytes);
 		}
 		{
 			static float data[100];
 			static int ix = 0;
-			data[ix++] = (float)MemoryTracking::TotalBytes;
+			data[ix++] = (float)memory.TotalBytes;
 			ix %= 100;
 			ImGui::PlotLines("Total Bytes", data, 100);
-			ImGui::Text("%d", MemoryTracking::TotalBytes);
+			ImGui::Text("%lld", (long long)memory.TotalBytes);
+		}
+
+		// Break our allocations down by the tag that was active when they were made
+		if (ImGui::CollapsingHeader("Memory Tags")) {
+			ImGui::Columns(3);
+			ImGui::Text("Tag"); ImGui::NextColumn();
+			ImGui::Text("Live Allocs"); ImGui::NextColumn();
+			ImGui::Text("Live Bytes"); ImGui::NextColumn();
+			for (uint16_t tag = 0; tag < MemoryTracking::GetTagCount(); tag++) {
+				MemoryStats tagStats = MemoryTracking::GetTagStats(tag);
+				ImGui::Text("%s", MemoryTracking::GetTagName(tag)); ImGui::NextColumn();
+				ImGui::Text("%lld", (long long)tagStats.NumAllocs); ImGui::NextColumn();
+				ImGui::Text("%lld", (long long)tagStats.NumBytes); ImGui::NextColumn();
+			}
+			ImGui::Columns(1);
+		}
+
+		// Sampled call sites, so we can find out where our allocations are coming from
+		if (ImGui::CollapsingHeader("Allocation Sites")) {
+			int rate = (int)MemoryTracking::GetSampleRate();
+			if (ImGui::InputInt("Sample 1 in N (0 = off)", &rate)) {
+				MemoryTracking::SetSampleRate((uint32_t)std::max(rate, 0));
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Reset")) {
+				MemoryTracking::ResetAllocationSites();
+			}
+
+			AllocationSite sites[16];
+			size_t numSites = MemoryTracking::GetAllocationSites(sites, 16);
+			char name[256];
+			for (size_t siteIx = 0; siteIx < numSites; siteIx++) {
+				MemoryTracking::DescribeAddress(sites[siteIx].Frames[0], name, sizeof(name));
+				ImGui::PushID((int)siteIx);
+				if (ImGui::TreeNode("site", "%lld samples, %lld bytes: %s", (long long)sites[siteIx].Count, (long long)sites[siteIx].Bytes, name)) {
+					for (int frameIx = 1; frameIx < AllocationSite::MaxFrames && sites[siteIx].Frames[frameIx]; frameIx++) {
+						MemoryTracking::DescribeAddress(sites[siteIx].Frames[frameIx], name, sizeof(name));
+						ImGui::Text("%s", name);
+					}
+					ImGui::TreePop();
+				}
+				ImGui::PopID();
+			}
 		}
 
 		// Start a new ImGui header for our camera settings
@@ -832,4 +1102,7 @@ void Game::DrawGui(float deltaTime) {
 		}
 		ImGui::End();
 	}
+
+	// Our frame timeline
+	Profiler::DrawGui();
 }
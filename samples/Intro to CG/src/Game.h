@@ -12,6 +12,7 @@
 #include "Mesh.h"
 #include "Shader.h"
 #include "Camera.h"
+#include "FramePacer.h"
 
 class Game {
 public:
@@ -49,6 +50,9 @@ private:
 
 	Camera::Sptr myCamera;
 
+	// Handles our swap interval and frame limiting
+	FramePacer  myFramePacer;
+
 	// Our models transformation matrix
 	glm::mat4   myModelTransform;
 };
\ No newline at end of file
@@ -7,6 +7,8 @@ class GraphicsResource {
 public:
 	virtual inline void SetDebugName(const std::string& name) { myDebugName = name;  glObjectLabel(identifier, myRenderhandle, -1, name.c_str()); }
 	const std::string& GetDebugName() const { return myDebugName; }
+	// Gets the underlying OpenGL object name for this resource
+	GLuint GetRenderHandle() const { return myRenderhandle; }
 	
 protected:
 	GraphicsResource() : myRenderhandle(0), myDebugName(std::string()) {};
@@ -45,7 +45,7 @@ void Material::Apply() {
 
 Material::Sptr Material::Clone()
 {
-	Sptr result = std::make_shared<Material>(*this);
+	Sptr result = Create(*this);
 
 	return result;
 }
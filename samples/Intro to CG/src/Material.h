@@ -7,6 +7,7 @@
 #include "Texture2D.h"
 #include "TextureSampler.h"
 #include "TextureCube.h"
+#include "ResourcePool.h"
 
 /*
 Represents settings for a shader
@@ -14,15 +15,23 @@ Represents settings for a shader
 class Material {
 public:
 	typedef std::shared_ptr<Material> Sptr;
+	typedef ResourceHandle<Material> Handle;
 
-	std::function<void(Sptr)> PreFrame;
+	/*
+	 * Creates a new material in the material pool
+	 * @param args The arguments to pass to the material's constructor
+	 */
+	template <typename... Args>
+	static Sptr Create(Args&&... args) { return CreatePooled<Material>(std::forward<Args>(args)...); }
+
+	std::function<void(const Handle&)> PreFrame;
 	bool IsBlendingEnabled;
 	bool IsCullingEnabled;
 	
-	Material(const Shader::Sptr& shader) { myShader = shader; IsBlendingEnabled = false; IsCullingEnabled = true; }
+	Material(const Shader::Handle& shader) { myShader = shader; IsBlendingEnabled = false; IsCullingEnabled = true; }
 	virtual ~Material() = default;
 	
-	const Shader::Sptr& GetShader() const { return myShader; }
+	const Shader::Handle& GetShader() const { return myShader; }
 	virtual void Apply();
 
 	Sptr Clone();
@@ -37,6 +46,15 @@ public:
 	// New in tutorial 06
 	void Set(const std::string& name, const ITexture::Sptr& value, const TextureSampler::Sptr& sampler = nullptr) { myTextures[name] = { value, sampler }; }
 
+	// Calls func with every texture that has been set on this material
+	template <typename Func>
+	void ForEachTexture(Func&& func) const {
+		for (const auto& kvp : myTextures) {
+			if (kvp.second.Texture != nullptr)
+				func(kvp.second.Texture.get());
+		}
+	}
+
 	void DrawEditor(const std::vector<TextureSampler::Sptr>& samplerOptions, const std::vector<Texture2D::Sptr>& textureOptions);
 	
 protected:
@@ -44,7 +62,7 @@ protected:
 		ITexture::Sptr       Texture;
 		TextureSampler::Sptr Sampler;
 	};
-	Shader::Sptr myShader;
+	Shader::Handle myShader;
 	std::unordered_map<std::string, glm::mat4> myMat4s;
 	std::unordered_map<std::string, glm::vec4> myVec4s;
 	std::unordered_map<std::string, glm::vec3> myVec3s;
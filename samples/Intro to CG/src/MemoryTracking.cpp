@@ -1,55 +1,438 @@
 #include "MemoryTracking.h"
-#include "Logging.h"
 
-size_t MemoryTracking::NumAllocs = 0;
-size_t MemoryTracking::TotalAllocs = 0;
-size_t MemoryTracking::NumBytes = 0;
-size_t MemoryTracking::TotalBytes = 0;
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
 
-MemoryTracking::StackEntry MemoryTracking::myStack[100];
-uint32_t   MemoryTracking::myStackIx;
+#ifdef WINDOWS
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <DbgHelp.h>
+#include <intrin.h>
+#pragma comment(lib, "dbghelp.lib")
+#define RETURN_ADDRESS() _ReturnAddress()
+#else
+#define RETURN_ADDRESS() __builtin_return_address(0)
+#endif
 
-void MemoryTracking::NotifyAlloc(size_t size, void* block) {
-	myStack[myStackIx].NumAllocs++;
-	myStack[myStackIx].NumBytes += size;
-	NumAllocs++;
-	NumBytes += size;
-	TotalAllocs++;
-	TotalBytes += size;
+// NOTE: Nothing in this file can allocate through operator new, or we'd recurse into ourselves. All of our
+// state is in fixed size, zero initialized arrays so it's ready before any static constructors run
+
+namespace {
+	// Stored in front of every block we hand out, 16 bytes so we keep malloc's alignment
+	struct BlockHeader {
+		uint64_t Size;
+		uint16_t Tag;
+		uint16_t Reserved;
+		uint32_t Magic;
+	};
+	static_assert(sizeof(BlockHeader) == 16, "Block headers must keep 16 byte alignment");
+	const uint32_t HeaderMagic = 0x4D454D54; // "MEMT"
+
+	// The number of threads that get their own counters, any threads past this share an overflow slot
+	const uint32_t MaxThreads = 64;
+	// The number of unique call sites each thread can track
+	const uint32_t MaxSites = 256;
+	// The depth of each thread's tag stack
+	const uint32_t MaxTagDepth = 32;
+
+	struct SiteEntry {
+		// A hash of Frames, 0 means the entry is empty. Published with release semantics after the frames are written
+		std::atomic<uint64_t> Hash;
+		void*                 Frames[AllocationSite::MaxFrames];
+		std::atomic<int64_t>  Count;
+		std::atomic<int64_t>  Bytes;
+	};
+
+	// All of a single thread's counters. Only the owning thread writes to these, so we can get away with
+	// relaxed loads and stores instead of locked read-modify-writes (except for the shared overflow slot)
+	struct alignas(64) ThreadSlot {
+		std::atomic<int64_t> NumAllocs;
+		std::atomic<int64_t> TotalAllocs;
+		std::atomic<int64_t> NumBytes;
+		std::atomic<int64_t> TotalBytes;
+		std::atomic<int64_t> TagAllocs[MemoryTracking::MaxTags];
+		std::atomic<int64_t> TagBytes[MemoryTracking::MaxTags];
+		std::atomic<int64_t> TagTotalAllocs[MemoryTracking::MaxTags];
+		std::atomic<int64_t> TagTotalBytes[MemoryTracking::MaxTags];
+		SiteEntry            Sites[MaxSites];
+	};
+
+	// Each thread's stack of active tags, and the counters when each PushStack happened
+	struct TagStack {
+		uint16_t Tags[MaxTagDepth];
+		int64_t  StartAllocs[MaxTagDepth];
+		int64_t  StartBytes[MaxTagDepth];
+		uint32_t Depth;
+	};
+
+	ThreadSlot               g_Slots[MaxThreads + 1];
+	std::atomic<uint32_t>    g_SlotCount{ 0 };
+
+	char                     g_TagNames[MemoryTracking::MaxTags][MemoryTracking::MaxTagName] = { "Untagged" };
+	std::atomic<uint16_t>    g_TagCount{ 1 };
+	std::atomic_flag         g_TagLock = ATOMIC_FLAG_INIT;
+
+	std::atomic<uint32_t>    g_SampleRate{ 0 };
+
+	thread_local ThreadSlot* tl_Slot = nullptr;
+	thread_local TagStack    tl_Tags;
+	thread_local uint32_t    tl_SampleCountdown = 0;
+
+	inline ThreadSlot* GetSlot() {
+		if (tl_Slot == nullptr) {
+			uint32_t index = g_SlotCount.fetch_add(1, std::memory_order_relaxed);
+			if (index >= MaxThreads) {
+				index = MaxThreads;
+			}
+			tl_Slot = &g_Slots[index];
+		}
+		return tl_Slot;
+	}
+
+	// The overflow slot is shared between threads, so it needs proper atomic adds
+	inline bool IsShared(const ThreadSlot* slot) {
+		return slot == &g_Slots[MaxThreads];
+	}
+
+	inline void Add(ThreadSlot* slot, std::atomic<int64_t>& counter, int64_t value) {
+		if (IsShared(slot))
+			counter.fetch_add(value, std::memory_order_relaxed);
+		else
+			counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	inline uint16_t CurrentTag() {
+		// Pushes past MaxTagDepth aren't stored, so anything deeper uses the deepest tag we have
+		return tl_Tags.Depth > 0 ? tl_Tags.Tags[std::min(tl_Tags.Depth, MaxTagDepth) - 1] : 0;
+	}
+
+	void RecordSite(ThreadSlot* slot, void* caller, size_t size) {
+		AllocationSite site = {};
+		site.Frames[0] = caller;
+#ifdef WINDOWS
+		// Skip ourselves, Allocate and operator new, so the first frame should be our caller
+		void* frames[AllocationSite::MaxFrames];
+		USHORT count = CaptureStackBackTrace(3, AllocationSite::MaxFrames, frames, nullptr);
+		for (USHORT ix = 0; ix < count; ix++)
+			site.Frames[ix] = frames[ix];
+		if (count == 0)
+			site.Frames[0] = caller;
+#endif
+		// FNV-1a over our frame addresses
+		uint64_t hash = 1469598103934665603ull;
+		for (int ix = 0; ix < AllocationSite::MaxFrames; ix++) {
+			hash = (hash ^ reinterpret_cast<uintptr_t>(site.Frames[ix])) * 1099511628211ull;
+		}
+		hash = hash == 0 ? 1 : hash;
+
+		// Open addressing, if the table is full we just drop the sample
+		for (uint32_t probe = 0; probe < MaxSites; probe++) {
+			SiteEntry& entry = slot->Sites[(hash + probe) % MaxSites];
+			uint64_t existing = entry.Hash.load(std::memory_order_acquire);
+			if (existing == 0) {
+				memcpy(entry.Frames, site.Frames, sizeof(site.Frames));
+				entry.Count.store(1, std::memory_order_relaxed);
+				entry.Bytes.store(static_cast<int64_t>(size), std::memory_order_relaxed);
+				entry.Hash.store(hash, std::memory_order_release);
+				return;
+			}
+			if (existing == hash && memcmp(entry.Frames, site.Frames, sizeof(site.Frames)) == 0) {
+				Add(slot, entry.Count, 1);
+				Add(slot, entry.Bytes, static_cast<int64_t>(size));
+				return;
+			}
+		}
+	}
+}
+
+void* MemoryTracking::Allocate(size_t size, void* caller) {
+	BlockHeader* header = static_cast<BlockHeader*>(malloc(size + sizeof(BlockHeader)));
+	if (header == nullptr)
+		return nullptr;
+
+	uint16_t tag = CurrentTag();
+	header->Size = size;
+	header->Tag = tag;
+	header->Reserved = 0;
+	header->Magic = HeaderMagic;
+
+	ThreadSlot* slot = GetSlot();
+	int64_t bytes = static_cast<int64_t>(size);
+	Add(slot, slot->NumAllocs, 1);
+	Add(slot, slot->TotalAllocs, 1);
+	Add(slot, slot->NumBytes, bytes);
+	Add(slot, slot->TotalBytes, bytes);
+	Add(slot, slot->TagAllocs[tag], 1);
+	Add(slot, slot->TagBytes[tag], bytes);
+	Add(slot, slot->TagTotalAllocs[tag], 1);
+	Add(slot, slot->TagTotalBytes[tag], bytes);
+
+	// Sampling is a single well predicted branch when disabled
+	uint32_t rate = g_SampleRate.load(std::memory_order_relaxed);
+	if (rate != 0 && !IsShared(slot)) {
+		if (tl_SampleCountdown == 0 || tl_SampleCountdown > rate) {
+			tl_SampleCountdown = rate;
+			RecordSite(slot, caller, size);
+		}
+		tl_SampleCountdown--;
+	}
+
+	return header + 1;
+}
+
+void MemoryTracking::Free(void* block) {
+	if (block == nullptr)
+		return;
+	BlockHeader* header = static_cast<BlockHeader*>(block) - 1;
+	if (header->Magic != HeaderMagic) {
+		// This should never happen, but if it does it's memory that didn't come from us
+		fprintf(stderr, "MemoryTracking: freeing a block that was not allocated by us (%p)\n", block);
+		return;
+	}
+
+	ThreadSlot* slot = GetSlot();
+	int64_t bytes = static_cast<int64_t>(header->Size);
+	Add(slot, slot->NumAllocs, -1);
+	Add(slot, slot->NumBytes, -bytes);
+	Add(slot, slot->TagAllocs[header->Tag], -1);
+	Add(slot, slot->TagBytes[header->Tag], -bytes);
+
+	header->Magic = 0;
+	free(header);
+}
+
+size_t MemoryTracking::GetBlockSize(void* block) {
+	return block != nullptr ? static_cast<size_t>((static_cast<BlockHeader*>(block) - 1)->Size) : 0;
+}
+
+MemoryStats MemoryTracking::GetStats() {
+	MemoryStats result;
+	uint32_t count = std::min(g_SlotCount.load(std::memory_order_relaxed), MaxThreads + 1);
+	for (uint32_t ix = 0; ix <= MaxThreads; ix++) {
+		// The overflow slot is always last, so make sure to include it
+		if (ix >= count && ix != MaxThreads)
+			continue;
+		const ThreadSlot& slot = g_Slots[ix];
+		result.NumAllocs   += slot.NumAllocs.load(std::memory_order_relaxed);
+		result.TotalAllocs += slot.TotalAllocs.load(std::memory_order_relaxed);
+		result.NumBytes    += slot.NumBytes.load(std::memory_order_relaxed);
+		result.TotalBytes  += slot.TotalBytes.load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
+MemoryStats MemoryTracking::GetTagStats(uint16_t tag) {
+	MemoryStats result;
+	if (tag >= MaxTags)
+		return result;
+	uint32_t count = std::min(g_SlotCount.load(std::memory_order_relaxed), MaxThreads + 1);
+	for (uint32_t ix = 0; ix <= MaxThreads; ix++) {
+		if (ix >= count && ix != MaxThreads)
+			continue;
+		const ThreadSlot& slot = g_Slots[ix];
+		result.NumAllocs   += slot.TagAllocs[tag].load(std::memory_order_relaxed);
+		result.TotalAllocs += slot.TagTotalAllocs[tag].load(std::memory_order_relaxed);
+		result.NumBytes    += slot.TagBytes[tag].load(std::memory_order_relaxed);
+		result.TotalBytes  += slot.TagTotalBytes[tag].load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
+uint16_t MemoryTracking::RegisterTag(const std::string_view& name) {
+	size_t length = std::min(name.size(), MaxTagName - 1);
+
+	while (g_TagLock.test_and_set(std::memory_order_acquire)) {}
+	uint16_t count = g_TagCount.load(std::memory_order_relaxed);
+	uint16_t result = 0;
+	// Re-use an existing tag with the same name
+	for (uint16_t ix = 1; ix < count; ix++) {
+		if (strncmp(g_TagNames[ix], name.data(), length) == 0 && g_TagNames[ix][length] == '\0') {
+			result = ix;
+			break;
+		}
+	}
+	if (result == 0 && count < MaxTags) {
+		memcpy(g_TagNames[count], name.data(), length);
+		g_TagNames[count][length] = '\0';
+		result = count;
+		g_TagCount.store(count + 1, std::memory_order_release);
+	}
+	g_TagLock.clear(std::memory_order_release);
+
+	return result;
+}
+
+uint16_t MemoryTracking::GetTagCount() {
+	return g_TagCount.load(std::memory_order_acquire);
 }
 
-void MemoryTracking::NotifyDealloc(size_t size, void* block) {
-	myStack[myStackIx].NumAllocs--;
-	myStack[myStackIx].NumBytes -= size;
-	NumAllocs--;
-	NumBytes -= size;
+const char* MemoryTracking::GetTagName(uint16_t tag) {
+	return tag < GetTagCount() ? g_TagNames[tag] : "<invalid>";
+}
+
+void MemoryTracking::PushTag(uint16_t tag) {
+	// If we go past our maximum depth, we'll keep attributing to the deepest tag we have
+	if (tl_Tags.Depth < MaxTagDepth) {
+		ThreadSlot* slot = GetSlot();
+		tl_Tags.Tags[tl_Tags.Depth] = tag < MaxTags ? tag : 0;
+		tl_Tags.StartAllocs[tl_Tags.Depth] = slot->NumAllocs.load(std::memory_order_relaxed);
+		tl_Tags.StartBytes[tl_Tags.Depth] = slot->NumBytes.load(std::memory_order_relaxed);
+	}
+	tl_Tags.Depth++;
+}
+
+void MemoryTracking::PopTag() {
+	if (tl_Tags.Depth > 0)
+		tl_Tags.Depth--;
 }
 
 void MemoryTracking::PushStack(const std::string_view& name) {
-	myStackIx++;
-	myStack[myStackIx].NumBytes = 0;
-	myStack[myStackIx].NumAllocs = 0;
-	name.copy(myStack[myStackIx].Name, 0, 100 < name.size() ? name.size() : 100);
+	PushTag(RegisterTag(name));
 }
 
-void MemoryTracking::PopStack(size_t* numAllocs, size_t* numBytes) {
+void MemoryTracking::PopStack(int64_t* numAllocs, int64_t* numBytes) {
+	if (tl_Tags.Depth == 0)
+		return;
+	uint32_t ix = std::min(tl_Tags.Depth - 1, MaxTagDepth - 1);
+	ThreadSlot* slot = GetSlot();
 	if (numAllocs)
-		* numAllocs = myStack[myStackIx].NumAllocs;
+		*numAllocs = slot->NumAllocs.load(std::memory_order_relaxed) - tl_Tags.StartAllocs[ix];
 	if (numBytes)
-		* numBytes = myStack[myStackIx].NumBytes;
-	myStackIx--;
+		*numBytes = slot->NumBytes.load(std::memory_order_relaxed) - tl_Tags.StartBytes[ix];
+	PopTag();
+}
+
+void MemoryTracking::SetSampleRate(uint32_t rate) {
+	g_SampleRate.store(rate, std::memory_order_relaxed);
+}
+
+uint32_t MemoryTracking::GetSampleRate() {
+	return g_SampleRate.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTracking::GetAllocationSites(AllocationSite* results, size_t maxResults) {
+	size_t found = 0;
+	uint32_t count = std::min(g_SlotCount.load(std::memory_order_relaxed), MaxThreads);
+	for (uint32_t slotIx = 0; slotIx < count; slotIx++) {
+		ThreadSlot& slot = g_Slots[slotIx];
+		for (uint32_t ix = 0; ix < MaxSites; ix++) {
+			SiteEntry& entry = slot.Sites[ix];
+			if (entry.Hash.load(std::memory_order_acquire) == 0)
+				continue;
+
+			AllocationSite site;
+			memcpy(site.Frames, entry.Frames, sizeof(site.Frames));
+			site.Count = entry.Count.load(std::memory_order_relaxed);
+			site.Bytes = entry.Bytes.load(std::memory_order_relaxed);
+
+			// Merge with the same site from other threads
+			AllocationSite* existing = std::find_if(results, results + found, [&](const AllocationSite& other) {
+				return memcmp(other.Frames, site.Frames, sizeof(site.Frames)) == 0;
+			});
+			if (existing != results + found) {
+				existing->Count += site.Count;
+				existing->Bytes += site.Bytes;
+			}
+			else if (found < maxResults) {
+				results[found++] = site;
+			}
+			else {
+				// Replace our smallest result if this one is bigger
+				AllocationSite* smallest = std::min_element(results, results + found, [](const AllocationSite& a, const AllocationSite& b) { return a.Bytes < b.Bytes; });
+				if (smallest->Bytes < site.Bytes)
+					*smallest = site;
+			}
+		}
+	}
+	std::sort(results, results + found, [](const AllocationSite& a, const AllocationSite& b) { return a.Bytes > b.Bytes; });
+	return found;
+}
+
+void MemoryTracking::ResetAllocationSites() {
+	// Note that this can race with threads that are currently recording, we can live with a dropped sample or two
+	uint32_t count = std::min(g_SlotCount.load(std::memory_order_relaxed), MaxThreads);
+	for (uint32_t slotIx = 0; slotIx < count; slotIx++) {
+		for (SiteEntry& entry : g_Slots[slotIx].Sites) {
+			entry.Hash.store(0, std::memory_order_release);
+		}
+	}
+}
+
+void MemoryTracking::DescribeAddress(void* address, char* buffer, size_t size) {
+#ifdef WINDOWS
+	static bool symbolsLoaded = false;
+	HANDLE process = GetCurrentProcess();
+	if (!symbolsLoaded) {
+		SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+		symbolsLoaded = SymInitialize(process, nullptr, TRUE) == TRUE;
+	}
+	if (symbolsLoaded) {
+		alignas(SYMBOL_INFO) char symbolBuffer[sizeof(SYMBOL_INFO) + 256];
+		SYMBOL_INFO* symbol = reinterpret_cast<SYMBOL_INFO*>(symbolBuffer);
+		symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+		symbol->MaxNameLen = 255;
+		DWORD64 displacement = 0;
+		if (SymFromAddr(process, reinterpret_cast<DWORD64>(address), &displacement, symbol)) {
+			IMAGEHLP_LINE64 line = {};
+			line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+			DWORD lineDisplacement = 0;
+			if (SymGetLineFromAddr64(process, reinterpret_cast<DWORD64>(address), &lineDisplacement, &line)) {
+				snprintf(buffer, size, "%s (%s:%lu)", symbol->Name, line.FileName, line.LineNumber);
+			} else {
+				snprintf(buffer, size, "%s+0x%llx", symbol->Name, (unsigned long long)displacement);
+			}
+			return;
+		}
+	}
+#endif
+	snprintf(buffer, size, "%p", address);
 }
 
 void* operator new(size_t size) {
-	void* result = malloc(size);
-	MemoryTracking::NotifyAlloc(size, result);
+	void* result = MemoryTracking::Allocate(size, RETURN_ADDRESS());
+	if (result == nullptr)
+		throw std::bad_alloc();
 	return result;
 }
 
-void operator delete(void* block) {
-	if (block) {
-		size_t blockSize = _msize(block);
-		MemoryTracking::NotifyDealloc(blockSize, block);
-		free(block);
-	}
+void* operator new[](size_t size) {
+	void* result = MemoryTracking::Allocate(size, RETURN_ADDRESS());
+	if (result == nullptr)
+		throw std::bad_alloc();
+	return result;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return MemoryTracking::Allocate(size, RETURN_ADDRESS());
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return MemoryTracking::Allocate(size, RETURN_ADDRESS());
+}
+
+void operator delete(void* block) noexcept {
+	MemoryTracking::Free(block);
+}
+
+void operator delete[](void* block) noexcept {
+	MemoryTracking::Free(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+	MemoryTracking::Free(block);
+}
+
+void operator delete[](void* block, size_t) noexcept {
+	MemoryTracking::Free(block);
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept {
+	MemoryTracking::Free(block);
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept {
+	MemoryTracking::Free(block);
 }
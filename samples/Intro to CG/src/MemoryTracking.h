@@ -2,35 +2,137 @@
 #include <cstdlib>
 #include <new>
 #include <cstdint>
-#include <string>
+#include <string_view>
 
+// Helpers so our scope macro can make a unique variable per line
+#define MEMORY_CONCAT_INNER(a, b) a##b
+#define MEMORY_CONCAT(a, b) MEMORY_CONCAT_INNER(a, b)
+
+/*
+ * Attributes all allocations made by this thread in the enclosing scope to the given tag, tags can be nested
+ * The tag is only registered the first time the scope is hit, so this is cheap enough to leave in hot code
+ */
+#define MEMORY_TAG_SCOPE(name) \
+	static const uint16_t MEMORY_CONCAT(__memoryTagId, __LINE__) = MemoryTracking::RegisterTag(name); \
+	MemoryTagScope MEMORY_CONCAT(__memoryTagScope, __LINE__)(MEMORY_CONCAT(__memoryTagId, __LINE__))
+
+// Allocation counters, merged across all threads when read
+struct MemoryStats {
+	// The number of allocations currently alive
+	int64_t NumAllocs   = 0;
+	// The total number of allocations made
+	int64_t TotalAllocs = 0;
+	// The number of bytes currently allocated
+	int64_t NumBytes    = 0;
+	// The total number of bytes that have been allocated
+	int64_t TotalBytes  = 0;
+};
+
+// A sampled location that we allocated memory from
+struct AllocationSite {
+	static const int MaxFrames = 4;
+	// The return addresses for the allocation, innermost first (unused frames are null)
+	void*   Frames[MaxFrames];
+	// The number of sampled allocations, and the bytes they requested
+	int64_t Count;
+	int64_t Bytes;
+};
+
+/*
+ * Tracks all allocations made through the global new and delete operators. Each thread records into it's
+ * own counters, which are only merged when read, so there's no contention between threads. Every block
+ * carries a small header with it's size and tag, so we don't rely on any platform specific heap queries
+ */
 class MemoryTracking {
 public:
-	static size_t NumAllocs;
-	static size_t TotalAllocs;
-	static size_t NumBytes;
-	static size_t TotalBytes;
-	
-	static void NotifyAlloc(size_t size, void* block);
-	static void NotifyDealloc(size_t size, void* block);
+	// The maximum number of unique tags we can register (tag 0 is always "Untagged")
+	static const uint16_t MaxTags = 64;
+	// The maximum length of a tag's name, including the null terminator
+	static const size_t MaxTagName = 48;
+
+	// Gets the allocation counters for the whole program
+	static MemoryStats GetStats();
+	/*
+	 * Gets the allocation counters for a single tag (note that TotalAllocs and TotalBytes only count allocations
+	 * made while the tag was active, while NumAllocs and NumBytes include frees of the tag's blocks)
+	 * @param tag The ID of the tag, as returned by RegisterTag
+	 */
+	static MemoryStats GetTagStats(uint16_t tag);
 
+	/*
+	 * Registers a new tag, or returns the ID of an existing tag with the same name
+	 * @param name The name of the tag, names longer than MaxTagName will be truncated
+	 * @returns The ID of the tag, or 0 if we have run out of tags
+	 */
+	static uint16_t RegisterTag(const std::string_view& name);
+	// Gets the number of tags that have been registered
+	static uint16_t GetTagCount();
+	// Gets the name of the tag with the given ID
+	static const char* GetTagName(uint16_t tag);
+
+	/*
+	 * Makes the given tag active on this thread, until the matching PopTag
+	 * @param tag The ID of the tag, as returned by RegisterTag
+	 */
+	static void PushTag(uint16_t tag);
+	// Restores the tag that was active before the last PushTag on this thread
+	static void PopTag();
+
+	/*
+	 * Starts a named measurement scope on this thread, the name is also used as the active tag
+	 * @param name The name of the scope
+	 */
 	static void PushStack(const std::string_view& name);
-	static void PopStack(size_t* numAllocs, size_t* numBytes);	
-
-private:
-	struct StackEntry {
-		char Name[100];
-		size_t NumAllocs;
-		size_t NumBytes;
-	};
-	static StackEntry myStack[100];
-	static uint32_t   myStackIx;
+	/*
+	 * Ends the last scope started with PushStack on this thread, and reports the net allocations made by
+	 * this thread while it was active (including any nested scopes)
+	 * @param numAllocs If not null, will store the number of allocations that are still alive
+	 * @param numBytes  If not null, will store the number of bytes that are still allocated
+	 */
+	static void PopStack(int64_t* numAllocs, int64_t* numBytes);
+
+	/*
+	 * Sets how often we sample the call site of an allocation, a rate of N samples 1 in N allocations
+	 * @param rate The sample rate, or 0 to disable sampling (the default)
+	 */
+	static void SetSampleRate(uint32_t rate);
+	static uint32_t GetSampleRate();
+	/*
+	 * Gets the sampled allocation sites with the most bytes, merged across all threads
+	 * @param results    The array to store the sites into
+	 * @param maxResults The number of elements in results
+	 * @returns The number of sites written to results
+	 */
+	static size_t GetAllocationSites(AllocationSite* results, size_t maxResults);
+	// Clears all of our sampled allocation sites
+	static void ResetAllocationSites();
+	/*
+	 * Writes a human readable description of an address to a buffer (the symbol name if we can find it)
+	 * @param address The address to describe
+	 * @param buffer  The buffer to write to
+	 * @param size    The size of buffer, in bytes
+	 */
+	static void DescribeAddress(void* address, char* buffer, size_t size);
+
+	/*
+	 * Gets the size that was requested for a block allocated through our operator new
+	 * @param block The block to get the size of
+	 */
+	static size_t GetBlockSize(void* block);
+
+	// These are used by our global new and delete operators, you shouldn't need to call these directly
+	static void* Allocate(size_t size, void* caller);
+	static void  Free(void* block);
 };
 
-inline size_t get_block_size(void* block) {
-	return *(((size_t*)block) - 1);
-}
+/*
+ * RAII helper for MemoryTracking::PushTag and PopTag, see MEMORY_TAG_SCOPE
+ */
+class MemoryTagScope {
+public:
+	MemoryTagScope(uint16_t tag) { MemoryTracking::PushTag(tag); }
+	~MemoryTagScope() { MemoryTracking::PopTag(); }
 
-_NODISCARD _Ret_notnull_ _Post_writable_byte_size_(_Size) _VCRT_ALLOCATOR
-void* operator new(size_t _Size);
-void operator delete(void* block);
\ No newline at end of file
+	MemoryTagScope(const MemoryTagScope& other) = delete;
+	MemoryTagScope& operator =(const MemoryTagScope& other) = delete;
+};
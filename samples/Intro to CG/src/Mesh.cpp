@@ -1,9 +1,14 @@
 #include "Mesh.h"
+#include "FrameArena.h"
 
 Mesh::Mesh(Vertex* vertices, GLsizei numVerts, uint32_t* indices, GLsizei numIndices) {
 	myIndexCount = numIndices;
 	myVertexCount = numVerts;
 
+	myBoundingRadius = 0.0f;
+	for (GLsizei ix = 0; ix < numVerts; ix++)
+		myBoundingRadius = glm::max(myBoundingRadius, glm::length(vertices[ix].Position));
+
 	// Create and bind our vertex array
 	glCreateVertexArrays(1, &myRenderhandle);
 	glBindVertexArray(myRenderhandle);
@@ -60,9 +65,14 @@ Mesh::~Mesh() {
 }
 
 void Mesh::SetDebugName(const std::string& name) {
+	myDebugName = name;
 	glObjectLabel(GL_VERTEX_ARRAY, myRenderhandle, -1, name.c_str());
-	glObjectLabel(GL_BUFFER, myBuffers[0], -1, (name + " | VBO").c_str());
-	glObjectLabel(GL_BUFFER, myBuffers[1], -1, (name + " | IBO").c_str());
+	// Our buffer labels are only needed until GL copies them, so we build them in the frame arena
+	FrameString label(name.c_str(), name.size());
+	label += " | VBO";
+	glObjectLabel(GL_BUFFER, myBuffers[0], -1, label.c_str());
+	label.replace(label.size() - 3, 3, "IBO");
+	glObjectLabel(GL_BUFFER, myBuffers[1], -1, label.c_str());
 }
 
 void Mesh::Draw() {
@@ -76,3 +86,13 @@ void Mesh::Draw() {
 		glDrawArrays(GL_TRIANGLES, 0, myVertexCount);
 	}
 }
+
+void Mesh::DrawIndirect(size_t commandOffset) {
+	glBindVertexArray(myRenderhandle);
+	// Array commands are the same as element commands without the base vertex, so both can share a buffer
+	// as long as the base vertex is left at 0
+	if (myIndexCount > 0)
+		glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)commandOffset);
+	else
+		glDrawArraysIndirect(GL_TRIANGLES, (const void*)commandOffset);
+}
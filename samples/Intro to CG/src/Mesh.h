@@ -29,10 +29,24 @@ public:
 
 	// Draws this mesh
 	void Draw();
+	/*
+	 * Draws this mesh using a DrawElementsIndirectCommand that is already on the GPU, so the draw's parameters
+	 * can be decided by a compute shader (ex: occlusion culling setting the instance count to 0)
+	 * @param commandOffset The offset of the command in the bound GL_DRAW_INDIRECT_BUFFER, in bytes
+	 */
+	void DrawIndirect(size_t commandOffset);
+
+	// Gets the number of bytes this mesh uses in it's vertex and index buffers
+	size_t GetGpuSize() const { return myVertexCount * sizeof(Vertex) + myIndexCount * sizeof(uint32_t); }
+	// Gets the number of elements that Draw submits (our indices, or our vertices if we don't have any)
+	GLsizei GetDrawCount() const { return myIndexCount > 0 ? myIndexCount : myVertexCount; }
+	// Gets the distance from the mesh's origin to it's furthest vertex
+	float GetBoundingRadius() const { return myBoundingRadius; }
 
 private:
 	// 0 is vertices, 1 is indices
 	GLuint myBuffers[2];
 	// The number of vertices and indices in this mesh
 	GLsizei myVertexCount, myIndexCount;
+	float myBoundingRadius;
 };
@@ -3,6 +3,6 @@
 #include "Mesh.h"
 
 struct MeshRenderer {
-	Material::Sptr Material;
-	Mesh::Sptr     Mesh;
+	Material::Handle Material;
+	Mesh::Handle     Mesh;
 };
\ No newline at end of file
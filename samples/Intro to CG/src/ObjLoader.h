@@ -13,7 +13,7 @@ public:
 	static MeshData LoadObj(const char* filename, glm::vec4 baseColor = glm::vec4(1.0f));
 	static Mesh::Sptr LoadObjToMesh(const char* filename, glm::vec4 baseColor = glm::vec4(1.0f)) {
 		MeshData data = LoadObj(filename, baseColor);
-		auto result = std::make_shared<Mesh>(
+		Mesh::Sptr result = Mesh::Create(
 			data.Vertices.data(), static_cast<GLsizei>(data.Vertices.size()), 
 			data.Indices.data(), static_cast<GLsizei>(data.Indices.size()));
 		result->SetDebugName(filename);
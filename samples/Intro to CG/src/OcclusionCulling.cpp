@@ -0,0 +1,247 @@
+#include "OcclusionCulling.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include "imgui.h"
+
+GLuint          OcclusionCulling::myBoundsBuffer      = 0;
+GLuint          OcclusionCulling::myCommandsBuffer    = 0;
+GLuint          OcclusionCulling::myStatsBuffer       = 0;
+size_t          OcclusionCulling::myCapacity          = 0;
+uint32_t        OcclusionCulling::myDrawCount         = 0;
+Texture2D::Sptr OcclusionCulling::myDepthCopy         = nullptr;
+Texture2D::Sptr OcclusionCulling::myHiZ               = nullptr;
+glm::mat4       OcclusionCulling::myHiZViewProjection = glm::mat4(1.0f);
+bool            OcclusionCulling::myHasHiZ            = false;
+Texture2D::Sptr OcclusionCulling::myOverdrawCounts    = nullptr;
+GLuint          OcclusionCulling::myEmptyVao          = 0;
+Shader::Sptr    OcclusionCulling::myCullShader        = nullptr;
+Shader::Sptr    OcclusionCulling::myBuildShader       = nullptr;
+Shader::Sptr    OcclusionCulling::myDepthShader       = nullptr;
+Shader::Sptr    OcclusionCulling::myOverdrawShader    = nullptr;
+Shader::Sptr    OcclusionCulling::myResolveShader     = nullptr;
+bool            OcclusionCulling::myPrepassEnabled    = true;
+bool            OcclusionCulling::myOcclusionEnabled  = true;
+bool            OcclusionCulling::myShowOverdraw      = false;
+float           OcclusionCulling::myMaxOverdraw       = 8.0f;
+
+void OcclusionCulling::Init() {
+	LOG_ASSERT(myStatsBuffer == 0, "Occlusion culling has already been initialized!");
+
+	glCreateBuffers(1, &myStatsBuffer);
+	glNamedBufferStorage(myStatsBuffer, sizeof(uint32_t), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glObjectLabel(GL_BUFFER, myStatsBuffer, -1, "Cull Stats");
+	__Reserve(256);
+
+	glCreateVertexArrays(1, &myEmptyVao);
+
+	myCullShader = Shader::Create();
+	myCullShader->LoadCompute("shaders/hiz-cull.comp.glsl");
+	myBuildShader = Shader::Create();
+	myBuildShader->LoadCompute("shaders/hiz-build.comp.glsl");
+	myDepthShader = Shader::Create();
+	myDepthShader->Load("shaders/depth-only.vs.glsl", "shaders/depth-only.fs.glsl");
+	myOverdrawShader = Shader::Create();
+	myOverdrawShader->Load("shaders/lighting.vs.glsl", "shaders/overdraw.fs.glsl");
+	myResolveShader = Shader::Create();
+	myResolveShader->Load("shaders/fullscreen.vs.glsl", "shaders/overdraw-resolve.fs.glsl");
+}
+
+void OcclusionCulling::Shutdown() {
+	GLuint buffers[3] = { myBoundsBuffer, myCommandsBuffer, myStatsBuffer };
+	glDeleteBuffers(3, buffers);
+	myBoundsBuffer = myCommandsBuffer = myStatsBuffer = 0;
+	myCapacity = 0;
+	glDeleteVertexArrays(1, &myEmptyVao);
+	myEmptyVao = 0;
+
+	myDepthCopy = nullptr;
+	myHiZ = nullptr;
+	myOverdrawCounts = nullptr;
+	myHasHiZ = false;
+	myCullShader = nullptr;
+	myBuildShader = nullptr;
+	myDepthShader = nullptr;
+	myOverdrawShader = nullptr;
+	myResolveShader = nullptr;
+}
+
+void OcclusionCulling::Cull(const DrawBounds* bounds, size_t count) {
+	myDrawCount = (uint32_t)count;
+	if (count == 0)
+		return;
+
+	__Reserve(count);
+	glNamedBufferSubData(myBoundsBuffer, 0, sizeof(DrawBounds) * count, bounds);
+	uint32_t zero = 0;
+	glNamedBufferSubData(myStatsBuffer, 0, sizeof(uint32_t), &zero);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BoundsBinding, myBoundsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CommandsBinding, myCommandsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, StatsBinding, myStatsBuffer);
+
+	// Without a pyramid from last frame we still need to write our commands, we just don't cull anything
+	bool enabled = IsOcclusionEnabled() && myHasHiZ;
+	myCullShader->Bind();
+	myCullShader->SetUniform("a_Enabled", enabled ? 1 : 0);
+	myCullShader->SetUniform("a_DrawCount", (int)count);
+	if (enabled) {
+		myCullShader->SetUniform("a_PrevViewProjection", myHiZViewProjection);
+		myCullShader->SetUniform("a_HiZSize", glm::vec2(myHiZ->GetDescription().Width, myHiZ->GetDescription().Height));
+		myCullShader->SetUniform("a_HiZLevels", myHiZ->GetDescription().MipLevels);
+		myHiZ->Bind(0);
+		// The pyramid's own sampling state is what we want, so make sure no sampler object overrides it
+		glBindSampler(0, 0);
+	}
+	myCullShader->SetUniform("s_HiZ", 0);
+	myCullShader->Dispatch(((uint32_t)count + 63) / 64);
+
+	// The commands are read by the draws that come next
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, myCommandsBuffer);
+}
+
+void OcclusionCulling::BuildHiZ(const Camera& camera, int width, int height) {
+	if (width <= 0 || height <= 0)
+		return;
+
+	Texture2DDescription depthDesc = Texture2DDescription();
+	depthDesc.Format = InternalFormat::Depth24;
+	depthDesc.EnableMip = false;
+	depthDesc.Sampler.MinFilter = MinFilter::Nearest;
+	depthDesc.Sampler.MagFilter = MagFilter::Nearest;
+	__ResizeTarget(myDepthCopy, depthDesc, width, height, "Hi-Z Depth Copy");
+
+	Texture2DDescription hiZDesc = Texture2DDescription();
+	hiZDesc.Format = InternalFormat::R32F;
+	// This gets clamped to the full mip chain
+	hiZDesc.MipLevels = 32;
+	hiZDesc.Sampler.WrapS = WrapMode::ClampToEdge;
+	hiZDesc.Sampler.WrapT = WrapMode::ClampToEdge;
+	hiZDesc.Sampler.MinFilter = MinFilter::NearestMipNearest;
+	hiZDesc.Sampler.MagFilter = MagFilter::Nearest;
+	hiZDesc.Sampler.AnisotropicEnabled = false;
+	__ResizeTarget(myHiZ, hiZDesc, width, height, "Hi-Z");
+
+	// Copies from the window's depth buffer, since it is bound as the read framebuffer
+	glCopyTextureSubImage2D(myDepthCopy->GetRenderHandle(), 0, 0, 0, 0, 0, width, height);
+
+	myBuildShader->Bind();
+	myBuildShader->SetUniform("s_Depth", 0);
+	myDepthCopy->Bind(0);
+	glBindSampler(0, 0);
+
+	// The first level is a straight copy of the depth buffer, then each level is built from the one before it
+	int levels = myHiZ->GetDescription().MipLevels;
+	for (int level = 0; level < levels; level++) {
+		int targetWidth  = std::max(width >> level, 1);
+		int targetHeight = std::max(height >> level, 1);
+		if (level == 0) {
+			myBuildShader->SetUniform("a_FromDepth", 1);
+			myBuildShader->SetUniform("a_SourceSize", glm::vec2(width, height));
+		} else {
+			myBuildShader->SetUniform("a_FromDepth", 0);
+			myBuildShader->SetUniform("a_SourceSize", glm::vec2(std::max(width >> (level - 1), 1), std::max(height >> (level - 1), 1)));
+			glBindImageTexture(0, myHiZ->GetRenderHandle(), level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+			// The previous level needs to be written before we read it
+			glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+		}
+		myBuildShader->SetUniform("a_TargetSize", glm::vec2(targetWidth, targetHeight));
+		glBindImageTexture(1, myHiZ->GetRenderHandle(), level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+		myBuildShader->Dispatch((targetWidth + 7) / 8, (targetHeight + 7) / 8);
+	}
+	glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+	glBindImageTexture(1, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+	ITexture::Unbind(0);
+
+	// Next frame's cull samples the pyramid as a texture
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+	myHiZViewProjection = camera.GetViewProjection();
+	myHasHiZ = true;
+}
+
+void OcclusionCulling::BeginOverdraw(int width, int height) {
+	Texture2DDescription desc = Texture2DDescription();
+	desc.Format = InternalFormat::R32UI;
+	desc.EnableMip = false;
+	desc.Sampler.MinFilter = MinFilter::Nearest;
+	desc.Sampler.MagFilter = MagFilter::Nearest;
+	__ResizeTarget(myOverdrawCounts, desc, width, height, "Overdraw Counts");
+
+	uint32_t zero = 0;
+	glClearTexImage(myOverdrawCounts->GetRenderHandle(), 0, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+	glBindImageTexture(0, myOverdrawCounts->GetRenderHandle(), 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+	// The overdraw shader only writes to the counts, and EndOverdraw replaces the whole screen anyways
+	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+}
+
+void OcclusionCulling::EndOverdraw() {
+	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+	glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+	glBindImageTexture(0, myOverdrawCounts->GetRenderHandle(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_R32UI);
+
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_BLEND);
+	myResolveShader->Bind();
+	myResolveShader->SetUniform("a_MaxOverdraw", myMaxOverdraw);
+	glBindVertexArray(myEmptyVao);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	glBindVertexArray(0);
+	glEnable(GL_DEPTH_TEST);
+
+	glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_READ_ONLY, GL_R32UI);
+}
+
+void OcclusionCulling::DrawInspector() {
+	if (ImGui::Checkbox("Depth Prepass", &myPrepassEnabled) && !myPrepassEnabled)
+		Invalidate();
+	ImGui::Checkbox("Occlusion Culling", &myOcclusionEnabled);
+	if (!myPrepassEnabled && ImGui::IsItemHovered())
+		ImGui::SetTooltip("Occlusion culling needs the depth prepass");
+	ImGui::Checkbox("Show Overdraw", &myShowOverdraw);
+	if (myShowOverdraw)
+		ImGui::DragFloat("Max Overdraw", &myMaxOverdraw, 0.1f, 2.0f, 64.0f);
+
+	// Reading the stats back stalls until the GPU has caught up, so we only do it while the panel is open
+	uint32_t visible = myDrawCount;
+	if (myDrawCount > 0 && myStatsBuffer != 0)
+		glGetNamedBufferSubData(myStatsBuffer, 0, sizeof(uint32_t), &visible);
+	ImGui::Text("Draws: %u visible, %u culled", visible, myDrawCount - visible);
+	if (myHiZ != nullptr)
+		ImGui::Text("Hi-Z: %ux%u, %d levels", myHiZ->GetDescription().Width, myHiZ->GetDescription().Height, myHiZ->GetDescription().MipLevels);
+}
+
+void OcclusionCulling::__Reserve(size_t count) {
+	if (count <= myCapacity)
+		return;
+	size_t capacity = std::max(count, myCapacity * 2);
+	if (myBoundsBuffer == 0) {
+		glCreateBuffers(1, &myBoundsBuffer);
+		glCreateBuffers(1, &myCommandsBuffer);
+		glObjectLabel(GL_BUFFER, myBoundsBuffer, -1, "Draw Bounds");
+		glObjectLabel(GL_BUFFER, myCommandsBuffer, -1, "Draw Commands");
+	}
+	// These are re-specified rather than using immutable storage, since they grow with the scene
+	glNamedBufferData(myBoundsBuffer, sizeof(DrawBounds) * capacity, nullptr, GL_DYNAMIC_DRAW);
+	glNamedBufferData(myCommandsBuffer, sizeof(DrawCommand) * capacity, nullptr, GL_DYNAMIC_COPY);
+	myCapacity = capacity;
+}
+
+void OcclusionCulling::__ResizeTarget(Texture2D::Sptr& texture, const Texture2DDescription& description, int width, int height, const char* name) {
+	if (texture == nullptr) {
+		Texture2DDescription desc = description;
+		desc.Width  = width;
+		desc.Height = height;
+		texture = Texture2D::Create(desc);
+		texture->SetDebugName(name);
+	} else if (texture->GetDescription().Width != (uint32_t)width || texture->GetDescription().Height != (uint32_t)height) {
+		// Re-create from the original description rather than resizing, so that the mip chain can grow back
+		Texture2DDescription desc = description;
+		desc.Width  = width;
+		desc.Height = height;
+		texture->Recreate(desc);
+		// The old pyramid no longer lines up with the screen
+		if (texture == myHiZ)
+			myHasHiZ = false;
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <glad/glad.h>
+#include <GLM/glm.hpp>
+
+#include "Camera.h"
+#include "Shader.h"
+#include "Texture2D.h"
+
+/*
+ * GPU occlusion culling using a hierarchical Z (Hi-Z) pyramid. After the depth prepass, the depth buffer is
+ * copied into a pyramid where each level keeps the furthest depth of the level above it. At the start of the
+ * next frame, the bounds of every draw are tested against that pyramid (using last frame's camera), and the
+ * results are written straight into the indirect draw commands, so hidden meshes are skipped without ever
+ * reading the results back on the CPU
+ *
+ * Since we test against last frame's depth, something that is revealed this frame will pop in a frame late
+ */
+class OcclusionCulling {
+public:
+	// The storage buffer bindings that we use
+	static const GLuint BoundsBinding   = 7;
+	static const GLuint CommandsBinding = 8;
+	static const GLuint StatsBinding    = 9;
+
+	// The bounds of a single draw, as it's laid out on the GPU
+	struct DrawBounds {
+		// xyz is the world space center, w is the radius
+		glm::vec4  CenterRadius;
+		// x is the number of indices (or vertices) that the draw uses, see Mesh::GetDrawCount
+		glm::uvec4 Counts;
+	};
+	// Matches DrawElementsIndirectCommand
+	struct DrawCommand {
+		uint32_t Count;
+		uint32_t InstanceCount;
+		uint32_t FirstIndex;
+		int32_t  BaseVertex;
+		uint32_t BaseInstance;
+	};
+
+	// Creates our buffers and loads our shaders, must be called once the GL context exists
+	static void Init();
+	// Deletes our buffers, textures and shaders
+	static void Shutdown();
+
+	/*
+	 * Tests this frame's draws against last frame's Hi-Z, and writes out the indirect commands. The command
+	 * buffer is left bound to GL_DRAW_INDIRECT_BUFFER, so draw i can be made with DrawCommandOffset(i)
+	 * @param bounds The bounds of each draw
+	 * @param count  The number of draws
+	 */
+	static void Cull(const DrawBounds* bounds, size_t count);
+	// Gets the offset of a draw's command in the indirect buffer, see Mesh::DrawIndirect
+	static size_t DrawCommandOffset(size_t index) { return index * sizeof(DrawCommand); }
+
+	/*
+	 * Builds the Hi-Z pyramid from the current depth buffer, should be called right after the depth prepass
+	 * @param camera The camera the depth buffer was rendered with
+	 * @param width  The width of the depth buffer, in pixels
+	 * @param height The height of the depth buffer, in pixels
+	 */
+	static void BuildHiZ(const Camera& camera, int width, int height);
+	// Throws away the Hi-Z pyramid, so that nothing is culled next frame (ex: after a camera cut or a resize)
+	static void Invalidate() { myHasHiZ = false; }
+
+	/*
+	 * Starts counting how many fragments are shaded for each pixel. Until EndOverdraw, meshes should be drawn
+	 * with GetOverdrawShader instead of their material's shader
+	 * @param width  The width of the screen, in pixels
+	 * @param height The height of the screen, in pixels
+	 */
+	static void BeginOverdraw(int width, int height);
+	// Draws the overdraw counts over the whole screen as a heatmap
+	static void EndOverdraw();
+	// Gets the shader that counts overdraw, it takes the same vertex inputs and uniforms as lighting.vs.glsl
+	static const Shader::Sptr& GetOverdrawShader() { return myOverdrawShader; }
+	// Gets the shader to use for the depth prepass
+	static const Shader::Sptr& GetDepthShader() { return myDepthShader; }
+
+	static bool IsPrepassEnabled() { return myPrepassEnabled; }
+	// Occlusion culling needs the depth prepass to build it's Hi-Z pyramid
+	static bool IsOcclusionEnabled() { return myPrepassEnabled && myOcclusionEnabled; }
+	static bool IsOverdrawEnabled() { return myShowOverdraw; }
+
+	// Draws an ImGui panel with our settings and stats
+	static void DrawInspector();
+
+private:
+	static GLuint          myBoundsBuffer;
+	static GLuint          myCommandsBuffer;
+	static GLuint          myStatsBuffer;
+	// The number of draws our buffers have room for
+	static size_t          myCapacity;
+	static uint32_t        myDrawCount;
+
+	// The depth buffer gets copied here, since we can't read from the window's depth buffer directly
+	static Texture2D::Sptr myDepthCopy;
+	static Texture2D::Sptr myHiZ;
+	static glm::mat4       myHiZViewProjection;
+	static bool            myHasHiZ;
+	static Texture2D::Sptr myOverdrawCounts;
+	// An empty vertex array, for drawing our full screen triangle
+	static GLuint          myEmptyVao;
+
+	static Shader::Sptr    myCullShader;
+	static Shader::Sptr    myBuildShader;
+	static Shader::Sptr    myDepthShader;
+	static Shader::Sptr    myOverdrawShader;
+	static Shader::Sptr    myResolveShader;
+
+	static bool            myPrepassEnabled;
+	static bool            myOcclusionEnabled;
+	static bool            myShowOverdraw;
+	static float           myMaxOverdraw;
+
+	// Makes sure our buffers can hold at least the given number of draws
+	static void __Reserve(size_t count);
+	// Makes sure a screen sized texture exists and is the right size
+	static void __ResizeTarget(Texture2D::Sptr& texture, const Texture2DDescription& description, int width, int height, const char* name);
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <GLM/glm.hpp>
+
+/*
+ * A light that shines in every direction from an entity's position, and stops at a set radius. These are
+ * gathered and sent to the GPU every frame by ClusteredLighting
+ */
+struct PointLight {
+	glm::vec3 Color     = glm::vec3(1.0f);
+	float     Intensity = 1.0f;
+	// How far the light reaches, smaller lights touch fewer clusters and are cheaper to draw
+	float     Radius    = 5.0f;
+};
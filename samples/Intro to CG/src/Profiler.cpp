@@ -0,0 +1,400 @@
+#include "Profiler.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <glad/glad.h>
+
+#include "imgui.h"
+#include "Logging.h"
+#include "FrameArena.h"
+
+// The thread index that we use for events that ran on the GPU
+static const uint32_t GpuThread = UINT32_MAX;
+
+std::mutex                      Profiler::myThreadsLock;
+std::vector<Profiler::ThreadBuffer*> Profiler::myThreads;
+
+Profiler::GpuFrame Profiler::myGpuFrames[Profiler::GpuLatency];
+uint32_t     Profiler::myGpuFrameIx = 0;
+uint32_t     Profiler::myGpuDepth = 0;
+
+ProfileFrame Profiler::myHistory[Profiler::HistorySize];
+uint64_t     Profiler::myFrameIndex = 0;
+uint64_t     Profiler::myFrameStart = 0;
+uint64_t     Profiler::myLastRecorded = UINT64_MAX;
+bool         Profiler::isPaused = false;
+std::atomic<bool> Profiler::isInitialized(false);
+
+// Each thread gets a buffer the first time it records something
+static thread_local Profiler::ThreadBuffer* tl_ThreadBuffer = nullptr;
+
+void Profiler::Init() {
+	isInitialized = true;
+	SetThreadName("Main");
+}
+
+void Profiler::Shutdown() {
+	for (GpuFrame& frame : myGpuFrames) {
+		if (!frame.Queries.empty())
+			glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+		frame.Queries.clear();
+		frame.Events.clear();
+		frame.QueriesUsed = 0;
+		frame.Pending = false;
+	}
+
+	// Other threads (ex: pool workers) hold on to their buffers, and may still be inside of a scope, so we can't
+	// delete them. Instead we free their events and keep them around, to be picked up again if we're re-initialized
+	std::lock_guard<std::mutex> lock(myThreadsLock);
+	for (ThreadBuffer* buffer : myThreads) {
+		std::lock_guard<std::mutex> bufferLock(buffer->Lock);
+		buffer->Events = std::vector<ProfileEvent>();
+	}
+
+	for (ProfileFrame& frame : myHistory) {
+		frame.CpuEvents = std::vector<ProfileEvent>();
+		frame.GpuEvents = std::vector<ProfileEvent>();
+	}
+	isInitialized = false;
+}
+
+void Profiler::SetThreadName(const char* name) {
+	ThreadBuffer* buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->Lock);
+	buffer->Name = name;
+}
+
+Profiler::ThreadBuffer* Profiler::GetThreadBuffer() {
+	if (tl_ThreadBuffer == nullptr) {
+		ThreadBuffer* buffer = new ThreadBuffer();
+		std::lock_guard<std::mutex> lock(myThreadsLock);
+		buffer->Index = static_cast<uint32_t>(myThreads.size());
+		buffer->Name = "Thread " + std::to_string(buffer->Index);
+		buffer->Events.reserve(256);
+		myThreads.push_back(buffer);
+		tl_ThreadBuffer = buffer;
+	}
+	return tl_ThreadBuffer;
+}
+
+uint64_t Profiler::Now() {
+	static const auto epoch = std::chrono::steady_clock::now();
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+}
+
+void Profiler::PushCpu(const char* name, uint64_t start, uint64_t end, uint32_t depth) {
+	if (!isInitialized)
+		return;
+	ThreadBuffer* buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->Lock);
+	buffer->Events.push_back({ name, start, end, buffer->Index, depth });
+}
+
+uint32_t Profiler::BeginGpu(const char* name) {
+	if (!isInitialized)
+		return UINT32_MAX;
+
+	GpuFrame& frame = myGpuFrames[myGpuFrameIx];
+	uint32_t query = __NextQuery(frame);
+	glQueryCounter(frame.Queries[query], GL_TIMESTAMP);
+
+	// Until we resolve, start and end store the indices of our queries
+	frame.Events.push_back({ name, query, 0, GpuThread, myGpuDepth++ });
+	return static_cast<uint32_t>(frame.Events.size() - 1);
+}
+
+void Profiler::EndGpu(uint32_t index) {
+	GpuFrame& frame = myGpuFrames[myGpuFrameIx];
+	// Scopes can nest, so other scopes may have used up the pool since we began
+	uint32_t query = __NextQuery(frame);
+	glQueryCounter(frame.Queries[query], GL_TIMESTAMP);
+	frame.Events[index].End = query;
+	myGpuDepth--;
+}
+
+uint32_t Profiler::__NextQuery(GpuFrame& frame) {
+	if (frame.QueriesUsed == frame.Queries.size()) {
+		size_t oldSize = frame.Queries.size();
+		frame.Queries.resize(oldSize + 32);
+		glGenQueries(32, frame.Queries.data() + oldSize);
+	}
+	return frame.QueriesUsed++;
+}
+
+void Profiler::BeginFrame() {
+	myFrameStart = Now();
+	if (!isInitialized)
+		return;
+
+	// If the GPU still hasn't finished with the frame in this slot, we have no choice but to wait for it
+	GpuFrame& frame = myGpuFrames[myGpuFrameIx];
+	if (frame.Pending)
+		__ResolveGpuFrame(frame);
+
+	frame.QueriesUsed = 0;
+	frame.Events.clear();
+	frame.FrameIndex = myFrameIndex;
+	frame.Pending = true;
+	myGpuDepth = 0;
+	// Grab the GPU and CPU clocks at the same time so we can put them on the same timeline
+	glGetInteger64v(GL_TIMESTAMP, &frame.GpuClock);
+	frame.CpuClock = Now();
+}
+
+void Profiler::EndFrame() {
+	uint64_t end = Now();
+
+	if (!isPaused) {
+		ProfileFrame& record = myHistory[myFrameIndex % HistorySize];
+		record.Index = myFrameIndex;
+		record.Start = myFrameStart;
+		record.End = end;
+		record.CpuEvents.clear();
+		record.GpuEvents.clear();
+		record.GpuResolved = false;
+		myLastRecorded = myFrameIndex;
+
+		// Gather up the events from all our threads
+		std::lock_guard<std::mutex> lock(myThreadsLock);
+		for (ThreadBuffer* buffer : myThreads) {
+			std::lock_guard<std::mutex> bufferLock(buffer->Lock);
+			record.CpuEvents.insert(record.CpuEvents.end(), buffer->Events.begin(), buffer->Events.end());
+			buffer->Events.clear();
+		}
+	} else {
+		std::lock_guard<std::mutex> lock(myThreadsLock);
+		for (ThreadBuffer* buffer : myThreads) {
+			std::lock_guard<std::mutex> bufferLock(buffer->Lock);
+			buffer->Events.clear();
+		}
+	}
+
+	if (isInitialized) {
+		// Resolve any older frames that the GPU has already finished with, without blocking
+		for (uint32_t ix = 1; ix < GpuLatency; ix++) {
+			GpuFrame& frame = myGpuFrames[(myGpuFrameIx + ix) % GpuLatency];
+			if (frame.Pending) {
+				GLint available = GL_TRUE;
+				if (frame.QueriesUsed > 0)
+					glGetQueryObjectiv(frame.Queries[frame.QueriesUsed - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+				if (available)
+					__ResolveGpuFrame(frame);
+			}
+		}
+		myGpuFrameIx = (myGpuFrameIx + 1) % GpuLatency;
+	}
+
+	myFrameIndex++;
+}
+
+ProfileFrame* Profiler::__FindFrame(uint64_t index) {
+	ProfileFrame& frame = myHistory[index % HistorySize];
+	return frame.Index == index && frame.End != 0 ? &frame : nullptr;
+}
+
+void Profiler::__ResolveGpuFrame(GpuFrame& frame) {
+	ProfileFrame* record = __FindFrame(frame.FrameIndex);
+	if (record != nullptr) {
+		record->GpuEvents.clear();
+		for (const ProfileEvent& e : frame.Events) {
+			GLuint64 start = 0, end = 0;
+			glGetQueryObjectui64v(frame.Queries[e.Start], GL_QUERY_RESULT, &start);
+			glGetQueryObjectui64v(frame.Queries[e.End], GL_QUERY_RESULT, &end);
+			ProfileEvent resolved = e;
+			resolved.Start = frame.CpuClock + (static_cast<int64_t>(start) - frame.GpuClock);
+			resolved.End   = frame.CpuClock + (static_cast<int64_t>(end) - frame.GpuClock);
+			record->GpuEvents.push_back(resolved);
+		}
+		record->GpuResolved = true;
+	}
+	frame.Pending = false;
+}
+
+// Writes a string to a JSON stream, escaping as needed
+static void WriteJsonString(std::ostream& stream, const std::string& value) {
+	stream << '"';
+	for (char c : value) {
+		if (c == '"' || c == '\\')
+			stream << '\\';
+		stream << c;
+	}
+	stream << '"';
+}
+
+static void WriteTraceEvent(std::ostream& stream, const ProfileEvent& e, uint32_t tid, const char* category, bool& first) {
+	if (!first) stream << ",\n";
+	first = false;
+	stream << "{\"name\":";
+	WriteJsonString(stream, e.Name);
+	// Chrome traces are in microseconds
+	stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+		<< ",\"ts\":" << (e.Start / 1000.0) << ",\"dur\":" << ((e.End - e.Start) / 1000.0) << "}";
+}
+
+bool Profiler::ExportChromeTrace(const std::string& fileName) {
+	std::ofstream file(fileName);
+	if (!file.is_open()) {
+		LOG_WARN("Failed to open trace file \"{}\"", fileName);
+		return false;
+	}
+
+	// We'll put the GPU after all of our CPU threads
+	uint32_t gpuTid = 0;
+	bool first = true;
+	file << std::fixed << std::setprecision(3);
+	file << "{\"traceEvents\":[\n";
+	{
+		std::lock_guard<std::mutex> lock(myThreadsLock);
+		for (ThreadBuffer* buffer : myThreads) {
+			if (!first) file << ",\n";
+			first = false;
+			file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->Index << ",\"args\":{\"name\":";
+			WriteJsonString(file, buffer->Name);
+			file << "}}";
+		}
+		gpuTid = static_cast<uint32_t>(myThreads.size());
+	}
+	if (!first) file << ",\n";
+	file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << gpuTid << ",\"args\":{\"name\":\"GPU\"}}";
+
+	for (const ProfileFrame& frame : myHistory) {
+		if (frame.End == 0)
+			continue;
+		for (const ProfileEvent& e : frame.CpuEvents)
+			WriteTraceEvent(file, e, e.Thread, "cpu", first);
+		for (const ProfileEvent& e : frame.GpuEvents)
+			WriteTraceEvent(file, e, gpuTid, "gpu", first);
+	}
+	file << "\n]}\n";
+
+	LOG_INFO("Wrote profiler trace to \"{}\"", fileName);
+	return true;
+}
+
+// Picks a stable color for a scope based on it's name
+static ImU32 ColorForName(const char* name) {
+	uint32_t hash = 2166136261u;
+	for (const char* c = name; *c; c++)
+		hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+	return IM_COL32(80 + (hash & 0x7F), 80 + ((hash >> 8) & 0x7F), 80 + ((hash >> 16) & 0x7F), 255);
+}
+
+void Profiler::DrawGui() {
+	ImGui::Begin("Profiler");
+
+	ImGui::Checkbox("Paused", &isPaused);
+	ImGui::SameLine();
+	if (ImGui::Button("Export Trace")) {
+		ExportChromeTrace("profile.json");
+	}
+
+	// Let the user scrub back through our history
+	static int framesBack = 0;
+	ImGui::SliderInt("Frames Back", &framesBack, 0, HistorySize - 1);
+	const ProfileFrame* frame = nullptr;
+	if (myLastRecorded != UINT64_MAX && myLastRecorded >= static_cast<uint64_t>(framesBack)) {
+		frame = __FindFrame(myLastRecorded - framesBack);
+	}
+	if (frame == nullptr) {
+		ImGui::Text("No data");
+		ImGui::End();
+		return;
+	}
+
+	ImGui::Text("Frame %llu: %.3fms%s", (unsigned long long)frame->Index, (frame->End - frame->Start) / 1000000.0,
+		frame->GpuResolved ? "" : " (GPU pending)");
+
+	// Our time range covers the frame, and any GPU work that ran past it
+	uint64_t rangeStart = frame->Start;
+	uint64_t rangeEnd = frame->End;
+	for (const ProfileEvent& e : frame->GpuEvents)
+		rangeEnd = std::max(rangeEnd, e.End);
+
+	// Figure out how many rows each thread needs
+	FrameVector<uint32_t> threadDepths;
+	for (const ProfileEvent& e : frame->CpuEvents) {
+		if (e.Thread >= threadDepths.size())
+			threadDepths.resize(e.Thread + 1, 0);
+		threadDepths[e.Thread] = std::max(threadDepths[e.Thread], e.Depth + 1);
+	}
+	uint32_t gpuDepth = 0;
+	for (const ProfileEvent& e : frame->GpuEvents)
+		gpuDepth = std::max(gpuDepth, e.Depth + 1);
+
+	const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+	const float labelWidth = 80.0f;
+	ImDrawList* drawList = ImGui::GetWindowDrawList();
+	ImVec2 origin = ImGui::GetCursorScreenPos();
+	float width = std::max(ImGui::GetContentRegionAvail().x - labelWidth, 50.0f);
+	double scale = width / static_cast<double>(std::max<uint64_t>(rangeEnd - rangeStart, 1));
+	ImVec2 mouse = ImGui::GetIO().MousePos;
+	float y = origin.y;
+
+	auto drawRow = [&](const std::vector<ProfileEvent>& events, uint32_t thread, uint32_t depth, const char* label) {
+		drawList->AddText(ImVec2(origin.x, y + 2.0f), IM_COL32(200, 200, 200, 255), label);
+		for (const ProfileEvent& e : events) {
+			if (e.Thread != thread)
+				continue;
+			float x0 = origin.x + labelWidth + static_cast<float>((e.Start - rangeStart) * scale);
+			float x1 = origin.x + labelWidth + static_cast<float>((e.End - rangeStart) * scale);
+			float y0 = y + e.Depth * rowHeight;
+			x1 = std::max(x1, x0 + 1.0f);
+			drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y0 + rowHeight - 1.0f), ColorForName(e.Name));
+			// Only draw the label if it'll fit
+			if (ImGui::CalcTextSize(e.Name).x < x1 - x0 - 4.0f) {
+				drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y0 + rowHeight), true);
+				drawList->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), e.Name);
+				drawList->PopClipRect();
+			}
+			if (mouse.x >= x0 && mouse.x <= x1 && mouse.y >= y0 && mouse.y < y0 + rowHeight) {
+				ImGui::SetTooltip("%s\n%.3fms", e.Name, (e.End - e.Start) / 1000000.0);
+			}
+		}
+		y += std::max(depth, 1u) * rowHeight + 4.0f;
+	};
+
+	{
+		std::lock_guard<std::mutex> lock(myThreadsLock);
+		for (uint32_t ix = 0; ix < threadDepths.size(); ix++) {
+			if (threadDepths[ix] > 0)
+				drawRow(frame->CpuEvents, ix, threadDepths[ix], ix < myThreads.size() ? myThreads[ix]->Name.c_str() : "?");
+		}
+	}
+	drawRow(frame->GpuEvents, GpuThread, gpuDepth, "GPU");
+	ImGui::Dummy(ImVec2(labelWidth + width, y - origin.y));
+
+	// A flat summary of where our time went, grouped by scope name
+	if (ImGui::CollapsingHeader("Totals")) {
+		struct Total { const char* Name; bool Gpu; double Ms; int Count; };
+		FrameVector<Total> totals;
+		totals.reserve(32);
+		auto accumulate = [&](const ProfileEvent& e, bool gpu) {
+			auto it = std::find_if(totals.begin(), totals.end(), [&](const Total& t) { return t.Gpu == gpu && strcmp(t.Name, e.Name) == 0; });
+			if (it == totals.end()) {
+				totals.push_back({ e.Name, gpu, 0.0, 0 });
+				it = totals.end() - 1;
+			}
+			it->Ms += (e.End - e.Start) / 1000000.0;
+			it->Count++;
+		};
+		for (const ProfileEvent& e : frame->CpuEvents) accumulate(e, false);
+		for (const ProfileEvent& e : frame->GpuEvents) accumulate(e, true);
+		std::sort(totals.begin(), totals.end(), [](const Total& a, const Total& b) { return a.Ms > b.Ms; });
+
+		ImGui::Columns(3);
+		ImGui::Text("Scope"); ImGui::NextColumn();
+		ImGui::Text("Time"); ImGui::NextColumn();
+		ImGui::Text("Calls"); ImGui::NextColumn();
+		for (const Total& t : totals) {
+			ImGui::Text("%s%s", t.Gpu ? "[GPU] " : "", t.Name); ImGui::NextColumn();
+			ImGui::Text("%.3fms", t.Ms); ImGui::NextColumn();
+			ImGui::Text("%d", t.Count); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+	}
+
+	ImGui::End();
+}
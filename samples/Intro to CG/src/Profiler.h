@@ -0,0 +1,168 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+
+// Helpers so our scope macros can make a unique variable per line
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+/*
+ * Times the enclosing scope on the CPU, for the calling thread
+ * Note that the name must outlive the frame (ex: a string literal)
+ */
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(__profileScope, __LINE__)(name)
+/*
+ * Times the enclosing scope on both the CPU and GPU, must only be used on the thread that owns the GL context
+ * Note that the name must outlive the frame (ex: a string literal)
+ */
+#define PROFILE_GPU_SCOPE(name) ProfileScope PROFILE_CONCAT(__profileScope, __LINE__)(name, true)
+
+// A single timed region, all times are in nanoseconds relative to the profiler's epoch
+struct ProfileEvent {
+	const char* Name;
+	uint64_t    Start;
+	uint64_t    End;
+	uint32_t    Thread;
+	uint32_t    Depth;
+};
+
+// All of the events that were recorded for a single frame
+struct ProfileFrame {
+	uint64_t                  Index = 0;
+	uint64_t                  Start = 0;
+	uint64_t                  End   = 0;
+	std::vector<ProfileEvent> CpuEvents;
+	// GPU events come in a few frames late, so these may be empty for the most recent frames
+	std::vector<ProfileEvent> GpuEvents;
+	bool                      GpuResolved = false;
+};
+
+/*
+ * A simple frame profiler. CPU scopes are recorded into per-thread buffers and gathered at the end of each
+ * frame, GPU scopes use GL_TIMESTAMP queries from a pool that is read back a few frames later so that we
+ * never stall waiting on the GPU
+ */
+class Profiler {
+public:
+	// How many frames we keep around for viewing and exporting
+	static const int HistorySize = 128;
+	// How many frames we let the GPU run behind before reading back our queries
+	static const int GpuLatency = 4;
+
+	/*
+	 * Initializes the profiler, the GL context that GPU scopes will be used on must be current
+	 */
+	static void Init();
+	// Releases our GL queries and recorded events, the GL context must still be current. Threads can keep
+	// recording after this, but their events are thrown away until the profiler is initialized again
+	static void Shutdown();
+
+	/*
+	 * Sets the name of the calling thread, as shown in the timeline and trace exports
+	 * @param name The name of the thread
+	 */
+	static void SetThreadName(const char* name);
+
+	// Marks the start of a new frame, should be called on the main thread
+	static void BeginFrame();
+	// Gathers all of the events for the frame, and resolves any GPU queries that have finished
+	static void EndFrame();
+
+	// Gets or sets whether we are recording new frames into our history
+	static bool IsPaused() { return isPaused; }
+	static void SetPaused(bool paused) { isPaused = paused; }
+
+	/*
+	 * Writes all of the frames in our history out as a Chrome trace file (chrome://tracing or https://ui.perfetto.dev)
+	 * @param fileName The path to the file to write
+	 * @returns True if the file was written, false if otherwise
+	 */
+	static bool ExportChromeTrace(const std::string& fileName);
+
+	// Draws the profiler's timeline window
+	static void DrawGui();
+
+	// These are used by ProfileScope, you shouldn't need to call these directly
+	static uint64_t Now();
+	static void PushCpu(const char* name, uint64_t start, uint64_t end, uint32_t depth);
+	static uint32_t BeginGpu(const char* name);
+	static void EndGpu(uint32_t index);
+
+	// Stores each thread's events until the end of the frame
+	struct ThreadBuffer {
+		std::mutex                Lock;
+		std::vector<ProfileEvent> Events;
+		std::string               Name;
+		uint32_t                  Index = 0;
+		uint32_t                  Depth = 0;
+	};
+	static ThreadBuffer* GetThreadBuffer();
+
+private:
+	// A frame's worth of GPU queries, we keep GpuLatency of these in flight
+	struct GpuFrame {
+		std::vector<uint32_t> Queries;
+		uint32_t              QueriesUsed = 0;
+		std::vector<ProfileEvent> Events; // Start and End store query indices until resolved
+		uint64_t              FrameIndex = 0;
+		// The GPU and CPU clocks at the start of the frame, so we can line up the two timelines
+		int64_t               GpuClock = 0;
+		uint64_t              CpuClock = 0;
+		bool                  Pending = false;
+	};
+
+	static std::mutex                 myThreadsLock;
+	static std::vector<ThreadBuffer*> myThreads;
+
+	static GpuFrame     myGpuFrames[GpuLatency];
+	static uint32_t     myGpuFrameIx;
+	static uint32_t     myGpuDepth;
+
+	static ProfileFrame myHistory[HistorySize];
+	static uint64_t     myFrameIndex;
+	static uint64_t     myFrameStart;
+	static uint64_t     myLastRecorded;
+	static bool         isPaused;
+	// Read by every thread that records, so that nothing is kept while we're shut down
+	static std::atomic<bool> isInitialized;
+
+	static ProfileFrame* __FindFrame(uint64_t index);
+	static void __ResolveGpuFrame(GpuFrame& frame);
+	// Grabs the next query from a frame's pool, growing the pool if it's full
+	static uint32_t __NextQuery(GpuFrame& frame);
+};
+
+/*
+ * RAII helper for timing a scope, use the PROFILE_SCOPE and PROFILE_GPU_SCOPE macros
+ */
+class ProfileScope {
+public:
+	ProfileScope(const char* name, bool gpu = false) :
+		myName(name),
+		myGpuIndex(gpu ? Profiler::BeginGpu(name) : UINT32_MAX)
+	{
+		myThread = Profiler::GetThreadBuffer();
+		myDepth  = myThread->Depth++;
+		myStart  = Profiler::Now();
+	}
+	~ProfileScope() {
+		uint64_t end = Profiler::Now();
+		myThread->Depth--;
+		Profiler::PushCpu(myName, myStart, end, myDepth);
+		if (myGpuIndex != UINT32_MAX)
+			Profiler::EndGpu(myGpuIndex);
+	}
+
+	ProfileScope(const ProfileScope& other) = delete;
+	ProfileScope& operator =(const ProfileScope& other) = delete;
+
+private:
+	const char*             myName;
+	uint32_t                myGpuIndex;
+	uint32_t                myDepth;
+	uint64_t                myStart;
+	Profiler::ThreadBuffer* myThread;
+};
@@ -0,0 +1,102 @@
+#include "RenderTarget.h"
+#include "Logging.h"
+
+RenderTarget::RenderTarget(const RenderTargetDescription& description) {
+	myDescription = description;
+	glCreateFramebuffers(1, &myRenderhandle);
+	__SetupAttachments();
+}
+
+RenderTarget::~RenderTarget() {
+	glDeleteFramebuffers(1, &myRenderhandle);
+}
+
+void RenderTarget::SetDebugName(const std::string& name) {
+	GraphicsResource::SetDebugName(name);
+	for (size_t ix = 0; ix < myColor.size(); ix++)
+		myColor[ix]->SetDebugName(name + " | Color" + std::to_string(ix));
+	if (myDepth != nullptr)
+		myDepth->SetDebugName(name + " | Depth");
+}
+
+void RenderTarget::Bind() {
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, myRenderhandle);
+	glViewport(0, 0, myDescription.Width, myDescription.Height);
+}
+
+void RenderTarget::Unbind() {
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+}
+
+void RenderTarget::Clear(const glm::vec4& color, float depth) {
+	for (size_t ix = 0; ix < myColor.size(); ix++)
+		glClearNamedFramebufferfv(myRenderhandle, GL_COLOR, (GLint)ix, &color[0]);
+	if (myDepth != nullptr) {
+		if (myDepth->GetDescription().Format == InternalFormat::Depth24Stencil8)
+			glClearNamedFramebufferfi(myRenderhandle, GL_DEPTH_STENCIL, 0, depth, 0);
+		else
+			glClearNamedFramebufferfv(myRenderhandle, GL_DEPTH, 0, &depth);
+	}
+}
+
+void RenderTarget::Resize(uint32_t width, uint32_t height) {
+	if (width == myDescription.Width && height == myDescription.Height)
+		return;
+	myDescription.Width  = width;
+	myDescription.Height = height;
+	for (Texture2D::Sptr& texture : myColor)
+		texture->Resize(width, height);
+	if (myDepth != nullptr)
+		myDepth->Resize(width, height);
+	// Resizing gave our textures new handles, so we need to attach them again
+	__SetupAttachments();
+}
+
+size_t RenderTarget::GetGpuSize() const {
+	size_t result = 0;
+	for (const Texture2D::Sptr& texture : myColor)
+		result += texture->GetGpuSize();
+	if (myDepth != nullptr)
+		result += myDepth->GetGpuSize();
+	return result;
+}
+
+void RenderTarget::__SetupAttachments() {
+	LOG_ASSERT(myDescription.Width > 0 && myDescription.Height > 0, "Render targets must have a size!");
+
+	// Only make our textures the first time, after that they are resized in place
+	if (myColor.empty()) {
+		for (Texture2DDescription desc : myDescription.Color) {
+			desc.Width  = myDescription.Width;
+			desc.Height = myDescription.Height;
+			myColor.push_back(Texture2D::Create(desc));
+		}
+		if (myDescription.HasDepth) {
+			Texture2DDescription desc = myDescription.Depth;
+			desc.Width  = myDescription.Width;
+			desc.Height = myDescription.Height;
+			myDepth = Texture2D::Create(desc);
+		}
+	}
+
+	std::vector<GLenum> drawBuffers;
+	for (size_t ix = 0; ix < myColor.size(); ix++) {
+		glNamedFramebufferTexture(myRenderhandle, GL_COLOR_ATTACHMENT0 + (GLenum)ix, myColor[ix]->GetRenderHandle(), 0);
+		drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + (GLenum)ix);
+	}
+	// Depth only targets (like shadow maps) don't draw to any color buffers
+	if (drawBuffers.empty())
+		glNamedFramebufferDrawBuffer(myRenderhandle, GL_NONE);
+	else
+		glNamedFramebufferDrawBuffers(myRenderhandle, (GLsizei)drawBuffers.size(), drawBuffers.data());
+
+	if (myDepth != nullptr) {
+		InternalFormat format = myDepth->GetDescription().Format;
+		GLenum attachment = (format == InternalFormat::Depth24Stencil8 || format == InternalFormat::DepthStencil) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+		glNamedFramebufferTexture(myRenderhandle, attachment, myDepth->GetRenderHandle(), 0);
+	}
+
+	GLenum status = glCheckNamedFramebufferStatus(myRenderhandle, GL_DRAW_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+		LOG_WARN("Render target is not complete (status 0x{:X})", status);
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <glad/glad.h>
+#include <GLM/glm.hpp>
+#include <vector>
+
+#include "Utils.h"
+#include "GraphicsResource.h"
+#include "Texture2D.h"
+
+/*
+ * Describes the attachments of a render target. Each attachment is a regular texture description, but their
+ * width and height are ignored in favor of the render target's size
+ */
+struct RenderTargetDescription {
+	uint32_t                          Width    = 0;
+	uint32_t                          Height   = 0;
+	// The textures for each of our color outputs, in order
+	std::vector<Texture2DDescription> Color;
+	// The depth (or depth stencil) texture, only used if HasDepth is true
+	bool                              HasDepth = false;
+	Texture2DDescription              Depth;
+
+	bool operator ==(const RenderTargetDescription& other) const {
+		if (Width != other.Width || Height != other.Height || Color.size() != other.Color.size() || HasDepth != other.HasDepth)
+			return false;
+		for (size_t ix = 0; ix < Color.size(); ix++) {
+			if (!IsSameAttachment(Color[ix], other.Color[ix]))
+				return false;
+		}
+		return !HasDepth || IsSameAttachment(Depth, other.Depth);
+	}
+	bool operator !=(const RenderTargetDescription& other) const { return !(*this == other); }
+
+	// Compares two attachments, ignoring their width and height since the target's size is used instead
+	static bool IsSameAttachment(const Texture2DDescription& a, const Texture2DDescription& b) {
+		return a.Format == b.Format && a.EnableMip == b.EnableMip && a.MipLevels == b.MipLevels &&
+			a.Sampler == b.Sampler && a.Sparse == b.Sparse;
+	}
+};
+
+/*
+ * A framebuffer and the textures it renders into. The attachments are regular Texture2Ds, so they can be
+ * handed to materials once we're done rendering to them
+ */
+class RenderTarget : public GraphicsResource<GL_FRAMEBUFFER> {
+public:
+	GraphicsClass(RenderTarget);
+
+	RenderTarget(const RenderTargetDescription& description);
+	virtual ~RenderTarget();
+
+	void SetDebugName(const std::string& name) override;
+
+	// Binds this render target for drawing, and sets the viewport to cover all of it
+	void Bind();
+	// Goes back to drawing to the window (the viewport is left for the caller to restore)
+	static void Unbind();
+
+	/*
+	 * Clears all of this render target's attachments
+	 * @param color The color to clear our color attachments to
+	 * @param depth The value to clear our depth attachment to
+	 */
+	void Clear(const glm::vec4& color = glm::vec4(0.0f), float depth = 1.0f);
+
+	/*
+	 * Re-creates all of our attachments at a new size, their contents are lost
+	 * @param width  The new width, in pixels
+	 * @param height The new height, in pixels
+	 */
+	void Resize(uint32_t width, uint32_t height);
+
+	const RenderTargetDescription& GetDescription() const { return myDescription; }
+	uint32_t GetWidth() const { return myDescription.Width; }
+	uint32_t GetHeight() const { return myDescription.Height; }
+
+	// Gets one of our color attachments
+	const Texture2D::Sptr& GetColor(size_t index = 0) const { return myColor[index]; }
+	// Gets our depth attachment, or null if we don't have one
+	const Texture2D::Sptr& GetDepth() const { return myDepth; }
+
+	// Gets the estimated amount of GPU memory used by all of our attachments, in bytes
+	size_t GetGpuSize() const;
+
+protected:
+	RenderTargetDescription      myDescription;
+	std::vector<Texture2D::Sptr> myColor;
+	Texture2D::Sptr              myDepth;
+
+	// Creates our attachments and attaches them to our framebuffer
+	void __SetupAttachments();
+};
@@ -0,0 +1,77 @@
+#include "RenderTargetPool.h"
+
+#include <algorithm>
+#include "imgui.h"
+
+std::vector<RenderTargetPool::Entry> RenderTargetPool::myEntries;
+uint64_t RenderTargetPool::myFrame            = 0;
+uint32_t RenderTargetPool::myCreatedLastFrame = 0;
+uint32_t RenderTargetPool::myCreatedThisFrame = 0;
+
+RenderTarget::Handle RenderTargetPool::Acquire(const RenderTargetDescription& description) {
+	for (Entry& entry : myEntries) {
+		if (__IsFree(entry) && entry.Target->GetDescription() == description) {
+			entry.LastUsed = myFrame;
+			return entry.Target;
+		}
+	}
+
+	Entry entry;
+	entry.Target   = RenderTarget::Handle::Create(description);
+	entry.LastUsed = myFrame;
+	entry.Target->SetDebugName("Transient RT " + std::to_string(myEntries.size()));
+	myEntries.push_back(entry);
+	myCreatedThisFrame++;
+	return entry.Target;
+}
+
+void RenderTargetPool::NextFrame() {
+	myFrame++;
+	myCreatedLastFrame = myCreatedThisFrame;
+	myCreatedThisFrame = 0;
+	// Targets that are still held count as used, so that we don't keep track of how long they've been out
+	for (Entry& entry : myEntries) {
+		if (!__IsFree(entry))
+			entry.LastUsed = myFrame;
+	}
+	myEntries.erase(std::remove_if(myEntries.begin(), myEntries.end(), [](const Entry& entry) {
+		return myFrame - entry.LastUsed > ReleaseDelay;
+	}), myEntries.end());
+}
+
+void RenderTargetPool::Clear() {
+	myEntries.clear();
+	myCreatedLastFrame = 0;
+	myCreatedThisFrame = 0;
+}
+
+size_t RenderTargetPool::GetGpuSize() {
+	size_t result = 0;
+	for (const Entry& entry : myEntries)
+		result += entry.Target->GetGpuSize();
+	return result;
+}
+
+void RenderTargetPool::DrawInspector() {
+	ImGui::Text("Pooled: %zu targets, %.2f MB", myEntries.size(), GetGpuSize() / (1024.0f * 1024.0f));
+	ImGui::Text("Created last frame: %u", myCreatedLastFrame);
+
+	ImGui::Columns(4);
+	ImGui::Text("Name");      ImGui::NextColumn();
+	ImGui::Text("Size");      ImGui::NextColumn();
+	ImGui::Text("Size (KB)"); ImGui::NextColumn();
+	ImGui::Text("In Use");    ImGui::NextColumn();
+	ImGui::Separator();
+	for (const Entry& entry : myEntries) {
+		const RenderTarget* target = entry.Target.Get();
+		ImGui::Text("%s", target->GetDebugName().c_str());                          ImGui::NextColumn();
+		ImGui::Text("%ux%u", target->GetWidth(), target->GetHeight());              ImGui::NextColumn();
+		ImGui::Text("%.1f", target->GetGpuSize() / 1024.0f);                        ImGui::NextColumn();
+		ImGui::Text("%s", __IsFree(entry) ? "No" : "Yes");                          ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+bool RenderTargetPool::__IsFree(const Entry& entry) {
+	return ResourcePool<RenderTarget>::GetRefCount(entry.Target.GetValue()) <= 1;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <vector>
+
+#include "RenderTarget.h"
+
+/*
+ * Hands out render targets that only live for part of a frame (post processing buffers, shadow maps, etc...).
+ * Instead of re-creating them every frame, targets are recycled by description once nobody holds them anymore
+ */
+class RenderTargetPool {
+public:
+	// How many frames a target can go unused before we delete it
+	static const uint64_t ReleaseDelay = 60;
+
+	/*
+	 * Gets a render target matching the given description, re-using a free one if we have it. The target is
+	 * free to be handed out again once the returned handle (and any copies of it) are released
+	 * @param description The description of the target we want
+	 * @returns A handle to the render target, it's contents are undefined
+	 */
+	static RenderTarget::Handle Acquire(const RenderTargetDescription& description);
+
+	// Should be called once per frame, deletes targets that have not been used for a while
+	static void NextFrame();
+	// Deletes all of our free targets, targets that are still held are deleted once they are released
+	static void Clear();
+
+	// Gets the estimated amount of GPU memory used by all of our targets, in bytes
+	static size_t GetGpuSize();
+
+	// Draws an ImGui table of the targets in the pool
+	static void DrawInspector();
+
+private:
+	struct Entry {
+		RenderTarget::Handle Target;
+		uint64_t             LastUsed = 0;
+	};
+
+	static std::vector<Entry> myEntries;
+	static uint64_t myFrame;
+	// How many targets we had to create last frame, if this is always above 0 something is holding on to targets
+	static uint32_t myCreatedLastFrame;
+	static uint32_t myCreatedThisFrame;
+
+	// Checks if nobody outside of the pool holds an entry's target
+	static bool __IsFree(const Entry& entry);
+};
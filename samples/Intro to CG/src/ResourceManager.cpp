@@ -0,0 +1,245 @@
+#include "ResourceManager.h"
+#include "Logging.h"
+#include "ObjLoader.h"
+#include "TextureContainer.h"
+#include "TextureStreamer.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+#include "imgui.h"
+
+std::unordered_map<std::string, ResourceManager::Entry> ResourceManager::myResources;
+size_t   ResourceManager::myBudget       = ResourceManager::DefaultBudget;
+size_t   ResourceManager::myTotalGpuSize = 0;
+uint64_t ResourceManager::myFrame        = 0;
+std::vector<std::unordered_map<std::string, ResourceManager::Entry>::iterator> ResourceManager::myEvictCandidates;
+
+uint32_t ResourceManager::Entry::GetRefCount() const {
+	switch (Type) {
+		case ResourceType::Texture2D:   return ResourcePool<::Texture2D>::GetRefCount(Texture.GetValue());
+		case ResourceType::TextureCube: return ResourcePool<::TextureCube>::GetRefCount(Cubemap.GetValue());
+		case ResourceType::Shader:      return ResourcePool<::Shader>::GetRefCount(Program.GetValue());
+		case ResourceType::Mesh:        return ResourcePool<::Mesh>::GetRefCount(Geometry.GetValue());
+		default: return 0;
+	}
+}
+
+Texture2D::Handle ResourceManager::LoadTexture2D(const std::string& fileName, bool loadAlpha) {
+	std::string key = "tex2d|" + __CanonicalPath(fileName) + (loadAlpha ? "|rgba" : "|rgb");
+	if (Entry* existing = __Find(key))
+		return existing->Texture;
+
+	// Prefer the cooked version of the texture if there is one
+	std::string cooked = std::filesystem::path(fileName).replace_extension(".dds").string();
+	bool useCooked = !TextureContainer::IsContainerFile(fileName) && __IsFile(cooked);
+	// Cooked files have all of their mips on disk, so we can stream them in as they are needed
+	Texture2D::Handle result = useCooked ? TextureStreamer::Load(cooked) : Texture2D::LoadFromFile(fileName, loadAlpha);
+	if (result == nullptr)
+		return nullptr;
+
+	Entry entry;
+	entry.Type    = ResourceType::Texture2D;
+	entry.Name    = fileName;
+	entry.GpuSize = result->GetGpuSize();
+	entry.Texture = result;
+	__Add(key, std::move(entry));
+	return result;
+}
+
+TextureCube::Handle ResourceManager::LoadTextureCube(const std::string faceFiles[6], bool flipVertically) {
+	std::string key = "cube";
+	for (int ix = 0; ix < 6; ix++)
+		key += "|" + __CanonicalPath(faceFiles[ix]);
+	key += flipVertically ? "|flip" : "|noflip";
+	if (Entry* existing = __Find(key))
+		return existing->Cubemap;
+
+	// The cooker writes a single cubemap named after the faces, without their _rt, _lf, etc... suffix. Cooked
+	// files are never flipped, so we can only use them when we weren't asked to flip
+	std::string cooked = std::filesystem::path(faceFiles[0]).replace_extension().string();
+	cooked.resize(cooked.size() - std::min(cooked.size(), (size_t)3));
+	cooked += ".dds";
+	bool useCooked = !flipVertically && __IsFile(cooked);
+	TextureCube::Handle result = useCooked ? TextureCube::LoadFromFile(cooked) : TextureCube::LoadFromFiles(faceFiles, flipVertically);
+	if (result == nullptr)
+		return nullptr;
+
+	Entry entry;
+	entry.Type    = ResourceType::TextureCube;
+	entry.Name    = std::filesystem::path(faceFiles[0]).parent_path().string();
+	entry.GpuSize = result->GetGpuSize();
+	entry.Cubemap = result;
+	__Add(key, std::move(entry));
+	return result;
+}
+
+TextureCube::Handle ResourceManager::LoadTextureCube(const std::string& fileName) {
+	std::string key = "cube|" + __CanonicalPath(fileName);
+	if (Entry* existing = __Find(key))
+		return existing->Cubemap;
+
+	TextureCube::Handle result = TextureContainer::IsContainerFile(fileName) ? TextureCube::LoadFromFile(fileName) : TextureCube::LoadFromImage(fileName);
+	if (result == nullptr)
+		return nullptr;
+
+	Entry entry;
+	entry.Type    = ResourceType::TextureCube;
+	entry.Name    = fileName;
+	entry.GpuSize = result->GetGpuSize();
+	entry.Cubemap = result;
+	__Add(key, std::move(entry));
+	return result;
+}
+
+Shader::Handle ResourceManager::LoadShader(const std::string& vsFile, const std::string& fsFile) {
+	std::string key = "shader|" + __CanonicalPath(vsFile) + "|" + __CanonicalPath(fsFile);
+	if (Entry* existing = __Find(key))
+		return existing->Program;
+
+	Shader::Handle result = Shader::Handle::Create();
+	result->Load(vsFile.c_str(), fsFile.c_str());
+
+	Entry entry;
+	entry.Type    = ResourceType::Shader;
+	entry.Name    = vsFile + " + " + fsFile;
+	// The program binary is the closest thing we have to a size for a shader
+	GLint binaryLength = 0;
+	glGetProgramiv(result->GetRenderHandle(), GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	entry.GpuSize = binaryLength;
+	entry.Program = result;
+	__Add(key, std::move(entry));
+	return result;
+}
+
+Mesh::Handle ResourceManager::LoadMesh(const std::string& fileName, const glm::vec4& baseColor) {
+	char color[64];
+	snprintf(color, 64, "|%g,%g,%g,%g", baseColor.r, baseColor.g, baseColor.b, baseColor.a);
+	std::string key = "mesh|" + __CanonicalPath(fileName) + color;
+	if (Entry* existing = __Find(key))
+		return existing->Geometry;
+
+	Mesh::Handle result = ObjLoader::LoadObjToMesh(fileName.c_str(), baseColor);
+
+	Entry entry;
+	entry.Type     = ResourceType::Mesh;
+	entry.Name     = fileName;
+	entry.GpuSize  = result->GetGpuSize();
+	entry.Geometry = result;
+	__Add(key, std::move(entry));
+	return result;
+}
+
+void ResourceManager::Update() {
+	myFrame++;
+	// Streamed textures change size as their levels come and go
+	for (auto& kvp : myResources) {
+		Entry& entry = kvp.second;
+		if (entry.Type == ResourceType::Texture2D && entry.Texture != nullptr) {
+			size_t size = entry.Texture->GetGpuSize();
+			myTotalGpuSize = myTotalGpuSize - entry.GpuSize + size;
+			entry.GpuSize = size;
+		}
+	}
+	if (myTotalGpuSize > myBudget)
+		__Evict(myBudget);
+}
+
+size_t ResourceManager::EvictUnused() {
+	return __Evict(0);
+}
+
+void ResourceManager::Clear() {
+	myResources.clear();
+	myTotalGpuSize = 0;
+}
+
+void ResourceManager::DrawInspector() {
+	ImGui::Text("Resident: %zu resources, %.2f MB", myResources.size(), myTotalGpuSize / (1024.0f * 1024.0f));
+
+	int budgetMb = (int)(myBudget / (1024 * 1024));
+	if (ImGui::DragInt("Budget (MB)", &budgetMb, 1.0f, 0, 8192)) {
+		myBudget = (size_t)std::max(budgetMb, 0) * 1024 * 1024;
+	}
+	if (ImGui::Button("Evict Unused")) {
+		size_t freed = EvictUnused();
+		LOG_INFO("Evicted {} bytes of unused resources", freed);
+	}
+
+	// Sort our resources by size so the big ones are at the top
+	std::vector<const Entry*> entries;
+	entries.reserve(myResources.size());
+	for (auto& kvp : myResources)
+		entries.push_back(&kvp.second);
+	std::sort(entries.begin(), entries.end(), [](const Entry* a, const Entry* b) { return a->GpuSize > b->GpuSize; });
+
+	ImGui::Columns(5);
+	ImGui::Text("Type");      ImGui::NextColumn();
+	ImGui::Text("Name");      ImGui::NextColumn();
+	ImGui::Text("Size (KB)"); ImGui::NextColumn();
+	ImGui::Text("Refs");      ImGui::NextColumn();
+	ImGui::Text("Last Used"); ImGui::NextColumn();
+	ImGui::Separator();
+	for (const Entry* entry : entries) {
+		ImGui::Text("%s", (~entry->Type).c_str());                    ImGui::NextColumn();
+		ImGui::Text("%s", entry->Name.c_str());                       ImGui::NextColumn();
+		ImGui::Text("%.1f", entry->GpuSize / 1024.0f);                ImGui::NextColumn();
+		// Don't count our own reference
+		ImGui::Text("%u", entry->GetRefCount() - 1);                  ImGui::NextColumn();
+		ImGui::Text("%llu frames ago", (unsigned long long)(myFrame - entry->LastUsed)); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+std::string ResourceManager::__CanonicalPath(const std::string& path) {
+	std::error_code error;
+	std::filesystem::path result = std::filesystem::weakly_canonical(path, error);
+	return error ? path : result.generic_string();
+}
+
+bool ResourceManager::__IsFile(const std::string& path) {
+	std::error_code error;
+	return std::filesystem::is_regular_file(path, error);
+}
+
+ResourceManager::Entry* ResourceManager::__Find(const std::string& key) {
+	auto it = myResources.find(key);
+	if (it == myResources.end())
+		return nullptr;
+	it->second.LastUsed = myFrame;
+	return &it->second;
+}
+
+void ResourceManager::__Add(const std::string& key, Entry&& entry) {
+	entry.LastUsed = myFrame;
+	myTotalGpuSize += entry.GpuSize;
+	myResources[key] = std::move(entry);
+
+	if (myTotalGpuSize > myBudget)
+		LOG_WARN("Resources are using {} bytes, which is over our budget of {} bytes", myTotalGpuSize, myBudget);
+}
+
+size_t ResourceManager::__Evict(size_t targetSize) {
+	// Only resources that nobody else is holding on to can be evicted
+	std::vector<std::unordered_map<std::string, Entry>::iterator>& candidates = myEvictCandidates;
+	candidates.clear();
+	for (auto it = myResources.begin(); it != myResources.end(); it++) {
+		if (it->second.GetRefCount() <= 1)
+			candidates.push_back(it);
+	}
+	// Evict the ones that were requested longest ago first
+	std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a->second.LastUsed < b->second.LastUsed; });
+
+	size_t freed = 0;
+	for (auto& it : candidates) {
+		if (myTotalGpuSize <= targetSize)
+			break;
+		LOG_TRACE("Evicting {} ({} bytes)", it->second.Name, it->second.GpuSize);
+		myTotalGpuSize -= it->second.GpuSize;
+		freed += it->second.GpuSize;
+		myResources.erase(it);
+	}
+	// The iterators we erased are dangling now, so don't leave them lying around
+	candidates.clear();
+	return freed;
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLM/glm.hpp>
+#include <EnumToString.h>
+
+#include "Texture2D.h"
+#include "TextureCube.h"
+#include "Shader.h"
+#include "Mesh.h"
+
+// The kinds of resources that the resource manager can load
+ENUM(ResourceType, int,
+	Texture2D   = 0,
+	TextureCube = 1,
+	Shader      = 2,
+	Mesh        = 3
+);
+
+/*
+ * Loads resources from disk, and makes sure that each file is only ever loaded once. Resources are keyed by
+ * their canonical path and the options they were loaded with, so asking for the same file twice will just
+ * hand back another handle to the first one.
+ *
+ * If the texture cooker has produced a DDS file next to an image we are asked for, we load the cooked file
+ * instead, so that we get it's compressed format and pre-built mips for free. Cooked textures are loaded
+ * through the TextureStreamer, so only the mip levels that are actually visible end up on the GPU.
+ *
+ * The manager holds a reference to everything it has loaded. Once nothing else is referencing a resource,
+ * it can be evicted if we are over our VRAM budget (least recently requested first)
+ */
+class ResourceManager {
+public:
+	// The default VRAM budget, in bytes
+	static const size_t DefaultBudget = 256 * 1024 * 1024;
+
+	/*
+	 * Loads a 2D texture from an image file, or returns the existing texture if it has already been loaded
+	 * @param fileName  The path to the image file
+	 * @param loadAlpha True if the texture should have an alpha channel
+	 * @returns A handle to the texture, or a null handle if the image could not be loaded
+	 */
+	static Texture2D::Handle LoadTexture2D(const std::string& fileName, bool loadAlpha = true);
+	/*
+	 * Loads a cubemap from 6 image files, or returns the existing cubemap if it has already been loaded
+	 * @param faceFiles      The paths to the images for each face, in CubeMapFace order
+	 * @param flipVertically True if the images should be flipped on load
+	 */
+	static TextureCube::Handle LoadTextureCube(const std::string faceFiles[6], bool flipVertically = true);
+	/*
+	 * Loads a cubemap from a single DDS or KTX2 file, or from an equirectangular or cross layout image, or returns
+	 * the existing cubemap if it has already been loaded
+	 * @param fileName The path to the file
+	 */
+	static TextureCube::Handle LoadTextureCube(const std::string& fileName);
+	/*
+	 * Loads a shader program from a vertex and fragment shader, or returns the existing program if it has already been loaded
+	 * @param vsFile The path to the vertex shader
+	 * @param fsFile The path to the fragment shader
+	 */
+	static Shader::Handle LoadShader(const std::string& vsFile, const std::string& fsFile);
+	/*
+	 * Loads a mesh from an OBJ file, or returns the existing mesh if it has already been loaded
+	 * @param fileName  The path to the OBJ file
+	 * @param baseColor The vertex color to use for the mesh
+	 */
+	static Mesh::Handle LoadMesh(const std::string& fileName, const glm::vec4& baseColor = glm::vec4(1.0f));
+
+	// Gets or sets how much GPU memory we let our resources use before we start evicting unused ones, in bytes
+	static void SetBudget(size_t bytes) { myBudget = bytes; }
+	static size_t GetBudget() { return myBudget; }
+	// Gets the estimated amount of GPU memory used by all of our resources, in bytes
+	static size_t GetTotalGpuSize() { return myTotalGpuSize; }
+
+	// Should be called once per frame, evicts unused resources if we are over budget
+	static void Update();
+	/*
+	 * Evicts every resource that is not referenced outside of the resource manager
+	 * @returns The number of bytes that were freed
+	 */
+	static size_t EvictUnused();
+	// Drops all of the manager's references, resources that are still in use elsewhere stay alive until released
+	static void Clear();
+
+	// Draws an ImGui table of all of our resident resources
+	static void DrawInspector();
+
+private:
+	struct Entry {
+		ResourceType        Type;
+		std::string         Name;
+		size_t              GpuSize   = 0;
+		uint64_t            LastUsed  = 0;
+		// Only the handle for our type is set
+		Texture2D::Handle   Texture;
+		TextureCube::Handle Cubemap;
+		Shader::Handle      Program;
+		Mesh::Handle        Geometry;
+
+		// Gets the number of references to the resource, including ours
+		uint32_t GetRefCount() const;
+	};
+
+	static std::unordered_map<std::string, Entry> myResources;
+	static size_t   myBudget;
+	static size_t   myTotalGpuSize;
+	static uint64_t myFrame;
+	// The resources that __Evict could remove, kept around so we don't allocate every frame we're over budget
+	static std::vector<std::unordered_map<std::string, Entry>::iterator> myEvictCandidates;
+
+	static std::string __CanonicalPath(const std::string& path);
+	static bool __IsFile(const std::string& path);
+	static Entry* __Find(const std::string& key);
+	static void __Add(const std::string& key, Entry&& entry);
+	static size_t __Evict(size_t targetSize);
+};
@@ -0,0 +1,363 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*
+ * A fixed size block allocator, used to keep shared_ptr control blocks for pooled resources together
+ * instead of scattered across the heap. Blocks are carved out of chunks and recycled through a free list,
+ * chunks are never returned to the OS
+ * @param Size  The size of each block, in bytes
+ * @param Align The alignment of each block
+ */
+template <size_t Size, size_t Align>
+class BlockPool {
+public:
+	// The number of blocks we allocate at a time
+	static const size_t BlocksPerChunk = 256;
+
+	static void* Allocate() {
+		std::lock_guard<std::mutex> lock(__Lock());
+		FreeBlock*& head = __Head();
+		if (head == nullptr) {
+			// Grab a new chunk and thread all of it's blocks onto the free list
+			uint8_t* chunk = static_cast<uint8_t*>(::operator new(BlockSize * BlocksPerChunk));
+			for (size_t ix = BlocksPerChunk; ix > 0; ix--) {
+				FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (ix - 1) * BlockSize);
+				block->Next = head;
+				head = block;
+			}
+		}
+		FreeBlock* result = head;
+		head = result->Next;
+		return result;
+	}
+	static void Free(void* block) {
+		std::lock_guard<std::mutex> lock(__Lock());
+		FreeBlock* freed = static_cast<FreeBlock*>(block);
+		freed->Next = __Head();
+		__Head() = freed;
+	}
+
+private:
+	struct FreeBlock { FreeBlock* Next; };
+	// Blocks must be able to hold our free list link, and keep the requested alignment when packed together
+	static const size_t BlockAlign = Align > alignof(FreeBlock) ? Align : alignof(FreeBlock);
+	static const size_t BlockSize  = ((Size > sizeof(FreeBlock) ? Size : sizeof(FreeBlock)) + BlockAlign - 1) & ~(BlockAlign - 1);
+
+	static_assert(BlockAlign <= alignof(std::max_align_t), "BlockPool does not support over-aligned types");
+
+	static std::mutex& __Lock() { static std::mutex lock; return lock; }
+	static FreeBlock*& __Head() { static FreeBlock* head = nullptr; return head; }
+};
+
+/*
+ * An STL allocator that puts single objects into a BlockPool, we hand this to shared_ptr so that it's
+ * control block comes from a pool (arrays fall back to the regular heap)
+ */
+template <typename T>
+class BlockPoolAllocator {
+public:
+	typedef T value_type;
+
+	BlockPoolAllocator() noexcept = default;
+	template <typename U>
+	BlockPoolAllocator(const BlockPoolAllocator<U>&) noexcept { }
+
+	T* allocate(size_t count) {
+		if (count == 1)
+			return static_cast<T*>(BlockPool<sizeof(T), alignof(T)>::Allocate());
+		return static_cast<T*>(::operator new(count * sizeof(T)));
+	}
+	void deallocate(T* block, size_t count) noexcept {
+		if (count == 1)
+			BlockPool<sizeof(T), alignof(T)>::Free(block);
+		else
+			::operator delete(block);
+	}
+
+	template <typename U>
+	bool operator ==(const BlockPoolAllocator<U>&) const noexcept { return true; }
+	template <typename U>
+	bool operator !=(const BlockPoolAllocator<U>&) const noexcept { return false; }
+};
+
+/*
+ * Stores all objects of a given type in chunks of contiguous slots, addressed by a 32 bit handle. The low
+ * bits of a handle are the slot index, and the high bits are the slot's generation, which is bumped every
+ * time the slot is freed. This means a stale handle can never resolve to whatever object reused it's slot
+ *
+ * Slots are reference counted, the object is destroyed when the last ResourceHandle (or pooled Sptr) to it
+ * is released. A handle value of 0 is always null
+ */
+template <typename T>
+class ResourcePool {
+public:
+	static const uint32_t IndexBits      = 20;
+	static const uint32_t GenerationBits = 32 - IndexBits;
+	static const uint32_t IndexMask      = (1u << IndexBits) - 1;
+	static const uint32_t GenerationMask = (1u << GenerationBits) - 1;
+	// The number of slots in each chunk, chunks are never moved once allocated so pointers stay valid
+	static const uint32_t ChunkSize      = 256;
+	static const uint32_t MaxChunks      = (1u << IndexBits) / ChunkSize;
+
+	/*
+	 * Constructs a new object in the pool, with a reference count of 1
+	 * @param args The arguments to pass to T's constructor
+	 * @returns The handle to the new object, which the caller must Release
+	 */
+	template <typename... Args>
+	static uint32_t Create(Args&&... args) {
+		Storage& storage = __Storage();
+		uint32_t index = __AllocateSlot(storage);
+		Slot& slot = __GetSlot(storage, index);
+		try {
+			new (slot.Data) T(std::forward<Args>(args)...);
+		} catch (...) {
+			__FreeSlot(storage, index);
+			throw;
+		}
+		slot.RefCount.store(1, std::memory_order_relaxed);
+		storage.AliveCount.fetch_add(1, std::memory_order_relaxed);
+		return (slot.Generation << IndexBits) | index;
+	}
+
+	/*
+	 * Gets the object that a handle refers to
+	 * @param handle The handle to resolve
+	 * @returns A pointer to the object, or nullptr if the handle is null or stale
+	 */
+	static T* Resolve(uint32_t handle) {
+		if (handle == 0)
+			return nullptr;
+		Storage& storage = __Storage();
+		uint32_t index = handle & IndexMask;
+		Slot* chunk = storage.Chunks[index / ChunkSize].load(std::memory_order_acquire);
+		if (chunk == nullptr)
+			return nullptr;
+		Slot& slot = chunk[index % ChunkSize];
+		if (slot.Generation != (handle >> IndexBits) || slot.RefCount.load(std::memory_order_relaxed) == 0)
+			return nullptr;
+		return reinterpret_cast<T*>(slot.Data);
+	}
+
+	// Adds a reference to a live handle
+	static void AddRef(uint32_t handle) {
+		if (handle != 0)
+			__GetSlot(__Storage(), handle & IndexMask).RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	// Removes a reference from a live handle, destroying the object once there are no references left
+	static void Release(uint32_t handle) {
+		if (handle == 0)
+			return;
+		Storage& storage = __Storage();
+		uint32_t index = handle & IndexMask;
+		Slot& slot = __GetSlot(storage, index);
+		if (slot.RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			reinterpret_cast<T*>(slot.Data)->~T();
+			storage.AliveCount.fetch_sub(1, std::memory_order_relaxed);
+			__FreeSlot(storage, index);
+		}
+	}
+	// Gets the number of references to a handle, or 0 if the handle is null or stale
+	static uint32_t GetRefCount(uint32_t handle) {
+		return Resolve(handle) != nullptr ? __GetSlot(__Storage(), handle & IndexMask).RefCount.load(std::memory_order_relaxed) : 0;
+	}
+
+	// Gets the number of objects that are currently alive in the pool
+	static uint32_t GetAliveCount() { return __Storage().AliveCount.load(std::memory_order_relaxed); }
+	// Gets the number of slots we have allocated
+	static uint32_t GetCapacity() { return __Storage().NumChunks * ChunkSize; }
+
+	/*
+	 * Invokes a function for every live object in the pool, in slot order
+	 * @param func A function taking the object's handle and a reference to the object
+	 */
+	template <typename Func>
+	static void ForEach(Func&& func) {
+		Storage& storage = __Storage();
+		uint32_t numChunks;
+		{
+			std::lock_guard<std::mutex> lock(storage.Lock);
+			numChunks = storage.NumChunks;
+		}
+		for (uint32_t chunkIx = 0; chunkIx < numChunks; chunkIx++) {
+			Slot* chunk = storage.Chunks[chunkIx].load(std::memory_order_acquire);
+			for (uint32_t ix = 0; ix < ChunkSize; ix++) {
+				if (chunk[ix].RefCount.load(std::memory_order_relaxed) > 0)
+					func(((uint32_t)chunk[ix].Generation << IndexBits) | (chunkIx * ChunkSize + ix), *reinterpret_cast<T*>(chunk[ix].Data));
+			}
+		}
+	}
+
+private:
+	struct Slot {
+		alignas(T) unsigned char Data[sizeof(T)];
+		std::atomic<uint32_t>    RefCount;
+		uint32_t                 Generation;
+		uint32_t                 NextFree;
+	};
+	struct Storage {
+		std::atomic<Slot*>    Chunks[MaxChunks];
+		uint32_t              NumChunks = 0;
+		uint32_t              FreeHead  = UINT32_MAX;
+		std::atomic<uint32_t> AliveCount{ 0 };
+		std::mutex            Lock;
+
+		Storage() {
+			for (uint32_t ix = 0; ix < MaxChunks; ix++)
+				Chunks[ix].store(nullptr, std::memory_order_relaxed);
+		}
+		// We leak the slots on purpose, since objects may still be released by other static destructors
+	};
+
+	static Storage& __Storage() {
+		// Function level static so pools are ready no matter when the first resource is created
+		static Storage* storage = new Storage();
+		return *storage;
+	}
+	static Slot& __GetSlot(Storage& storage, uint32_t index) {
+		return storage.Chunks[index / ChunkSize].load(std::memory_order_acquire)[index % ChunkSize];
+	}
+
+	static uint32_t __AllocateSlot(Storage& storage) {
+		std::lock_guard<std::mutex> lock(storage.Lock);
+		if (storage.FreeHead == UINT32_MAX) {
+			if (storage.NumChunks == MaxChunks)
+				throw std::runtime_error("Resource pool is full!");
+			Slot* chunk = new Slot[ChunkSize];
+			uint32_t base = storage.NumChunks * ChunkSize;
+			for (uint32_t ix = 0; ix < ChunkSize; ix++) {
+				chunk[ix].RefCount.store(0, std::memory_order_relaxed);
+				// Generations start at 1, so that a handle of 0 is never valid
+				chunk[ix].Generation = 1;
+				chunk[ix].NextFree = ix + 1 < ChunkSize ? base + ix + 1 : UINT32_MAX;
+			}
+			storage.Chunks[storage.NumChunks].store(chunk, std::memory_order_release);
+			storage.NumChunks++;
+			storage.FreeHead = base;
+		}
+		uint32_t index = storage.FreeHead;
+		storage.FreeHead = __GetSlot(storage, index).NextFree;
+		return index;
+	}
+	static void __FreeSlot(Storage& storage, uint32_t index) {
+		std::lock_guard<std::mutex> lock(storage.Lock);
+		Slot& slot = __GetSlot(storage, index);
+		slot.Generation = (slot.Generation % GenerationMask) + 1;
+		slot.NextFree = storage.FreeHead;
+		storage.FreeHead = index;
+	}
+};
+
+/*
+ * The deleter for Sptrs that point into a ResourcePool, this just drops the Sptr's reference on the slot.
+ * It also lets us recover the handle from an Sptr with std::get_deleter
+ */
+template <typename T>
+struct ResourceDeleter {
+	uint32_t Handle;
+	void operator()(T*) const { ResourcePool<T>::Release(Handle); }
+};
+
+/*
+ * A strong, 32 bit reference to an object in a ResourcePool. Copying a handle adds a reference to the
+ * object, and the object is destroyed once the last handle to it goes away. Handles can be made from a
+ * pooled Sptr (ex: from T::Create) and turned back into one, so code that still uses Sptrs keeps working
+ */
+template <typename T>
+class ResourceHandle {
+public:
+	typedef std::shared_ptr<T> Sptr;
+
+	ResourceHandle() : myValue(0) { }
+	ResourceHandle(std::nullptr_t) : myValue(0) { }
+	ResourceHandle(const ResourceHandle& other) : myValue(other.myValue) { ResourcePool<T>::AddRef(myValue); }
+	ResourceHandle(ResourceHandle&& other) noexcept : myValue(other.myValue) { other.myValue = 0; }
+	/*
+	 * Gets the handle for a pooled Sptr, the Sptr must have come from T::Create or ToShared
+	 * @param ptr The Sptr to get the handle for
+	 */
+	template <typename U>
+	ResourceHandle(const std::shared_ptr<U>& ptr) : myValue(0) {
+		if (ptr == nullptr)
+			return;
+		const ResourceDeleter<T>* deleter = std::get_deleter<ResourceDeleter<T>>(ptr);
+		if (deleter == nullptr)
+			throw std::runtime_error("Cannot make a handle from an Sptr that was not created in a resource pool!");
+		myValue = deleter->Handle;
+		ResourcePool<T>::AddRef(myValue);
+	}
+	~ResourceHandle() { ResourcePool<T>::Release(myValue); }
+
+	ResourceHandle& operator =(const ResourceHandle& other) {
+		ResourcePool<T>::AddRef(other.myValue);
+		ResourcePool<T>::Release(myValue);
+		myValue = other.myValue;
+		return *this;
+	}
+	ResourceHandle& operator =(ResourceHandle&& other) noexcept {
+		if (this != &other) {
+			ResourcePool<T>::Release(myValue);
+			myValue = other.myValue;
+			other.myValue = 0;
+		}
+		return *this;
+	}
+
+	/*
+	 * Creates a new object in T's pool
+	 * @param args The arguments to pass to T's constructor
+	 */
+	template <typename... Args>
+	static ResourceHandle Create(Args&&... args) {
+		ResourceHandle result;
+		result.myValue = ResourcePool<T>::Create(std::forward<Args>(args)...);
+		return result;
+	}
+
+	// Gets the object this handle refers to, or nullptr if the handle is null
+	T* Get() const { return ResourcePool<T>::Resolve(myValue); }
+	T* operator ->() const { return Get(); }
+	T& operator *() const { return *Get(); }
+	explicit operator bool() const { return Get() != nullptr; }
+
+	/*
+	 * Makes an Sptr that shares ownership of this object with the pool, for code that still works with Sptrs
+	 * The control block is allocated from a BlockPool
+	 */
+	Sptr ToShared() const {
+		T* object = Get();
+		if (object == nullptr)
+			return nullptr;
+		ResourcePool<T>::AddRef(myValue);
+		return Sptr(object, ResourceDeleter<T>{ myValue }, BlockPoolAllocator<T>());
+	}
+
+	// Gets the raw 32 bit value of this handle, this does not hold a reference!
+	uint32_t GetValue() const { return myValue; }
+
+	bool operator ==(const ResourceHandle& other) const { return myValue == other.myValue; }
+	bool operator !=(const ResourceHandle& other) const { return myValue != other.myValue; }
+	bool operator ==(std::nullptr_t) const { return Get() == nullptr; }
+	bool operator !=(std::nullptr_t) const { return Get() != nullptr; }
+	// Handles order by slot index, so sorting by handle keeps us walking the pool front to back
+	bool operator <(const ResourceHandle& other) const { return (myValue & ResourcePool<T>::IndexMask) < (other.myValue & ResourcePool<T>::IndexMask); }
+
+private:
+	uint32_t myValue;
+};
+
+/*
+ * Creates a new object in T's pool and wraps it in an Sptr, this is what T::Create uses for GraphicsClass types
+ * @param args The arguments to pass to T's constructor
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> CreatePooled(Args&&... args) {
+	return ResourceHandle<T>::Create(std::forward<Args>(args)...).ToShared();
+}
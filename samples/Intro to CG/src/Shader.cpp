@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <fstream>
 #include <filesystem>
+#include <string>
 
 // Reads the entire contents of a file
 char* readFile(const char* filename) {
@@ -40,6 +41,52 @@ char* readFile(const char* filename) {
 	}
 }
 
+/*
+ * Reads a shader file, replacing any #include "file" lines with the contents of that file (relative to the
+ * file that includes it). GLSL has no includes of it's own, this lets shaders share code like shadows.glsl
+ * @param filename The path of the shader to read
+ * @param depth    How many files deep we are, so that a file including itself doesn't recurse forever
+ */
+std::string readShaderFile(const std::string& filename, int depth = 0) {
+	if (depth > 16)
+		throw std::runtime_error("Shader includes are nested too deep, is a file including itself?");
+
+	char* contents = readFile(filename.c_str());
+	std::string source = contents;
+	delete[] contents;
+
+	std::string result;
+	result.reserve(source.size());
+	std::filesystem::path directory = std::filesystem::path(filename).parent_path();
+	size_t lineStart = 0;
+	int lineNumber = 1;
+	while (lineStart < source.size()) {
+		size_t lineEnd = source.find('\n', lineStart);
+		if (lineEnd == std::string::npos)
+			lineEnd = source.size();
+		std::string line = source.substr(lineStart, lineEnd - lineStart);
+
+		size_t first = line.find_first_not_of(" \t");
+		if (first != std::string::npos && line.compare(first, 8, "#include") == 0) {
+			size_t open = line.find('"', first);
+			size_t close = open != std::string::npos ? line.find('"', open + 1) : std::string::npos;
+			if (close == std::string::npos)
+				throw std::runtime_error("Malformed #include in " + filename + " on line " + std::to_string(lineNumber));
+			std::string included = (directory / line.substr(open + 1, close - open - 1)).string();
+			// The #line directives keep the compiler's line numbers pointing at the right place in each file
+			result += "#line 1\n";
+			result += readShaderFile(included, depth + 1);
+			result += "\n#line " + std::to_string(lineNumber + 1) + "\n";
+		} else {
+			result += line;
+			result += '\n';
+		}
+		lineStart = lineEnd + 1;
+		lineNumber++;
+	}
+	return result;
+}
+
 
 Shader::Shader() {
 	myRenderhandle = glCreateProgram();
@@ -69,6 +116,32 @@ void Shader::Compile(const char* vs_source, const char* vsName, const char* fs_s
 	glDetachShader(myRenderhandle, fs);
 	glDeleteShader(fs);
 
+	__CheckLinkStatus();
+}
+
+void Shader::CompileCompute(const char* cs_source, const char* csName) {
+	GLuint cs = __CompileShaderPart(cs_source, GL_COMPUTE_SHADER);
+	glObjectLabel(GL_SHADER, cs, -1, csName);
+
+	glAttachShader(myRenderhandle, cs);
+	glLinkProgram(myRenderhandle);
+	glDetachShader(myRenderhandle, cs);
+	glDeleteShader(cs);
+
+	__CheckLinkStatus();
+}
+
+void Shader::LoadCompute(const char* csFile) {
+	std::string cs_source = readShaderFile(csFile);
+	CompileCompute(cs_source.c_str(), csFile);
+	SetDebugName(std::filesystem::path(csFile).filename().string());
+}
+
+void Shader::Dispatch(uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ) {
+	glDispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
+}
+
+void Shader::__CheckLinkStatus() {
 	// Get whether the link was successful
 	GLint success = 0;
 	glGetProgramiv(myRenderhandle, GL_LINK_STATUS, &success);
@@ -104,17 +177,13 @@ void Shader::Compile(const char* vs_source, const char* vsName, const char* fs_s
 void Shader::Load(const char* vsFile, const char* fsFile)
 {
 	// Load in our shaders
-	char* vs_source = readFile(vsFile);
-	char* fs_source = readFile(fsFile);
+	std::string vs_source = readShaderFile(vsFile);
+	std::string fs_source = readShaderFile(fsFile);
 
 	// Compile our program
-	Compile(vs_source, vsFile, fs_source, fsFile);
+	Compile(vs_source.c_str(), vsFile, fs_source.c_str(), fsFile);
 
 	SetDebugName(std::filesystem::path(vsFile).filename().string() + " | " + std::filesystem::path(fsFile).filename().string());
-
-	// Clean up our memory
-	delete[] fs_source;
-	delete[] vs_source;
 }
 
 void Shader::SetUniform(const char* name, const glm::mat4& value) {
@@ -17,9 +17,16 @@ public:
 	void Compile(const char* vs_source, const char* vsName, const char* fs_source, const char* fsName);
 
 	// Loads a shader program from 2 files. vsFile is the path to the vertex shader, and fsFile is
-	// the path to the fragment shader
+	// the path to the fragment shader. Either can #include "file" to pull in shared code (ex: shadows.glsl)
 	void Load(const char* vsFile, const char* fsFile);
 
+	// Compiles this program as a compute shader, csName is used to label the shader for debugging
+	void CompileCompute(const char* cs_source, const char* csName);
+	// Loads a compute shader program from a file
+	void LoadCompute(const char* csFile);
+	// Dispatches this compute shader with the given number of work groups, the program must be bound first
+	void Dispatch(uint32_t numGroupsX, uint32_t numGroupsY = 1, uint32_t numGroupsZ = 1);
+
 	void SetUniform(const char* name, const glm::mat4& value);
 	void SetUniform(const char* name, const glm::vec4& value);
 	
@@ -35,5 +42,7 @@ public:
 
 private:
 	GLuint __CompileShaderPart(const char* source, GLenum type);
+	// Checks that our program linked, logs and throws if it didn't
+	void __CheckLinkStatus();
 };
 
@@ -0,0 +1,290 @@
+#include "ShadowMapping.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <GLM/gtc/matrix_transform.hpp>
+#include "imgui.h"
+
+GLuint       ShadowMapping::myShadowMap      = 0;
+GLuint       ShadowMapping::myFramebuffer    = 0;
+GLuint       ShadowMapping::myParamsBuffer   = 0;
+Shader::Sptr ShadowMapping::myDepthShader    = nullptr;
+ShadowMapping::Cascade ShadowMapping::myCascades[ShadowMapping::CascadeCount];
+uint64_t     ShadowMapping::myFrame          = 0;
+int          ShadowMapping::myResolution     = ShadowMapping::DefaultResolution;
+float        ShadowMapping::myShadowDistance = 60.0f;
+float        ShadowMapping::mySplitLambda    = 0.75f;
+float        ShadowMapping::myDepthBias      = 2.0f;
+float        ShadowMapping::mySlopeBias      = 2.0f;
+float        ShadowMapping::myNormalOffset   = 1.5f;
+int          ShadowMapping::myPcfRadius      = 1;
+bool         ShadowMapping::myCachingEnabled = true;
+
+// Hashes a block of memory into a running FNV-1a hash
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	for (size_t ix = 0; ix < size; ix++) {
+		hash ^= bytes[ix];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+void ShadowMapping::Init() {
+	LOG_ASSERT(myFramebuffer == 0, "Shadow mapping has already been initialized!");
+
+	glCreateFramebuffers(1, &myFramebuffer);
+	// We only ever write depth
+	glNamedFramebufferDrawBuffer(myFramebuffer, GL_NONE);
+	glNamedFramebufferReadBuffer(myFramebuffer, GL_NONE);
+	glObjectLabel(GL_FRAMEBUFFER, myFramebuffer, -1, "Shadow Cascades");
+
+	glCreateBuffers(1, &myParamsBuffer);
+	glNamedBufferStorage(myParamsBuffer, sizeof(Params), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glObjectLabel(GL_BUFFER, myParamsBuffer, -1, "Shadow Params");
+
+	myDepthShader = Shader::Create();
+	myDepthShader->Load("shaders/depth-only.vs.glsl", "shaders/depth-only.fs.glsl");
+
+	__CreateShadowMap();
+}
+
+void ShadowMapping::Shutdown() {
+	glDeleteTextures(1, &myShadowMap);
+	glDeleteFramebuffers(1, &myFramebuffer);
+	glDeleteBuffers(1, &myParamsBuffer);
+	myShadowMap = myFramebuffer = myParamsBuffer = 0;
+	myDepthShader = nullptr;
+}
+
+void ShadowMapping::Invalidate() {
+	for (Cascade& cascade : myCascades)
+		cascade.Valid = false;
+}
+
+void ShadowMapping::Render(const DirectionalLight* light, const Camera& camera, const ShadowCaster* casters, size_t count) {
+	if (myFramebuffer == 0)
+		return;
+	myFrame++;
+
+	Params params = Params();
+	if (light == nullptr) {
+		// Shaders check the light's w to see if there is a light at all
+		params.LightDirection = glm::vec4(0.0f);
+		glNamedBufferSubData(myParamsBuffer, 0, sizeof(Params), &params);
+		glBindBufferBase(GL_UNIFORM_BUFFER, ParamsBinding, myParamsBuffer);
+		return;
+	}
+
+	glm::vec3 lightDir = glm::normalize(light->Direction);
+	params.LightDirection = glm::vec4(lightDir, 1.0f);
+	params.LightColor     = glm::vec4(light->Color, light->Intensity);
+	const glm::mat4& view = camera.GetView();
+	params.ViewZ          = glm::vec4(view[0][2], view[1][2], view[2][2], view[3][2]);
+	params.Options        = glm::vec4(1.0f / myResolution, myNormalOffset, (float)CascadeCount, (float)myPcfRadius);
+
+	// Pull the near and far planes back out of the projection, like ClusteredLighting does
+	const glm::mat4& projection = camera.Projection;
+	float nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+	float farPlane  = projection[3][2] / (projection[2][2] + 1.0f);
+	float splits[CascadeCount];
+	__ComputeSplits(nearPlane, std::min(farPlane, myShadowDistance), splits);
+
+	// Goes from clip space to texture coordinates and depth
+	const glm::mat4 bias = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f)) * glm::scale(glm::mat4(1.0f), glm::vec3(0.5f));
+
+	bool bound = false;
+	for (int ix = 0; ix < CascadeCount; ix++) {
+		Cascade& cascade = myCascades[ix];
+		float splitNear = ix == 0 ? nearPlane : splits[ix - 1];
+		float texelSize = 0.0f;
+		glm::mat4 viewProjection = light->CastShadows ?
+			__FitCascade(camera, lightDir, nearPlane, farPlane, splitNear, splits[ix], texelSize) : glm::mat4(1.0f);
+
+		params.ShadowMatrices[ix]    = bias * viewProjection;
+		params.CascadeSplits[ix]     = splits[ix];
+		params.CascadeTexelSizes[ix] = texelSize;
+		cascade.FarDepth             = splits[ix];
+		cascade.TexelSize            = texelSize;
+
+		// Work out which casters touch the cascade. Since we clamp depth while drawing, casters between the
+		// light and the cascade still land in the shadow map, so we only cull along the sides and the far end
+		uint64_t hash = 14695981039346656037ull;
+		uint32_t casterCount = 0;
+		// Our projection is orthographic and scales all 3 axes by 1 over the cascade's radius, so a caster's radius
+		// scales the same way
+		float clipScale = texelSize > 0.0f ? 2.0f / (texelSize * myResolution) : 0.0f;
+		auto touchesCascade = [&](const ShadowCaster& caster) {
+			glm::vec4 center = viewProjection * glm::vec4(glm::vec3(caster.Bounds), 1.0f);
+			float reach = 1.0f + caster.Bounds.w * clipScale;
+			return std::abs(center.x) <= reach && std::abs(center.y) <= reach && center.z <= reach;
+		};
+		if (light->CastShadows) {
+			for (size_t casterIx = 0; casterIx < count; casterIx++) {
+				if (!touchesCascade(casters[casterIx]))
+					continue;
+				hash = HashBytes(hash, &casters[casterIx].Mesh, sizeof(Mesh*));
+				hash = HashBytes(hash, &casters[casterIx].World, sizeof(glm::mat4));
+				casterCount++;
+			}
+		}
+
+		// If the cascade hasn't moved and nothing in it has changed, last frame's shadows are still good
+		if (myCachingEnabled && cascade.Valid && cascade.ViewProjection == viewProjection && cascade.ContentHash == hash)
+			continue;
+
+		cascade.ViewProjection = viewProjection;
+		cascade.ContentHash    = hash;
+		cascade.CasterCount    = casterCount;
+		cascade.LastDrawn      = myFrame;
+		cascade.Valid          = true;
+
+		if (!bound) {
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, myFramebuffer);
+			glViewport(0, 0, myResolution, myResolution);
+			glEnable(GL_DEPTH_CLAMP);
+			glEnable(GL_POLYGON_OFFSET_FILL);
+			glPolygonOffset(mySlopeBias, myDepthBias);
+			glDisable(GL_CULL_FACE);
+			glDisable(GL_BLEND);
+			glDepthMask(GL_TRUE);
+			myDepthShader->Bind();
+			bound = true;
+		}
+
+		glNamedFramebufferTextureLayer(myFramebuffer, GL_DEPTH_ATTACHMENT, myShadowMap, 0, ix);
+		float clearDepth = 1.0f;
+		glClearNamedFramebufferfv(myFramebuffer, GL_DEPTH, 0, &clearDepth);
+		if (!light->CastShadows)
+			continue;
+		for (size_t casterIx = 0; casterIx < count; casterIx++) {
+			if (!touchesCascade(casters[casterIx]))
+				continue;
+			myDepthShader->SetUniform("a_ModelViewProjection", viewProjection * casters[casterIx].World);
+			casters[casterIx].Mesh->Draw();
+		}
+	}
+
+	if (bound) {
+		glDisable(GL_DEPTH_CLAMP);
+		glDisable(GL_POLYGON_OFFSET_FILL);
+		glEnable(GL_CULL_FACE);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+	}
+
+	glNamedBufferSubData(myParamsBuffer, 0, sizeof(Params), &params);
+	glBindBufferBase(GL_UNIFORM_BUFFER, ParamsBinding, myParamsBuffer);
+	glBindTextureUnit(TextureUnit, myShadowMap);
+	// A sampler object would override our comparison mode
+	glBindSampler(TextureUnit, 0);
+}
+
+void ShadowMapping::DrawInspector() {
+	static const int resolutions[] = { 512, 1024, 2048, 4096 };
+	static const char* resolutionNames[] = { "512", "1024", "2048", "4096" };
+	int current = (int)(std::find(resolutions, resolutions + 4, myResolution) - resolutions);
+	if (ImGui::Combo("Resolution", &current, resolutionNames, 4) && resolutions[current] != myResolution) {
+		myResolution = resolutions[current];
+		__CreateShadowMap();
+	}
+
+	bool changed = false;
+	changed |= ImGui::DragFloat("Shadow Distance", &myShadowDistance, 0.5f, 5.0f, 500.0f);
+	changed |= ImGui::SliderFloat("Split Lambda", &mySplitLambda, 0.0f, 1.0f);
+	changed |= ImGui::DragFloat("Depth Bias", &myDepthBias, 0.1f, 0.0f, 32.0f);
+	changed |= ImGui::DragFloat("Slope Bias", &mySlopeBias, 0.1f, 0.0f, 32.0f);
+	ImGui::DragFloat("Normal Offset (texels)", &myNormalOffset, 0.05f, 0.0f, 8.0f);
+	ImGui::SliderInt("PCF Radius", &myPcfRadius, 0, 3);
+	changed |= ImGui::Checkbox("Cache Cascades", &myCachingEnabled);
+	if (changed)
+		Invalidate();
+
+	ImGui::Columns(4);
+	ImGui::Text("Cascade");    ImGui::NextColumn();
+	ImGui::Text("Far Depth");  ImGui::NextColumn();
+	ImGui::Text("Casters");    ImGui::NextColumn();
+	ImGui::Text("Last Drawn"); ImGui::NextColumn();
+	ImGui::Separator();
+	for (int ix = 0; ix < CascadeCount; ix++) {
+		const Cascade& cascade = myCascades[ix];
+		ImGui::Text("%d", ix);                                         ImGui::NextColumn();
+		ImGui::Text("%.1f", cascade.FarDepth);                         ImGui::NextColumn();
+		ImGui::Text("%u", cascade.CasterCount);                        ImGui::NextColumn();
+		ImGui::Text("%llu frames ago", (unsigned long long)(myFrame - cascade.LastDrawn)); ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+void ShadowMapping::__CreateShadowMap() {
+	if (myShadowMap != 0)
+		glDeleteTextures(1, &myShadowMap);
+
+	glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &myShadowMap);
+	glTextureStorage3D(myShadowMap, 1, GL_DEPTH_COMPONENT32F, myResolution, myResolution, CascadeCount);
+	// Linear filtering with comparison gives us a 2x2 PCF for free on every tap
+	glTextureParameteri(myShadowMap, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTextureParameteri(myShadowMap, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTextureParameteri(myShadowMap, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTextureParameteri(myShadowMap, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	// Anything outside of a cascade is lit
+	glTextureParameteri(myShadowMap, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+	glTextureParameteri(myShadowMap, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+	float border[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	glTextureParameterfv(myShadowMap, GL_TEXTURE_BORDER_COLOR, border);
+	glObjectLabel(GL_TEXTURE, myShadowMap, -1, "Shadow Map");
+
+	Invalidate();
+}
+
+void ShadowMapping::__ComputeSplits(float nearPlane, float farPlane, float* splits) {
+	// The "practical" split scheme, a blend between logarithmic splits (which match how perspective spreads
+	// texels out) and even splits (which stop the first cascade from being tiny)
+	for (int ix = 0; ix < CascadeCount; ix++) {
+		float t = (ix + 1) / (float)CascadeCount;
+		float logSplit     = nearPlane * std::pow(farPlane / nearPlane, t);
+		float uniformSplit = nearPlane + (farPlane - nearPlane) * t;
+		splits[ix] = mySplitLambda * logSplit + (1.0f - mySplitLambda) * uniformSplit;
+	}
+}
+
+glm::mat4 ShadowMapping::__FitCascade(const Camera& camera, const glm::vec3& lightDir, float nearPlane, float farPlane, float splitNear, float splitFar, float& texelSize) {
+	// Find the corners of our slice of the view. Each corner lies on a ray from the camera, and depth is linear
+	// along those rays, so we can just interpolate between the near and far planes
+	glm::mat4 inverseViewProjection = glm::inverse(camera.GetViewProjection());
+	float tNear = (splitNear - nearPlane) / (farPlane - nearPlane);
+	float tFar  = (splitFar - nearPlane) / (farPlane - nearPlane);
+	glm::vec3 center = glm::vec3(0.0f);
+	glm::vec3 corners[8];
+	for (int ix = 0; ix < 4; ix++) {
+		glm::vec2 ndc = glm::vec2((ix & 1) ? 1.0f : -1.0f, (ix & 2) ? 1.0f : -1.0f);
+		glm::vec4 nearCorner = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+		glm::vec4 farCorner  = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+		glm::vec3 from = glm::vec3(nearCorner) / nearCorner.w;
+		glm::vec3 to   = glm::vec3(farCorner) / farCorner.w;
+		corners[ix]     = glm::mix(from, to, tNear);
+		corners[ix + 4] = glm::mix(from, to, tFar);
+		center += corners[ix] + corners[ix + 4];
+	}
+	center /= 8.0f;
+
+	// A sphere doesn't change size when the camera turns, so neither does the cascade. Rounding the radius up
+	// keeps floating point noise from changing it either
+	float radius = 0.0f;
+	for (const glm::vec3& corner : corners)
+		radius = std::max(radius, glm::length(corner - center));
+	radius = std::ceil(radius * 16.0f) / 16.0f;
+	texelSize = 2.0f * radius / myResolution;
+
+	// Snap the center to whole texels in light space, so that the shadow map only ever moves in texel steps
+	// (this is what stops the shadow edges from shimmering as the camera moves)
+	glm::vec3 up = std::abs(lightDir.z) > 0.99f ? glm::vec3(0, 1, 0) : glm::vec3(0, 0, 1);
+	glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), lightDir, up);
+	glm::vec3 lightCenter = glm::vec3(lightRotation * glm::vec4(center, 1.0f));
+	lightCenter = glm::floor(lightCenter / texelSize) * texelSize;
+
+	// The light sits one radius behind the center, looking down -z
+	glm::mat4 lightView = glm::translate(glm::mat4(1.0f), -(lightCenter + glm::vec3(0.0f, 0.0f, radius))) * lightRotation;
+	glm::mat4 lightProjection = glm::ortho(-radius, radius, -radius, radius, 0.0f, 2.0f * radius);
+	return lightProjection * lightView;
+}
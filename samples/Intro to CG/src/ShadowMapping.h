@@ -0,0 +1,112 @@
+#pragma once
+#include <glad/glad.h>
+#include <GLM/glm.hpp>
+
+#include "Camera.h"
+#include "Mesh.h"
+#include "Shader.h"
+#include "DirectionalLight.h"
+
+/*
+ * Cascaded shadow maps for a directional light. The camera's view is split into a few ranges by depth, and
+ * each range gets it's own shadow map fitted around it, so that nearby shadows get more resolution than
+ * far away ones. All the cascades live in one depth array texture
+ *
+ * Cascades are fit around a bounding sphere of their part of the view, and snapped to whole shadow map
+ * texels, so their edges don't crawl when the camera moves or turns. Each cascade remembers the casters it
+ * drew last time, and is only re-drawn when it moves or something in it changes
+ *
+ * Shaders get the light and the cascades from shadows.glsl (see blinn-phong-clustered.fs.glsl)
+ */
+class ShadowMapping {
+public:
+	static const int    CascadeCount      = 4;
+	static const int    DefaultResolution = 2048;
+	// The uniform block binding and texture unit that shaders find us at, these must match shadows.glsl
+	static const GLuint ParamsBinding     = 5;
+	static const GLuint TextureUnit       = 8;
+
+	// Something that can cast a shadow
+	struct ShadowCaster {
+		Mesh*     Mesh;
+		glm::mat4 World;
+		// xyz is the world space center of the caster's bounds, w is the radius
+		glm::vec4 Bounds;
+	};
+
+	// Creates our shadow map and loads our shader, must be called once the GL context exists
+	static void Init();
+	// Deletes our shadow map and shader
+	static void Shutdown();
+
+	/*
+	 * Updates any cascades that need it, and binds the shadow map and light for the shaders that come after.
+	 * This changes the bound framebuffer and viewport, so they need to be restored afterwards
+	 * @param light   The light to draw shadows for, or nullptr to turn the light off
+	 * @param camera  The camera that we are rendering from
+	 * @param casters The things that can cast shadows
+	 * @param count   The number of casters
+	 */
+	static void Render(const DirectionalLight* light, const Camera& camera, const ShadowCaster* casters, size_t count);
+
+	// Forces all the cascades to be re-drawn next frame
+	static void Invalidate();
+
+	// Draws an ImGui panel with our settings and stats
+	static void DrawInspector();
+
+private:
+	struct Cascade {
+		// Takes world space positions into the cascade's clip space
+		glm::mat4 ViewProjection;
+		// The furthest view space depth that the cascade covers
+		float     FarDepth;
+		// The size of one shadow map texel, in world units
+		float     TexelSize;
+		// What was drawn into the cascade last time, if this and our matrix don't change we can skip it
+		uint64_t  ContentHash;
+		bool      Valid;
+		// How many casters were drawn into the cascade the last time it was drawn
+		uint32_t  CasterCount;
+		// The frame this cascade was last drawn on
+		uint64_t  LastDrawn;
+	};
+
+	// The layout of our uniform block, in std140
+	struct Params {
+		// Takes world space positions into each cascade's shadow map, as texture coordinates and depth
+		glm::mat4 ShadowMatrices[CascadeCount];
+		glm::vec4 CascadeSplits;
+		glm::vec4 CascadeTexelSizes;
+		// The row of the camera's view matrix that gives us view space z
+		glm::vec4 ViewZ;
+		glm::vec4 LightDirection;
+		glm::vec4 LightColor;
+		// x is 1 over the shadow map size, y is the normal offset in texels, z is the number of cascades, w is the PCF radius
+		glm::vec4 Options;
+	};
+
+	static GLuint       myShadowMap;
+	static GLuint       myFramebuffer;
+	static GLuint       myParamsBuffer;
+	static Shader::Sptr myDepthShader;
+	static Cascade      myCascades[CascadeCount];
+	static uint64_t     myFrame;
+
+	static int          myResolution;
+	static float        myShadowDistance;
+	// How much we favor logarithmic splits over even ones, between 0 and 1
+	static float        mySplitLambda;
+	static float        myDepthBias;
+	static float        mySlopeBias;
+	static float        myNormalOffset;
+	static int          myPcfRadius;
+	static bool         myCachingEnabled;
+
+	// (Re-)creates the shadow map at our current resolution
+	static void __CreateShadowMap();
+	// Works out the view space depth where each cascade ends
+	static void __ComputeSplits(float nearPlane, float farPlane, float* splits);
+	// Fits a cascade around the part of the camera's view between two depths
+	static glm::mat4 __FitCascade(const Camera& camera, const glm::vec3& lightDir, float nearPlane, float farPlane, float splitNear, float splitFar, float& texelSize);
+};
@@ -1,13 +1,30 @@
 #include "Texture2D.h"
 #include "Logging.h"
+#include "TextureContainer.h"
+#include "PixelUploadRing.h"
 #include <stb_image.h>
 #include <filesystem>
+#include <algorithm>
 #include <GLM/gtc/type_ptr.hpp>
+#include <GLFW/glfw3.h>
+
+// ARB_sparse_texture only has a bind-to-edit version of this, so we have to bind the texture to commit it's pages
+typedef void (APIENTRYP PFNGLTEXPAGECOMMITMENTARBPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit);
+
+// Loads glTexPageCommitmentARB the first time we need it, returns nullptr if the extension is not supported
+static PFNGLTEXPAGECOMMITMENTARBPROC GetTexPageCommitment() {
+	static PFNGLTEXPAGECOMMITMENTARBPROC result = glfwExtensionSupported("GL_ARB_sparse_texture") ?
+		(PFNGLTEXPAGECOMMITMENTARBPROC)glfwGetProcAddress("glTexPageCommitmentARB") : nullptr;
+	return result;
+}
 
 Texture2D::Texture2D(const Texture2DDescription& desc) {
 	myDescription = desc;
 	
 	myRenderhandle = 0;
+	myBaseLevel = 0;
+	myCommittedLevels = 0;
+	mySparseLevels = 0;
 	__SetupTexture();
 }
 
@@ -17,7 +34,26 @@ Texture2D::~Texture2D() {
 
 void Texture2D::__SetupTexture() {
 	glCreateTextures(GL_TEXTURE_2D, 1, &myRenderhandle);
+
+	if (myDescription.Sparse && !SupportsSparse(myDescription.Format)) {
+		LOG_WARN("Sparse textures are not supported for {}, falling back to a regular texture", ~myDescription.Format);
+		myDescription.Sparse = false;
+	}
+	// Sparse textures need to be flagged before their storage is allocated
+	if (myDescription.Sparse) {
+		glTextureParameteri(myRenderhandle, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+		glTextureParameteri(myRenderhandle, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+	}
+	// Small textures can't have as many levels as we may have asked for
+	if (myDescription.EnableMip) {
+		int maxLevels = 1;
+		for (uint32_t size = std::max(myDescription.Width, myDescription.Height); size > 1; size /= 2)
+			maxLevels++;
+		myDescription.MipLevels = std::min(myDescription.MipLevels, maxLevels);
+	}
 	glTextureStorage2D(myRenderhandle, myDescription.EnableMip ? myDescription.MipLevels : 1, (GLenum)myDescription.Format, myDescription.Width, myDescription.Height);
+	if (myDescription.Sparse)
+		glGetTextureParameteriv(myRenderhandle, GL_NUM_SPARSE_LEVELS_ARB, &mySparseLevels);
 
 	glTextureParameteri(myRenderhandle, GL_TEXTURE_WRAP_S,     (GLenum)myDescription.Sampler.WrapS);
 	glTextureParameteri(myRenderhandle, GL_TEXTURE_WRAP_T,     (GLenum)myDescription.Sampler.WrapT);
@@ -30,19 +66,199 @@ void Texture2D::__SetupTexture() {
 		glTextureParameterf(myRenderhandle, GL_TEXTURE_MAX_ANISOTROPY, myDescription.Sampler.MaxAnisotropy);
 }
 
+bool IsCompressedFormat(InternalFormat format) {
+	switch (format) {
+		case InternalFormat::BC1:
+		case InternalFormat::BC1_SRGB:
+		case InternalFormat::BC3:
+		case InternalFormat::BC3_SRGB:
+		case InternalFormat::BC4:
+		case InternalFormat::BC5:
+		case InternalFormat::BC7:
+		case InternalFormat::BC7_SRGB:
+			return true;
+		default:
+			return false;
+	}
+}
+
+size_t GetCompressedBlockSize(InternalFormat format) {
+	switch (format) {
+		// BC1 and BC4 pack a 4x4 block into 64 bits, the rest use 128
+		case InternalFormat::BC1:
+		case InternalFormat::BC1_SRGB:
+		case InternalFormat::BC4:
+			return 8;
+		default:
+			return 16;
+	}
+}
+
+size_t GetTextureMemorySize(InternalFormat format, uint32_t width, uint32_t height, int mipLevels, int layers) {
+	if (IsCompressedFormat(format)) {
+		size_t result = 0;
+		for (int level = 0; level < mipLevels; level++) {
+			size_t blocksX = (std::max(width >> level, 1u) + 3) / 4;
+			size_t blocksY = (std::max(height >> level, 1u) + 3) / 4;
+			result += blocksX * blocksY * GetCompressedBlockSize(format);
+		}
+		return result * layers;
+	}
+
+	size_t texelSize = 4;
+	switch (format) {
+		case InternalFormat::R8:     texelSize = 1; break;
+		case InternalFormat::R16:
+		case InternalFormat::R16F:   texelSize = 2; break;
+		// Drivers pad 3 component formats out to 4 components, so we count them as such
+		case InternalFormat::RGB8:
+		case InternalFormat::RGBA8:
+		case InternalFormat::SRGB8_A8:
+		case InternalFormat::R32F:
+		case InternalFormat::R32UI:
+		case InternalFormat::RG16F:
+		case InternalFormat::R11G11B10F:
+		case InternalFormat::Depth24:
+		case InternalFormat::Depth32F:
+		case InternalFormat::Depth24Stencil8: texelSize = 4; break;
+		case InternalFormat::RGB16:
+		case InternalFormat::RGBA16:
+		case InternalFormat::RGBA16F: texelSize = 8; break;
+		case InternalFormat::RGBA32F: texelSize = 16; break;
+		default: break;
+	}
+
+	size_t result = 0;
+	for (int level = 0; level < mipLevels; level++) {
+		result += texelSize * std::max(width >> level, 1u) * std::max(height >> level, 1u);
+	}
+	return result * layers;
+}
+
+size_t Texture2D::GetGpuSize() const {
+	int mipLevels = myDescription.EnableMip ? myDescription.MipLevels : 1;
+	if (!myDescription.Sparse)
+		return GetTextureMemorySize(myDescription.Format, myDescription.Width, myDescription.Height, mipLevels);
+
+	size_t result = 0;
+	for (int level = 0; level < mipLevels; level++) {
+		if (IsLevelCommitted(level))
+			result += GetTextureMemorySize(myDescription.Format, std::max(myDescription.Width >> level, 1u), std::max(myDescription.Height >> level, 1u));
+	}
+	return result;
+}
+
+void Texture2D::SetBaseLevel(int level) {
+	myBaseLevel = level;
+	// LODs are measured from the base level, so this is all we need (setting the min LOD too would offset it twice)
+	glTextureParameteri(myRenderhandle, GL_TEXTURE_BASE_LEVEL, level);
+}
+
+void Texture2D::SetLevelCommitted(int level, bool committed) {
+	LOG_ASSERT(myDescription.Sparse, "Only sparse textures can have their levels committed!");
+	int mipLevels = myDescription.EnableMip ? myDescription.MipLevels : 1;
+
+	// The mip tail is committed all at once, so we just commit the first level of it
+	int first = level, last = level;
+	if (level >= mySparseLevels) {
+		first = mySparseLevels;
+		last  = mipLevels - 1;
+	}
+	uint32_t mask = 0;
+	for (int ix = first; ix <= last; ix++)
+		mask |= 1u << ix;
+	if (((myCommittedLevels & mask) != 0) == committed)
+		return;
+
+	// Committing a whole level at once means we don't need to care about the page size
+	GLint previous = 0;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, myRenderhandle);
+	GetTexPageCommitment()(GL_TEXTURE_2D, first, 0, 0, 0,
+		std::max(myDescription.Width >> first, 1u), std::max(myDescription.Height >> first, 1u), 1, committed ? GL_TRUE : GL_FALSE);
+	glBindTexture(GL_TEXTURE_2D, previous);
+
+	if (committed)
+		myCommittedLevels |= mask;
+	else
+		myCommittedLevels &= ~mask;
+}
+
+bool Texture2D::SupportsSparse(InternalFormat format) {
+	if (GetTexPageCommitment() == nullptr)
+		return false;
+	GLint numPageSizes = 0;
+	glGetInternalformativ(GL_TEXTURE_2D, (GLenum)format, GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &numPageSizes);
+	return numPageSizes > 0;
+}
+
 void Texture2D::LoadData(void* data, size_t width, size_t height, PixelFormat format, PixelType type) {
-	// TODO: Re-create texture if our data is a different size
-	
-	LOG_ASSERT(width == myDescription.Width, "Width of data does not match the width of this texture!");
-	LOG_ASSERT(height == myDescription.Height, "Height of data does not match the width of this texture!");
+	LOG_ASSERT(!IsCompressedFormat(myDescription.Format), "Compressed textures must be loaded with LoadCompressedData!");
+
+	// Texture storage is immutable, so we need a new texture if the data is a different size
+	if (width != myDescription.Width || height != myDescription.Height)
+		Resize((uint32_t)width, (uint32_t)height);
 	
-	glTextureSubImage2D(myRenderhandle, 0, 0, 0, myDescription.Width, myDescription.Height, (GLenum)format, (GLenum)type, data);
+	PixelUploadRing::Global().Upload2D(myRenderhandle, 0, 0, 0, myDescription.Width, myDescription.Height, (GLenum)format, (GLenum)type, data);
 
 	if (myDescription.EnableMip)
 		glGenerateTextureMipmap(myRenderhandle);
 }
 
+void Texture2D::Resize(uint32_t width, uint32_t height) {
+	if (width == myDescription.Width && height == myDescription.Height)
+		return;
+	Texture2DDescription desc = myDescription;
+	desc.Width  = width;
+	desc.Height = height;
+	Recreate(desc);
+}
+
+void Texture2D::Recreate(const Texture2DDescription& description) {
+	glDeleteTextures(1, &myRenderhandle);
+	myDescription = description;
+	myRenderhandle = 0;
+	myBaseLevel = 0;
+	myCommittedLevels = 0;
+	mySparseLevels = 0;
+	__SetupTexture();
+	// Our label belonged to the old texture
+	if (!myDebugName.empty())
+		SetDebugName(myDebugName);
+}
+
+void Texture2D::LoadCompressedData(int level, const void* data, size_t size, uint32_t width, uint32_t height) {
+	LOG_ASSERT(IsCompressedFormat(myDescription.Format), "LoadCompressedData can only be used with compressed textures!");
+	glCompressedTextureSubImage2D(myRenderhandle, level, 0, 0, width, height, (GLenum)myDescription.Format, (GLsizei)size, data);
+}
+
 Texture2D::Sptr Texture2D::LoadFromFile(const std::string& fileName, bool loadAlpha) {
+	// Pre-compressed containers already have all their mips, so we just copy the blocks straight to the GPU
+	if (TextureContainer::IsContainerFile(fileName)) {
+		TextureContainer container;
+		if (!TextureContainer::LoadFromFile(fileName, container))
+			return nullptr;
+		if (container.Faces != 1) {
+			LOG_WARN("\"{}\" is a cubemap, use TextureCube::LoadFromFile instead", fileName);
+			return nullptr;
+		}
+
+		Texture2DDescription desc = Texture2DDescription();
+		desc.Width     = container.Width;
+		desc.Height    = container.Height;
+		desc.Format    = container.Format;
+		desc.EnableMip = container.MipLevels > 1;
+		desc.MipLevels = container.MipLevels;
+
+		Sptr result = Create(desc);
+		for (uint32_t level = 0; level < container.MipLevels; level++) {
+			const ContainerLevel& info = container.GetLevel(0, level);
+			result->LoadCompressedData(level, container.GetLevelData(0, level), info.Size, info.Width, info.Height);
+		}
+		result->SetDebugName(std::filesystem::path(fileName).filename().string());
+		return result;
+	}
+
 
 	int width, height, numChannels;
 	void* data = stbi_load(fileName.c_str(), &width, &height, &numChannels, loadAlpha ? 4 : 3);
@@ -53,7 +269,7 @@ Texture2D::Sptr Texture2D::LoadFromFile(const std::string& fileName, bool loadAl
 		desc.Height = height;
 		desc.Format = loadAlpha ? InternalFormat::RGBA8 : InternalFormat::RGB8;
 		
-		Sptr result = std::make_shared<Texture2D>(desc);
+		Sptr result = Create(desc);
 		result->LoadData(data, width, height, loadAlpha? PixelFormat::Rgba : PixelFormat::Rgb, PixelType::UByte);
 		stbi_image_free(data);
 		result->SetDebugName(std::filesystem::path(fileName).filename().string());
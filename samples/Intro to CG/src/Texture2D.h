@@ -9,6 +9,27 @@
 #include "GraphicsResource.h"
 #include "ITexture.h"
 
+// The S3TC formats are part of EXT_texture_compression_s3tc, which our GL loader doesn't pull in
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+// Same goes for ARB_sparse_texture, which we load ourselves if the driver supports it
+#ifndef GL_TEXTURE_SPARSE_ARB
+#define GL_VIRTUAL_PAGE_SIZE_X_ARB       0x9195
+#define GL_VIRTUAL_PAGE_SIZE_Y_ARB       0x9196
+#define GL_VIRTUAL_PAGE_SIZE_Z_ARB       0x9197
+#define GL_TEXTURE_SPARSE_ARB            0x91A6
+#define GL_VIRTUAL_PAGE_SIZE_INDEX_ARB   0x91A7
+#define GL_NUM_VIRTUAL_PAGE_SIZES_ARB    0x91A8
+#define GL_NUM_SPARSE_LEVELS_ARB         0x91AA
+#endif
+
 // https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
 // These are some of our more common available internal formats
 ENUM(InternalFormat, GLint,
@@ -19,11 +40,46 @@ ENUM(InternalFormat, GLint,
 	RGB8         = GL_RGB8,
 	RGB16        = GL_RGB16,
 	RGBA8        = GL_RGBA8,
-	RGBA16       = GL_RGBA16
+	RGBA16       = GL_RGBA16,
+	SRGB8_A8     = GL_SRGB8_ALPHA8,
+
+	// Sized depth and floating point formats, mostly for render targets (the unsized Depth and DepthStencil can't be used with texture storage)
+	Depth24      = GL_DEPTH_COMPONENT24,
+	Depth32F     = GL_DEPTH_COMPONENT32F,
+	Depth24Stencil8 = GL_DEPTH24_STENCIL8,
+	R16F         = GL_R16F,
+	R32F         = GL_R32F,
+	RG16F        = GL_RG16F,
+	RGBA16F      = GL_RGBA16F,
+	RGBA32F      = GL_RGBA32F,
+	R11G11B10F   = GL_R11F_G11F_B10F,
+	// Integer formats, these can only be read and written as images or with texelFetch
+	R32UI        = GL_R32UI,
+
+	// Block compressed formats, these can only be loaded from pre-compressed data (see TextureContainer.h)
+	BC1          = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+	BC1_SRGB     = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,
+	BC3          = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+	BC3_SRGB     = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,
+	BC4          = GL_COMPRESSED_RED_RGTC1,
+	BC5          = GL_COMPRESSED_RG_RGTC2,
+	BC7          = GL_COMPRESSED_RGBA_BPTC_UNORM,
+	BC7_SRGB     = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
 
 	// Note: There are sized internal formats but there is a LOT of them
 );
 
+/*
+ * Gets whether a format is block compressed
+ * @param format The format to check
+ */
+bool IsCompressedFormat(InternalFormat format);
+/*
+ * Gets the number of bytes in a single 4x4 block of a compressed format
+ * @param format The format to check, must be a compressed format
+ */
+size_t GetCompressedBlockSize(InternalFormat format);
+
 // The layout of the input pixel data
 ENUM(PixelFormat, GLint,
 	Red          = GL_RED,
@@ -47,6 +103,16 @@ ENUM(PixelType, GLint,
 	Float  = GL_FLOAT
 );
 
+/*
+ * Estimates how much GPU memory a texture will use
+ * @param format    The internal format of the texture
+ * @param width     The width of the base level, in pixels
+ * @param height    The height of the base level, in pixels
+ * @param mipLevels The number of mip levels in the texture
+ * @param layers    The number of layers or faces in the texture
+ */
+size_t GetTextureMemorySize(InternalFormat format, uint32_t width, uint32_t height, int mipLevels = 1, int layers = 1);
+
 // Represents all the data required to set up our texture (but not actually load it's data)
 // This is more or less all the GPU state that we care about
 struct Texture2DDescription {
@@ -58,6 +124,14 @@ struct Texture2DDescription {
 	bool           EnableMip = true;
 	int            MipLevels = 8;
 	SamplerDesc    Sampler   = SamplerDesc();
+	// If true, the texture's levels are not backed by any memory until they are committed (see Texture2D::SetLevelCommitted)
+	bool           Sparse    = false;
+
+	bool operator ==(const Texture2DDescription& other) const {
+		return Width == other.Width && Height == other.Height && Format == other.Format && EnableMip == other.EnableMip &&
+			MipLevels == other.MipLevels && Sampler == other.Sampler && Sparse == other.Sparse;
+	}
+	bool operator !=(const Texture2DDescription& other) const { return !(*this == other); }
 };
 
 // Represents a 2D texture in OpenGL
@@ -69,12 +143,81 @@ public:
 	Texture2D(const Texture2DDescription& description);
 	virtual ~Texture2D();
 
+	/*
+	 * Loads pixel data into the base level of this texture, re-creating the texture if the data is a different size
+	 * @param data   The pixels to load
+	 * @param width  The width of the data, in pixels
+	 * @param height The height of the data, in pixels
+	 * @param format The layout of the components in the pixel data
+	 * @param type   The type of each component in the pixel data
+	 */
 	void LoadData(void* data, size_t width, size_t height, PixelFormat format, PixelType type);
+
+	/*
+	 * Re-creates this texture with a new size, the contents of the texture are lost. The GL handle changes, but
+	 * anything holding on to this texture object will keep working
+	 * @param width  The new width, in pixels
+	 * @param height The new height, in pixels
+	 */
+	void Resize(uint32_t width, uint32_t height);
+	/*
+	 * Re-creates this texture from a new description, the contents of the texture are lost
+	 * @param description The new description for the texture
+	 */
+	void Recreate(const Texture2DDescription& description);
 		
+	/*
+	 * Loads a single level of pre-compressed data into this texture, the texture must have a compressed format
+	 * @param level  The mip level to load into
+	 * @param data   The compressed blocks for the level
+	 * @param size   The size of data, in bytes
+	 * @param width  The width of the level, in pixels
+	 * @param height The height of the level, in pixels
+	 */
+	void LoadCompressedData(int level, const void* data, size_t size, uint32_t width, uint32_t height);
+
+	/*
+	 * Loads a texture from a file. DDS and KTX2 files are loaded as-is, with all of their mip levels, while
+	 * anything else is decoded with stb_image
+	 * @param fileName  The path to the file to load
+	 * @param loadAlpha True if the texture should have an alpha channel (ignored for DDS and KTX2)
+	 */
 	static Sptr LoadFromFile(const std::string& fileName, bool loadAlpha = true);
 
+	const Texture2DDescription& GetDescription() const { return myDescription; }
+	// Gets the estimated amount of GPU memory used by this texture, in bytes (only committed levels count for sparse textures)
+	size_t GetGpuSize() const;
+
+	/*
+	 * Stops the GPU from sampling any level above the given one, so that levels which haven't been loaded yet are never used
+	 * @param level The largest level that may be sampled
+	 */
+	void SetBaseLevel(int level);
+	int GetBaseLevel() const { return myBaseLevel; }
+
+	/*
+	 * Commits or releases the memory behind a single level of a sparse texture. All the levels in the mip tail
+	 * (see GetSparseLevelCount) share their memory, so committing any one of them commits all of them
+	 * @param level     The level to commit or release
+	 * @param committed True to back the level with memory, false to release it
+	 */
+	void SetLevelCommitted(int level, bool committed);
+	bool IsLevelCommitted(int level) const { return (myCommittedLevels & (1u << level)) != 0; }
+	// Gets the number of levels that can be committed one at a time, the rest make up the mip tail
+	int GetSparseLevelCount() const { return mySparseLevels; }
+
+	/*
+	 * Checks whether the driver supports sparse textures in the given format
+	 * @param format The internal format of the texture
+	 */
+	static bool SupportsSparse(InternalFormat format);
+
 protected:
 	Texture2DDescription myDescription;
+	int                  myBaseLevel;
+	// A bit for each level of a sparse texture that is backed by memory
+	uint32_t             myCommittedLevels;
+	int                  mySparseLevels;
 
 	void __SetupTexture();
 };
\ No newline at end of file
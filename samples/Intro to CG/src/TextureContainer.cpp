@@ -0,0 +1,306 @@
+#include "TextureContainer.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// Builds a DDS four character code
+constexpr uint32_t FourCC(char a, char b, char c, char d) {
+	return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+}
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3ddds/dds-pixelformat
+struct DdsPixelFormat {
+	uint32_t Size;
+	uint32_t Flags;
+	uint32_t FourCC;
+	uint32_t RGBBitCount;
+	uint32_t BitMasks[4];
+};
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3ddds/dds-header
+struct DdsHeader {
+	uint32_t       Size;
+	uint32_t       Flags;
+	uint32_t       Height;
+	uint32_t       Width;
+	uint32_t       PitchOrLinearSize;
+	uint32_t       Depth;
+	uint32_t       MipMapCount;
+	uint32_t       Reserved1[11];
+	DdsPixelFormat PixelFormat;
+	uint32_t       Caps;
+	uint32_t       Caps2;
+	uint32_t       Caps3;
+	uint32_t       Caps4;
+	uint32_t       Reserved2;
+};
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3ddds/dds-header-dxt10
+struct DdsHeaderDX10 {
+	uint32_t DxgiFormat;
+	uint32_t ResourceDimension;
+	uint32_t MiscFlag;
+	uint32_t ArraySize;
+	uint32_t MiscFlags2;
+};
+
+static_assert(sizeof(DdsHeader) == 124, "DDS header must be 124 bytes");
+
+// http://github.khronos.org/KTX-Specification/
+struct Ktx2Header {
+	uint8_t  Identifier[12];
+	uint32_t VkFormat;
+	uint32_t TypeSize;
+	uint32_t PixelWidth;
+	uint32_t PixelHeight;
+	uint32_t PixelDepth;
+	uint32_t LayerCount;
+	uint32_t FaceCount;
+	uint32_t LevelCount;
+	uint32_t SupercompressionScheme;
+	uint32_t DfdByteOffset;
+	uint32_t DfdByteLength;
+	uint32_t KvdByteOffset;
+	uint32_t KvdByteLength;
+	uint64_t SgdByteOffset;
+	uint64_t SgdByteLength;
+};
+
+struct Ktx2Level {
+	uint64_t ByteOffset;
+	uint64_t ByteLength;
+	uint64_t UncompressedByteLength;
+};
+
+static_assert(sizeof(Ktx2Header) == 80, "KTX2 header must be 80 bytes");
+
+const uint8_t Ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+const uint32_t DDSCAPS2_CUBEMAP              = 0x200;
+const uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+
+// Gets the size of a single compressed mip level
+inline size_t CompressedLevelSize(InternalFormat format, uint32_t width, uint32_t height) {
+	return ((width + 3) / 4) * ((height + 3) / 4) * GetCompressedBlockSize(format);
+}
+
+// Gets the number of levels in a full mip chain, files that claim more than this are malformed
+inline uint32_t MaxLevelCount(uint32_t width, uint32_t height) {
+	uint32_t levels = 1;
+	while (width > 1 || height > 1) {
+		width  = std::max(width / 2, 1u);
+		height = std::max(height / 2, 1u);
+		levels++;
+	}
+	return levels;
+}
+
+// Copies a POD struct out of a file's bytes, returns false if the file isn't big enough
+template <typename T>
+bool ReadStruct(const std::vector<uint8_t>& file, size_t offset, T& result) {
+	if (offset + sizeof(T) > file.size())
+		return false;
+	memcpy(&result, file.data() + offset, sizeof(T));
+	return true;
+}
+
+bool TextureContainer::IsContainerFile(const std::string& fileName) {
+	std::string extension = std::filesystem::path(fileName).extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+	return extension == ".dds" || extension == ".ktx2";
+}
+
+bool TextureContainer::LoadFromFile(const std::string& fileName, TextureContainer& result) {
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if (!file.is_open()) {
+		LOG_WARN("Failed to open texture container \"{}\"", fileName);
+		return false;
+	}
+
+	// Read the whole file in one go, we'll be keeping most of it anyways
+	std::vector<uint8_t> data((size_t)file.tellg());
+	file.seekg(0, std::ios::beg);
+	file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+	bool success = false;
+	if (data.size() >= 4 && memcmp(data.data(), "DDS ", 4) == 0)
+		success = __LoadDDS(data, result);
+	else if (data.size() >= sizeof(Ktx2Identifier) && memcmp(data.data(), Ktx2Identifier, sizeof(Ktx2Identifier)) == 0)
+		success = __LoadKTX2(data, result);
+	else
+		LOG_WARN("\"{}\" is not a DDS or KTX2 file", fileName);
+
+	if (!success)
+		LOG_WARN("Failed to load texture container \"{}\"", fileName);
+	return success;
+}
+
+bool TextureContainer::__LoadDDS(const std::vector<uint8_t>& file, TextureContainer& result) {
+	size_t offset = 4;
+	DdsHeader header;
+	if (!ReadStruct(file, offset, header) || header.Size != sizeof(DdsHeader))
+		return false;
+	offset += sizeof(DdsHeader);
+
+	bool isCube = (header.Caps2 & DDSCAPS2_CUBEMAP) != 0;
+	uint32_t arraySize = 1;
+
+	switch (header.PixelFormat.FourCC) {
+		case FourCC('D', 'X', 'T', '1'): result.Format = InternalFormat::BC1; break;
+		case FourCC('D', 'X', 'T', '5'): result.Format = InternalFormat::BC3; break;
+		case FourCC('A', 'T', 'I', '1'):
+		case FourCC('B', 'C', '4', 'U'): result.Format = InternalFormat::BC4; break;
+		case FourCC('A', 'T', 'I', '2'):
+		case FourCC('B', 'C', '5', 'U'): result.Format = InternalFormat::BC5; break;
+		case FourCC('D', 'X', '1', '0'):
+		{
+			DdsHeaderDX10 dx10;
+			if (!ReadStruct(file, offset, dx10))
+				return false;
+			offset += sizeof(DdsHeaderDX10);
+			isCube    = (dx10.MiscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) != 0;
+			arraySize = std::max(dx10.ArraySize, 1u);
+
+			// https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format
+			switch (dx10.DxgiFormat) {
+				case 71: result.Format = InternalFormat::BC1;      break;
+				case 72: result.Format = InternalFormat::BC1_SRGB; break;
+				case 77: result.Format = InternalFormat::BC3;      break;
+				case 78: result.Format = InternalFormat::BC3_SRGB; break;
+				case 80: result.Format = InternalFormat::BC4;      break;
+				case 83: result.Format = InternalFormat::BC5;      break;
+				case 98: result.Format = InternalFormat::BC7;      break;
+				case 99: result.Format = InternalFormat::BC7_SRGB; break;
+				default:
+					LOG_WARN("Unsupported DXGI format {} in DDS file", dx10.DxgiFormat);
+					return false;
+			}
+			break;
+		}
+		default:
+			LOG_WARN("Unsupported DDS pixel format, only BC1, BC3, BC4, BC5 and BC7 are supported");
+			return false;
+	}
+
+	if (arraySize != 1) {
+		LOG_WARN("DDS texture arrays are not supported");
+		return false;
+	}
+
+	if (header.Width == 0 || header.Height == 0 || header.MipMapCount > MaxLevelCount(header.Width, header.Height)) {
+		LOG_WARN("DDS file has a bad size ({}x{}) or level count ({})", header.Width, header.Height, header.MipMapCount);
+		return false;
+	}
+
+	result.Width     = header.Width;
+	result.Height    = header.Height;
+	result.MipLevels = std::max(header.MipMapCount, 1u);
+	result.Faces     = isCube ? 6 : 1;
+
+	// DDS stores each face with all of it's mips, one face after another
+	result.Levels.clear();
+	result.Levels.reserve(result.Faces * result.MipLevels);
+	size_t dataStart = offset;
+	for (uint32_t face = 0; face < result.Faces; face++) {
+		for (uint32_t level = 0; level < result.MipLevels; level++) {
+			ContainerLevel entry;
+			entry.Width  = std::max(result.Width >> level, 1u);
+			entry.Height = std::max(result.Height >> level, 1u);
+			entry.Size   = CompressedLevelSize(result.Format, entry.Width, entry.Height);
+			entry.Offset = offset - dataStart;
+			offset += entry.Size;
+			result.Levels.push_back(entry);
+		}
+	}
+	if (offset > file.size()) {
+		LOG_WARN("DDS file is truncated");
+		return false;
+	}
+
+	result.DataOffset = dataStart;
+	result.Data.assign(file.begin() + dataStart, file.begin() + offset);
+	return true;
+}
+
+bool TextureContainer::__LoadKTX2(const std::vector<uint8_t>& file, TextureContainer& result) {
+	Ktx2Header header;
+	if (!ReadStruct(file, 0, header))
+		return false;
+
+	if (header.SupercompressionScheme != 0) {
+		LOG_WARN("Supercompressed KTX2 files are not supported");
+		return false;
+	}
+	if (header.PixelDepth > 1 || header.LayerCount > 1) {
+		LOG_WARN("KTX2 volume textures and arrays are not supported");
+		return false;
+	}
+
+	// https://www.khronos.org/registry/vulkan/specs/1.2-extensions/man/html/VkFormat.html
+	switch (header.VkFormat) {
+		case 131:
+		case 133: result.Format = InternalFormat::BC1;      break;
+		case 132:
+		case 134: result.Format = InternalFormat::BC1_SRGB; break;
+		case 137: result.Format = InternalFormat::BC3;      break;
+		case 138: result.Format = InternalFormat::BC3_SRGB; break;
+		case 139: result.Format = InternalFormat::BC4;      break;
+		case 141: result.Format = InternalFormat::BC5;      break;
+		case 145: result.Format = InternalFormat::BC7;      break;
+		case 146: result.Format = InternalFormat::BC7_SRGB; break;
+		default:
+			LOG_WARN("Unsupported VkFormat {} in KTX2 file", header.VkFormat);
+			return false;
+	}
+
+	uint32_t height = std::max(header.PixelHeight, 1u);
+	if (header.PixelWidth == 0 || header.LevelCount > MaxLevelCount(header.PixelWidth, height)) {
+		LOG_WARN("KTX2 file has a bad size ({}x{}) or level count ({})", header.PixelWidth, header.PixelHeight, header.LevelCount);
+		return false;
+	}
+	if (header.FaceCount != 1 && header.FaceCount != 6) {
+		LOG_WARN("KTX2 file has a bad face count ({})", header.FaceCount);
+		return false;
+	}
+
+	result.Width     = header.PixelWidth;
+	result.Height    = height;
+	// A level count of 0 means the loader should generate mips, which we can't do for compressed data
+	result.MipLevels = std::max(header.LevelCount, 1u);
+	result.Faces     = header.FaceCount;
+
+	// KTX2 stores each level with all of it's faces, and the level index tells us where each level starts
+	result.Levels.resize(result.Faces * result.MipLevels);
+	size_t dataStart = SIZE_MAX;
+	size_t dataEnd   = 0;
+	for (uint32_t level = 0; level < result.MipLevels; level++) {
+		Ktx2Level index;
+		if (!ReadStruct(file, sizeof(Ktx2Header) + level * sizeof(Ktx2Level), index))
+			return false;
+		if (index.ByteOffset + index.ByteLength > file.size()) {
+			LOG_WARN("KTX2 file is truncated");
+			return false;
+		}
+		dataStart = std::min(dataStart, (size_t)index.ByteOffset);
+		dataEnd   = std::max(dataEnd, (size_t)(index.ByteOffset + index.ByteLength));
+
+		size_t faceSize = (size_t)index.ByteLength / result.Faces;
+		for (uint32_t face = 0; face < result.Faces; face++) {
+			ContainerLevel& entry = result.Levels[face * result.MipLevels + level];
+			entry.Width  = std::max(result.Width >> level, 1u);
+			entry.Height = std::max(result.Height >> level, 1u);
+			entry.Size   = faceSize;
+			entry.Offset = (size_t)index.ByteOffset + face * faceSize;
+		}
+	}
+
+	// Re-base our offsets so we only need to keep the image data around
+	for (ContainerLevel& entry : result.Levels)
+		entry.Offset -= dataStart;
+	result.DataOffset = dataStart;
+	result.Data.assign(file.begin() + dataStart, file.begin() + dataEnd);
+	return true;
+}
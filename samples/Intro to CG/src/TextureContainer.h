@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Texture2D.h"
+
+// A single mip level of a single face within a TextureContainer
+struct ContainerLevel {
+	uint32_t Width;
+	uint32_t Height;
+	// Where the level's blocks are in the container's Data, in bytes
+	size_t   Offset;
+	size_t   Size;
+};
+
+/*
+ * Pre-compressed texture data, as loaded from a DDS or KTX2 file. We only support block compressed 2D textures
+ * and cubemaps (no arrays or volumes), and the data is kept exactly as it was on disk so that it can be
+ * handed straight to glCompressedTextureSubImage
+ */
+struct TextureContainer {
+	InternalFormat              Format    = InternalFormat::BC1;
+	uint32_t                    Width     = 0;
+	uint32_t                    Height    = 0;
+	uint32_t                    MipLevels = 0;
+	// 1 for a 2D texture, 6 for a cubemap (in CubeMapFace order)
+	uint32_t                    Faces     = 0;
+	std::vector<uint8_t>        Data;
+	// Where Data starts within the file, so that single levels can be read back in from disk later
+	size_t                      DataOffset = 0;
+	// Stored as [face * MipLevels + level]
+	std::vector<ContainerLevel> Levels;
+
+	const ContainerLevel& GetLevel(uint32_t face, uint32_t level) const { return Levels[face * MipLevels + level]; }
+	const uint8_t* GetLevelData(uint32_t face, uint32_t level) const { return Data.data() + GetLevel(face, level).Offset; }
+
+	/*
+	 * Gets whether a file is one of the containers we can load, based on it's extension
+	 * @param fileName The path to the file
+	 */
+	static bool IsContainerFile(const std::string& fileName);
+
+	/*
+	 * Loads a DDS or KTX2 file (we check the file's header, not the extension)
+	 * @param fileName The path to the file to load
+	 * @param result   The container to load into
+	 * @returns True if the file was loaded, false if it was missing or in a format we don't support
+	 */
+	static bool LoadFromFile(const std::string& fileName, TextureContainer& result);
+
+private:
+	static bool __LoadDDS(const std::vector<uint8_t>& file, TextureContainer& result);
+	static bool __LoadKTX2(const std::vector<uint8_t>& file, TextureContainer& result);
+};
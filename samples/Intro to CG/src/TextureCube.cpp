@@ -1,6 +1,14 @@
 #include "TextureCube.h"
 #include "Logging.h"
 #include "stb_image.h"
+#include "TextureContainer.h"
+#include "PixelUploadRing.h"
+#include "Shader.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <future>
 
 TextureCube::TextureCube(const TextureCubeDesc& desc) {
 	myDesc = desc;
@@ -12,46 +20,194 @@ TextureCube::TextureCube(const TextureCubeDesc& desc) {
 TextureCube::~TextureCube() { glDeleteTextures(1, &myRenderhandle); }
 
 void TextureCube::LoadData(uint32_t width, uint32_t height, CubeMapFace face, PixelFormat format, PixelType type, void* data) {		
-	glTextureSubImage3D(myRenderhandle, 0, 0, 0, (int)face, myDesc.Size, myDesc.Size, 1, (GLenum)format, (GLenum)type, data);
+	PixelUploadRing::Global().Upload3D(myRenderhandle, 0, 0, 0, (int)face, myDesc.Size, myDesc.Size, 1, (GLenum)format, (GLenum)type, data);
 }
 
-TextureCube::Sptr TextureCube::LoadFromFiles(const std::string faceFiles[6], bool flipVertically) {
+void TextureCube::LoadCompressedData(CubeMapFace face, int level, const void* data, size_t size, uint32_t width) {
+	LOG_ASSERT(IsCompressedFormat(myDesc.Format), "LoadCompressedData can only be used with compressed cubemaps!");
+	glCompressedTextureSubImage3D(myRenderhandle, level, 0, 0, (int)face, width, width, 1, (GLenum)myDesc.Format, (GLsizei)size, data);
+}
+
+TextureCube::Sptr TextureCube::LoadFromFile(const std::string& fileName) {
+	TextureContainer container;
+	if (!TextureContainer::LoadFromFile(fileName, container))
+		return nullptr;
+	if (container.Faces != 6 || container.Width != container.Height) {
+		LOG_WARN("\"{}\" does not contain a cubemap", fileName);
+		return nullptr;
+	}
+
 	TextureCubeDesc desc = TextureCubeDesc();
-	desc.Format = InternalFormat::RGB8;
-	
-    stbi_set_flip_vertically_on_load(flipVertically);
-	Sptr result = nullptr;
-	
-	for(int ix = 0; ix < 6; ix++) {
+	desc.Size      = container.Width;
+	desc.Format    = container.Format;
+	desc.MipLevels = container.MipLevels;
 
-		int width, height, numChannels;
-		void* data = stbi_load(faceFiles[ix].c_str(), &width, &height, &numChannels, 3);
-		
-		if (desc.Size != 0 && ((width != desc.Size) | (height != desc.Size))) {
-			stbi_image_free(data);
-			LOG_ASSERT(false, "Image file dimensions do not match the size of this cubemap! ({})", faceFiles[ix]);
-		}
-		if (width != height) {
-			stbi_image_free(data);
-			LOG_ASSERT(false, "Image for cubemap must be square! ({})", faceFiles[ix]);
+	Sptr result = Create(desc);
+	for (uint32_t face = 0; face < 6; face++) {
+		for (uint32_t level = 0; level < container.MipLevels; level++) {
+			const ContainerLevel& info = container.GetLevel(face, level);
+			result->LoadCompressedData((CubeMapFace)face, level, container.GetLevelData(face, level), info.Size, info.Width);
 		}
+	}
+	result->SetDebugName(std::filesystem::path(fileName).filename().string());
+	return result;
+}
 
-		if (ix == 0) {
-			desc.Size = width;
-			result = std::make_shared<TextureCube>(desc);
-		}
-		
-		if (data != nullptr && width != 0 && height != 0 && numChannels != 0) {
-			result->LoadData(width, height, (CubeMapFace)ix,
-				numChannels == 4 ? PixelFormat::Rgba : PixelFormat::Rgb,
-				PixelType::UByte, data);
-			stbi_image_free(data);
-		}
-		else {
-			LOG_WARN("Failed to load image from \"{}\"", faceFiles[ix]);
+// Gets the number of levels in a full mip chain for a cubemap with the given face size
+static int GetFullMipCount(uint32_t size) {
+	int result = 1;
+	while (size > 1) {
+		size /= 2;
+		result++;
+	}
+	return result;
+}
+
+void TextureCube::GenerateMipmaps() {
+	if (myDesc.MipLevels > 1)
+		glGenerateTextureMipmap(myRenderhandle);
+}
+
+TextureCube::Sptr TextureCube::LoadFromFiles(const std::string faceFiles[6], bool flipVertically) {
+	// We read the size from the first face's header, so that we can make the cubemap before anything is decoded
+	int size, height, numChannels;
+	if (!stbi_info(faceFiles[0].c_str(), &size, &height, &numChannels)) {
+		LOG_WARN("Failed to load image from \"{}\"", faceFiles[0]);
+		return nullptr;
+	}
+	if (size != height) {
+		LOG_WARN("Image for cubemap must be square! ({})", faceFiles[0]);
+		return nullptr;
+	}
+
+	TextureCubeDesc desc = TextureCubeDesc();
+	desc.Format    = InternalFormat::RGB8;
+	desc.Size      = size;
+	desc.MipLevels = GetFullMipCount(size);
+	Sptr result = Create(desc);
+
+	struct DecodedFace {
+		uint8_t* Data   = nullptr;
+		int      Width  = 0;
+		int      Height = 0;
+	};
+	std::future<DecodedFace> faces[6];
+	for (int ix = 0; ix < 6; ix++) {
+		faces[ix] = ThreadPool::Global().Enqueue([fileName = faceFiles[ix], flipVertically]() {
+			DecodedFace face;
+			int numChannels;
+			face.Data = stbi_load(fileName.c_str(), &face.Width, &face.Height, &numChannels, 3);
+			// stbi_set_flip_vertically_on_load is shared by every thread, so we flip the rows ourselves
+			if (face.Data != nullptr && flipVertically) {
+				size_t rowSize = (size_t)face.Width * 3;
+				std::vector<uint8_t> temp(rowSize);
+				for (int row = 0; row < face.Height / 2; row++) {
+					uint8_t* top    = face.Data + row * rowSize;
+					uint8_t* bottom = face.Data + (face.Height - 1 - row) * rowSize;
+					memcpy(temp.data(), top, rowSize);
+					memcpy(top, bottom, rowSize);
+					memcpy(bottom, temp.data(), rowSize);
+				}
+			}
+			return face;
+		});
+	}
+
+	// Upload the faces in whatever order they finish decoding
+	bool uploaded[6] = { false, false, false, false, false, false };
+	int remaining = 6;
+	while (remaining > 0) {
+		for (int ix = 0; ix < 6; ix++) {
+			if (uploaded[ix] || faces[ix].wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+				continue;
+			uploaded[ix] = true;
+			remaining--;
+
+			DecodedFace face = faces[ix].get();
+			if (face.Data == nullptr) {
+				LOG_WARN("Failed to load image from \"{}\"", faceFiles[ix]);
+			} else if (face.Width != size || face.Height != size) {
+				LOG_WARN("Image file dimensions do not match the size of this cubemap! ({})", faceFiles[ix]);
+			} else {
+				result->LoadData(face.Width, face.Height, (CubeMapFace)ix, PixelFormat::Rgb, PixelType::UByte, face.Data);
+			}
+			stbi_image_free(face.Data);
 		}
 	}
 
+	// Doing this once at the end is much cheaper than re-generating the whole chain after every face
+	result->GenerateMipmaps();
+	result->SetDebugName(std::filesystem::path(faceFiles[0]).parent_path().filename().string());
+	return result;
+}
+
+TextureCube::Sptr TextureCube::LoadFromImage(const std::string& fileName, uint32_t faceSize) {
+	int width, height, numChannels;
+	uint8_t* data = stbi_load(fileName.c_str(), &width, &height, &numChannels, 4);
+	if (data == nullptr) {
+		LOG_WARN("Failed to load image from \"{}\"", fileName);
+		return nullptr;
+	}
+
+	// Work out the layout from the shape of the image
+	CubeMapLayout layout;
+	uint32_t imageFaceSize;
+	if (width == height * 2) {
+		layout = CubeMapLayout::Equirectangular;
+		// A face covers a quarter of the panorama's width
+		imageFaceSize = width / 4;
+	} else if (width * 3 == height * 4) {
+		layout = CubeMapLayout::HorizontalCross;
+		imageFaceSize = width / 4;
+	} else if (width * 4 == height * 3) {
+		layout = CubeMapLayout::VerticalCross;
+		imageFaceSize = width / 3;
+	} else {
+		LOG_WARN("\"{}\" is {}x{}, which is not an equirectangular (2:1) or cross (4:3 or 3:4) image", fileName, width, height);
+		stbi_image_free(data);
+		return nullptr;
+	}
+	// Crosses are copied texel for texel, so they can't be resized
+	if (faceSize == 0 || layout != CubeMapLayout::Equirectangular)
+		faceSize = imageFaceSize;
+
+	Texture2DDescription sourceDesc = Texture2DDescription();
+	sourceDesc.Width             = width;
+	sourceDesc.Height            = height;
+	sourceDesc.Format            = InternalFormat::RGBA8;
+	sourceDesc.EnableMip         = false;
+	sourceDesc.Sampler.WrapS     = WrapMode::Repeat;
+	sourceDesc.Sampler.WrapT     = WrapMode::ClampToEdge;
+	sourceDesc.Sampler.MinFilter = MinFilter::Linear;
+	Texture2D::Sptr source = Texture2D::Create(sourceDesc);
+	source->LoadData(data, width, height, PixelFormat::Rgba, PixelType::UByte);
+	stbi_image_free(data);
+
+	// Image stores need a 4 component format, so this cubemap is RGBA rather than RGB
+	TextureCubeDesc desc = TextureCubeDesc();
+	desc.Format    = InternalFormat::RGBA8;
+	desc.Size      = faceSize;
+	desc.MipLevels = GetFullMipCount(faceSize);
+	Sptr result = Create(desc);
+
+	Shader::Sptr converter = Shader::Create();
+	converter->LoadCompute("shaders/cubemap-convert.comp.glsl");
+	converter->Bind();
+	converter->SetUniform("a_Layout", (int)layout);
+	converter->SetUniform("a_FaceSize", (int)faceSize);
+	source->Bind(0);
+	// Make sure a leftover sampler object doesn't change how we read the source
+	glBindSampler(0, 0);
+	glBindImageTexture(0, result->GetRenderHandle(), 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	// One thread per texel, with a layer of groups for each face
+	converter->Dispatch((faceSize + 7) / 8, (faceSize + 7) / 8, 6);
+	glBindImageTexture(0, 0, 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	ITexture::Unbind(0);
+
+	// The mip generation reads what we just wrote with image stores, so we need to make sure those writes have landed
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+	result->GenerateMipmaps();
+	result->SetDebugName(std::filesystem::path(fileName).filename().string());
 	return result;
 }
 
@@ -62,9 +218,9 @@ void TextureCube::__InitTexture() {
 
 	glTextureParameteri(myRenderhandle, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTextureParameteri(myRenderhandle, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTextureParameteri(myRenderhandle, GL_TEXTURE_MIN_FILTER, (GLenum)MinFilter::Linear);
+	glTextureParameteri(myRenderhandle, GL_TEXTURE_MIN_FILTER, (GLenum)(myDesc.MipLevels > 1 ? MinFilter::LinearMipLinear : MinFilter::Linear));
 	glTextureParameteri(myRenderhandle, GL_TEXTURE_MAG_FILTER, (GLenum)MagFilter::Linear);
 
 		
-	glTextureStorage2D(myRenderhandle, 1, format, myDesc.Size, myDesc.Size);
+	glTextureStorage2D(myRenderhandle, myDesc.MipLevels, format, myDesc.Size, myDesc.Size);
 }
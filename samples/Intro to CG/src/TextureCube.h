@@ -23,9 +23,20 @@ ENUM(CubeMapFace, GLint,
 	NegZ = 5
 );
 
+// The layouts we can convert a single image into a cubemap from
+ENUM(CubeMapLayout, GLint,
+	// A 2:1 latitude / longitude panorama
+	Equirectangular = 0,
+	// A 4:3 cross, with +Y and -Y above and below +Z
+	HorizontalCross = 1,
+	// A 3:4 cross, with -Z below -Y (upside down)
+	VerticalCross   = 2
+);
+
 struct TextureCubeDesc {
 	uint32_t       Size        = 0;
 	InternalFormat Format      = InternalFormat::RGBA8;
+	int            MipLevels   = 1;
 };
 
 
@@ -37,8 +48,42 @@ public:
 	virtual ~TextureCube();
 
 	void LoadData(uint32_t width, uint32_t height, CubeMapFace face, PixelFormat format, PixelType type, void* data);
+	/*
+	 * Loads a single level of a face from pre-compressed data, the cubemap must have a compressed format
+	 * @param face  The face to load into
+	 * @param level The mip level to load into
+	 * @param data  The compressed blocks for the level
+	 * @param size  The size of data, in bytes
+	 * @param width The size of the level, in pixels
+	 */
+	void LoadCompressedData(CubeMapFace face, int level, const void* data, size_t size, uint32_t width);
 
+	// Generates all of the mip levels below the base level from the base level
+	void GenerateMipmaps();
+
+	/*
+	 * Loads a cubemap from 6 image files, which are decoded in parallel on the thread pool and uploaded as
+	 * soon as each one is ready. The cubemap gets a full mip chain, which is generated once all faces are in
+	 * @param faceFiles      The paths to the images for each face, in CubeMapFace order
+	 * @param flipVertically True if the images should be flipped on load
+	 */
 	static Sptr LoadFromFiles(const std::string faceFiles[6], bool flipVertically = true);
+	/*
+	 * Loads a cubemap from a single equirectangular or cross layout image, the layout is picked from the
+	 * image's aspect ratio (2:1, 4:3 or 3:4). The faces are built on the GPU with a compute shader
+	 * @param fileName The path to the image file
+	 * @param faceSize The size of each face, or 0 to pick one based on the size of the image (crosses always use their own face size)
+	 */
+	static Sptr LoadFromImage(const std::string& fileName, uint32_t faceSize = 0);
+	/*
+	 * Loads a cubemap from a single DDS or KTX2 file, with all of it's mip levels
+	 * @param fileName The path to the container file
+	 */
+	static Sptr LoadFromFile(const std::string& fileName);
+
+	const TextureCubeDesc& GetDescription() const { return myDesc; }
+	// Gets the estimated amount of GPU memory used by this cubemap, in bytes
+	size_t GetGpuSize() const { return GetTextureMemorySize(myDesc.Format, myDesc.Size, myDesc.Size, myDesc.MipLevels, 6); }
 	
 protected:
 	TextureCubeDesc myDesc;
@@ -40,6 +40,13 @@ struct SamplerDesc {
 
 	bool      AnisotropicEnabled        = true;
 	float     MaxAnisotropy             = 1.0f;
+
+	bool operator ==(const SamplerDesc& other) const {
+		return WrapS == other.WrapS && WrapT == other.WrapT && WrapR == other.WrapR &&
+			MinFilter == other.MinFilter && MagFilter == other.MagFilter && BorderColor == other.BorderColor &&
+			AnisotropicEnabled == other.AnisotropicEnabled && MaxAnisotropy == other.MaxAnisotropy;
+	}
+	bool operator !=(const SamplerDesc& other) const { return !(*this == other); }
 };
 
 class TextureSampler : public GraphicsResource<GL_SAMPLER> {
@@ -0,0 +1,227 @@
+#include "TextureStreamer.h"
+#include "Logging.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include "imgui.h"
+
+std::unordered_map<const ITexture*, TextureStreamer::Entry> TextureStreamer::myEntries;
+size_t   TextureStreamer::myUploadBudget  = TextureStreamer::DefaultUploadBudget;
+bool     TextureStreamer::mySparseEnabled = true;
+uint64_t TextureStreamer::myFrame         = 0;
+size_t   TextureStreamer::myLastUploaded  = 0;
+
+Texture2D::Handle TextureStreamer::Load(const std::string& fileName) {
+	if (!TextureContainer::IsContainerFile(fileName))
+		return Texture2D::LoadFromFile(fileName);
+
+	TextureContainer container;
+	if (!TextureContainer::LoadFromFile(fileName, container))
+		return nullptr;
+	if (container.Faces != 1) {
+		LOG_WARN("\"{}\" is a cubemap, only 2D textures can be streamed", fileName);
+		return nullptr;
+	}
+
+	Texture2DDescription desc = Texture2DDescription();
+	desc.Width     = container.Width;
+	desc.Height    = container.Height;
+	desc.Format    = container.Format;
+	desc.EnableMip = container.MipLevels > 1;
+	desc.MipLevels = container.MipLevels;
+	desc.Sparse    = mySparseEnabled && container.MipLevels > 1 && Texture2D::SupportsSparse(container.Format);
+	Texture2D::Handle result = Texture2D::Create(desc);
+
+	// Find the first level that is small enough to keep around all the time
+	int tail = (int)container.MipLevels - 1;
+	while (tail > 0 && std::max(container.Width >> (tail - 1), container.Height >> (tail - 1)) <= ResidentTailSize)
+		tail--;
+	// Sparse textures commit their whole mip tail at once, so we may as well fill all of it
+	if (desc.Sparse)
+		tail = std::min(tail, result->GetSparseLevelCount());
+
+	for (int level = (int)container.MipLevels - 1; level >= tail; level--) {
+		const ContainerLevel& info = container.GetLevel(0, level);
+		if (desc.Sparse)
+			result->SetLevelCommitted(level, true);
+		result->LoadCompressedData(level, container.GetLevelData(0, level), info.Size, info.Width, info.Height);
+	}
+	result->SetBaseLevel(tail);
+	result->SetDebugName(std::filesystem::path(fileName).filename().string());
+
+	Entry entry;
+	entry.Texture       = result.GetValue();
+	entry.FileName      = fileName;
+	entry.TailLevel     = tail;
+	entry.ResidentLevel = tail;
+	entry.WantedLevel   = tail;
+	entry.WantedFrame   = myFrame;
+	// From here on we only need to know where the levels are in the file
+	entry.Layout = std::move(container);
+	entry.Layout.Data.clear();
+	entry.Layout.Data.shrink_to_fit();
+	myEntries[result.Get()] = std::move(entry);
+	return result;
+}
+
+void TextureStreamer::ReportUsage(const ITexture* texture, float screenSize) {
+	auto it = myEntries.find(texture);
+	if (it == myEntries.end())
+		return;
+
+	Entry& entry = it->second;
+	int level = __GetLevelForSize(entry, screenSize);
+	if (level <= entry.WantedLevel) {
+		entry.WantedLevel = level;
+		entry.WantedFrame = myFrame;
+	}
+}
+
+void TextureStreamer::Update() {
+	myFrame++;
+
+	std::vector<std::pair<Texture2D*, Entry*>> ready;
+	for (auto it = myEntries.begin(); it != myEntries.end();) {
+		Entry& entry = it->second;
+		// The pool hands back a different texture (or none at all) once the one we were streaming has been deleted
+		Texture2D* texture = ResourcePool<Texture2D>::Resolve(entry.Texture);
+		if (texture != it->first) {
+			it = myEntries.erase(it);
+			continue;
+		}
+
+		// Let the wanted level drift back towards the tail one step at a time, for as long as nobody needs it
+		if (entry.WantedLevel < entry.TailLevel && myFrame - entry.WantedFrame > EvictDelay) {
+			entry.WantedLevel++;
+			entry.WantedFrame = myFrame;
+		}
+
+		// Sparse textures can give back the memory for levels we don't need anymore
+		if (texture->GetDescription().Sparse && entry.ResidentLevel < entry.WantedLevel) {
+			texture->SetBaseLevel(entry.WantedLevel);
+			for (int level = entry.ResidentLevel; level < entry.WantedLevel; level++)
+				texture->SetLevelCommitted(level, false);
+			entry.ResidentLevel = entry.WantedLevel;
+		}
+
+		if (entry.PendingLevel >= 0 && entry.PendingData.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+			ready.push_back({ texture, &entry });
+		it++;
+	}
+
+	// Upload the textures that are furthest from where they need to be first
+	std::sort(ready.begin(), ready.end(), [](const auto& a, const auto& b) {
+		return a.second->ResidentLevel - a.second->WantedLevel > b.second->ResidentLevel - b.second->WantedLevel;
+	});
+	size_t uploaded = 0;
+	for (auto& [texture, entry] : ready) {
+		const ContainerLevel& info = entry->Layout.GetLevel(0, entry->PendingLevel);
+		// Anything over our budget waits for next frame, but we always upload at least one level so big levels can't get stuck
+		if (uploaded > 0 && uploaded + info.Size > myUploadBudget)
+			continue;
+
+		int level = entry->PendingLevel;
+		std::vector<uint8_t> data = entry->PendingData.get();
+		entry->PendingLevel = -1;
+		if (data.size() != info.Size) {
+			LOG_WARN("Failed to read level {} of \"{}\", it will no longer be streamed", level, entry->FileName);
+			myEntries.erase(texture);
+			continue;
+		}
+		// The texture may have shrunk on screen while we were reading
+		if (level != entry->ResidentLevel - 1 || level < entry->WantedLevel)
+			continue;
+
+		if (texture->GetDescription().Sparse)
+			texture->SetLevelCommitted(level, true);
+		texture->LoadCompressedData(level, data.data(), data.size(), info.Width, info.Height);
+		texture->SetBaseLevel(level);
+		entry->ResidentLevel = level;
+		uploaded += data.size();
+	}
+	myLastUploaded = uploaded;
+
+	// Start reading the next level for anything that still needs more detail
+	for (auto& kvp : myEntries) {
+		Entry& entry = kvp.second;
+		if (entry.PendingLevel >= 0 || entry.ResidentLevel <= entry.WantedLevel)
+			continue;
+
+		entry.PendingLevel = entry.ResidentLevel - 1;
+		const ContainerLevel& info = entry.Layout.GetLevel(0, entry.PendingLevel);
+		std::string fileName = entry.FileName;
+		size_t offset = entry.Layout.DataOffset + info.Offset;
+		size_t size   = info.Size;
+		entry.PendingData = ThreadPool::Global().Enqueue([fileName, offset, size]() { return __ReadLevel(fileName, offset, size); });
+	}
+}
+
+void TextureStreamer::Clear() {
+	myEntries.clear();
+}
+
+void TextureStreamer::DrawInspector() {
+	size_t gpuSize = 0;
+	for (auto& kvp : myEntries) {
+		if (Texture2D* texture = ResourcePool<Texture2D>::Resolve(kvp.second.Texture))
+			gpuSize += texture->GetGpuSize();
+	}
+	ImGui::Text("Streaming: %zu textures, %.2f MB resident", myEntries.size(), gpuSize / (1024.0f * 1024.0f));
+	ImGui::Text("Uploaded last frame: %.1f KB", myLastUploaded / 1024.0f);
+
+	int budgetKb = (int)(myUploadBudget / 1024);
+	if (ImGui::DragInt("Upload Budget (KB)", &budgetKb, 64.0f, 64, 65536))
+		myUploadBudget = (size_t)std::max(budgetKb, 64) * 1024;
+	ImGui::Checkbox("Sparse Textures", &mySparseEnabled);
+	if (ImGui::IsItemHovered())
+		ImGui::SetTooltip("Only affects textures that are loaded from now on");
+
+	ImGui::Columns(5);
+	ImGui::Text("Name");      ImGui::NextColumn();
+	ImGui::Text("Resident");  ImGui::NextColumn();
+	ImGui::Text("Wanted");    ImGui::NextColumn();
+	ImGui::Text("Size (KB)"); ImGui::NextColumn();
+	ImGui::Text("Sparse");    ImGui::NextColumn();
+	ImGui::Separator();
+	for (auto& kvp : myEntries) {
+		const Entry& entry = kvp.second;
+		Texture2D* texture = ResourcePool<Texture2D>::Resolve(entry.Texture);
+		if (texture == nullptr)
+			continue;
+		const ContainerLevel& resident = entry.Layout.GetLevel(0, entry.ResidentLevel);
+		const ContainerLevel& wanted   = entry.Layout.GetLevel(0, entry.WantedLevel);
+		ImGui::Text("%s", texture->GetDebugName().c_str());                                    ImGui::NextColumn();
+		ImGui::Text("%d (%ux%u)", entry.ResidentLevel, resident.Width, resident.Height);       ImGui::NextColumn();
+		ImGui::Text("%d (%ux%u)", entry.WantedLevel, wanted.Width, wanted.Height);             ImGui::NextColumn();
+		ImGui::Text("%.1f", texture->GetGpuSize() / 1024.0f);                                  ImGui::NextColumn();
+		ImGui::Text("%s", texture->GetDescription().Sparse ? "Yes" : "No");                    ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+}
+
+int TextureStreamer::__GetLevelForSize(const Entry& entry, float screenSize) {
+	if (screenSize <= 1.0f)
+		return entry.TailLevel;
+	// Each level halves the size of the texture. We round down, to the smallest level that is still at least as big
+	// as the screen, so the texture is never drawn with fewer texels than pixels
+	float ratio = std::max(entry.Layout.Width, entry.Layout.Height) / screenSize;
+	int level = ratio <= 1.0f ? 0 : (int)std::floor(std::log2(ratio));
+	return std::clamp(level, 0, entry.TailLevel);
+}
+
+std::vector<uint8_t> TextureStreamer::__ReadLevel(const std::string& fileName, size_t offset, size_t size) {
+	std::vector<uint8_t> result;
+	std::ifstream file(fileName, std::ios::binary);
+	if (!file.is_open())
+		return result;
+	file.seekg(offset);
+	result.resize(size);
+	file.read(reinterpret_cast<char*>(result.data()), size);
+	// Hand back whatever we managed to read, the caller will notice if it's short
+	result.resize((size_t)file.gcount());
+	return result;
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Texture2D.h"
+#include "TextureContainer.h"
+
+/*
+ * Streams the mip levels of cooked (DDS or KTX2) textures in and out, based on how big they are on screen.
+ *
+ * When a texture is loaded, only it's smallest levels are uploaded, so it can be drawn right away at a low
+ * resolution. Every frame the renderer reports how many pixels each texture covers, and we read the levels
+ * that are needed from disk on the thread pool, then upload them on the main thread from the smallest to the
+ * largest, within a per-frame byte budget. The texture's base level is clamped to the largest level that is
+ * resident, so the GPU never samples a level that hasn't arrived yet.
+ *
+ * If ARB_sparse_texture is supported, a level is only backed by memory once it is committed, so levels that
+ * haven't been needed in a while are released again and VRAM use follows what is actually visible. Without
+ * it, levels are still loaded lazily, but they stay resident once they have been loaded.
+ */
+class TextureStreamer {
+public:
+	// The default number of bytes we upload per frame
+	static const size_t   DefaultUploadBudget = 4 * 1024 * 1024;
+	// Levels this size or smaller are uploaded as soon as the texture is loaded, and are never released
+	static const uint32_t ResidentTailSize    = 64;
+	// How many frames a level has to go unused before we drop it
+	static const uint64_t EvictDelay          = 120;
+
+	/*
+	 * Loads a texture from a DDS or KTX2 file, uploading only the smallest levels. Anything that isn't a
+	 * container is loaded all at once with Texture2D::LoadFromFile, since we can't read it one level at a time
+	 * @param fileName The path to the file to load
+	 * @returns A handle to the texture, or a null handle if the file could not be loaded
+	 */
+	static Texture2D::Handle Load(const std::string& fileName);
+
+	/*
+	 * Lets the streamer know how big a texture is on screen this frame. Textures we aren't streaming are ignored
+	 * @param texture    The texture being drawn
+	 * @param screenSize Roughly how many pixels the texture covers along it's longest side
+	 */
+	static void ReportUsage(const ITexture* texture, float screenSize);
+
+	// Should be called once per frame on the main thread, uploads finished reads and starts new ones
+	static void Update();
+	// Stops streaming all textures, the textures themselves stay alive until their handles are released
+	static void Clear();
+
+	// Gets or sets how many bytes we will upload in a single frame (we always upload at least one level)
+	static void SetUploadBudget(size_t bytes) { myUploadBudget = bytes; }
+	static size_t GetUploadBudget() { return myUploadBudget; }
+	// Gets or sets whether textures loaded from now on should use sparse storage when the driver supports it
+	static void SetSparseEnabled(bool enabled) { mySparseEnabled = enabled; }
+	static bool IsSparseEnabled() { return mySparseEnabled; }
+
+	// Draws an ImGui table of the textures we are streaming
+	static void DrawInspector();
+
+private:
+	struct Entry {
+		// The raw handle to the texture, we don't hold a reference so that the texture can still be unloaded
+		uint32_t         Texture       = 0;
+		std::string      FileName;
+		// The level layout of the file (the level data itself is not kept)
+		TextureContainer Layout;
+		// The first level that we never release
+		int              TailLevel     = 0;
+		// The largest level that is currently uploaded
+		int              ResidentLevel = 0;
+		// The largest level that has been asked for recently, and the last frame it was asked for
+		int              WantedLevel   = 0;
+		uint64_t         WantedFrame   = 0;
+		// The level we are currently reading from disk, or -1 if there are no reads in flight
+		int              PendingLevel  = -1;
+		std::future<std::vector<uint8_t>> PendingData;
+	};
+
+	static std::unordered_map<const ITexture*, Entry> myEntries;
+	static size_t   myUploadBudget;
+	static bool     mySparseEnabled;
+	static uint64_t myFrame;
+	// How many bytes we uploaded last frame, for the inspector
+	static size_t   myLastUploaded;
+
+	static int __GetLevelForSize(const Entry& entry, float screenSize);
+	static std::vector<uint8_t> __ReadLevel(const std::string& fileName, size_t offset, size_t size);
+};
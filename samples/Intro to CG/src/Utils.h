@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include "ResourcePool.h"
 
 #define NoCopy(TypeName) \
 TypeName(const TypeName& other) = delete; \
@@ -10,8 +11,12 @@ TypeName& operator =(const TypeName& other) = delete;
 TypeName(const TypeName&& other) = delete; \
 TypeName& operator =(const TypeName&& other) = delete;
 
+// Graphics classes live in a ResourcePool, Create returns a pooled Sptr that can be turned into a Handle
 #define GraphicsClass(TypeName)\
 	typedef std::shared_ptr<TypeName> Sptr;\
+	typedef ResourceHandle<TypeName> Handle;\
+	template <typename... Args>\
+	static Sptr Create(Args&&... args) { return CreatePooled<TypeName>(std::forward<Args>(args)...); }\
 	NoMove(TypeName);\
 	NoCopy(TypeName); 
 
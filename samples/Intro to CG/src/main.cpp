@@ -22,8 +22,9 @@ int main() {
 	game->Run();
 	delete game;
 
-	LOG_INFO("Total allocations over run: {}", MemoryTracking::TotalAllocs);
-	LOG_INFO("Total bytes allocated over run: {}", MemoryTracking::TotalBytes);
+	MemoryStats memory = MemoryTracking::GetStats();
+	LOG_INFO("Total allocations over run: {}", memory.TotalAllocs);
+	LOG_INFO("Total bytes allocated over run: {}", memory.TotalBytes);
 
 	Logger::Uninitialize();
 
@@ -0,0 +1,49 @@
+-- Offline texture cooker, converts the images in a sample's res folder into block compressed DDS files
+-- Samples run this as a prebuild step (see AddProjects in the root premake file)
+project "TextureCooker"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++17"
+    -- Sets RuntimLibrary to MultiThreaded (non DLL version for static linking)
+    staticruntime "on"
+
+    -- We output next to the samples, so their prebuild step can find us
+    targetdir ("%{wks.location}\\bin\\" .. outputdir .. "\\%{prj.name}")
+    objdir ("%{wks.location}\\obj\\" .. outputdir .. "\\%{prj.name}")
+
+    files
+    {
+        "src\\**.cpp",
+        "src\\**.h"
+    }
+
+    links {
+        "stbs",
+        "toolkit"
+    }
+
+    includedirs {
+        "%{prj.location}\\src",
+        "%{wks.location}\\modules\\toolkit\\include",
+        "%{wks.location}\\dependencies\\stbs"
+    }
+
+    defines {
+        "_CRT_SECURE_NO_WARNINGS"
+    }
+
+    filter "system:windows"
+        systemversion "latest"
+
+        defines {
+            "WINDOWS"
+        }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    -- The cooker is run on every build, so release builds keep it optimized (debug builds are left unoptimized for debugging)
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
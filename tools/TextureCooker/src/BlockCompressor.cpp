@@ -0,0 +1,255 @@
+#include "BlockCompressor.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+// Packs a color (in the 0-255 range) into RGB565
+inline uint16_t Pack565(const float color[3]) {
+	int r = (int)std::lround(std::clamp(color[0], 0.0f, 255.0f) * 31.0f / 255.0f);
+	int g = (int)std::lround(std::clamp(color[1], 0.0f, 255.0f) * 63.0f / 255.0f);
+	int b = (int)std::lround(std::clamp(color[2], 0.0f, 255.0f) * 31.0f / 255.0f);
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// Expands an RGB565 color back to the 0-255 range, the same way the hardware does
+inline void Unpack565(uint16_t packed, float result[3]) {
+	int r = (packed >> 11) & 31;
+	int g = (packed >> 5) & 63;
+	int b = packed & 31;
+	result[0] = (float)((r << 3) | (r >> 2));
+	result[1] = (float)((g << 2) | (g >> 4));
+	result[2] = (float)((b << 3) | (b >> 2));
+}
+
+/*
+ * Orders a pair of endpoints for 4 color mode, picks the best index for every pixel, and returns the total
+ * squared error of the block
+ */
+float FinishBC1(uint16_t a, uint16_t b, const float pixels[16][3], uint16_t& c0, uint16_t& c1, uint32_t& indices) {
+	// 4 color mode requires c0 > c1, if they're equal we just use the first color for everything
+	c0 = std::max(a, b);
+	c1 = std::min(a, b);
+
+	float palette[4][3];
+	Unpack565(c0, palette[0]);
+	Unpack565(c1, palette[1]);
+	for (int ix = 0; ix < 3; ix++) {
+		palette[2][ix] = (2.0f * palette[0][ix] + palette[1][ix]) / 3.0f;
+		palette[3][ix] = (palette[0][ix] + 2.0f * palette[1][ix]) / 3.0f;
+	}
+	int numColors = c0 == c1 ? 1 : 4;
+
+	indices = 0;
+	float error = 0.0f;
+	for (int pixel = 0; pixel < 16; pixel++) {
+		int best = 0;
+		float bestError = FLT_MAX;
+		for (int color = 0; color < numColors; color++) {
+			float dr = pixels[pixel][0] - palette[color][0];
+			float dg = pixels[pixel][1] - palette[color][1];
+			float db = pixels[pixel][2] - palette[color][2];
+			float distance = dr * dr + dg * dg + db * db;
+			if (distance < bestError) {
+				bestError = distance;
+				best = color;
+			}
+		}
+		indices |= (uint32_t)best << (pixel * 2);
+		error += bestError;
+	}
+	return error;
+}
+
+void BlockCompressor::EncodeBC1(const uint8_t block[64], uint8_t output[8]) {
+	float pixels[16][3];
+	float mean[3] = { 0.0f, 0.0f, 0.0f };
+	for (int pixel = 0; pixel < 16; pixel++) {
+		for (int ix = 0; ix < 3; ix++) {
+			pixels[pixel][ix] = block[pixel * 4 + ix];
+			mean[ix] += pixels[pixel][ix] / 16.0f;
+		}
+	}
+
+	// Find the axis our colors vary along the most, using a few rounds of power iteration on the covariance
+	float covariance[6] = { 0.0f }; // xx, xy, xz, yy, yz, zz
+	for (int pixel = 0; pixel < 16; pixel++) {
+		float d[3] = { pixels[pixel][0] - mean[0], pixels[pixel][1] - mean[1], pixels[pixel][2] - mean[2] };
+		covariance[0] += d[0] * d[0]; covariance[1] += d[0] * d[1]; covariance[2] += d[0] * d[2];
+		covariance[3] += d[1] * d[1]; covariance[4] += d[1] * d[2]; covariance[5] += d[2] * d[2];
+	}
+	float axis[3] = { 1.0f, 1.0f, 1.0f };
+	for (int iteration = 0; iteration < 8; iteration++) {
+		float next[3] = {
+			covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+			covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+			covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]
+		};
+		float length = std::max({ std::abs(next[0]), std::abs(next[1]), std::abs(next[2]) });
+		// A flat block has no covariance, any axis will do
+		if (length < 1e-6f)
+			break;
+		for (int ix = 0; ix < 3; ix++)
+			axis[ix] = next[ix] / length;
+	}
+	float axisLengthSq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+	// Our initial endpoints are the extents of the block along that axis
+	float minT = FLT_MAX, maxT = -FLT_MAX;
+	for (int pixel = 0; pixel < 16; pixel++) {
+		float t = ((pixels[pixel][0] - mean[0]) * axis[0] + (pixels[pixel][1] - mean[1]) * axis[1] + (pixels[pixel][2] - mean[2]) * axis[2]) / axisLengthSq;
+		minT = std::min(minT, t);
+		maxT = std::max(maxT, t);
+	}
+	float start[3], end[3];
+	for (int ix = 0; ix < 3; ix++) {
+		start[ix] = mean[ix] + axis[ix] * maxT;
+		end[ix]   = mean[ix] + axis[ix] * minT;
+	}
+
+	uint16_t c0, c1;
+	uint32_t indices;
+	float error = FinishBC1(Pack565(start), Pack565(end), pixels, c0, c1, indices);
+
+	// Refine the endpoints with least squares, given the indices that we picked last time
+	static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	for (int iteration = 0; iteration < 2 && error > 0.0f && c0 != c1; iteration++) {
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[3] = { 0.0f, 0.0f, 0.0f }, bx[3] = { 0.0f, 0.0f, 0.0f };
+		for (int pixel = 0; pixel < 16; pixel++) {
+			float a = weights[(indices >> (pixel * 2)) & 3];
+			float b = 1.0f - a;
+			aa += a * a; ab += a * b; bb += b * b;
+			for (int ix = 0; ix < 3; ix++) {
+				ax[ix] += a * pixels[pixel][ix];
+				bx[ix] += b * pixels[pixel][ix];
+			}
+		}
+		float determinant = aa * bb - ab * ab;
+		if (std::abs(determinant) < 1e-6f)
+			break;
+		for (int ix = 0; ix < 3; ix++) {
+			start[ix] = (ax[ix] * bb - bx[ix] * ab) / determinant;
+			end[ix]   = (bx[ix] * aa - ax[ix] * ab) / determinant;
+		}
+
+		uint16_t n0, n1;
+		uint32_t newIndices;
+		float newError = FinishBC1(Pack565(start), Pack565(end), pixels, n0, n1, newIndices);
+		if (newError >= error)
+			break;
+		c0 = n0; c1 = n1; indices = newIndices; error = newError;
+	}
+
+	output[0] = (uint8_t)(c0 & 0xFF);
+	output[1] = (uint8_t)(c0 >> 8);
+	output[2] = (uint8_t)(c1 & 0xFF);
+	output[3] = (uint8_t)(c1 >> 8);
+	for (int ix = 0; ix < 4; ix++)
+		output[4 + ix] = (uint8_t)(indices >> (ix * 8));
+}
+
+void BlockCompressor::EncodeBC4(const uint8_t block[64], int channel, uint8_t output[8]) {
+	uint8_t minValue = 255, maxValue = 0;
+	for (int pixel = 0; pixel < 16; pixel++) {
+		minValue = std::min(minValue, block[pixel * 4 + channel]);
+		maxValue = std::max(maxValue, block[pixel * 4 + channel]);
+	}
+
+	// We always use the 8 value mode (a0 > a1), which has the most precision between the endpoints
+	output[0] = maxValue;
+	output[1] = minValue;
+	float palette[8];
+	palette[0] = maxValue;
+	palette[1] = minValue;
+	for (int ix = 2; ix < 8; ix++)
+		palette[ix] = ((8 - ix) * maxValue + (ix - 1) * minValue) / 7.0f;
+	int numValues = maxValue == minValue ? 1 : 8;
+
+	uint64_t indices = 0;
+	for (int pixel = 0; pixel < 16; pixel++) {
+		float value = block[pixel * 4 + channel];
+		int best = 0;
+		float bestError = FLT_MAX;
+		for (int ix = 0; ix < numValues; ix++) {
+			float distance = std::abs(value - palette[ix]);
+			if (distance < bestError) {
+				bestError = distance;
+				best = ix;
+			}
+		}
+		indices |= (uint64_t)best << (pixel * 3);
+	}
+	for (int ix = 0; ix < 6; ix++)
+		output[2 + ix] = (uint8_t)(indices >> (ix * 8));
+}
+
+void BlockCompressor::EncodeBC3(const uint8_t block[64], uint8_t output[16]) {
+	// BC3 is a BC4 block for alpha, followed by a BC1 block for color
+	EncodeBC4(block, 3, output);
+	EncodeBC1(block, output + 8);
+}
+
+void BlockCompressor::EncodeBC5(const uint8_t block[64], uint8_t output[16]) {
+	EncodeBC4(block, 0, output);
+	EncodeBC4(block, 1, output + 8);
+}
+
+size_t BlockCompressor::GetBlockSize(BlockFormat format) {
+	return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+}
+
+uint32_t BlockCompressor::GetDxgiFormat(BlockFormat format) {
+	// https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format
+	switch (format) {
+		case BlockFormat::BC1: return 71;
+		case BlockFormat::BC3: return 77;
+		case BlockFormat::BC4: return 80;
+		case BlockFormat::BC5: return 83;
+		default: return 0;
+	}
+}
+
+const char* BlockCompressor::GetName(BlockFormat format) {
+	switch (format) {
+		case BlockFormat::BC1: return "BC1";
+		case BlockFormat::BC3: return "BC3";
+		case BlockFormat::BC4: return "BC4";
+		case BlockFormat::BC5: return "BC5";
+		default: return "?";
+	}
+}
+
+size_t BlockCompressor::GetCompressedSize(BlockFormat format, uint32_t width, uint32_t height) {
+	return ((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(format);
+}
+
+void BlockCompressor::CompressImage(BlockFormat format, const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* output) {
+	uint32_t blocksX = (width + 3) / 4;
+	uint32_t blocksY = (height + 3) / 4;
+	size_t blockSize = GetBlockSize(format);
+
+	ThreadPool::Global().ParallelFor(blocksY, [&](size_t blockY) {
+		uint8_t block[64];
+		for (uint32_t blockX = 0; blockX < blocksX; blockX++) {
+			// Gather the block, repeating the edge pixels for images that aren't a multiple of 4
+			for (uint32_t y = 0; y < 4; y++) {
+				uint32_t sourceY = std::min((uint32_t)blockY * 4 + y, height - 1);
+				for (uint32_t x = 0; x < 4; x++) {
+					uint32_t sourceX = std::min(blockX * 4 + x, width - 1);
+					memcpy(block + (y * 4 + x) * 4, pixels + ((size_t)sourceY * width + sourceX) * 4, 4);
+				}
+			}
+
+			uint8_t* target = output + (blockY * blocksX + blockX) * blockSize;
+			switch (format) {
+				case BlockFormat::BC1: EncodeBC1(block, target);    break;
+				case BlockFormat::BC3: EncodeBC3(block, target);    break;
+				case BlockFormat::BC4: EncodeBC4(block, 0, target); break;
+				case BlockFormat::BC5: EncodeBC5(block, target);    break;
+			}
+		}
+	});
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// The block compressed formats that the cooker can produce
+enum class BlockFormat {
+	BC1, // RGB, 4 bits per pixel
+	BC3, // RGBA, 8 bits per pixel
+	BC4, // R, 4 bits per pixel
+	BC5  // RG, 8 bits per pixel
+};
+
+/*
+ * CPU encoders for the BCn formats. Colors are fit along their principal axis and then refined with a least
+ * squares pass, which gets most of the way to what the big offline compressors do for a fraction of the cost
+ * (we don't do BC7, it's mode search is a project of it's own)
+ */
+class BlockCompressor {
+public:
+	// Gets the number of bytes in a single 4x4 block of the given format
+	static size_t GetBlockSize(BlockFormat format);
+	// Gets the DXGI format that DDS files use for the given format
+	static uint32_t GetDxgiFormat(BlockFormat format);
+	// Gets a human readable name for the format
+	static const char* GetName(BlockFormat format);
+
+	/*
+	 * Compresses an RGBA8 image, each row of blocks is encoded on it's own thread
+	 * @param format The format to compress to
+	 * @param pixels The RGBA8 pixels of the image, tightly packed
+	 * @param width  The width of the image, in pixels
+	 * @param height The height of the image, in pixels
+	 * @param output Where to write the blocks, must be at least GetCompressedSize bytes
+	 */
+	static void CompressImage(BlockFormat format, const uint8_t* pixels, uint32_t width, uint32_t height, uint8_t* output);
+	// Gets the number of bytes an image will take up once compressed
+	static size_t GetCompressedSize(BlockFormat format, uint32_t width, uint32_t height);
+
+	/*
+	 * Encodes a single block, block is the 16 RGBA8 pixels of the block in row order
+	 */
+	static void EncodeBC1(const uint8_t block[64], uint8_t output[8]);
+	static void EncodeBC3(const uint8_t block[64], uint8_t output[16]);
+	static void EncodeBC4(const uint8_t block[64], int channel, uint8_t output[8]);
+	static void EncodeBC5(const uint8_t block[64], uint8_t output[16]);
+};
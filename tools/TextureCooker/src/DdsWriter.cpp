@@ -0,0 +1,96 @@
+#include "DdsWriter.h"
+
+#include <cstring>
+#include <fstream>
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3ddds/dds-header
+struct DdsHeader {
+	uint32_t Size;
+	uint32_t Flags;
+	uint32_t Height;
+	uint32_t Width;
+	uint32_t PitchOrLinearSize;
+	uint32_t Depth;
+	uint32_t MipMapCount;
+	uint32_t Reserved1[11];
+	// DDS_PIXELFORMAT
+	uint32_t PfSize;
+	uint32_t PfFlags;
+	uint32_t PfFourCC;
+	uint32_t PfRGBBitCount;
+	uint32_t PfBitMasks[4];
+	uint32_t Caps;
+	uint32_t Caps2;
+	uint32_t Caps3;
+	uint32_t Caps4;
+	uint32_t Reserved2;
+};
+
+// https://docs.microsoft.com/en-us/windows/win32/direct3ddds/dds-header-dxt10
+struct DdsHeaderDX10 {
+	uint32_t DxgiFormat;
+	uint32_t ResourceDimension;
+	uint32_t MiscFlag;
+	uint32_t ArraySize;
+	uint32_t MiscFlags2;
+};
+
+static_assert(sizeof(DdsHeader) == 124, "DDS header must be 124 bytes");
+
+const uint32_t DDSD_CAPS        = 0x1;
+const uint32_t DDSD_HEIGHT      = 0x2;
+const uint32_t DDSD_WIDTH       = 0x4;
+const uint32_t DDSD_PIXELFORMAT = 0x1000;
+const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+const uint32_t DDSD_LINEARSIZE  = 0x80000;
+const uint32_t DDPF_FOURCC      = 0x4;
+const uint32_t DDSCAPS_COMPLEX  = 0x8;
+const uint32_t DDSCAPS_TEXTURE  = 0x1000;
+const uint32_t DDSCAPS_MIPMAP   = 0x400000;
+// The cubemap flag, plus all 6 of the face flags
+const uint32_t DDSCAPS2_CUBEMAP_ALLFACES = 0x200 | 0xFC00;
+
+const uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+const uint32_t D3D10_RESOURCE_MISC_TEXTURECUBE    = 0x4;
+
+bool DdsWriter::Write(const std::string& fileName, const CookedImage& image) {
+	std::ofstream file(fileName, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	DdsHeader header;
+	memset(&header, 0, sizeof(DdsHeader));
+	header.Size              = sizeof(DdsHeader);
+	header.Flags             = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+	header.Height            = image.Height;
+	header.Width             = image.Width;
+	header.PitchOrLinearSize = (uint32_t)image.Levels[0].size();
+	header.MipMapCount       = image.MipLevels;
+	header.PfSize            = 32;
+	header.PfFlags           = DDPF_FOURCC;
+	header.PfFourCC          = '0' << 24 | '1' << 16 | 'X' << 8 | 'D'; // "DX10"
+	header.Caps              = DDSCAPS_TEXTURE;
+	if (image.MipLevels > 1)
+		header.Caps |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+	if (image.Faces == 6) {
+		header.Caps |= DDSCAPS_COMPLEX;
+		header.Caps2 = DDSCAPS2_CUBEMAP_ALLFACES;
+	}
+
+	DdsHeaderDX10 dx10;
+	dx10.DxgiFormat        = BlockCompressor::GetDxgiFormat(image.Format);
+	dx10.ResourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+	dx10.MiscFlag          = image.Faces == 6 ? D3D10_RESOURCE_MISC_TEXTURECUBE : 0;
+	// For cubemaps, this is the number of cubes rather than the number of faces
+	dx10.ArraySize         = 1;
+	dx10.MiscFlags2        = 0;
+
+	file.write("DDS ", 4);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(DdsHeader));
+	file.write(reinterpret_cast<const char*>(&dx10), sizeof(DdsHeaderDX10));
+	// DDS stores each face with all of it's mips, which is the same order we keep them in
+	for (const std::vector<uint8_t>& level : image.Levels)
+		file.write(reinterpret_cast<const char*>(level.data()), level.size());
+
+	return file.good();
+}
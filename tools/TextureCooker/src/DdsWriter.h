@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "BlockCompressor.h"
+
+// A compressed image, ready to be written to a container
+struct CookedImage {
+	BlockFormat                       Format;
+	uint32_t                          Width;
+	uint32_t                          Height;
+	uint32_t                          MipLevels;
+	// 1 for a 2D texture, or 6 for a cubemap
+	uint32_t                          Faces;
+	// The compressed blocks for each level, stored as [face * MipLevels + level]
+	std::vector<std::vector<uint8_t>> Levels;
+};
+
+/*
+ * Writes DDS files, always using the DX10 extended header so that there's no ambiguity about the format
+ * (these are read back in by TextureContainer in the samples)
+ */
+class DdsWriter {
+public:
+	/*
+	 * Writes a cooked image to a DDS file
+	 * @param fileName The path to the file to write
+	 * @param image    The image to write
+	 * @returns True if the file was written, false if otherwise
+	 */
+	static bool Write(const std::string& fileName, const CookedImage& image);
+};
@@ -0,0 +1,161 @@
+#include "MipGenerator.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+
+const float Pi = 3.14159265358979f;
+
+// The Lanczos kernel with a radius of 3
+inline float Lanczos3(float x) {
+	x = std::abs(x);
+	if (x < 1e-5f)
+		return 1.0f;
+	if (x >= 3.0f)
+		return 0.0f;
+	float px = Pi * x;
+	return 3.0f * std::sin(px) * std::sin(px / 3.0f) / (px * px);
+}
+
+// https://en.wikipedia.org/wiki/SRGB#Specification_of_the_transformation
+inline float SrgbToLinear(float value) {
+	return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+inline float LinearToSrgb(float value) {
+	return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+// The weights for every source texel that contributes to a single destination texel
+struct FilterTaps {
+	int                First;
+	std::vector<float> Weights;
+};
+
+/*
+ * Works out the filter taps for resampling a row or column of source texels to a smaller size. Our kernel is
+ * stretched by the scale factor, so that it acts as a low pass filter for the smaller image
+ */
+std::vector<FilterTaps> BuildTaps(uint32_t sourceSize, uint32_t destSize) {
+	std::vector<FilterTaps> result(destSize);
+	float scale  = (float)sourceSize / (float)destSize;
+	float radius = 3.0f * std::max(scale, 1.0f);
+	for (uint32_t ix = 0; ix < destSize; ix++) {
+		float center = (ix + 0.5f) * scale;
+		int first = (int)std::floor(center - radius);
+		int last  = (int)std::ceil(center + radius);
+		FilterTaps& taps = result[ix];
+		taps.First = first;
+		float total = 0.0f;
+		for (int source = first; source <= last; source++) {
+			float weight = Lanczos3((source + 0.5f - center) / std::max(scale, 1.0f));
+			taps.Weights.push_back(weight);
+			total += weight;
+		}
+		for (float& weight : taps.Weights)
+			weight /= total;
+	}
+	return result;
+}
+
+// Resamples a float RGBA image down to the given size, first along X and then along Y
+std::vector<float> Resample(const std::vector<float>& source, uint32_t width, uint32_t height, uint32_t newWidth, uint32_t newHeight) {
+	std::vector<FilterTaps> tapsX = BuildTaps(width, newWidth);
+	std::vector<FilterTaps> tapsY = BuildTaps(height, newHeight);
+
+	std::vector<float> horizontal((size_t)newWidth * height * 4);
+	ThreadPool::Global().ParallelFor(height, [&](size_t y) {
+		const float* row = source.data() + y * width * 4;
+		float* out = horizontal.data() + y * newWidth * 4;
+		for (uint32_t x = 0; x < newWidth; x++) {
+			float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			const FilterTaps& taps = tapsX[x];
+			for (size_t tap = 0; tap < taps.Weights.size(); tap++) {
+				// Clamp to the edge of the image
+				int sourceX = std::clamp(taps.First + (int)tap, 0, (int)width - 1);
+				for (int c = 0; c < 4; c++)
+					sum[c] += row[sourceX * 4 + c] * taps.Weights[tap];
+			}
+			for (int c = 0; c < 4; c++)
+				out[x * 4 + c] = sum[c];
+		}
+	}, 16);
+
+	std::vector<float> result((size_t)newWidth * newHeight * 4);
+	ThreadPool::Global().ParallelFor(newHeight, [&](size_t y) {
+		const FilterTaps& taps = tapsY[y];
+		float* out = result.data() + y * newWidth * 4;
+		for (size_t tap = 0; tap < taps.Weights.size(); tap++) {
+			int sourceY = std::clamp(taps.First + (int)tap, 0, (int)height - 1);
+			const float* row = horizontal.data() + (size_t)sourceY * newWidth * 4;
+			for (uint32_t ix = 0; ix < newWidth * 4; ix++)
+				out[ix] += row[ix] * taps.Weights[tap];
+		}
+	}, 16);
+	return result;
+}
+
+uint32_t MipGenerator::GetLevelCount(uint32_t width, uint32_t height) {
+	uint32_t levels = 1;
+	while (width > 1 || height > 1) {
+		width  = std::max(width / 2, 1u);
+		height = std::max(height / 2, 1u);
+		levels++;
+	}
+	return levels;
+}
+
+std::vector<MipLevel> MipGenerator::Generate(const uint8_t* pixels, uint32_t width, uint32_t height, ImageKind kind) {
+	std::vector<MipLevel> result;
+	result.reserve(GetLevelCount(width, height));
+
+	// The base level is just a copy of our input
+	MipLevel base;
+	base.Width  = width;
+	base.Height = height;
+	base.Pixels.assign(pixels, pixels + (size_t)width * height * 4);
+	result.push_back(std::move(base));
+
+	// Convert the image into linear floats, we filter every level from the one above it without going back to 8 bits
+	float toLinear[256];
+	for (int ix = 0; ix < 256; ix++)
+		toLinear[ix] = kind == ImageKind::Color ? SrgbToLinear(ix / 255.0f) : ix / 255.0f;
+	std::vector<float> current((size_t)width * height * 4);
+	for (size_t ix = 0; ix < current.size(); ix++) {
+		// Alpha is always linear
+		current[ix] = (ix % 4) == 3 ? pixels[ix] / 255.0f : toLinear[pixels[ix]];
+	}
+
+	while (width > 1 || height > 1) {
+		uint32_t newWidth  = std::max(width / 2, 1u);
+		uint32_t newHeight = std::max(height / 2, 1u);
+		current = Resample(current, width, height, newWidth, newHeight);
+		width  = newWidth;
+		height = newHeight;
+
+		MipLevel level;
+		level.Width  = width;
+		level.Height = height;
+		level.Pixels.resize((size_t)width * height * 4);
+		for (size_t texel = 0; texel < (size_t)width * height; texel++) {
+			float* value = current.data() + texel * 4;
+			float rgb[3] = { value[0], value[1], value[2] };
+			if (kind == ImageKind::NormalMap) {
+				// Averaging unit vectors makes them shorter, so push them back out to unit length
+				float n[3] = { rgb[0] * 2.0f - 1.0f, rgb[1] * 2.0f - 1.0f, rgb[2] * 2.0f - 1.0f };
+				float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+				if (length > 1e-5f) {
+					for (int c = 0; c < 3; c++)
+						rgb[c] = (n[c] / length) * 0.5f + 0.5f;
+				}
+			} else if (kind == ImageKind::Color) {
+				for (int c = 0; c < 3; c++)
+					rgb[c] = LinearToSrgb(std::clamp(rgb[c], 0.0f, 1.0f));
+			}
+			for (int c = 0; c < 3; c++)
+				level.Pixels[texel * 4 + c] = (uint8_t)std::lround(std::clamp(rgb[c], 0.0f, 1.0f) * 255.0f);
+			level.Pixels[texel * 4 + 3] = (uint8_t)std::lround(std::clamp(value[3], 0.0f, 1.0f) * 255.0f);
+		}
+		result.push_back(std::move(level));
+	}
+	return result;
+}
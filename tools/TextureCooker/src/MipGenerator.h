@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// A single level of a mip chain, stored as tightly packed RGBA8
+struct MipLevel {
+	uint32_t             Width;
+	uint32_t             Height;
+	std::vector<uint8_t> Pixels;
+};
+
+// How the color channels of an image should be treated while filtering
+enum class ImageKind {
+	Color,     // sRGB encoded color, filtered in linear space
+	Linear,    // Data that is already linear (masks, roughness, etc...)
+	NormalMap  // Tangent space normals, which are re-normalized after filtering
+};
+
+/*
+ * Builds full mip chains on the CPU. Each level is resampled from the one above it with a separable
+ * Lanczos-3 filter, which keeps a lot more detail than the box filter most drivers use. Color images are
+ * converted to linear space before filtering so that the mips don't get darker as they get smaller
+ */
+class MipGenerator {
+public:
+	/*
+	 * Generates every mip level for an image, down to 1x1
+	 * @param pixels The RGBA8 pixels of the base level
+	 * @param width  The width of the base level, in pixels
+	 * @param height The height of the base level, in pixels
+	 * @param kind   How the image's color channels should be filtered
+	 * @returns All of the levels, with the base level first
+	 */
+	static std::vector<MipLevel> Generate(const uint8_t* pixels, uint32_t width, uint32_t height, ImageKind kind);
+
+	// Gets the number of levels in a full mip chain for an image of the given size
+	static uint32_t GetLevelCount(uint32_t width, uint32_t height);
+};
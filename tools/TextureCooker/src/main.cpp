@@ -0,0 +1,379 @@
+/*
+ * Texture Cooker
+ *
+ * Converts every image in a folder into a block compressed DDS file, with a full mip chain. Cubemaps made
+ * up of 6 images named <name>_rt, _lf, _up, _dn, _ft and _bk are cooked into a single cubemap DDS
+ *
+ * Usage: TextureCooker <input folder> <output folder> [--force] [--format auto|bc1|bc3|bc4|bc5] [--atlas <name> [--page-size <size>]]
+ *
+ * With --atlas, every image in the folder is instead packed into <name>_<page>.png pages and a <name>.atlas
+ * layout file, which can be loaded with TTK::TextureAtlas::LoadFromFile. Sprites that share a page can be
+ * drawn without switching textures. Pages are kept as PNGs, since sprites are usually too small to compress
+ *
+ * Files are only re-cooked if their source is newer than the cooked file (or --force is given), so this is
+ * cheap enough to run before every build. By default the format is picked from the image:
+ *   *_normal, *_nrm                     -> BC5 (normal map)
+ *   *_mask, *_rough, *_metal, *_ao      -> BC4 (linear, red channel only)
+ *   anything with transparent pixels    -> BC3
+ *   everything else                     -> BC1
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <stb_image.h>
+#include <stb_image_write.h>
+
+#include "AtlasPacker.h"
+
+#include "BlockCompressor.h"
+#include "MipGenerator.h"
+#include "DdsWriter.h"
+
+namespace fs = std::filesystem;
+
+// A single file that we want to produce
+struct CookJob {
+	fs::path              Output;
+	// Either a single image, or the 6 faces of a cubemap in +X, -X, +Y, -Y, +Z, -Z order
+	std::vector<fs::path> Inputs;
+};
+
+// The suffixes for cubemap faces, in the order that GL expects them
+const char* CubeFaceSuffixes[6] = { "_rt", "_lf", "_up", "_dn", "_ft", "_bk" };
+
+bool IsImageFile(const fs::path& path) {
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+	return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+}
+
+bool EndsWith(const std::string& value, const std::string& suffix) {
+	return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Picks how to filter and compress an image, based on it's name and contents
+void ChooseFormat(const std::string& stem, const std::vector<uint8_t*>& faces, size_t numPixels, BlockFormat& format, ImageKind& kind) {
+	std::string name = stem;
+	std::transform(name.begin(), name.end(), name.begin(), [](char c) { return (char)std::tolower(c); });
+
+	if (EndsWith(name, "_normal") || EndsWith(name, "_nrm")) {
+		format = BlockFormat::BC5;
+		kind   = ImageKind::NormalMap;
+		return;
+	}
+	if (EndsWith(name, "_mask") || EndsWith(name, "_rough") || EndsWith(name, "_roughness") || EndsWith(name, "_metal") || EndsWith(name, "_ao")) {
+		format = BlockFormat::BC4;
+		kind   = ImageKind::Linear;
+		return;
+	}
+
+	kind   = ImageKind::Color;
+	format = BlockFormat::BC1;
+	for (uint8_t* face : faces) {
+		for (size_t ix = 0; ix < numPixels; ix++) {
+			if (face[ix * 4 + 3] != 255) {
+				format = BlockFormat::BC3;
+				return;
+			}
+		}
+	}
+}
+
+// Finds all of the images in a folder, and works out what we need to cook
+std::vector<CookJob> FindJobs(const fs::path& inputDir, const fs::path& outputDir) {
+	std::vector<fs::path> images;
+	for (const fs::directory_entry& entry : fs::recursive_directory_iterator(inputDir)) {
+		if (entry.is_regular_file() && IsImageFile(entry.path()))
+			images.push_back(entry.path());
+	}
+	std::sort(images.begin(), images.end());
+
+	// Group up any cubemap faces, keyed by the path without the face suffix
+	std::map<fs::path, std::vector<fs::path>> cubeFaces;
+	for (const fs::path& image : images) {
+		std::string stem = image.stem().string();
+		for (int face = 0; face < 6; face++) {
+			if (EndsWith(stem, CubeFaceSuffixes[face])) {
+				fs::path key = image.parent_path() / stem.substr(0, stem.size() - 3);
+				std::vector<fs::path>& faces = cubeFaces[key];
+				faces.resize(6);
+				faces[face] = image;
+			}
+		}
+	}
+
+	std::vector<CookJob> result;
+	std::vector<fs::path> usedByCubes;
+	for (auto& kvp : cubeFaces) {
+		bool complete = std::all_of(kvp.second.begin(), kvp.second.end(), [](const fs::path& face) { return !face.empty(); });
+		if (!complete)
+			continue;
+		CookJob job;
+		job.Output = outputDir / fs::relative(kvp.first, inputDir);
+		job.Output += ".dds";
+		job.Inputs = kvp.second;
+		usedByCubes.insert(usedByCubes.end(), kvp.second.begin(), kvp.second.end());
+		result.push_back(job);
+	}
+
+	for (const fs::path& image : images) {
+		if (std::find(usedByCubes.begin(), usedByCubes.end(), image) != usedByCubes.end())
+			continue;
+		CookJob job;
+		job.Output = outputDir / fs::relative(image, inputDir);
+		job.Output.replace_extension(".dds");
+		job.Inputs.push_back(image);
+		result.push_back(job);
+	}
+	return result;
+}
+
+// Checks whether the cooked file is newer than all of it's inputs
+bool IsUpToDate(const CookJob& job) {
+	std::error_code error;
+	if (!fs::exists(job.Output, error))
+		return false;
+	fs::file_time_type cookedTime = fs::last_write_time(job.Output, error);
+	for (const fs::path& input : job.Inputs) {
+		if (fs::last_write_time(input, error) > cookedTime)
+			return false;
+	}
+	return true;
+}
+
+bool Cook(const CookJob& job, const char* forcedFormat) {
+	// Load all of our faces up front, since we need to know about all of them to pick a format
+	std::vector<uint8_t*> faces;
+	int width = 0, height = 0;
+	bool success = true;
+	for (const fs::path& input : job.Inputs) {
+		int faceWidth, faceHeight, numChannels;
+		uint8_t* data = stbi_load(input.string().c_str(), &faceWidth, &faceHeight, &numChannels, 4);
+		if (data == nullptr) {
+			printf("  ERROR: Failed to load %s (%s)\n", input.string().c_str(), stbi_failure_reason());
+			success = false;
+			break;
+		}
+		faces.push_back(data);
+		if (faces.size() > 1 && (faceWidth != width || faceHeight != height)) {
+			printf("  ERROR: Cubemap faces must all be the same size (%s)\n", input.string().c_str());
+			success = false;
+			break;
+		}
+		width  = faceWidth;
+		height = faceHeight;
+	}
+	if (success && faces.size() == 6 && width != height) {
+		printf("  ERROR: Cubemap faces must be square (%s)\n", job.Output.string().c_str());
+		success = false;
+	}
+
+	if (success) {
+		BlockFormat format;
+		ImageKind kind;
+		ChooseFormat(job.Output.stem().string(), faces, (size_t)width * height, format, kind);
+		if (forcedFormat != nullptr) {
+			if      (strcmp(forcedFormat, "bc1") == 0) format = BlockFormat::BC1;
+			else if (strcmp(forcedFormat, "bc3") == 0) format = BlockFormat::BC3;
+			else if (strcmp(forcedFormat, "bc4") == 0) format = BlockFormat::BC4;
+			else if (strcmp(forcedFormat, "bc5") == 0) format = BlockFormat::BC5;
+		}
+
+		CookedImage image;
+		image.Format    = format;
+		image.Width     = width;
+		image.Height    = height;
+		image.MipLevels = MipGenerator::GetLevelCount(width, height);
+		image.Faces     = (uint32_t)faces.size();
+		for (uint8_t* face : faces) {
+			std::vector<MipLevel> mips = MipGenerator::Generate(face, width, height, kind);
+			for (const MipLevel& mip : mips) {
+				std::vector<uint8_t> blocks(BlockCompressor::GetCompressedSize(format, mip.Width, mip.Height));
+				BlockCompressor::CompressImage(format, mip.Pixels.data(), mip.Width, mip.Height, blocks.data());
+				image.Levels.push_back(std::move(blocks));
+			}
+		}
+
+		std::error_code error;
+		fs::create_directories(job.Output.parent_path(), error);
+		success = DdsWriter::Write(job.Output.string(), image);
+		if (success)
+			printf("  %s (%s, %dx%d, %u mips%s)\n", job.Output.string().c_str(), BlockCompressor::GetName(format), width, height, image.MipLevels, image.Faces == 6 ? ", cubemap" : "");
+		else
+			printf("  ERROR: Failed to write %s\n", job.Output.string().c_str());
+	}
+
+	for (uint8_t* face : faces)
+		stbi_image_free(face);
+	return success;
+}
+
+// Checks whether a file is one of the pages that CookAtlas writes (<name>_<page>.png in the output folder)
+bool IsAtlasPage(const fs::path& path, const fs::path& outputFolder, const std::string& name) {
+	std::error_code error;
+	if (fs::weakly_canonical(path.parent_path(), error) != outputFolder || path.extension() != ".png")
+		return false;
+	std::string stem = path.stem().string();
+	std::string prefix = name + "_";
+	if (stem.size() <= prefix.size() || stem.compare(0, prefix.size(), prefix) != 0)
+		return false;
+	return std::all_of(stem.begin() + prefix.size(), stem.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+// Packs every image in a folder into a single atlas, returns 0 if it was up to date, 1 if it was cooked, or -1 if it failed
+int CookAtlas(const fs::path& inputDir, const fs::path& outputDir, const std::string& name, int pageSize, bool force) {
+	// The output folder may be inside of the input folder, in which case we have to make sure that we don't pack
+	// our own pages (or anything else that was copied to the output) back into the atlas
+	std::error_code error;
+	fs::path outputFolder = fs::weakly_canonical(outputDir, error);
+	fs::path inputFolder  = fs::weakly_canonical(inputDir, error);
+	std::vector<fs::path> images;
+	for (auto it = fs::recursive_directory_iterator(inputDir); it != fs::recursive_directory_iterator(); ++it) {
+		const fs::directory_entry& entry = *it;
+		if (entry.is_directory()) {
+			if (outputFolder != inputFolder && fs::weakly_canonical(entry.path(), error) == outputFolder)
+				it.disable_recursion_pending();
+			continue;
+		}
+		if (entry.is_regular_file() && IsImageFile(entry.path()) && !IsAtlasPage(entry.path(), outputFolder, name))
+			images.push_back(entry.path());
+	}
+	std::sort(images.begin(), images.end());
+
+	CookJob job;
+	job.Output = outputDir / (name + ".atlas");
+	job.Inputs = images;
+	if (!force && IsUpToDate(job))
+		return 0;
+
+	AtlasPacker packer(pageSize);
+	std::vector<std::string> names;
+	for (const fs::path& image : images) {
+		int width, height, numChannels;
+		uint8_t* data = stbi_load(image.string().c_str(), &width, &height, &numChannels, 4);
+		if (data == nullptr) {
+			printf("  ERROR: Failed to load %s (%s)\n", image.string().c_str(), stbi_failure_reason());
+			return -1;
+		}
+		int index = packer.Add(data, width, height);
+		stbi_image_free(data);
+		if (index == -1) {
+			printf("  ERROR: %s is empty\n", image.string().c_str());
+			return -1;
+		}
+		// Regions are named the same way on every platform, so the game can look them up by path
+		names.push_back(fs::relative(image, inputDir).generic_string());
+	}
+	if (packer.Pack() > 0) {
+		for (size_t ix = 0; ix < names.size(); ix++) {
+			if (packer.GetPlacements()[ix].Page == -1)
+				printf("  ERROR: %s does not fit in a %dx%d atlas page\n", names[ix].c_str(), pageSize, pageSize);
+		}
+		return -1;
+	}
+
+	fs::create_directories(outputDir, error);
+	FILE* layout = fopen(job.Output.string().c_str(), "w");
+	if (layout == nullptr) {
+		printf("  ERROR: Failed to write %s\n", job.Output.string().c_str());
+		return -1;
+	}
+	fprintf(layout, "# Texture atlas cooked from %s, see TTK::TextureAtlas::LoadFromFile\n", inputDir.generic_string().c_str());
+	fprintf(layout, "# page <width> <height> <file>\n# region <page> <x> <y> <width> <height> <name>\n");
+	bool success = true;
+	for (int page = 0; page < packer.GetPageCount(); page++) {
+		std::string pageFile = name + "_" + std::to_string(page) + ".png";
+		std::string pagePath = (outputDir / pageFile).string();
+		if (!stbi_write_png(pagePath.c_str(), pageSize, pageSize, 4, packer.GetPagePixels(page).data(), pageSize * 4)) {
+			printf("  ERROR: Failed to write %s\n", pagePath.c_str());
+			success = false;
+		}
+		fprintf(layout, "page %d %d %s\n", pageSize, pageSize, pageFile.c_str());
+	}
+	for (size_t ix = 0; ix < names.size(); ix++) {
+		const AtlasPacker::Placement& placement = packer.GetPlacements()[ix];
+		fprintf(layout, "region %d %d %d %d %d %s\n", placement.Page, placement.X, placement.Y, placement.Width, placement.Height, names[ix].c_str());
+	}
+	fclose(layout);
+
+	// Don't leave a layout behind that looks up to date if any of it's pages are missing
+	if (!success) {
+		fs::remove(job.Output, error);
+		return -1;
+	}
+	printf("  %s (%d images, %d pages of %dx%d)\n", job.Output.string().c_str(), (int)names.size(), packer.GetPageCount(), pageSize, pageSize);
+	return 1;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		printf("Usage: TextureCooker <input folder> <output folder> [--force] [--format auto|bc1|bc3|bc4|bc5] [--atlas <name> [--page-size <size>]]\n");
+		return 1;
+	}
+
+	fs::path inputDir  = argv[1];
+	fs::path outputDir = argv[2];
+	bool force = false;
+	const char* forcedFormat = nullptr;
+	const char* atlasName = nullptr;
+	int pageSize = 2048;
+	for (int ix = 3; ix < argc; ix++) {
+		if (strcmp(argv[ix], "--force") == 0)
+			force = true;
+		else if (strcmp(argv[ix], "--format") == 0 && ix + 1 < argc) {
+			forcedFormat = argv[++ix];
+			if (strcmp(forcedFormat, "auto") == 0)
+				forcedFormat = nullptr;
+		}
+		else if (strcmp(argv[ix], "--atlas") == 0 && ix + 1 < argc)
+			atlasName = argv[++ix];
+		else if (strcmp(argv[ix], "--page-size") == 0 && ix + 1 < argc)
+			pageSize = atoi(argv[++ix]);
+		else {
+			printf("Unknown argument: %s\n", argv[ix]);
+			return 1;
+		}
+	}
+
+	if (!fs::is_directory(inputDir)) {
+		printf("Input folder %s does not exist, nothing to cook\n", inputDir.string().c_str());
+		return 0;
+	}
+
+	if (atlasName != nullptr) {
+		if (pageSize <= 0) {
+			printf("Atlas page size must be positive\n");
+			return 1;
+		}
+		auto start = std::chrono::high_resolution_clock::now();
+		int result = CookAtlas(inputDir, outputDir, atlasName, pageSize, force);
+		auto end = std::chrono::high_resolution_clock::now();
+		printf("Texture cooker: atlas %s %s (%.2fs)\n", atlasName, result > 0 ? "cooked" : result == 0 ? "up to date" : "failed",
+			std::chrono::duration<double>(end - start).count());
+		return result < 0 ? 1 : 0;
+	}
+
+	auto start = std::chrono::high_resolution_clock::now();
+	std::vector<CookJob> jobs = FindJobs(inputDir, outputDir);
+	int numCooked = 0, numFailed = 0;
+	for (const CookJob& job : jobs) {
+		if (!force && IsUpToDate(job))
+			continue;
+		if (Cook(job, forcedFormat))
+			numCooked++;
+		else
+			numFailed++;
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+
+	printf("Texture cooker: %d cooked, %d up to date, %d failed (%.2fs)\n", numCooked, (int)jobs.size() - numCooked - numFailed, numFailed,
+		std::chrono::duration<double>(end - start).count());
+	return numFailed > 0 ? 1 : 0;
+}